@@ -0,0 +1,114 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "BenchUtil.h"
+#include "fb-cpp/Batch.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+static constexpr unsigned MESSAGE_COUNT = 1000u;
+
+FBCPP_BENCHMARK(BatchExecute)
+{
+	struct Record
+	{
+		std::int32_t id;
+		std::string_view name;
+		double amount;
+	};
+
+	BenchDatabase database{"Bench-BatchExecute"};
+	auto& attachment = database.getAttachment();
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction,
+			"create table bench_batch (id integer, name varchar(50), amount double precision)"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	std::vector<Record> records;
+	records.reserve(MESSAGE_COUNT);
+
+	for (unsigned i = 0u; i < MESSAGE_COUNT; ++i)
+		records.push_back({static_cast<std::int32_t>(i), "name", i * 1.5});
+
+	Transaction transaction{attachment};
+	Statement insert{attachment, transaction, "insert into bench_batch (id, name, amount) values (?, ?, ?)"};
+
+	// Each iteration rolls back its inserts, so the table does not grow across iterations.
+	runner.measure(
+		"addMessage+execute",
+		[&]
+		{
+			Batch batch{insert, transaction};
+
+			for (const auto& record : records)
+			{
+				insert.setInt32(0, record.id);
+				insert.setString(1, record.name);
+				insert.setDouble(2, record.amount);
+				batch.addMessage();
+			}
+
+			doNotOptimize(batch.execute());
+			transaction.rollbackRetaining();
+		},
+		MESSAGE_COUNT);
+
+	runner.measure(
+		"addRange+execute",
+		[&]
+		{
+			Batch batch{insert, transaction};
+			batch.addRange(std::span{records});
+			doNotOptimize(batch.execute());
+			transaction.rollbackRetaining();
+		},
+		MESSAGE_COUNT);
+
+	runner.measure(
+		"execute/row-by-row",
+		[&]
+		{
+			for (const auto& record : records)
+			{
+				insert.setInt32(0, record.id);
+				insert.setString(1, record.name);
+				insert.setDouble(2, record.amount);
+				insert.execute(transaction);
+			}
+
+			transaction.rollbackRetaining();
+		},
+		MESSAGE_COUNT);
+}
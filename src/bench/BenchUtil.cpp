@@ -0,0 +1,196 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "BenchUtil.h"
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+
+namespace fbcpp::bench
+{
+	Client CLIENT{fb::fb_get_master_interface()};
+
+	const void* volatile benchSink = nullptr;
+
+	namespace
+	{
+		fs::path tempDir;
+		bool removeTempDir = false;
+		std::string benchServerPrefix;
+
+		std::vector<std::pair<const char*, Registration::Function>>& getRegistry()
+		{
+			static std::vector<std::pair<const char*, Registration::Function>> registry;
+			return registry;
+		}
+
+		bool createAccessibleDirectory(const fs::path& path)
+		{
+			if (!fs::create_directory(path))
+				return false;
+
+			fs::permissions(
+				path, fs::perms::owner_all | fs::perms::group_all | fs::perms::others_all, fs::perm_options::replace);
+
+			return true;
+		}
+
+		void initTempDir()
+		{
+			const char* benchDirEnv = std::getenv("FBCPP_BENCH_DIR");
+			const char* benchServerEnv = std::getenv("FBCPP_BENCH_SERVER");
+			if (benchServerEnv && *benchServerEnv)
+				benchServerPrefix = std::string(benchServerEnv) + ":";
+
+			if (benchDirEnv && *benchDirEnv)
+			{
+				tempDir = benchDirEnv;
+				createAccessibleDirectory(tempDir);
+				return;
+			}
+
+			const fs::path prefix = fs::temp_directory_path();
+
+			auto now = std::chrono::system_clock::now();
+			auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+
+			std::ostringstream oss;
+			oss << "fbcpp-bench-" << time;
+
+			tempDir = prefix / oss.str();
+
+			if (createAccessibleDirectory(tempDir))
+				removeTempDir = true;
+		}
+	}  // namespace
+
+	std::string getTempFile(const std::string_view name, bool includeServerPrefix)
+	{
+		const auto path = (tempDir / name).string();
+		return includeServerPrefix ? benchServerPrefix + path : path;
+	}
+
+	void Runner::report(const std::string& name, std::uint64_t iterations, std::chrono::nanoseconds elapsed,
+		std::uint64_t itemsPerIteration)
+	{
+		const double nsPerIteration = static_cast<double>(elapsed.count()) / static_cast<double>(iterations);
+
+		std::cout << std::left << std::setw(56) << name << std::right << std::setw(12) << iterations << "  "
+				  << std::fixed << std::setprecision(1) << std::setw(14) << nsPerIteration << " ns/op";
+
+		if (itemsPerIteration > 1u)
+		{
+			std::cout << std::setw(14) << nsPerIteration / static_cast<double>(itemsPerIteration) << " ns/item";
+		}
+
+		std::cout << std::endl;
+	}
+
+	Registration::Registration(const char* name, Function function)
+	{
+		getRegistry().emplace_back(name, function);
+	}
+
+	BenchDatabase::BenchDatabase(std::string_view name)
+		: attachment{CLIENT, getTempFile(std::string{name} + ".fdb"),
+			  AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)}
+	{
+	}
+
+	BenchDatabase::~BenchDatabase() noexcept
+	{
+		if (attachment.isValid())
+		{
+			try
+			{
+				attachment.dropDatabase();
+			}
+			catch (...)
+			{
+				// swallow
+			}
+		}
+	}
+}  // namespace fbcpp::bench
+
+
+int main(int argc, char* argv[])
+{
+	std::string filter;
+	std::chrono::milliseconds minTime{200};
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string_view arg{argv[i]};
+
+		if (arg.starts_with("--filter="))
+			filter = arg.substr(9);
+		else if (arg.starts_with("--min-time-ms="))
+			minTime = std::chrono::milliseconds{std::atoi(argv[i] + 14)};
+		else
+		{
+			std::cerr << "Usage: " << argv[0] << " [--filter=<substring>] [--min-time-ms=<milliseconds>]" << std::endl;
+			return 1;
+		}
+	}
+
+	initTempDir();
+
+	int result = 0;
+
+	for (const auto& [name, function] : getRegistry())
+	{
+		try
+		{
+			Runner runner{name, filter, minTime};
+			function(runner);
+		}
+		catch (const std::exception& e)
+		{
+			std::cerr << name << ": " << e.what() << std::endl;
+			result = 1;
+		}
+	}
+
+	CLIENT.shutdown();
+
+	if (removeTempDir)
+	{
+		std::error_code ec;
+		fs::remove(tempDir, ec);
+	}
+
+	return result;
+}
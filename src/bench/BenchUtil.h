@@ -0,0 +1,165 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_BENCH_BENCH_UTIL_H
+#define FBCPP_BENCH_BENCH_UTIL_H
+
+#include "fb-cpp/Attachment.h"
+#include "fb-cpp/Client.h"
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+
+using namespace fbcpp;
+
+namespace fbcpp::bench
+{
+	extern Client CLIENT;
+	extern const void* volatile benchSink;
+
+	std::string getTempFile(const std::string_view name, bool includeServerPrefix = true);
+
+	///
+	/// Forces the compiler to consider `value` as used, so the computation that produced it is not optimized out.
+	///
+	template <typename T>
+	inline void doNotOptimize(const T& value)
+	{
+		benchSink = &value;
+	}
+
+	///
+	/// Measures operations of one benchmark function and prints one line per measured case.
+	///
+	class Runner final
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		explicit Runner(std::string_view benchmark, std::string_view filter, std::chrono::nanoseconds minTime)
+			: benchmark{benchmark},
+			  filter{filter},
+			  minTime{minTime}
+		{
+		}
+
+	public:
+		///
+		/// Runs `operation` repeatedly, doubling the iteration count until a run takes at least the minimum time,
+		/// and reports the average time per iteration.
+		/// `itemsPerIteration` is the number of logical items (rows, messages) one call processes.
+		///
+		template <typename F>
+		void measure(std::string_view caseName, F&& operation, std::uint64_t itemsPerIteration = 1u)
+		{
+			const auto name = benchmark + "/" + std::string{caseName};
+
+			if (!filter.empty() && name.find(filter) == std::string::npos)
+				return;
+
+			std::uint64_t iterations = 1u;
+
+			while (true)
+			{
+				const auto start = Clock::now();
+
+				for (std::uint64_t i = 0u; i < iterations; ++i)
+					operation();
+
+				const auto elapsed = Clock::now() - start;
+
+				if (elapsed >= minTime || iterations >= MAX_ITERATIONS)
+				{
+					report(name, iterations, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed),
+						itemsPerIteration);
+					return;
+				}
+
+				iterations *= elapsed * 10 < minTime ? 10u : 2u;
+			}
+		}
+
+	private:
+		void report(const std::string& name, std::uint64_t iterations, std::chrono::nanoseconds elapsed,
+			std::uint64_t itemsPerIteration);
+
+	private:
+		static constexpr std::uint64_t MAX_ITERATIONS = 1u << 30;
+
+		std::string benchmark;
+		std::string filter;
+		std::chrono::nanoseconds minTime;
+	};
+
+	///
+	/// Registers a benchmark function at static initialization time.
+	///
+	class Registration final
+	{
+	public:
+		using Function = void (*)(Runner& runner);
+
+		explicit Registration(const char* name, Function function);
+	};
+
+	///
+	/// Creates a fresh database for a benchmark function and drops it when destroyed.
+	///
+	class BenchDatabase final
+	{
+	public:
+		explicit BenchDatabase(std::string_view name);
+
+		~BenchDatabase() noexcept;
+
+		BenchDatabase(const BenchDatabase&) = delete;
+		BenchDatabase& operator=(const BenchDatabase&) = delete;
+
+	public:
+		Attachment& getAttachment() noexcept
+		{
+			return attachment;
+		}
+
+	private:
+		Attachment attachment;
+	};
+}  // namespace fbcpp::bench
+
+using namespace fbcpp::bench;
+
+
+///
+/// Defines and registers a benchmark function receiving a `Runner& runner` argument.
+///
+#define FBCPP_BENCHMARK(name)                                                                      \
+	static void name(::fbcpp::bench::Runner& runner);                                              \
+	static const ::fbcpp::bench::Registration name##Registration{#name, &name};                    \
+	static void name(::fbcpp::bench::Runner& runner)
+
+
+#endif  // FBCPP_BENCH_BENCH_UTIL_H
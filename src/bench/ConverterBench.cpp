@@ -0,0 +1,129 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "BenchUtil.h"
+#include "fb-cpp/CalendarConverter.h"
+#include "fb-cpp/Exception.h"
+#include "fb-cpp/NumericConverter.h"
+#include <cstdint>
+#include <string>
+
+
+FBCPP_BENCHMARK(NumericConverter)
+{
+	impl::NumericConverter converter{CLIENT};
+	std::int64_t value = 123456789;
+
+	runner.measure("numberToNumber/int64-upscale",
+		[&]
+		{
+			doNotOptimize(converter.numberToNumber<std::int64_t>(ScaledInt64{value, -2}, -6));
+		});
+
+	runner.measure("numberToNumber/int64-downscale",
+		[&]
+		{
+			doNotOptimize(converter.numberToNumber<std::int32_t>(ScaledInt64{value, -6}, -2));
+		});
+
+	runner.measure("numberToNumber/int16-to-int64",
+		[&]
+		{
+			doNotOptimize(converter.numberToNumber<std::int64_t>(ScaledInt16{1234, -2}, -4));
+		});
+
+	runner.measure("numberToString/int32-unscaled",
+		[&]
+		{
+			doNotOptimize(converter.numberToString(ScaledInt32{-1234567, 0}));
+		});
+
+	runner.measure("numberToString/int64-scaled",
+		[&]
+		{
+			doNotOptimize(converter.numberToString(ScaledInt64{value, -4}));
+		});
+}
+
+FBCPP_BENCHMARK(CalendarConverter)
+{
+	impl::CalendarConverter converter{CLIENT};
+	impl::StatusWrapper statusWrapper{CLIENT};
+
+	const auto opaqueDate = converter.stringToOpaqueDate("2024-02-29");
+	const auto opaqueTime = converter.stringToOpaqueTime("13:14:15.1234");
+	const auto opaqueTimestamp = converter.stringToOpaqueTimestamp("2024-02-29 13:14:15.1234");
+	const auto opaqueTimestampTz =
+		converter.stringToOpaqueTimestampTz(&statusWrapper, "2024-02-29 13:14:15.1234 America/Sao_Paulo");
+
+	runner.measure("stringToDate",
+		[&]
+		{
+			doNotOptimize(converter.stringToDate("2024-02-29"));
+		});
+
+	runner.measure("opaqueDateToString",
+		[&]
+		{
+			doNotOptimize(converter.opaqueDateToString(opaqueDate));
+		});
+
+	runner.measure("stringToTime",
+		[&]
+		{
+			doNotOptimize(converter.stringToTime("13:14:15.1234"));
+		});
+
+	runner.measure("opaqueTimeToString",
+		[&]
+		{
+			doNotOptimize(converter.opaqueTimeToString(opaqueTime));
+		});
+
+	runner.measure("stringToTimestamp",
+		[&]
+		{
+			doNotOptimize(converter.stringToTimestamp("2024-02-29 13:14:15.1234"));
+		});
+
+	runner.measure("opaqueTimestampToString",
+		[&]
+		{
+			doNotOptimize(converter.opaqueTimestampToString(opaqueTimestamp));
+		});
+
+	runner.measure("stringToOpaqueTimestampTz",
+		[&]
+		{
+			doNotOptimize(
+				converter.stringToOpaqueTimestampTz(&statusWrapper, "2024-02-29 13:14:15.1234 America/Sao_Paulo"));
+		});
+
+	runner.measure("opaqueTimestampTzToString",
+		[&]
+		{
+			doNotOptimize(converter.opaqueTimestampTzToString(&statusWrapper, opaqueTimestampTz));
+		});
+}
@@ -0,0 +1,120 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "BenchUtil.h"
+#include "fb-cpp/Batch.h"
+#include "fb-cpp/RowSet.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+
+static constexpr unsigned ROW_COUNT = 10000u;
+
+static void populate(Attachment& attachment)
+{
+	struct Record
+	{
+		std::int32_t id;
+		std::string name;
+		double amount;
+	};
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement ddl{
+			attachment, transaction, "create table bench_rows (id integer, name varchar(50), amount double precision)"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	std::vector<Record> records;
+	records.reserve(ROW_COUNT);
+
+	for (unsigned i = 0u; i < ROW_COUNT; ++i)
+		records.push_back({static_cast<std::int32_t>(i), "name " + std::to_string(i), i * 1.5});
+
+	Transaction transaction{attachment};
+	Statement insert{attachment, transaction, "insert into bench_rows (id, name, amount) values (?, ?, ?)"};
+	Batch batch{insert, transaction};
+	batch.addRange(std::span{records});
+	batch.execute();
+	transaction.commit();
+}
+
+FBCPP_BENCHMARK(RowSetFetch)
+{
+	BenchDatabase database{"Bench-RowSetFetch"};
+	auto& attachment = database.getAttachment();
+	populate(attachment);
+
+	Transaction transaction{attachment};
+	Statement select{attachment, transaction, "select id, name, amount from bench_rows"};
+
+	runner.measure(
+		"fetchNext",
+		[&]
+		{
+			std::int64_t sum = 0;
+
+			for (bool hasRow = select.execute(transaction); hasRow; hasRow = select.fetchNext())
+				sum += select.getInt32(0).value();
+
+			doNotOptimize(sum);
+		},
+		ROW_COUNT);
+
+	for (const unsigned maxRows : {100u, 1000u})
+	{
+		runner.measure(
+			"RowSet/" + std::to_string(maxRows),
+			[&]
+			{
+				std::int64_t sum = 0;
+
+				if (select.execute(transaction))
+				{
+					sum += select.getInt32(0).value();
+
+					while (true)
+					{
+						RowSet rowSet{select, maxRows};
+
+						if (rowSet.getCount() == 0u)
+							break;
+
+						for (unsigned i = 0u; i < rowSet.getCount(); ++i)
+							sum += rowSet.getRow(i).getInt32(0).value();
+					}
+				}
+
+				doNotOptimize(sum);
+			},
+			ROW_COUNT);
+	}
+}
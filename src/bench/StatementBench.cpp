@@ -0,0 +1,339 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "BenchUtil.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <chrono>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+
+
+FBCPP_BENCHMARK(StatementGetters)
+{
+	BenchDatabase database{"Bench-StatementGetters"};
+	auto& attachment = database.getAttachment();
+
+	Transaction transaction{attachment};
+	Statement stmt{attachment, transaction,
+		"select cast(1234 as smallint), cast(123456 as integer), cast(1234567890123 as bigint), "
+		"cast(12345.6789 as numeric(18, 4)), cast(1.5 as float), cast(2.5 as double precision), "
+		"cast('2024-02-29' as date), cast('13:14:15.1234' as time), cast('2024-02-29 13:14:15.1234' as timestamp), "
+		"cast('2024-02-29 13:14:15.1234 UTC' as timestamp with time zone), cast('hello world' as varchar(50)), "
+		"true from rdb$database"};
+	stmt.execute(transaction);
+
+	runner.measure("getInt16",
+		[&]
+		{
+			doNotOptimize(stmt.getInt16(0));
+		});
+
+	runner.measure("getInt32",
+		[&]
+		{
+			doNotOptimize(stmt.getInt32(1));
+		});
+
+	runner.measure("getInt64",
+		[&]
+		{
+			doNotOptimize(stmt.getInt64(2));
+		});
+
+	runner.measure("getScaledInt64",
+		[&]
+		{
+			doNotOptimize(stmt.getScaledInt64(3));
+		});
+
+	runner.measure("getInt64/from-smallint",
+		[&]
+		{
+			doNotOptimize(stmt.getInt64(0));
+		});
+
+	runner.measure("getDouble/from-numeric",
+		[&]
+		{
+			doNotOptimize(stmt.getDouble(3));
+		});
+
+	runner.measure("getFloat",
+		[&]
+		{
+			doNotOptimize(stmt.getFloat(4));
+		});
+
+	runner.measure("getDouble",
+		[&]
+		{
+			doNotOptimize(stmt.getDouble(5));
+		});
+
+	runner.measure("getDate",
+		[&]
+		{
+			doNotOptimize(stmt.getDate(6));
+		});
+
+	runner.measure("getTime",
+		[&]
+		{
+			doNotOptimize(stmt.getTime(7));
+		});
+
+	runner.measure("getTimestamp",
+		[&]
+		{
+			doNotOptimize(stmt.getTimestamp(8));
+		});
+
+	runner.measure("getTimestampTz",
+		[&]
+		{
+			doNotOptimize(stmt.getTimestampTz(9));
+		});
+
+	runner.measure("getString",
+		[&]
+		{
+			doNotOptimize(stmt.getString(10));
+		});
+
+	runner.measure("getStringView",
+		[&]
+		{
+			doNotOptimize(stmt.getStringView(10));
+		});
+
+	runner.measure("getBool",
+		[&]
+		{
+			doNotOptimize(stmt.getBool(11));
+		});
+
+	runner.measure("getString/from-numeric",
+		[&]
+		{
+			doNotOptimize(stmt.getString(3));
+		});
+
+	runner.measure("getString/from-timestamp",
+		[&]
+		{
+			doNotOptimize(stmt.getString(8));
+		});
+}
+
+FBCPP_BENCHMARK(StatementSetters)
+{
+	BenchDatabase database{"Bench-StatementSetters"};
+	auto& attachment = database.getAttachment();
+
+	Transaction transaction{attachment};
+	Statement stmt{attachment, transaction,
+		"select cast(? as smallint), cast(? as integer), cast(? as bigint), cast(? as numeric(18, 4)), "
+		"cast(? as float), cast(? as double precision), cast(? as date), cast(? as time), cast(? as timestamp), "
+		"cast(? as varchar(50)), cast(? as boolean) from rdb$database"};
+
+	const Date date{std::chrono::year{2024}, std::chrono::month{2}, std::chrono::day{29}};
+	const Time time{std::chrono::hours{13} + std::chrono::minutes{14} + std::chrono::seconds{15}};
+	const Timestamp timestamp{date, time};
+
+	runner.measure("setNull",
+		[&]
+		{
+			stmt.setNull(0);
+		});
+
+	runner.measure("setInt16",
+		[&]
+		{
+			stmt.setInt16(0, 1234);
+		});
+
+	runner.measure("setInt32",
+		[&]
+		{
+			stmt.setInt32(1, 123456);
+		});
+
+	runner.measure("setInt64",
+		[&]
+		{
+			stmt.setInt64(2, 1234567890123);
+		});
+
+	runner.measure("setScaledInt64",
+		[&]
+		{
+			stmt.setScaledInt64(3, ScaledInt64{123456789, -4});
+		});
+
+	runner.measure("setInt32/to-numeric",
+		[&]
+		{
+			stmt.setInt32(3, 12345);
+		});
+
+	runner.measure("setFloat",
+		[&]
+		{
+			stmt.setFloat(4, 1.5f);
+		});
+
+	runner.measure("setDouble",
+		[&]
+		{
+			stmt.setDouble(5, 2.5);
+		});
+
+	runner.measure("setDate",
+		[&]
+		{
+			stmt.setDate(6, date);
+		});
+
+	runner.measure("setTime",
+		[&]
+		{
+			stmt.setTime(7, time);
+		});
+
+	runner.measure("setTimestamp",
+		[&]
+		{
+			stmt.setTimestamp(8, timestamp);
+		});
+
+	runner.measure("setString",
+		[&]
+		{
+			stmt.setString(9, "hello world");
+		});
+
+	runner.measure("setBool",
+		[&]
+		{
+			stmt.setBool(10, true);
+		});
+}
+
+FBCPP_BENCHMARK(StatementSetString)
+{
+	BenchDatabase database{"Bench-StatementSetString"};
+	auto& attachment = database.getAttachment();
+
+	Transaction transaction{attachment};
+	Statement stmt{attachment, transaction,
+		"select cast(? as boolean), cast(? as smallint), cast(? as integer), cast(? as bigint), "
+		"cast(? as numeric(18, 4)), cast(? as int128), cast(? as float), cast(? as double precision), "
+		"cast(? as date), cast(? as time), cast(? as timestamp), cast(? as time with time zone), "
+		"cast(? as timestamp with time zone), cast(? as decfloat(16)), cast(? as decfloat(34)), "
+		"cast(? as varchar(50)) from rdb$database"};
+
+	struct Case final
+	{
+		const char* name;
+		std::string_view value;
+	};
+
+	static constexpr Case cases[] = {
+		{"boolean", "true"},
+		{"smallint", "1234"},
+		{"integer", "123456"},
+		{"bigint", "1234567890123"},
+		{"numeric", "12345.6789"},
+		{"int128", "170141183460469231731687303715884105727"},
+		{"float", "1.5"},
+		{"double", "2.5"},
+		{"date", "2024-02-29"},
+		{"time", "13:14:15.1234"},
+		{"timestamp", "2024-02-29 13:14:15.1234"},
+		{"time-tz", "13:14:15.1234 UTC"},
+		{"timestamp-tz", "2024-02-29 13:14:15.1234 America/Sao_Paulo"},
+		{"decfloat16", "1234.5678"},
+		{"decfloat34", "12345678901234567890.1234"},
+		{"varchar", "hello world"},
+	};
+
+	for (unsigned index = 0u; index < std::size(cases); ++index)
+	{
+		const auto& testCase = cases[index];
+
+		runner.measure(std::string{"setString/"} + testCase.name,
+			[&]
+			{
+				stmt.setString(index, testCase.value);
+			});
+	}
+}
+
+FBCPP_BENCHMARK(StatementStructBinding)
+{
+	struct Record
+	{
+		std::optional<std::int32_t> id;
+		std::optional<std::string> name;
+		std::optional<double> amount;
+		std::optional<Date> date;
+	};
+
+	struct Params
+	{
+		std::int32_t id;
+		std::string_view name;
+		double amount;
+		Date date;
+	};
+
+	BenchDatabase database{"Bench-StatementStructBinding"};
+	auto& attachment = database.getAttachment();
+
+	Transaction transaction{attachment};
+	Statement stmt{attachment, transaction,
+		"select cast(? as integer), cast(? as varchar(50)), cast(? as double precision), cast(? as date) "
+		"from rdb$database"};
+
+	const Params params{1, "name", 2.5, Date{std::chrono::year{2024}, std::chrono::month{2}, std::chrono::day{29}}};
+	stmt.set(params);
+	stmt.execute(transaction);
+
+	runner.measure("set",
+		[&]
+		{
+			stmt.set(params);
+		});
+
+	runner.measure("get",
+		[&]
+		{
+			doNotOptimize(stmt.get<Record>());
+		});
+}
@@ -0,0 +1,499 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "ArrowExport.h"
+#include "fb-cpp/Attachment.h"
+#include "fb-cpp/Blob.h"
+#include "fb-cpp/Client.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+namespace
+{
+	// Modified Julian Day of 1970-01-01, the Arrow epoch.
+	constexpr std::int64_t UNIX_EPOCH_DATE = 40587;
+	constexpr std::int64_t MICROSECONDS_PER_DAY = 86400ll * 1000000ll;
+	// ISC_TIME is in units of 100 microseconds.
+	constexpr std::int64_t MICROSECONDS_PER_ISC_TIME = 100;
+	constexpr unsigned CS_BINARY = 1u;
+	constexpr int BLOB_SUB_TYPE_TEXT = 1;
+
+	void checkArrow(const arrow::Status& status)
+	{
+		if (!status.ok())
+			throw FbCppException("Arrow error: " + status.ToString());
+	}
+
+	template <typename T>
+	T checkArrow(arrow::Result<T>&& result)
+	{
+		checkArrow(result.status());
+		return std::move(result).ValueUnsafe();
+	}
+
+	template <typename T>
+	T read(const std::byte* data) noexcept
+	{
+		T value;
+		std::memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	std::int64_t toMicroseconds(const ISC_TIMESTAMP& timestamp) noexcept
+	{
+		return (static_cast<std::int64_t>(timestamp.timestamp_date) - UNIX_EPOCH_DATE) * MICROSECONDS_PER_DAY +
+			static_cast<std::int64_t>(timestamp.timestamp_time) * MICROSECONDS_PER_ISC_TIME;
+	}
+
+	std::shared_ptr<arrow::DataType> makeScaledType(int precision, int scale, std::shared_ptr<arrow::DataType> type)
+	{
+		return scale == 0 ? std::move(type) : arrow::decimal128(precision, -scale);
+	}
+
+	std::shared_ptr<arrow::DataType> getArrowType(const Descriptor& descriptor)
+	{
+		switch (descriptor.adjustedType)
+		{
+			case DescriptorAdjustedType::NULL_TYPE:
+				return arrow::null();
+
+			case DescriptorAdjustedType::BOOLEAN:
+				return arrow::boolean();
+
+			case DescriptorAdjustedType::INT16:
+				return makeScaledType(4, descriptor.scale, arrow::int16());
+
+			case DescriptorAdjustedType::INT32:
+				return makeScaledType(9, descriptor.scale, arrow::int32());
+
+			case DescriptorAdjustedType::INT64:
+				return makeScaledType(18, descriptor.scale, arrow::int64());
+
+			case DescriptorAdjustedType::INT128:
+				return arrow::decimal128(38, -descriptor.scale);
+
+			case DescriptorAdjustedType::FLOAT:
+				return arrow::float32();
+
+			case DescriptorAdjustedType::DOUBLE:
+				return arrow::float64();
+
+			case DescriptorAdjustedType::DECFLOAT16:
+			case DescriptorAdjustedType::DECFLOAT34:
+				return arrow::utf8();
+
+			case DescriptorAdjustedType::DATE:
+				return arrow::date32();
+
+			case DescriptorAdjustedType::TIME:
+			case DescriptorAdjustedType::TIME_TZ:
+			case DescriptorAdjustedType::TIME_TZ_EX:
+				return arrow::time64(arrow::TimeUnit::MICRO);
+
+			case DescriptorAdjustedType::TIMESTAMP:
+				return arrow::timestamp(arrow::TimeUnit::MICRO);
+
+			case DescriptorAdjustedType::TIMESTAMP_TZ:
+			case DescriptorAdjustedType::TIMESTAMP_TZ_EX:
+				return arrow::timestamp(arrow::TimeUnit::MICRO, "UTC");
+
+			case DescriptorAdjustedType::STRING:
+				return descriptor.charSetId == CS_BINARY ? arrow::binary() : arrow::utf8();
+
+			case DescriptorAdjustedType::BLOB:
+				return descriptor.subType == BLOB_SUB_TYPE_TEXT ? arrow::utf8() : arrow::binary();
+		}
+
+		throw FbCppException("Column '" + descriptor.name + "' has a type that cannot be exported to Arrow");
+	}
+
+	bool hasTimeZone(DescriptorAdjustedType type) noexcept
+	{
+		return type == DescriptorAdjustedType::TIME_TZ || type == DescriptorAdjustedType::TIME_TZ_EX ||
+			type == DescriptorAdjustedType::TIMESTAMP_TZ || type == DescriptorAdjustedType::TIMESTAMP_TZ_EX;
+	}
+
+	template <typename Builder>
+	Builder& as(arrow::ArrayBuilder& builder) noexcept
+	{
+		return static_cast<Builder&>(builder);
+	}
+}  // namespace
+
+
+struct ArrowConverter::Column final
+{
+	DescriptorLayout layout;
+	std::unique_ptr<arrow::ArrayBuilder> builder;
+	std::unique_ptr<arrow::StringBuilder> zoneBuilder;
+};
+
+
+ArrowConverter::ArrowConverter(
+	Attachment& attachment, Transaction& transaction, DescriptorSetPtr descriptors, const ArrowExportOptions& options)
+	: attachment{attachment},
+	  transaction{transaction},
+	  descriptors{std::move(descriptors)},
+	  options{options},
+	  statusWrapper{attachment.getClient()}
+{
+	assert(this->descriptors);
+
+	const auto& descriptorList = this->descriptors->getDescriptors();
+	arrow::FieldVector fields;
+
+	fields.reserve(descriptorList.size());
+	columns.reserve(descriptorList.size());
+
+	for (std::size_t i = 0; i < descriptorList.size(); ++i)
+	{
+		const auto& descriptor = descriptorList[i];
+		const auto& name = descriptor.alias.empty() ? descriptor.name : descriptor.alias;
+		auto type = getArrowType(descriptor);
+
+		auto& column = columns.emplace_back();
+		column.layout = this->descriptors->getLayout(i);
+		column.builder = checkArrow(arrow::MakeBuilder(type, options.getMemoryPool()));
+		fields.push_back(arrow::field(name, std::move(type), descriptor.isNullable));
+
+		if (options.getTimeZoneColumns() && hasTimeZone(descriptor.adjustedType))
+		{
+			column.zoneBuilder = std::make_unique<arrow::StringBuilder>(options.getMemoryPool());
+			fields.push_back(arrow::field(name + "_TZ", arrow::utf8(), descriptor.isNullable));
+		}
+	}
+
+	schema = arrow::schema(std::move(fields));
+}
+
+ArrowConverter::~ArrowConverter() noexcept = default;
+
+std::shared_ptr<arrow::RecordBatch> ArrowConverter::convert(const RowSet& rowSet)
+{
+	assert(rowSet.getDescriptorSet() == descriptors);
+
+	const auto count = static_cast<std::int64_t>(rowSet.getCount());
+
+	for (auto& column : columns)
+	{
+		checkArrow(column.builder->Reserve(count));
+
+		if (column.zoneBuilder)
+			checkArrow(column.zoneBuilder->Reserve(count));
+	}
+
+	for (unsigned row = 0; row < rowSet.getCount(); ++row)
+	{
+		const auto message = rowSet.getRawRow(row).data();
+
+		for (auto& column : columns)
+			append(column, message);
+	}
+
+	arrow::ArrayVector arrays;
+	arrays.reserve(static_cast<std::size_t>(schema->num_fields()));
+
+	for (auto& column : columns)
+	{
+		arrays.push_back(checkArrow(column.builder->Finish()));
+
+		if (column.zoneBuilder)
+			arrays.push_back(checkArrow(column.zoneBuilder->Finish()));
+	}
+
+	return arrow::RecordBatch::Make(schema, count, std::move(arrays));
+}
+
+void ArrowConverter::append(Column& column, const std::byte* message)
+{
+	const auto& layout = column.layout;
+	auto& builder = *column.builder;
+
+	if (layout.adjustedType == DescriptorAdjustedType::NULL_TYPE ||
+		read<std::int16_t>(&message[layout.nullOffset]) != FB_FALSE)
+	{
+		checkArrow(builder.AppendNull());
+
+		if (column.zoneBuilder)
+			checkArrow(column.zoneBuilder->AppendNull());
+
+		return;
+	}
+
+	const auto data = &message[layout.offset];
+
+	switch (layout.adjustedType)
+	{
+		case DescriptorAdjustedType::BOOLEAN:
+			as<arrow::BooleanBuilder>(builder).UnsafeAppend(read<FB_BOOLEAN>(data) != FB_FALSE);
+			break;
+
+		case DescriptorAdjustedType::INT16:
+			if (layout.scale != 0)
+			{
+				const auto value = static_cast<std::int64_t>(read<std::int16_t>(data));
+				as<arrow::Decimal128Builder>(builder).UnsafeAppend(arrow::Decimal128{value});
+			}
+			else
+				as<arrow::Int16Builder>(builder).UnsafeAppend(read<std::int16_t>(data));
+			break;
+
+		case DescriptorAdjustedType::INT32:
+			if (layout.scale != 0)
+			{
+				const auto value = static_cast<std::int64_t>(read<std::int32_t>(data));
+				as<arrow::Decimal128Builder>(builder).UnsafeAppend(arrow::Decimal128{value});
+			}
+			else
+				as<arrow::Int32Builder>(builder).UnsafeAppend(read<std::int32_t>(data));
+			break;
+
+		case DescriptorAdjustedType::INT64:
+			if (layout.scale != 0)
+				as<arrow::Decimal128Builder>(builder).UnsafeAppend(arrow::Decimal128{read<std::int64_t>(data)});
+			else
+				as<arrow::Int64Builder>(builder).UnsafeAppend(read<std::int64_t>(data));
+			break;
+
+		case DescriptorAdjustedType::INT128:
+		{
+			// FB_I128 and Decimal128 both hold the little-endian two's complement value as low and high words.
+			const auto value = read<FB_I128>(data);
+			as<arrow::Decimal128Builder>(builder).UnsafeAppend(
+				arrow::Decimal128{static_cast<std::int64_t>(value.fb_data[1]), value.fb_data[0]});
+			break;
+		}
+
+		case DescriptorAdjustedType::FLOAT:
+			as<arrow::FloatBuilder>(builder).UnsafeAppend(read<float>(data));
+			break;
+
+		case DescriptorAdjustedType::DOUBLE:
+			as<arrow::DoubleBuilder>(builder).UnsafeAppend(read<double>(data));
+			break;
+
+		case DescriptorAdjustedType::DECFLOAT16:
+		{
+			std::array<char, fb::IDecFloat16::STRING_SIZE> buffer;
+			const auto value = read<FB_DEC16>(data);
+			attachment.getClient()
+				.getDecFloat16Util(&statusWrapper)
+				->toString(&statusWrapper, &value, static_cast<unsigned>(buffer.size()), buffer.data());
+			const auto length = static_cast<std::int32_t>(std::strlen(buffer.data()));
+			checkArrow(as<arrow::StringBuilder>(builder).Append(buffer.data(), length));
+			break;
+		}
+
+		case DescriptorAdjustedType::DECFLOAT34:
+		{
+			std::array<char, fb::IDecFloat34::STRING_SIZE> buffer;
+			const auto value = read<FB_DEC34>(data);
+			attachment.getClient()
+				.getDecFloat34Util(&statusWrapper)
+				->toString(&statusWrapper, &value, static_cast<unsigned>(buffer.size()), buffer.data());
+			const auto length = static_cast<std::int32_t>(std::strlen(buffer.data()));
+			checkArrow(as<arrow::StringBuilder>(builder).Append(buffer.data(), length));
+			break;
+		}
+
+		case DescriptorAdjustedType::DATE:
+			as<arrow::Date32Builder>(builder).UnsafeAppend(
+				static_cast<std::int32_t>(read<ISC_DATE>(data) - UNIX_EPOCH_DATE));
+			break;
+
+		case DescriptorAdjustedType::TIME:
+			as<arrow::Time64Builder>(builder).UnsafeAppend(
+				static_cast<std::int64_t>(read<ISC_TIME>(data)) * MICROSECONDS_PER_ISC_TIME);
+			break;
+
+		case DescriptorAdjustedType::TIMESTAMP:
+			as<arrow::TimestampBuilder>(builder).UnsafeAppend(toMicroseconds(read<ISC_TIMESTAMP>(data)));
+			break;
+
+		case DescriptorAdjustedType::TIME_TZ:
+		case DescriptorAdjustedType::TIME_TZ_EX:
+		{
+			// The EX layouts only append the offset, which is not exported.
+			const auto value = read<ISC_TIME_TZ>(data);
+			as<arrow::Time64Builder>(builder).UnsafeAppend(
+				static_cast<std::int64_t>(value.utc_time) * MICROSECONDS_PER_ISC_TIME);
+			appendTimeZone(column, value.time_zone, data);
+			break;
+		}
+
+		case DescriptorAdjustedType::TIMESTAMP_TZ:
+		case DescriptorAdjustedType::TIMESTAMP_TZ_EX:
+		{
+			const auto value = read<ISC_TIMESTAMP_TZ>(data);
+			as<arrow::TimestampBuilder>(builder).UnsafeAppend(toMicroseconds(value.utc_timestamp));
+			appendTimeZone(column, value.time_zone, data);
+			break;
+		}
+
+		case DescriptorAdjustedType::STRING:
+		{
+			// StringBuilder derives from BinaryBuilder, so both are appended straight from the VARYING buffer.
+			const auto length = read<std::uint16_t>(data);
+			checkArrow(as<arrow::BinaryBuilder>(builder).Append(
+				reinterpret_cast<const std::uint8_t*>(data + sizeof(std::uint16_t)), length));
+			break;
+		}
+
+		case DescriptorAdjustedType::BLOB:
+		{
+			BlobId blobId;
+			blobId.id = read<ISC_QUAD>(data);
+
+			Blob blob{attachment, transaction, blobId};
+			blobBuffer.resize(blob.getLength());
+			const auto length = blob.read(blobBuffer);
+			blob.close();
+
+			checkArrow(as<arrow::BinaryBuilder>(builder).Append(
+				reinterpret_cast<const std::uint8_t*>(blobBuffer.data()), static_cast<std::int32_t>(length)));
+			break;
+		}
+
+		case DescriptorAdjustedType::NULL_TYPE:
+			break;
+	}
+}
+
+void ArrowConverter::appendTimeZone(Column& column, ISC_USHORT zoneId, const std::byte* data)
+{
+	if (!column.zoneBuilder)
+		return;
+
+	auto zoneName = zoneNames.find(zoneId);
+
+	if (zoneName == zoneNames.end())
+	{
+		auto& cache = attachment.getClient().getTimeZoneCache();
+		auto name = cache.findName(zoneId);
+
+		if (!name.has_value())
+		{
+			std::array<char, 128> buffer{};
+			unsigned hours;
+			unsigned minutes;
+			unsigned seconds;
+			unsigned fractions;
+
+			if (column.layout.adjustedType == DescriptorAdjustedType::TIME_TZ ||
+				column.layout.adjustedType == DescriptorAdjustedType::TIME_TZ_EX)
+			{
+				const auto value = read<ISC_TIME_TZ>(data);
+				attachment.getClient().getUtil()->decodeTimeTz(&statusWrapper, &value, &hours, &minutes, &seconds,
+					&fractions, static_cast<unsigned>(buffer.size()), buffer.data());
+			}
+			else
+			{
+				const auto value = read<ISC_TIMESTAMP_TZ>(data);
+				unsigned year;
+				unsigned month;
+				unsigned day;
+				attachment.getClient().getUtil()->decodeTimeStampTz(&statusWrapper, &value, &year, &month, &day,
+					&hours, &minutes, &seconds, &fractions, static_cast<unsigned>(buffer.size()), buffer.data());
+			}
+
+			name = cache.intern(zoneId, buffer.data());
+		}
+
+		zoneName = zoneNames.emplace(zoneId, std::move(name.value())).first;
+	}
+
+	const std::string_view value = zoneName->second;
+	checkArrow(column.zoneBuilder->Append(value.data(), static_cast<std::int32_t>(value.size())));
+}
+
+
+ArrowBatchReader::ArrowBatchReader(Statement& statement, Transaction& transaction, const ArrowExportOptions& options)
+	: statement{statement},
+	  batchSize{options.getBatchSize()},
+	  converter{statement.getAttachment(), transaction, statement.getOutputDescriptorSet(), options}
+{
+	assert(statement.isValid());
+	assert(statement.getResultSetHandle());
+
+	if (batchSize == 0)
+		throw std::invalid_argument{"ArrowBatchReader batchSize must be greater than zero"};
+}
+
+std::shared_ptr<arrow::RecordBatch> ArrowBatchReader::next()
+{
+	if (finished)
+		return nullptr;
+
+	if (rowSet.has_value())
+		rowSet->refill(statement);
+	else
+		rowSet.emplace(statement, batchSize);
+
+	finished = rowSet->isEof();
+
+	if (rowSet->getCount() == 0)
+		return nullptr;
+
+	return converter.convert(*rowSet);
+}
+
+std::shared_ptr<arrow::Schema> ArrowBatchReader::schema() const
+{
+	return converter.getSchema();
+}
+
+arrow::Status ArrowBatchReader::ReadNext(std::shared_ptr<arrow::RecordBatch>* batch)
+{
+	try
+	{
+		*batch = next();
+		return arrow::Status::OK();
+	}
+	catch (const std::exception& e)
+	{
+		*batch = nullptr;
+		return arrow::Status::IOError(e.what());
+	}
+}
+
+
+std::shared_ptr<arrow::RecordBatch> fbcpp::toArrowRecordBatch(
+	Attachment& attachment, Transaction& transaction, const RowSet& rowSet, const ArrowExportOptions& options)
+{
+	ArrowConverter converter{attachment, transaction, rowSet.getDescriptorSet(), options};
+	return converter.convert(rowSet);
+}
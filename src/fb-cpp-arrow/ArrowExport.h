@@ -0,0 +1,240 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef FBCPP_ARROW_ARROW_EXPORT_H
+#define FBCPP_ARROW_ARROW_EXPORT_H
+
+#include "fb-cpp/fb-api.h"
+#include "fb-cpp/types.h"
+#include "fb-cpp/Descriptor.h"
+#include "fb-cpp/Exception.h"
+#include "fb-cpp/RowSet.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+#include <arrow/api.h>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	class Attachment;
+	class Statement;
+	class Transaction;
+
+	///
+	/// Represents options used to export query results as Arrow record batches.
+	///
+	class ArrowExportOptions final
+	{
+	public:
+		///
+		/// Returns the maximum number of rows of each record batch.
+		///
+		unsigned getBatchSize() const
+		{
+			return batchSize;
+		}
+
+		///
+		/// Sets the maximum number of rows of each record batch.
+		///
+		ArrowExportOptions& setBatchSize(unsigned value)
+		{
+			batchSize = value;
+			return *this;
+		}
+
+		///
+		/// Returns whether each TIME/TIMESTAMP WITH TIME ZONE column is followed by a `<name>_TZ` utf8 column
+		/// with the time zone name of each value.
+		///
+		bool getTimeZoneColumns() const
+		{
+			return timeZoneColumns;
+		}
+
+		///
+		/// Sets whether each TIME/TIMESTAMP WITH TIME ZONE column is followed by a `<name>_TZ` utf8 column
+		/// with the time zone name of each value.
+		///
+		ArrowExportOptions& setTimeZoneColumns(bool value)
+		{
+			timeZoneColumns = value;
+			return *this;
+		}
+
+		///
+		/// Returns the Arrow memory pool used to allocate the arrays.
+		///
+		arrow::MemoryPool* getMemoryPool() const
+		{
+			return memoryPool;
+		}
+
+		///
+		/// Sets the Arrow memory pool used to allocate the arrays.
+		///
+		ArrowExportOptions& setMemoryPool(arrow::MemoryPool* value)
+		{
+			memoryPool = value;
+			return *this;
+		}
+
+	private:
+		unsigned batchSize = 65536u;
+		bool timeZoneColumns = true;
+		arrow::MemoryPool* memoryPool = arrow::default_memory_pool();
+	};
+
+	///
+	/// @brief Converts Firebird messages into Arrow record batches.
+	///
+	/// The Arrow type of each column is derived from its DescriptorAdjustedType:
+	///
+	/// | Column type                | Arrow type                                             |
+	/// |----------------------------|--------------------------------------------------------|
+	/// | BOOLEAN                    | boolean                                                |
+	/// | SMALLINT/INTEGER/BIGINT    | int16/int32/int64, or decimal128(4/9/18, s) if scaled  |
+	/// | INT128                     | decimal128(38, s)                                      |
+	/// | FLOAT/DOUBLE PRECISION     | float32/float64                                        |
+	/// | DECFLOAT(16)/DECFLOAT(34)  | utf8 (exact decimal text)                              |
+	/// | DATE                       | date32                                                 |
+	/// | TIME                       | time64[us]                                             |
+	/// | TIMESTAMP                  | timestamp[us]                                          |
+	/// | TIME WITH TIME ZONE        | time64[us] in UTC, plus an optional zone name column   |
+	/// | TIMESTAMP WITH TIME ZONE   | timestamp[us, UTC], plus an optional zone name column  |
+	/// | CHAR/VARCHAR               | utf8, or binary for the OCTETS character set           |
+	/// | BLOB                       | utf8 for sub-type TEXT, binary otherwise               |
+	///
+	/// Fixed-width values are decoded straight from the message buffers and strings are appended from the
+	/// VARYING buffers, so no per-cell `std::string` is created. Blob contents are read through the attachment
+	/// and transaction given to the constructor.
+	///
+	class ArrowConverter final
+	{
+	public:
+		///
+		/// Prepares the conversion of messages described by `descriptors`.
+		///
+		explicit ArrowConverter(Attachment& attachment, Transaction& transaction, DescriptorSetPtr descriptors,
+			const ArrowExportOptions& options = {});
+
+		~ArrowConverter() noexcept;
+
+		ArrowConverter(const ArrowConverter&) = delete;
+		ArrowConverter& operator=(const ArrowConverter&) = delete;
+
+	public:
+		///
+		/// Returns the Arrow schema of the record batches.
+		///
+		const std::shared_ptr<arrow::Schema>& getSchema() const noexcept
+		{
+			return schema;
+		}
+
+		///
+		/// Converts the rows of the RowSet into one record batch.
+		///
+		std::shared_ptr<arrow::RecordBatch> convert(const RowSet& rowSet);
+
+	private:
+		struct Column;
+
+	private:
+		void append(Column& column, const std::byte* message);
+		void appendTimeZone(Column& column, ISC_USHORT zoneId, const std::byte* data);
+
+	private:
+		Attachment& attachment;
+		Transaction& transaction;
+		DescriptorSetPtr descriptors;
+		ArrowExportOptions options;
+		impl::StatusWrapper statusWrapper;
+		std::shared_ptr<arrow::Schema> schema;
+		std::vector<Column> columns;
+		std::unordered_map<ISC_USHORT, TimeZoneName> zoneNames;
+		std::vector<std::byte> blobBuffer;
+	};
+
+	///
+	/// @brief Streams the current result set of a Statement as Arrow record batches.
+	///
+	/// Each batch is fetched into a reused RowSet of `ArrowExportOptions::getBatchSize()` rows and converted
+	/// to Arrow arrays. As with RowSet, fetching starts after the row already fetched by `Statement::execute()`.
+	/// The statement must not be used by the caller while the reader is used.
+	///
+	/// Errors are thrown by next() and returned as `arrow::Status` by ReadNext(), so the reader can be handed
+	/// to Arrow consumers such as Parquet writers or DuckDB.
+	///
+	class ArrowBatchReader final : public arrow::RecordBatchReader
+	{
+	public:
+		///
+		/// Prepares the export of the current result set of `statement`, executed in `transaction`.
+		///
+		explicit ArrowBatchReader(
+			Statement& statement, Transaction& transaction, const ArrowExportOptions& options = {});
+
+	public:
+		///
+		/// Returns the next record batch, or nullptr at the end of the result set.
+		///
+		std::shared_ptr<arrow::RecordBatch> next();
+
+		///
+		/// Returns the Arrow schema of the record batches.
+		///
+		std::shared_ptr<arrow::Schema> schema() const override;
+
+		///
+		/// Reads the next record batch, setting it to nullptr at the end of the result set.
+		///
+		arrow::Status ReadNext(std::shared_ptr<arrow::RecordBatch>* batch) override;
+
+	private:
+		Statement& statement;
+		unsigned batchSize;
+		ArrowConverter converter;
+		std::optional<RowSet> rowSet;
+		bool finished = false;
+	};
+
+	///
+	/// Converts the rows of a RowSet into one Arrow record batch.
+	///
+	std::shared_ptr<arrow::RecordBatch> toArrowRecordBatch(Attachment& attachment, Transaction& transaction,
+		const RowSet& rowSet, const ArrowExportOptions& options = {});
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_ARROW_ARROW_EXPORT_H
@@ -0,0 +1,569 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "ArrowImport.h"
+#include "fb-cpp/Batch.h"
+#include "fb-cpp/Client.h"
+#include "fb-cpp/Exception.h"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+namespace
+{
+	// Modified Julian Day of 1970-01-01, the Arrow epoch.
+	constexpr std::int64_t UNIX_EPOCH_DATE = 40587;
+	// ISC_TIME is in units of 100 microseconds.
+	constexpr std::int64_t ISC_TIME_PER_SECOND = 10000;
+	constexpr std::int64_t ISC_TIME_PER_DAY = 86400 * ISC_TIME_PER_SECOND;
+	// Firebird time zone ID of the +00:00 offset; offset zones are stored as minutes + 1439.
+	constexpr ISC_USHORT UTC_OFFSET_ZONE_ID = 1439;
+	// Rows converted at once, keeping the multi-message buffer small and cache friendly.
+	constexpr std::int64_t SLICE_ROWS = 4096;
+
+	template <typename T>
+	void write(std::byte* data, T value) noexcept
+	{
+		std::memcpy(data, &value, sizeof(value));
+	}
+
+	void setNotNull(std::byte* message, const DescriptorLayout& layout) noexcept
+	{
+		write(&message[layout.nullOffset], static_cast<std::int16_t>(FB_FALSE));
+	}
+
+	[[noreturn]] void throwTypeMismatch(const arrow::Array& array)
+	{
+		throw FbCppException("Cannot convert Arrow " + array.type()->ToString() + " values to the parameter type");
+	}
+
+	std::int64_t floorDiv(std::int64_t value, std::int64_t divisor) noexcept
+	{
+		const auto quotient = value / divisor;
+		return quotient * divisor > value ? quotient - 1 : quotient;
+	}
+
+	std::int64_t getUnitsPerSecond(arrow::TimeUnit::type unit) noexcept
+	{
+		switch (unit)
+		{
+			case arrow::TimeUnit::SECOND:
+				return 1;
+
+			case arrow::TimeUnit::MILLI:
+				return 1000;
+
+			case arrow::TimeUnit::MICRO:
+				return 1000000;
+
+			case arrow::TimeUnit::NANO:
+				return 1000000000;
+		}
+
+		return 1;
+	}
+
+	// Converts a count of Arrow time units into ISC_TIME units, rounding toward negative infinity.
+	std::int64_t toIscUnits(std::int64_t value, std::int64_t unitsPerSecond) noexcept
+	{
+		return unitsPerSecond >= ISC_TIME_PER_SECOND ? floorDiv(value, unitsPerSecond / ISC_TIME_PER_SECOND)
+													 : value * (ISC_TIME_PER_SECOND / unitsPerSecond);
+	}
+
+	ISC_TIMESTAMP toIscTimestamp(std::int64_t iscUnitsSinceEpoch) noexcept
+	{
+		const auto days = floorDiv(iscUnitsSinceEpoch, ISC_TIME_PER_DAY);
+
+		ISC_TIMESTAMP timestamp;
+		timestamp.timestamp_date = static_cast<ISC_DATE>(days + UNIX_EPOCH_DATE);
+		timestamp.timestamp_time = static_cast<ISC_TIME>(iscUnitsSinceEpoch - days * ISC_TIME_PER_DAY);
+
+		return timestamp;
+	}
+
+	template <typename T>
+	void encodeAsText(FieldEncoder& encoder, std::byte* message, unsigned index, T value)
+	{
+		std::array<char, 64> buffer;
+		const auto end = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value).ptr;
+		encoder.encodeText(message, index, {buffer.data(), static_cast<std::size_t>(end - buffer.data())});
+	}
+
+	template <typename T>
+	bool writeScaled(std::byte* data, std::int64_t value)
+	{
+		if (value < std::numeric_limits<T>::min() || value > std::numeric_limits<T>::max())
+			return false;
+
+		write(data, static_cast<T>(value));
+		return true;
+	}
+
+	bool writeScaledInteger(std::byte* data, const DescriptorLayout& layout, std::int64_t value)
+	{
+		switch (layout.adjustedType)
+		{
+			case DescriptorAdjustedType::INT16:
+				return writeScaled<std::int16_t>(data, value);
+
+			case DescriptorAdjustedType::INT32:
+				return writeScaled<std::int32_t>(data, value);
+
+			default:
+				write(data, value);
+				return true;
+		}
+	}
+
+	void encodeInteger(FieldEncoder& encoder, std::byte* message, unsigned index, std::int64_t value)
+	{
+		const auto& layout = encoder.getDescriptorSet()->getLayout(index);
+		const auto data = &message[layout.offset];
+
+		switch (layout.adjustedType)
+		{
+			case DescriptorAdjustedType::BOOLEAN:
+				*data = static_cast<std::byte>(value != 0);
+				break;
+
+			case DescriptorAdjustedType::INT16:
+			case DescriptorAdjustedType::INT32:
+			case DescriptorAdjustedType::INT64:
+			{
+				auto scaled = value;
+
+				for (auto scale = layout.scale; scale < 0; ++scale)
+				{
+					if (scaled > std::numeric_limits<std::int64_t>::max() / 10 ||
+						scaled < std::numeric_limits<std::int64_t>::min() / 10)
+					{
+						throw FbCppException("Integer value " + std::to_string(value) + " out of range");
+					}
+
+					scaled *= 10;
+				}
+
+				if (!writeScaledInteger(data, layout, scaled))
+					throw FbCppException("Integer value " + std::to_string(value) + " out of range");
+
+				break;
+			}
+
+			case DescriptorAdjustedType::FLOAT:
+				write(data, static_cast<float>(value));
+				break;
+
+			case DescriptorAdjustedType::DOUBLE:
+				write(data, static_cast<double>(value));
+				break;
+
+			default:
+				encodeAsText(encoder, message, index, value);
+				return;
+		}
+
+		setNotNull(message, layout);
+	}
+
+	void encodeFloating(FieldEncoder& encoder, std::byte* message, unsigned index, double value)
+	{
+		const auto& layout = encoder.getDescriptorSet()->getLayout(index);
+		const auto data = &message[layout.offset];
+
+		switch (layout.adjustedType)
+		{
+			case DescriptorAdjustedType::INT16:
+			case DescriptorAdjustedType::INT32:
+			case DescriptorAdjustedType::INT64:
+			{
+				const auto scaled = std::round(value * std::pow(10.0, -layout.scale));
+
+				// 2^63 is exactly representable, so the upper bound is exclusive.
+				if (!(scaled >= -9223372036854775808.0 && scaled < 9223372036854775808.0) ||
+					!writeScaledInteger(data, layout, static_cast<std::int64_t>(scaled)))
+				{
+					throw FbCppException("Floating point value out of range");
+				}
+
+				break;
+			}
+
+			case DescriptorAdjustedType::FLOAT:
+				write(data, static_cast<float>(value));
+				break;
+
+			case DescriptorAdjustedType::DOUBLE:
+				write(data, value);
+				break;
+
+			default:
+				encodeAsText(encoder, message, index, value);
+				return;
+		}
+
+		setNotNull(message, layout);
+	}
+
+	void encodeTimestamp(const arrow::Array& array, const DescriptorLayout& layout, std::byte* message,
+		ISC_TIMESTAMP timestamp)
+	{
+		const auto data = &message[layout.offset];
+
+		switch (layout.adjustedType)
+		{
+			case DescriptorAdjustedType::DATE:
+				write(data, timestamp.timestamp_date);
+				break;
+
+			case DescriptorAdjustedType::TIMESTAMP:
+				write(data, timestamp);
+				break;
+
+			case DescriptorAdjustedType::TIMESTAMP_TZ:
+			case DescriptorAdjustedType::TIMESTAMP_TZ_EX:
+			{
+				ISC_TIMESTAMP_TZ value{};
+				value.utc_timestamp = timestamp;
+				value.time_zone = UTC_OFFSET_ZONE_ID;
+				write(data, value);
+				break;
+			}
+
+			default:
+				throwTypeMismatch(array);
+		}
+
+		setNotNull(message, layout);
+	}
+
+	void encodeTime(const arrow::Array& array, const DescriptorLayout& layout, std::byte* message, ISC_TIME time)
+	{
+		const auto data = &message[layout.offset];
+
+		switch (layout.adjustedType)
+		{
+			case DescriptorAdjustedType::TIME:
+				write(data, time);
+				break;
+
+			case DescriptorAdjustedType::TIME_TZ:
+			case DescriptorAdjustedType::TIME_TZ_EX:
+			{
+				ISC_TIME_TZ value{};
+				value.utc_time = time;
+				value.time_zone = UTC_OFFSET_ZONE_ID;
+				write(data, value);
+				break;
+			}
+
+			default:
+				throwTypeMismatch(array);
+		}
+
+		setNotNull(message, layout);
+	}
+}  // namespace
+
+
+ArrowImporter::ArrowImporter(Batch& batch, const BatchWriterOptions& options)
+	: batch{batch},
+	  writer{batch, options},
+	  encoder{batch.getClient(), batch.getInputDescriptorSet(),
+		  [this](std::span<const std::byte> data) { return writer.addBlob(data); }}
+{
+	if (encoder.hasBlobs() && batch.getOptions().getBlobPolicy() != BlobPolicy::ID_ENGINE)
+		throw std::invalid_argument{"ArrowImporter requires BlobPolicy::ID_ENGINE for blob parameters"};
+
+	StatusWrapper statusWrapper{batch.getClient()};
+	messageLength = batch.getInputMetadata()->getAlignedLength(&statusWrapper);
+}
+
+void ArrowImporter::add(const arrow::RecordBatch& recordBatch)
+{
+	const auto columnCount = static_cast<unsigned>(encoder.getDescriptorSet()->size());
+
+	if (recordBatch.num_columns() != static_cast<int>(columnCount))
+	{
+		throw FbCppException("Record batch has " + std::to_string(recordBatch.num_columns()) +
+			" columns, expected " + std::to_string(columnCount));
+	}
+
+	const auto rows = recordBatch.num_rows();
+
+	if (encoder.hasBlobs())
+	{
+		// Batch-local blob IDs must be added right before the message referencing them.
+		messages.resize(messageLength);
+
+		for (std::int64_t row = 0; row < rows; ++row)
+		{
+			for (unsigned i = 0u; i < columnCount; ++i)
+				encodeColumn(i, *recordBatch.column(static_cast<int>(i)), row, row + 1);
+
+			writer.add(1u, messages.data());
+		}
+	}
+	else
+	{
+		messages.resize(static_cast<std::size_t>(std::min(rows, SLICE_ROWS)) * messageLength);
+
+		for (std::int64_t begin = 0; begin < rows; begin += SLICE_ROWS)
+		{
+			const auto end = std::min(rows, begin + SLICE_ROWS);
+
+			for (unsigned i = 0u; i < columnCount; ++i)
+				encodeColumn(i, *recordBatch.column(static_cast<int>(i)), begin, end);
+
+			writer.add(static_cast<unsigned>(end - begin), messages.data());
+		}
+	}
+
+	rowCount += static_cast<std::uint64_t>(rows);
+}
+
+BatchWriterReport ArrowImporter::finish()
+{
+	return writer.finish();
+}
+
+void ArrowImporter::encodeColumn(unsigned index, const arrow::Array& array, std::int64_t begin, std::int64_t end)
+{
+	const auto& layout = encoder.getDescriptorSet()->getLayout(index);
+
+	const auto forEachValue = [&](const auto& encode)
+	{
+		for (auto row = begin; row < end; ++row)
+		{
+			const auto message = &messages[static_cast<std::size_t>(row - begin) * messageLength];
+
+			if (array.IsNull(row))
+			{
+				encoder.encodeNull(message, index);
+				continue;
+			}
+
+			try
+			{
+				encode(message, row);
+			}
+			catch (const std::exception& e)
+			{
+				throw FbCppException("Row " + std::to_string(rowCount + static_cast<std::uint64_t>(row)) +
+					", column " + std::to_string(index + 1u) + ": " + e.what());
+			}
+		}
+	};
+
+	const auto forEachInteger = [&]<typename ArrayType>(const ArrayType& typed)
+	{
+		forEachValue([&](std::byte* message, std::int64_t row)
+			{ encodeInteger(encoder, message, index, static_cast<std::int64_t>(typed.Value(row))); });
+	};
+
+	switch (array.type_id())
+	{
+		case arrow::Type::NA:
+			for (auto row = begin; row < end; ++row)
+				encoder.encodeNull(&messages[static_cast<std::size_t>(row - begin) * messageLength], index);
+			break;
+
+		case arrow::Type::BOOL:
+		{
+			const auto& typed = static_cast<const arrow::BooleanArray&>(array);
+			forEachValue([&](std::byte* message, std::int64_t row)
+				{ encodeInteger(encoder, message, index, typed.Value(row) ? 1 : 0); });
+			break;
+		}
+
+		case arrow::Type::INT8:
+			forEachInteger(static_cast<const arrow::Int8Array&>(array));
+			break;
+
+		case arrow::Type::INT16:
+			forEachInteger(static_cast<const arrow::Int16Array&>(array));
+			break;
+
+		case arrow::Type::INT32:
+			forEachInteger(static_cast<const arrow::Int32Array&>(array));
+			break;
+
+		case arrow::Type::INT64:
+			forEachInteger(static_cast<const arrow::Int64Array&>(array));
+			break;
+
+		case arrow::Type::UINT8:
+			forEachInteger(static_cast<const arrow::UInt8Array&>(array));
+			break;
+
+		case arrow::Type::UINT16:
+			forEachInteger(static_cast<const arrow::UInt16Array&>(array));
+			break;
+
+		case arrow::Type::UINT32:
+			forEachInteger(static_cast<const arrow::UInt32Array&>(array));
+			break;
+
+		case arrow::Type::UINT64:
+		{
+			const auto& typed = static_cast<const arrow::UInt64Array&>(array);
+			forEachValue(
+				[&](std::byte* message, std::int64_t row)
+				{
+					const auto value = typed.Value(row);
+
+					if (value > static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()))
+						encodeAsText(encoder, message, index, value);
+					else
+						encodeInteger(encoder, message, index, static_cast<std::int64_t>(value));
+				});
+			break;
+		}
+
+		case arrow::Type::FLOAT:
+		{
+			const auto& typed = static_cast<const arrow::FloatArray&>(array);
+			forEachValue([&](std::byte* message, std::int64_t row)
+				{ encodeFloating(encoder, message, index, typed.Value(row)); });
+			break;
+		}
+
+		case arrow::Type::DOUBLE:
+		{
+			const auto& typed = static_cast<const arrow::DoubleArray&>(array);
+			forEachValue([&](std::byte* message, std::int64_t row)
+				{ encodeFloating(encoder, message, index, typed.Value(row)); });
+			break;
+		}
+
+		case arrow::Type::STRING:
+		{
+			const auto& typed = static_cast<const arrow::StringArray&>(array);
+			forEachValue([&](std::byte* message, std::int64_t row)
+				{ encoder.encodeText(message, index, typed.GetView(row)); });
+			break;
+		}
+
+		case arrow::Type::LARGE_STRING:
+		{
+			const auto& typed = static_cast<const arrow::LargeStringArray&>(array);
+			forEachValue([&](std::byte* message, std::int64_t row)
+				{ encoder.encodeText(message, index, typed.GetView(row)); });
+			break;
+		}
+
+		case arrow::Type::BINARY:
+		{
+			const auto& typed = static_cast<const arrow::BinaryArray&>(array);
+			forEachValue([&](std::byte* message, std::int64_t row)
+				{ encoder.encodeBytes(message, index, std::as_bytes(std::span{typed.GetView(row)})); });
+			break;
+		}
+
+		case arrow::Type::LARGE_BINARY:
+		{
+			const auto& typed = static_cast<const arrow::LargeBinaryArray&>(array);
+			forEachValue([&](std::byte* message, std::int64_t row)
+				{ encoder.encodeBytes(message, index, std::as_bytes(std::span{typed.GetView(row)})); });
+			break;
+		}
+
+		case arrow::Type::DECIMAL128:
+		{
+			const auto& typed = static_cast<const arrow::Decimal128Array&>(array);
+			forEachValue([&](std::byte* message, std::int64_t row)
+				{ encoder.encodeText(message, index, typed.FormatValue(row)); });
+			break;
+		}
+
+		case arrow::Type::DATE32:
+		{
+			const auto& typed = static_cast<const arrow::Date32Array&>(array);
+			forEachValue(
+				[&](std::byte* message, std::int64_t row)
+				{
+					encodeTimestamp(array, layout, message,
+						toIscTimestamp(static_cast<std::int64_t>(typed.Value(row)) * ISC_TIME_PER_DAY));
+				});
+			break;
+		}
+
+		case arrow::Type::TIMESTAMP:
+		{
+			const auto& typed = static_cast<const arrow::TimestampArray&>(array);
+			const auto unitsPerSecond =
+				getUnitsPerSecond(static_cast<const arrow::TimestampType&>(*array.type()).unit());
+			forEachValue(
+				[&](std::byte* message, std::int64_t row)
+				{
+					encodeTimestamp(
+						array, layout, message, toIscTimestamp(toIscUnits(typed.Value(row), unitsPerSecond)));
+				});
+			break;
+		}
+
+		case arrow::Type::TIME32:
+		{
+			const auto& typed = static_cast<const arrow::Time32Array&>(array);
+			const auto unitsPerSecond = getUnitsPerSecond(static_cast<const arrow::Time32Type&>(*array.type()).unit());
+			forEachValue(
+				[&](std::byte* message, std::int64_t row)
+				{
+					encodeTime(array, layout, message,
+						static_cast<ISC_TIME>(toIscUnits(typed.Value(row), unitsPerSecond)));
+				});
+			break;
+		}
+
+		case arrow::Type::TIME64:
+		{
+			const auto& typed = static_cast<const arrow::Time64Array&>(array);
+			const auto unitsPerSecond = getUnitsPerSecond(static_cast<const arrow::Time64Type&>(*array.type()).unit());
+			forEachValue(
+				[&](std::byte* message, std::int64_t row)
+				{
+					encodeTime(array, layout, message,
+						static_cast<ISC_TIME>(toIscUnits(typed.Value(row), unitsPerSecond)));
+				});
+			break;
+		}
+
+		default:
+			throw FbCppException("Unsupported Arrow type " + array.type()->ToString() + " in column " +
+				std::to_string(index + 1u));
+	}
+}
@@ -0,0 +1,109 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_ARROW_ARROW_IMPORT_H
+#define FBCPP_ARROW_ARROW_IMPORT_H
+
+#include "fb-cpp/fb-api.h"
+#include "fb-cpp/BatchWriter.h"
+#include "fb-cpp/BulkImporter.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <arrow/api.h>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	class Batch;
+
+	///
+	/// @brief Loads Arrow record batches into a Batch, column by column.
+	///
+	/// Record batch columns are matched to the batch parameters by position. Each column is converted
+	/// straight into the multi-message buffer with a tight loop per Arrow type, then all rows are passed
+	/// to a BatchWriter, which executes the batch before its buffer fills up and merges the per-row
+	/// completion states into its report.
+	///
+	/// Integers, floating point, booleans, dates, times and timestamps are converted directly; strings
+	/// go through the same text parsing as BulkImporter and binaries are copied as-is into string and
+	/// blob parameters. Other combinations (decimals or INT128 / DECFLOAT parameters) are converted
+	/// through their text representation. Arrow timestamps and times are UTC, so they are stored with
+	/// the `+00:00` zone in parameters with time zone.
+	///
+	/// Blob parameters require a batch created with `BlobPolicy::ID_ENGINE`; rows with blobs are then
+	/// added one by one, right after their blobs.
+	///
+	class ArrowImporter final
+	{
+	public:
+		///
+		/// Creates an importer over the given batch. The batch must outlive the importer.
+		///
+		explicit ArrowImporter(Batch& batch, const BatchWriterOptions& options = {});
+
+		ArrowImporter(const ArrowImporter&) = delete;
+		ArrowImporter& operator=(const ArrowImporter&) = delete;
+
+	public:
+		///
+		/// Converts and queues all rows of `recordBatch`.
+		///
+		/// Throws FbCppException when the columns do not match the parameters or a value cannot be
+		/// converted, naming the row and column.
+		///
+		void add(const arrow::RecordBatch& recordBatch);
+
+		///
+		/// Returns the number of rows added so far.
+		///
+		std::uint64_t getRowCount() const noexcept
+		{
+			return rowCount;
+		}
+
+		///
+		/// Executes the queued rows and returns the merged report, indexed by row number.
+		///
+		BatchWriterReport finish();
+
+	private:
+		void encodeColumn(unsigned index, const arrow::Array& array, std::int64_t begin, std::int64_t end);
+
+	private:
+		Batch& batch;
+		BatchWriter writer;
+		impl::FieldEncoder encoder;
+		unsigned messageLength = 0u;
+		std::vector<std::byte> messages;
+		std::uint64_t rowCount = 0u;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_ARROW_ARROW_IMPORT_H
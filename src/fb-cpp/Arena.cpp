@@ -0,0 +1,63 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Arena.h"
+#include <cassert>
+#include <cstdint>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+void* Arena::allocate(std::size_t size, std::size_t alignment)
+{
+	assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+	while (currentBlock < blocks.size())
+	{
+		auto& block = blocks[currentBlock];
+		const auto base = reinterpret_cast<std::uintptr_t>(block.data.get());
+		const auto start = ((base + offset + alignment - 1) & ~(alignment - 1)) - base;
+
+		if (start + size <= block.size)
+		{
+			offset = start + size;
+			used += size;
+			return block.data.get() + start;
+		}
+
+		++currentBlock;
+		offset = 0;
+	}
+
+	// Blocks are kept by reset(), so this only happens until the arena is warmed up.
+	const auto newSize = std::max(blockSize, size + alignment - 1);
+	blocks.push_back(Block{.data = std::make_unique_for_overwrite<std::byte[]>(newSize), .size = newSize});
+	currentBlock = blocks.size() - 1;
+	offset = 0;
+
+	return allocate(size, alignment);
+}
@@ -0,0 +1,186 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_ARENA_H
+#define FBCPP_ARENA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// @brief Monotonic memory arena for temporary conversion results.
+	///
+	/// Memory is carved out of blocks that are kept across `reset()` calls, so once warmed up an arena
+	/// serves its allocations without touching the heap. Views returned by arena-backed accessors, such as
+	/// `Row::getString(unsigned, Arena&)`, are valid until the arena is reset or destroyed.
+	///
+	/// An arena must be used by one thread at a time.
+	///
+	class Arena final
+	{
+	public:
+		///
+		/// Default size of the blocks allocated by an arena.
+		///
+		static constexpr std::size_t DEFAULT_BLOCK_SIZE = 4096;
+
+		///
+		/// Creates an empty arena allocating blocks of `blockSize` bytes, or larger when needed.
+		///
+		explicit Arena(std::size_t blockSize = DEFAULT_BLOCK_SIZE) noexcept
+			: blockSize{std::max<std::size_t>(blockSize, 1u)}
+		{
+		}
+
+		Arena(Arena&&) noexcept = default;
+		Arena& operator=(Arena&&) noexcept = default;
+
+		Arena(const Arena&) = delete;
+		Arena& operator=(const Arena&) = delete;
+
+	public:
+		///
+		/// Allocates `size` bytes aligned to `alignment`, which must be a power of two.
+		///
+		void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+		///
+		/// Copies `value` into the arena and returns a view of the copy.
+		///
+		std::string_view store(std::string_view value)
+		{
+			if (value.empty())
+				return {};
+
+			const auto data = static_cast<char*>(allocate(value.size(), 1u));
+			std::copy(value.begin(), value.end(), data);
+
+			return {data, value.size()};
+		}
+
+		///
+		/// Returns an emptied string used to format values before they are stored. Its capacity is kept
+		/// between calls.
+		///
+		std::string& getScratch() noexcept
+		{
+			scratch.clear();
+			return scratch;
+		}
+
+		///
+		/// Makes all the memory of the arena available again, invalidating the views it returned.
+		///
+		void reset() noexcept
+		{
+			currentBlock = 0;
+			offset = 0;
+			used = 0;
+		}
+
+		///
+		/// Returns the number of bytes allocated since the last reset.
+		///
+		std::size_t getUsed() const noexcept
+		{
+			return used;
+		}
+
+		///
+		/// Returns the total size of the blocks owned by the arena.
+		///
+		std::size_t getCapacity() const noexcept
+		{
+			std::size_t capacity = 0;
+
+			for (const auto& block : blocks)
+				capacity += block.size;
+
+			return capacity;
+		}
+
+	private:
+		struct Block final
+		{
+			std::unique_ptr<std::byte[]> data;
+			std::size_t size;
+		};
+
+	private:
+		std::size_t blockSize;
+		std::vector<Block> blocks;
+		std::size_t currentBlock = 0;
+		std::size_t offset = 0;
+		std::size_t used = 0;
+		std::string scratch;
+	};
+}  // namespace fbcpp
+
+namespace fbcpp::impl
+{
+	///
+	/// Null-terminated copy of a string view for C APIs, kept on the stack for short values.
+	///
+	class CString final
+	{
+	public:
+		explicit CString(std::string_view value)
+		{
+			if (value.size() < sizeof(buffer))
+			{
+				std::copy(value.begin(), value.end(), buffer);
+				buffer[value.size()] = '\0';
+			}
+			else
+				heap.assign(value);
+		}
+
+		CString(const CString&) = delete;
+		CString& operator=(const CString&) = delete;
+
+	public:
+		const char* get() const noexcept
+		{
+			return heap.empty() ? buffer : heap.c_str();
+		}
+
+	private:
+		char buffer[128];
+		std::string heap;
+	};
+}  // namespace fbcpp::impl
+
+
+#endif  // FBCPP_ARENA_H
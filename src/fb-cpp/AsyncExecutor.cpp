@@ -0,0 +1,196 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "AsyncExecutor.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace fbcpp;
+
+
+namespace
+{
+	struct Job final
+	{
+		const void* key;
+		std::function<void()> work;
+	};
+}  // namespace
+
+
+struct AsyncExecutor::Core final
+{
+	void workerLoop();
+
+	AsyncResumer resumer;
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::deque<Job> ready;
+	// Keys with a job in the ready queue or running, and their jobs waiting for it.
+	std::unordered_map<const void*, std::deque<std::function<void()>>> strands;
+	bool stopping = false;
+	std::vector<std::thread> threads;
+};
+
+
+void AsyncExecutor::Core::workerLoop()
+{
+	std::unique_lock lock{mutex};
+
+	while (true)
+	{
+		condition.wait(lock, [this] { return !ready.empty() || (stopping && strands.empty()); });
+
+		if (ready.empty())
+			return;
+
+		auto job = std::move(ready.front());
+		ready.pop_front();
+
+		lock.unlock();
+
+		try
+		{
+			job.work();
+		}
+		catch (...)
+		{
+			// swallow
+		}
+
+		job.work = nullptr;
+
+		lock.lock();
+
+		if (job.key)
+		{
+			const auto strand = strands.find(job.key);
+			auto& waiting = strand->second;
+
+			if (waiting.empty())
+			{
+				strands.erase(strand);
+
+				if (stopping && strands.empty())
+					condition.notify_all();
+			}
+			else
+			{
+				// Queued at the back, so a busy key does not starve the others.
+				ready.push_back({job.key, std::move(waiting.front())});
+				waiting.pop_front();
+				condition.notify_one();
+			}
+		}
+	}
+}
+
+
+AsyncExecutor::AsyncExecutor(const AsyncExecutorOptions& options)
+	: core{std::make_unique<Core>()}
+{
+	core->resumer = options.getResumer();
+
+	auto threadCount = options.getThreadCount();
+
+	if (threadCount == 0)
+		threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+	core->threads.reserve(threadCount);
+
+	try
+	{
+		for (unsigned i = 0; i < threadCount; ++i)
+			core->threads.emplace_back([this] { core->workerLoop(); });
+	}
+	catch (...)
+	{
+		{  // scope
+			std::lock_guard lock{core->mutex};
+			core->stopping = true;
+		}
+
+		core->condition.notify_all();
+
+		for (auto& thread : core->threads)
+			thread.join();
+
+		throw;
+	}
+}
+
+AsyncExecutor::~AsyncExecutor() noexcept
+{
+	{  // scope
+		std::lock_guard lock{core->mutex};
+		core->stopping = true;
+	}
+
+	core->condition.notify_all();
+
+	for (auto& thread : core->threads)
+		thread.join();
+}
+
+unsigned AsyncExecutor::getThreadCount() const noexcept
+{
+	return static_cast<unsigned>(core->threads.size());
+}
+
+void AsyncExecutor::post(const void* key, std::function<void()> work)
+{
+	{  // scope
+		std::lock_guard lock{core->mutex};
+
+		if (key)
+		{
+			const auto [strand, inserted] = core->strands.try_emplace(key);
+
+			if (!inserted)
+			{
+				strand->second.push_back(std::move(work));
+				return;
+			}
+		}
+
+		core->ready.push_back({key, std::move(work)});
+	}
+
+	core->condition.notify_one();
+}
+
+void AsyncExecutor::resume(std::coroutine_handle<> handle)
+{
+	if (core->resumer)
+		core->resumer(handle);
+	else
+		handle.resume();
+}
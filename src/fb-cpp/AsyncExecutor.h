@@ -0,0 +1,252 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef FBCPP_ASYNC_EXECUTOR_H
+#define FBCPP_ASYNC_EXECUTOR_H
+
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// Function used to resume a coroutine after its asynchronous operation completed.
+	///
+	/// It may, for example, post the handle to the event loop where the coroutine was started
+	/// (`asio::post(ioContext, handle)`). When not set, the coroutine is resumed by the I/O thread.
+	///
+	using AsyncResumer = std::function<void(std::coroutine_handle<> handle)>;
+
+	///
+	/// Represents options used to create an AsyncExecutor object.
+	///
+	class AsyncExecutorOptions final
+	{
+	public:
+		///
+		/// Returns the number of I/O threads.
+		///
+		unsigned getThreadCount() const
+		{
+			return threadCount;
+		}
+
+		///
+		/// Sets the number of I/O threads.
+		///
+		/// Zero means the number of hardware threads.
+		///
+		AsyncExecutorOptions& setThreadCount(unsigned value)
+		{
+			threadCount = value;
+			return *this;
+		}
+
+		///
+		/// Returns the function used to resume coroutines.
+		///
+		const AsyncResumer& getResumer() const
+		{
+			return resumer;
+		}
+
+		///
+		/// Sets the function used to resume coroutines.
+		///
+		AsyncExecutorOptions& setResumer(AsyncResumer value)
+		{
+			resumer = std::move(value);
+			return *this;
+		}
+
+	private:
+		unsigned threadCount = 4;
+		AsyncResumer resumer;
+	};
+
+	template <typename T>
+	class AsyncOperation;
+
+	///
+	/// @brief Runs blocking fbclient calls on a dedicated, fixed-size pool of I/O threads.
+	///
+	/// Work items are posted with a serialization key, usually the Attachment they use. Items with the
+	/// same key run one at a time, in the order they were posted, while items with different keys run
+	/// concurrently. So a few event loop threads may drive many concurrent queries, each attachment
+	/// using at most one I/O thread at a time.
+	///
+	/// The destructor runs the work items already posted before joining the I/O threads.
+	///
+	class AsyncExecutor final
+	{
+	public:
+		///
+		/// Starts the I/O threads.
+		///
+		explicit AsyncExecutor(const AsyncExecutorOptions& options = {});
+
+		///
+		/// Runs the pending work items and joins the I/O threads.
+		///
+		~AsyncExecutor() noexcept;
+
+		AsyncExecutor(const AsyncExecutor&) = delete;
+		AsyncExecutor& operator=(const AsyncExecutor&) = delete;
+
+		AsyncExecutor(AsyncExecutor&&) = delete;
+		AsyncExecutor& operator=(AsyncExecutor&&) = delete;
+
+	public:
+		///
+		/// Returns the number of I/O threads.
+		///
+		unsigned getThreadCount() const noexcept;
+
+		///
+		/// Posts a work item to run on an I/O thread after the items previously posted with
+		/// the same key.
+		///
+		/// A null key does not serialize the item with any other.
+		///
+		void post(const void* key, std::function<void()> work);
+
+		///
+		/// Resumes a coroutine using the configured AsyncResumer, or directly when there is none.
+		///
+		void resume(std::coroutine_handle<> handle);
+
+		///
+		/// Returns an awaitable that runs the specified function on an I/O thread, serialized by the key.
+		///
+		template <typename F>
+		auto run(const void* key, F&& function) -> AsyncOperation<std::invoke_result_t<std::decay_t<F>&>>
+		{
+			return AsyncOperation<std::invoke_result_t<std::decay_t<F>&>>{*this, key, std::forward<F>(function)};
+		}
+
+	private:
+		struct Core;
+		std::unique_ptr<Core> core;
+	};
+
+	///
+	/// @brief Awaitable that runs a blocking operation on an AsyncExecutor.
+	///
+	/// `co_await` suspends the calling coroutine, runs the operation on an I/O thread and resumes the
+	/// coroutine through the executor's AsyncResumer, returning the operation result or rethrowing
+	/// its exception. The objects used by the operation must remain valid until it completes.
+	///
+	template <typename T>
+	class [[nodiscard]] AsyncOperation final
+	{
+	public:
+		///
+		/// Constructs the operation. It does not start until awaited.
+		///
+		AsyncOperation(AsyncExecutor& executor, const void* key, std::function<T()> work)
+			: executor{&executor},
+			  key{key},
+			  work{std::move(work)}
+		{
+		}
+
+		AsyncOperation(AsyncOperation&&) noexcept = default;
+		AsyncOperation& operator=(AsyncOperation&&) noexcept = default;
+
+		AsyncOperation(const AsyncOperation&) = delete;
+		AsyncOperation& operator=(const AsyncOperation&) = delete;
+
+	public:
+		///
+		/// The operation always runs on an I/O thread.
+		///
+		bool await_ready() const noexcept
+		{
+			return false;
+		}
+
+		///
+		/// Posts the operation to the executor.
+		///
+		void await_suspend(std::coroutine_handle<> handle)
+		{
+			executor->post(key,
+				[this, handle]
+				{
+					try
+					{
+						if constexpr (std::is_void_v<T>)
+						{
+							work();
+							result.emplace();
+						}
+						else
+							result.emplace(work());
+					}
+					catch (...)
+					{
+						exception = std::current_exception();
+					}
+
+					executor->resume(handle);
+				});
+		}
+
+		///
+		/// Returns the operation result or rethrows its exception.
+		///
+		T await_resume()
+		{
+			if (exception)
+				std::rethrow_exception(exception);
+
+			if constexpr (!std::is_void_v<T>)
+				return std::move(*result);
+		}
+
+	private:
+		using Result = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+		AsyncExecutor* executor;
+		const void* key;
+		std::function<T()> work;
+		std::optional<Result> result;
+		std::exception_ptr exception;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_ASYNC_EXECUTOR_H
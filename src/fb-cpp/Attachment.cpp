@@ -30,13 +30,9 @@ using namespace fbcpp;
 using namespace fbcpp::impl;
 
 
-Attachment::Attachment(Client& client, const std::string& uri, const AttachmentOptions& options)
-	: client{&client}
+static FbUniquePtr<fb::IXpbBuilder> buildDpb(
+	Client& client, StatusWrapper& statusWrapper, const AttachmentOptions& options)
 {
-	const auto master = client.getMaster();
-
-	StatusWrapper statusWrapper{client};
-
 	auto dpbBuilder = fbUnique(client.getUtil()->getXpbBuilder(&statusWrapper, fb::IXpbBuilder::DPB,
 		reinterpret_cast<const std::uint8_t*>(options.getDpb().data()),
 		static_cast<unsigned>(options.getDpb().size())));
@@ -59,6 +55,31 @@ Attachment::Attachment(Client& client, const std::string& uri, const AttachmentO
 	if (const auto forcedWrites = options.getForcedWrites())
 		dpbBuilder->insertInt(&statusWrapper, isc_dpb_force_write, *forcedWrites ? 1 : 0);
 
+	return dpbBuilder;
+}
+
+
+ParameterBlock AttachmentOptions::compile(Client& client) const
+{
+	StatusWrapper statusWrapper{client};
+
+	const auto dpbBuilder = buildDpb(client, statusWrapper, *this);
+	const auto dpbBuffer = dpbBuilder->getBuffer(&statusWrapper);
+	const auto dpbBufferLen = dpbBuilder->getBufferLength(&statusWrapper);
+
+	return ParameterBlock{ParameterBlockType::DPB, {dpbBuffer, dpbBuffer + dpbBufferLen}};
+}
+
+
+Attachment::Attachment(Client& client, const std::string& uri, const AttachmentOptions& options)
+	: client{&client}
+{
+	const auto master = client.getMaster();
+
+	StatusWrapper statusWrapper{client};
+
+	const auto dpbBuilder = buildDpb(client, statusWrapper, options);
+
 	auto dispatcher = fbRef(master->getDispatcher());
 	const auto dpbBuffer = dpbBuilder->getBuffer(&statusWrapper);
 	const auto dpbBufferLen = dpbBuilder->getBufferLength(&statusWrapper);
@@ -69,6 +90,22 @@ Attachment::Attachment(Client& client, const std::string& uri, const AttachmentO
 		handle.reset(dispatcher->attachDatabase(&statusWrapper, uri.c_str(), dpbBufferLen, dpbBuffer));
 }
 
+Attachment::Attachment(
+	Client& client, const std::string& uri, const AttachmentOptions& options, const ParameterBlock& dpb)
+	: client{&client}
+{
+	dpb.checkType(ParameterBlockType::DPB);
+
+	StatusWrapper statusWrapper{client};
+
+	auto dispatcher = fbRef(client.getMaster()->getDispatcher());
+
+	if (options.getCreateDatabase())
+		handle.reset(dispatcher->createDatabase(&statusWrapper, uri.c_str(), dpb.getLength(), dpb.getData()));
+	else
+		handle.reset(dispatcher->attachDatabase(&statusWrapper, uri.c_str(), dpb.getLength(), dpb.getData()));
+}
+
 void Attachment::disconnectOrDrop(bool drop)
 {
 	assert(isValid());
@@ -84,6 +121,18 @@ void Attachment::disconnectOrDrop(bool drop)
 }
 
 
+const std::shared_ptr<OperationObserver>& Attachment::getObserver() const noexcept
+{
+	return observer ? observer : client->getObserver();
+}
+
+PerformanceCounters Attachment::getPerformanceCounters()
+{
+	assert(isValid());
+
+	return queryPerformanceCounters(*client, handle.get());
+}
+
 void Attachment::disconnect()
 {
 	disconnectOrDrop(false);
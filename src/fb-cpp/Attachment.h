@@ -27,6 +27,10 @@
 
 #include "fb-api.h"
 #include "SmartPtrs.h"
+#include "Observer.h"
+#include "ParameterBlock.h"
+#include "PerformanceCounters.h"
+#include "SlowQueryLog.h"
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -47,6 +51,12 @@ namespace fbcpp
 	///
 	class AttachmentOptions final
 	{
+	public:
+		///
+		/// Returns whether both options objects are equal, field by field.
+		///
+		bool operator==(const AttachmentOptions& o) const = default;
+
 	public:
 		///
 		/// Returns the character set which will be used for the connection.
@@ -193,6 +203,12 @@ namespace fbcpp
 			return *this;
 		}
 
+		///
+		/// Encodes these options in a DPB that can be passed to the Attachment constructor together with
+		/// these options, so that attaching with the same options does not build the DPB again.
+		///
+		ParameterBlock compile(Client& client) const;
+
 	private:
 		std::optional<std::string> connectionCharSet;
 		std::optional<std::string> userName;
@@ -209,6 +225,10 @@ namespace fbcpp
 	/// The Attachment must exist and remain valid while there are other objects using it, such as Transaction and
 	/// Statement.
 	///
+	/// Any number of threads may concurrently create and use Transaction, Statement and Blob objects of the same
+	/// Attachment; fbclient serializes the calls that reach the connection. Disconnecting, dropping or moving the
+	/// Attachment must not race with any other use of it.
+	///
 	class Attachment final
 	{
 	public:
@@ -218,13 +238,22 @@ namespace fbcpp
 		///
 		explicit Attachment(Client& client, const std::string& uri, const AttachmentOptions& options = {});
 
+		///
+		/// Constructs an Attachment object that connects to (or creates) the database specified by the URI
+		/// using a DPB returned by `options.compile()`. Only the createDatabase flag is taken from the options.
+		///
+		explicit Attachment(
+			Client& client, const std::string& uri, const AttachmentOptions& options, const ParameterBlock& dpb);
+
 		///
 		/// Move constructor.
 		/// A moved Attachment object becomes invalid.
 		///
 		Attachment(Attachment&& o) noexcept
 			: client{o.client},
-			  handle{std::move(o.handle)}
+			  handle{std::move(o.handle)},
+			  observer{std::move(o.observer)},
+			  slowQueryLog{std::move(o.slowQueryLog)}
 		{
 		}
 
@@ -240,6 +269,8 @@ namespace fbcpp
 			{
 				client = o.client;
 				handle = std::move(o.handle);
+				observer = std::move(o.observer);
+				slowQueryLog = std::move(o.slowQueryLog);
 			}
 
 			return *this;
@@ -291,6 +322,44 @@ namespace fbcpp
 			return handle;
 		}
 
+		///
+		/// Returns the observer notified of the operations of objects created with this Attachment:
+		/// its own observer if set, otherwise the Client observer.
+		///
+		const std::shared_ptr<OperationObserver>& getObserver() const noexcept;
+
+		///
+		/// Sets (or clears, with nullptr) the observer notified of the operations of objects created
+		/// afterwards with this Attachment, overriding the Client observer.
+		///
+		void setObserver(std::shared_ptr<OperationObserver> value) noexcept
+		{
+			observer = std::move(value);
+		}
+
+		///
+		/// Returns the slow-query log captured by the statements prepared with this Attachment, if any.
+		///
+		const std::shared_ptr<SlowQueryLog>& getSlowQueryLog() const noexcept
+		{
+			return slowQueryLog;
+		}
+
+		///
+		/// Sets (or clears, with nullptr) the slow-query log captured by the statements prepared afterwards
+		/// with this Attachment.
+		///
+		void setSlowQueryLog(std::shared_ptr<SlowQueryLog> value) noexcept
+		{
+			slowQueryLog = std::move(value);
+		}
+
+		///
+		/// Returns the cumulative page I/O, memory and per-table record counters of this attachment.
+		/// Subtract two snapshots, or use PerformanceSnapshot, to measure a piece of work.
+		///
+		PerformanceCounters getPerformanceCounters();
+
 		///
 		/// Disconnects from the database.
 		///
@@ -307,6 +376,8 @@ namespace fbcpp
 	private:
 		Client* client;
 		FbRef<fb::IAttachment> handle;
+		std::shared_ptr<OperationObserver> observer;
+		std::shared_ptr<SlowQueryLog> slowQueryLog;
 	};
 }  // namespace fbcpp
 
@@ -0,0 +1,302 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "AttachmentPool.h"
+#include "Client.h"
+#include "Exception.h"
+#include <stdexcept>
+#include <utility>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+void AttachmentLease::release() noexcept
+{
+	if (!attachment)
+		return;
+
+	pool->giveBack(partitionIndex, std::move(attachment), true);
+	pool = nullptr;
+}
+
+void AttachmentLease::discard() noexcept
+{
+	if (!attachment)
+		return;
+
+	pool->giveBack(partitionIndex, std::move(attachment), false);
+	pool = nullptr;
+}
+
+
+AttachmentPool::AttachmentPool(Client& client, const AttachmentPoolOptions& options)
+	: client{&client},
+	  options{options}
+{
+	if (options.getMaxSize() == 0u)
+		throw std::invalid_argument{"AttachmentPool maximum size must be greater than zero"};
+
+	if (options.getMinSize() > options.getMaxSize())
+		throw std::invalid_argument{"AttachmentPool minimum size must not exceed the maximum size"};
+}
+
+AttachmentLease AttachmentPool::acquire(const std::string& uri, const AttachmentOptions& attachmentOptions)
+{
+	if (attachmentOptions.getCreateDatabase())
+		throw std::invalid_argument{"AttachmentPool cannot be used with AttachmentOptions::setCreateDatabase"};
+
+	const auto deadline = ClockType::now() + options.getAcquireTimeout();
+
+	while (true)
+	{
+		std::vector<std::unique_ptr<Attachment>> expired;
+		std::unique_ptr<Attachment> attachment;
+		std::size_t partitionIndex;
+		bool created = false;
+
+		{  // scope
+			std::unique_lock lock{mutex};
+
+			partitionIndex = findPartition(uri, attachmentOptions);
+
+			while (true)
+			{
+				auto& partition = partitions[partitionIndex];
+
+				collectExpired(partition, ClockType::now(), expired);
+
+				if (!partition.idle.empty())
+				{
+					attachment = std::move(partition.idle.back().attachment);
+					partition.idle.pop_back();
+					++partition.leased;
+					break;
+				}
+
+				if (partition.leased < options.getMaxSize())
+				{
+					++partition.leased;
+					created = true;
+					break;
+				}
+
+				if (available.wait_until(lock, deadline) == std::cv_status::timeout &&
+					partitions[partitionIndex].idle.empty() &&
+					partitions[partitionIndex].leased >= options.getMaxSize())
+				{
+					throw FbCppException("Timed out waiting for an attachment from the AttachmentPool");
+				}
+			}
+		}
+
+		// Expired attachments are disconnected here, outside the lock.
+		expired.clear();
+
+		if (created)
+		{
+			try
+			{
+				attachment = std::make_unique<Attachment>(*client, uri, attachmentOptions);
+			}
+			catch (...)
+			{
+				giveBack(partitionIndex, nullptr, false);
+				throw;
+			}
+		}
+		else if (options.getValidateOnAcquire() && !ping(*attachment))
+		{
+			giveBack(partitionIndex, std::move(attachment), false);
+			continue;
+		}
+
+		return AttachmentLease{*this, partitionIndex, std::move(attachment)};
+	}
+}
+
+void AttachmentPool::prewarm(const std::string& uri, const AttachmentOptions& attachmentOptions)
+{
+	if (attachmentOptions.getCreateDatabase())
+		throw std::invalid_argument{"AttachmentPool cannot be used with AttachmentOptions::setCreateDatabase"};
+
+	while (true)
+	{
+		std::size_t partitionIndex;
+
+		{  // scope
+			std::lock_guard lock{mutex};
+
+			partitionIndex = findPartition(uri, attachmentOptions);
+			auto& partition = partitions[partitionIndex];
+
+			if (partition.idle.size() + partition.leased >= options.getMinSize())
+				return;
+
+			// Account the new attachment as leased while it's being created, so concurrent acquires see it.
+			++partition.leased;
+		}
+
+		std::unique_ptr<Attachment> attachment;
+
+		try
+		{
+			attachment = std::make_unique<Attachment>(*client, uri, attachmentOptions);
+		}
+		catch (...)
+		{
+			giveBack(partitionIndex, nullptr, false);
+			throw;
+		}
+
+		giveBack(partitionIndex, std::move(attachment), true);
+	}
+}
+
+std::size_t AttachmentPool::evictIdle()
+{
+	std::vector<std::unique_ptr<Attachment>> expired;
+
+	{  // scope
+		std::lock_guard lock{mutex};
+
+		const auto now = ClockType::now();
+
+		for (auto& partition : partitions)
+			collectExpired(partition, now, expired);
+	}
+
+	return expired.size();
+}
+
+void AttachmentPool::clear()
+{
+	std::vector<std::unique_ptr<Attachment>> idle;
+
+	{  // scope
+		std::lock_guard lock{mutex};
+
+		for (auto& partition : partitions)
+		{
+			for (auto& entry : partition.idle)
+				idle.push_back(std::move(entry.attachment));
+
+			partition.idle.clear();
+		}
+	}
+}
+
+std::size_t AttachmentPool::getIdleCount()
+{
+	std::lock_guard lock{mutex};
+
+	std::size_t count = 0u;
+
+	for (const auto& partition : partitions)
+		count += partition.idle.size();
+
+	return count;
+}
+
+std::size_t AttachmentPool::getLeasedCount()
+{
+	std::lock_guard lock{mutex};
+
+	std::size_t count = 0u;
+
+	for (const auto& partition : partitions)
+		count += partition.leased;
+
+	return count;
+}
+
+std::size_t AttachmentPool::findPartition(const std::string& uri, const AttachmentOptions& attachmentOptions)
+{
+	for (std::size_t index = 0u; index < partitions.size(); ++index)
+	{
+		const auto& partition = partitions[index];
+
+		if (partition.uri == uri && partition.attachmentOptions == attachmentOptions)
+			return index;
+	}
+
+	auto& partition = partitions.emplace_back();
+	partition.uri = uri;
+	partition.attachmentOptions = attachmentOptions;
+
+	return partitions.size() - 1u;
+}
+
+void AttachmentPool::collectExpired(
+	Partition& partition, ClockType::time_point now, std::vector<std::unique_ptr<Attachment>>& expired)
+{
+	// Idle attachments are pushed at the back, so the front holds the least recently used ones.
+	while (!partition.idle.empty() && partition.idle.size() + partition.leased > options.getMinSize() &&
+		now - partition.idle.front().lastUsed >= options.getIdleTimeout())
+	{
+		expired.push_back(std::move(partition.idle.front().attachment));
+		partition.idle.pop_front();
+	}
+}
+
+bool AttachmentPool::ping(Attachment& attachment)
+{
+	try
+	{
+		StatusWrapper statusWrapper{*client};
+		attachment.getHandle()->ping(&statusWrapper);
+		return true;
+	}
+	catch (const DatabaseException&)
+	{
+		return false;
+	}
+}
+
+void AttachmentPool::giveBack(std::size_t partitionIndex, std::unique_ptr<Attachment> attachment, bool reuse) noexcept
+{
+	std::unique_ptr<Attachment> disposed;
+
+	{  // scope
+		std::lock_guard lock{mutex};
+
+		auto& partition = partitions[partitionIndex];
+
+		assert(partition.leased > 0u);
+		--partition.leased;
+
+		if (attachment && reuse && attachment->isValid())
+		{
+			partition.idle.push_back(IdleAttachment{
+				.attachment = std::move(attachment),
+				.lastUsed = ClockType::now(),
+			});
+		}
+		else
+			disposed = std::move(attachment);
+	}
+
+	available.notify_all();
+}
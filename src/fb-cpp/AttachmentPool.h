@@ -0,0 +1,385 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_ATTACHMENT_POOL_H
+#define FBCPP_ATTACHMENT_POOL_H
+
+#include "Attachment.h"
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	class AttachmentPool;
+	class Client;
+
+	///
+	/// Represents options used when creating an AttachmentPool object.
+	///
+	class AttachmentPoolOptions final
+	{
+	public:
+		///
+		/// Returns the minimum number of attachments kept per pool key.
+		/// Idle eviction never reduces a key below this number.
+		///
+		unsigned getMinSize() const
+		{
+			return minSize;
+		}
+
+		///
+		/// Sets the minimum number of attachments kept per pool key.
+		///
+		AttachmentPoolOptions& setMinSize(unsigned value)
+		{
+			minSize = value;
+			return *this;
+		}
+
+		///
+		/// Returns the maximum number of attachments (idle plus leased) per pool key.
+		///
+		unsigned getMaxSize() const
+		{
+			return maxSize;
+		}
+
+		///
+		/// Sets the maximum number of attachments (idle plus leased) per pool key.
+		///
+		AttachmentPoolOptions& setMaxSize(unsigned value)
+		{
+			maxSize = value;
+			return *this;
+		}
+
+		///
+		/// Returns how long an attachment may stay idle before it becomes eligible for eviction.
+		///
+		std::chrono::milliseconds getIdleTimeout() const
+		{
+			return idleTimeout;
+		}
+
+		///
+		/// Sets how long an attachment may stay idle before it becomes eligible for eviction.
+		///
+		AttachmentPoolOptions& setIdleTimeout(std::chrono::milliseconds value)
+		{
+			idleTimeout = value;
+			return *this;
+		}
+
+		///
+		/// Returns how long acquire() waits for an attachment when the key is at its maximum size.
+		///
+		std::chrono::milliseconds getAcquireTimeout() const
+		{
+			return acquireTimeout;
+		}
+
+		///
+		/// Sets how long acquire() waits for an attachment when the key is at its maximum size.
+		///
+		AttachmentPoolOptions& setAcquireTimeout(std::chrono::milliseconds value)
+		{
+			acquireTimeout = value;
+			return *this;
+		}
+
+		///
+		/// Returns whether idle attachments are pinged before being handed out.
+		///
+		bool getValidateOnAcquire() const
+		{
+			return validateOnAcquire;
+		}
+
+		///
+		/// Sets whether idle attachments are pinged before being handed out.
+		///
+		AttachmentPoolOptions& setValidateOnAcquire(bool value)
+		{
+			validateOnAcquire = value;
+			return *this;
+		}
+
+	private:
+		unsigned minSize = 0u;
+		unsigned maxSize = 8u;
+		std::chrono::milliseconds idleTimeout{std::chrono::minutes{5}};
+		std::chrono::milliseconds acquireTimeout{std::chrono::seconds{30}};
+		bool validateOnAcquire = true;
+	};
+
+	///
+	/// RAII handle to an Attachment borrowed from an AttachmentPool.
+	/// The attachment is returned to the pool when the lease is destroyed or released.
+	/// The AttachmentPool must outlive all of its leases.
+	///
+	class AttachmentLease final
+	{
+	public:
+		///
+		/// Constructs an empty lease.
+		///
+		AttachmentLease() noexcept = default;
+
+		///
+		/// Move constructor.
+		/// A moved AttachmentLease object becomes empty.
+		///
+		AttachmentLease(AttachmentLease&& o) noexcept
+			: pool{o.pool},
+			  partitionIndex{o.partitionIndex},
+			  attachment{std::move(o.attachment)}
+		{
+			o.pool = nullptr;
+		}
+
+		///
+		/// Returns the current attachment (if any) to its pool and takes ownership of the other lease.
+		///
+		AttachmentLease& operator=(AttachmentLease&& o) noexcept
+		{
+			if (this != &o)
+			{
+				release();
+
+				pool = o.pool;
+				partitionIndex = o.partitionIndex;
+				attachment = std::move(o.attachment);
+				o.pool = nullptr;
+			}
+
+			return *this;
+		}
+
+		AttachmentLease(const AttachmentLease&) = delete;
+		AttachmentLease& operator=(const AttachmentLease&) = delete;
+
+		///
+		/// Returns the attachment to its pool.
+		///
+		~AttachmentLease() noexcept
+		{
+			release();
+		}
+
+	public:
+		///
+		/// Returns whether the lease holds an attachment.
+		///
+		bool isValid() const noexcept
+		{
+			return attachment != nullptr;
+		}
+
+		///
+		/// Returns the leased Attachment.
+		///
+		Attachment& get() noexcept
+		{
+			assert(isValid());
+			return *attachment;
+		}
+
+		///
+		/// Returns the leased Attachment.
+		///
+		Attachment& operator*() noexcept
+		{
+			return get();
+		}
+
+		///
+		/// Returns the leased Attachment.
+		///
+		Attachment* operator->() noexcept
+		{
+			return &get();
+		}
+
+		///
+		/// Returns the attachment to its pool, making the lease empty.
+		///
+		void release() noexcept;
+
+		///
+		/// Disconnects the attachment instead of returning it to the pool, making the lease empty.
+		/// Use it when the attachment state is known to be broken or must not be shared.
+		///
+		void discard() noexcept;
+
+	private:
+		AttachmentLease(AttachmentPool& pool, std::size_t partitionIndex, std::unique_ptr<Attachment> attachment)
+			: pool{&pool},
+			  partitionIndex{partitionIndex},
+			  attachment{std::move(attachment)}
+		{
+		}
+
+	private:
+		AttachmentPool* pool = nullptr;
+		std::size_t partitionIndex = 0u;
+		std::unique_ptr<Attachment> attachment;
+
+		friend class AttachmentPool;
+	};
+
+	///
+	/// Thread-safe pool of warm Attachment objects, keyed by URI plus AttachmentOptions.
+	/// Each distinct key has its own idle list and its own min/max bounds.
+	/// Attachments are handed out through AttachmentLease objects.
+	///
+	class AttachmentPool final
+	{
+	public:
+		///
+		/// Constructs an empty AttachmentPool using the specified Client object and options.
+		///
+		explicit AttachmentPool(Client& client, const AttachmentPoolOptions& options = {});
+
+		AttachmentPool(AttachmentPool&&) = delete;
+		AttachmentPool& operator=(AttachmentPool&&) = delete;
+		AttachmentPool(const AttachmentPool&) = delete;
+		AttachmentPool& operator=(const AttachmentPool&) = delete;
+
+		///
+		/// Disconnects all idle attachments.
+		/// All leases must have been released before the pool is destroyed.
+		///
+		~AttachmentPool() noexcept
+		{
+			try
+			{
+				clear();
+			}
+			catch (...)
+			{
+				// swallow
+			}
+		}
+
+	public:
+		///
+		/// Returns the Client object reference used to create this AttachmentPool object.
+		///
+		Client& getClient() noexcept
+		{
+			return *client;
+		}
+
+		///
+		/// Returns the options used to create this AttachmentPool object.
+		///
+		const AttachmentPoolOptions& getOptions() const noexcept
+		{
+			return options;
+		}
+
+		///
+		/// Leases an attachment for the specified URI and options.
+		/// The most recently used idle attachment is reused (after a ping, if enabled); otherwise a new one is
+		/// created while the key is below its maximum size; otherwise the call waits up to the acquire timeout.
+		///
+		AttachmentLease acquire(const std::string& uri, const AttachmentOptions& attachmentOptions = {});
+
+		///
+		/// Creates idle attachments for the specified key until it reaches the minimum size.
+		///
+		void prewarm(const std::string& uri, const AttachmentOptions& attachmentOptions = {});
+
+		///
+		/// Disconnects idle attachments that exceeded the idle timeout, keeping each key at its minimum size.
+		/// Returns the number of disconnected attachments.
+		/// This is also done opportunistically by acquire().
+		///
+		std::size_t evictIdle();
+
+		///
+		/// Disconnects all idle attachments.
+		///
+		void clear();
+
+		///
+		/// Returns the number of idle attachments across all keys.
+		///
+		std::size_t getIdleCount();
+
+		///
+		/// Returns the number of leased attachments across all keys.
+		///
+		std::size_t getLeasedCount();
+
+	private:
+		using ClockType = std::chrono::steady_clock;
+
+		struct IdleAttachment final
+		{
+			std::unique_ptr<Attachment> attachment;
+			ClockType::time_point lastUsed;
+		};
+
+		struct Partition final
+		{
+			std::string uri;
+			AttachmentOptions attachmentOptions;
+			std::deque<IdleAttachment> idle;
+			unsigned leased = 0u;
+		};
+
+	private:
+		std::size_t findPartition(const std::string& uri, const AttachmentOptions& attachmentOptions);
+		void collectExpired(
+			Partition& partition, ClockType::time_point now, std::vector<std::unique_ptr<Attachment>>& expired);
+		bool ping(Attachment& attachment);
+		void giveBack(std::size_t partitionIndex, std::unique_ptr<Attachment> attachment, bool reuse) noexcept;
+
+	private:
+		Client* client;
+		AttachmentPoolOptions options;
+		std::mutex mutex;
+		std::condition_variable available;
+		std::deque<Partition> partitions;
+
+		friend class AttachmentLease;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_ATTACHMENT_POOL_H
@@ -24,11 +24,185 @@
 
 #include "BackupManager.h"
 #include "Client.h"
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
 
 using namespace fbcpp;
 using namespace fbcpp::impl;
 
+
+namespace
+{
+	// Statistics columns requested from gbak: total time, delta time, page reads and page writes.
+	constexpr const char* STATISTICS_COLUMNS = "TDRW";
+
+	std::string_view trimLeft(std::string_view text) noexcept
+	{
+		const auto pos = text.find_first_not_of(" \t");
+		return pos == std::string_view::npos ? std::string_view{} : text.substr(pos);
+	}
+
+	std::string_view trim(std::string_view text) noexcept
+	{
+		text = trimLeft(text);
+		const auto pos = text.find_last_not_of(" \t");
+		return pos == std::string_view::npos ? std::string_view{} : text.substr(0u, pos + 1u);
+	}
+
+	// Extracts the next space-separated token, advancing the text past it.
+	std::string_view nextToken(std::string_view& text) noexcept
+	{
+		text = trimLeft(text);
+		const auto end = std::min(text.find_first_of(" \t"), text.size());
+		const auto token = text.substr(0u, end);
+		text.remove_prefix(end);
+		return token;
+	}
+
+	bool parseSeconds(std::string_view token, double& value)
+	{
+		if (token.empty() || token.find_first_not_of("0123456789.") != std::string_view::npos)
+			return false;
+
+		value = std::strtod(std::string{token}.c_str(), nullptr);
+		return true;
+	}
+
+	bool parseCount(std::string_view token, std::uint64_t& value) noexcept
+	{
+		const auto [end, error] = std::from_chars(token.data(), token.data() + token.size(), value);
+		return !token.empty() && error == std::errc{} && end == token.data() + token.size();
+	}
+
+	// Turns gbak verbose lines into BackupProgress events, tracking the current phase and table.
+	class ProgressParser final
+	{
+	public:
+		std::optional<BackupProgress> parse(std::string_view line)
+		{
+			if (line.starts_with("gbak:"))
+				line.remove_prefix(5u);
+
+			BackupProgress progress;
+			auto rest = line;
+
+			double elapsed = 0.0;
+			double delta = 0.0;
+			auto columns = line;
+
+			if (parseSeconds(nextToken(columns), elapsed) && parseSeconds(nextToken(columns), delta) &&
+				parseCount(nextToken(columns), progress.pageReads) &&
+				parseCount(nextToken(columns), progress.pageWrites))
+			{
+				progress.elapsed = std::chrono::duration<double>{elapsed};
+				progress.delta = std::chrono::duration<double>{delta};
+
+				// A single space separates the columns from the message and its indentation.
+				rest = columns.starts_with(' ') ? columns.substr(1u) : columns;
+			}
+			else
+			{
+				progress.pageReads = 0u;
+				progress.pageWrites = 0u;
+			}
+
+			const auto message = trim(rest);
+
+			// Skip empty lines and the header of the statistics columns.
+			if (message.empty() || (message.starts_with("time") && message.find("delta") != std::string_view::npos))
+				return std::nullopt;
+
+			static constexpr std::string_view TABLE_MARKER = "for table ";
+			const auto tablePos = message.find(TABLE_MARKER);
+
+			// Lines not indented start a new phase; the table is also taken from indented lines naming one.
+			if (rest.front() != ' ' && rest.front() != '\t')
+			{
+				phase = message;
+				phaseStart = elapsed;
+				relation.clear();
+			}
+
+			if (tablePos != std::string_view::npos)
+				relation = trim(message.substr(tablePos + TABLE_MARKER.size()));
+
+			auto words = message;
+			std::uint64_t records = 0u;
+
+			if (parseCount(nextToken(words), records) && trimLeft(words).starts_with("record"))
+				progress.records = records;
+
+			progress.message = message;
+			progress.phase = phase;
+			progress.relation = relation;
+			progress.phaseElapsed = std::chrono::duration<double>{std::max(elapsed - phaseStart, 0.0)};
+
+			return progress;
+		}
+
+	private:
+		std::string phase;
+		std::string relation;
+		double phaseStart = 0.0;
+	};
+
+	// Feeds the service lines to the user verbose output and to the progress output, when set.
+	ServiceManager::VerboseOutput makeVerboseOutput(
+		const ServiceManager::VerboseOutput& verboseOutput, const BackupProgressOutput& progressOutput)
+	{
+		if (!progressOutput)
+			return verboseOutput;
+
+		return [verboseOutput, progressOutput, parser = std::make_shared<ProgressParser>()](std::string_view line)
+		{
+			if (verboseOutput)
+				verboseOutput(line);
+
+			if (const auto progress = parser->parse(line))
+				progressOutput(progress.value());
+		};
+	}
+}  // namespace
+
+
 void BackupManager::backup(const BackupOptions& options)
+{
+	startAction(buildBackupSpb(options, false));
+	waitForCompletion(makeVerboseOutput(options.getVerboseOutput(), options.getProgressOutput()));
+}
+
+void BackupManager::backup(const BackupOptions& options, const ServiceManager::DataSink& sink)
+{
+	if (!options.getBackupFiles().empty())
+		throw std::invalid_argument{"Streaming backup does not accept backup files"};
+
+	if (options.getVerboseOutput() || options.getProgressOutput())
+		throw std::invalid_argument{"Streaming backup does not support verbose or progress output"};
+
+	startAction(buildBackupSpb(options, true));
+	waitForCompletion({}, false, sink);
+}
+
+void BackupManager::restore(const RestoreOptions& options)
+{
+	startAction(buildRestoreSpb(options, false));
+	waitForCompletion(makeVerboseOutput(options.getVerboseOutput(), options.getProgressOutput()), true);
+}
+
+void BackupManager::restore(const RestoreOptions& options, const ServiceManager::DataSource& source)
+{
+	if (!options.getBackupFiles().empty())
+		throw std::invalid_argument{"Streaming restore does not accept backup files"};
+
+	startAction(buildRestoreSpb(options, true));
+	waitForCompletion(makeVerboseOutput(options.getVerboseOutput(), options.getProgressOutput()), true, {}, source);
+}
+
+std::vector<std::uint8_t> BackupManager::buildBackupSpb(const BackupOptions& options, bool toStdout)
 {
 	StatusWrapper statusWrapper{getClient()};
 	auto builder =
@@ -36,6 +210,9 @@ void BackupManager::backup(const BackupOptions& options)
 	builder->insertTag(&statusWrapper, isc_action_svc_backup);
 	builder->insertString(&statusWrapper, isc_spb_dbname, options.getDatabase().c_str());
 
+	if (toStdout)
+		builder->insertString(&statusWrapper, isc_spb_bkp_file, "stdout");
+
 	for (const auto& backupFile : options.getBackupFiles())
 	{
 		builder->insertString(&statusWrapper, isc_spb_bkp_file, backupFile.path.c_str());
@@ -44,20 +221,22 @@ void BackupManager::backup(const BackupOptions& options)
 			addSpbInt(builder.get(), &statusWrapper, isc_spb_bkp_length, *backupFile.length, "Backup file length");
 	}
 
-	if (options.getVerboseOutput())
+	if (options.getVerboseOutput() || options.getProgressOutput())
 		builder->insertTag(&statusWrapper, isc_spb_verbose);
 
+	if (options.getProgressOutput())
+		builder->insertString(&statusWrapper, isc_spb_bkp_stat, STATISTICS_COLUMNS);
+
 	if (const auto parallelWorkers = options.getParallelWorkers())
 		builder->insertInt(&statusWrapper, isc_spb_bkp_parallel_workers, static_cast<int>(*parallelWorkers));
 
 	const auto buffer = builder->getBuffer(&statusWrapper);
 	const auto length = builder->getBufferLength(&statusWrapper);
 
-	startAction(std::vector<std::uint8_t>(buffer, buffer + length));
-	waitForCompletion(options.getVerboseOutput());
+	return {buffer, buffer + length};
 }
 
-void BackupManager::restore(const RestoreOptions& options)
+std::vector<std::uint8_t> BackupManager::buildRestoreSpb(const RestoreOptions& options, bool fromStdin)
 {
 	StatusWrapper statusWrapper{getClient()};
 	auto builder =
@@ -72,21 +251,26 @@ void BackupManager::restore(const RestoreOptions& options)
 			addSpbInt(builder.get(), &statusWrapper, isc_spb_res_length, *databaseFile.length, "Database file length");
 	}
 
+	if (fromStdin)
+		builder->insertString(&statusWrapper, isc_spb_bkp_file, "stdin");
+
 	for (const auto& backupFile : options.getBackupFiles())
 		builder->insertString(&statusWrapper, isc_spb_bkp_file, backupFile.c_str());
 
 	builder->insertInt(
 		&statusWrapper, isc_spb_options, options.getReplace() ? isc_spb_res_replace : isc_spb_res_create);
 
-	if (options.getVerboseOutput())
+	if (options.getVerboseOutput() || options.getProgressOutput())
 		builder->insertTag(&statusWrapper, isc_spb_verbose);
 
+	if (options.getProgressOutput())
+		builder->insertString(&statusWrapper, isc_spb_res_stat, STATISTICS_COLUMNS);
+
 	if (const auto parallelWorkers = options.getParallelWorkers())
 		builder->insertInt(&statusWrapper, isc_spb_res_parallel_workers, static_cast<int>(*parallelWorkers));
 
 	const auto buffer = builder->getBuffer(&statusWrapper);
 	const auto length = builder->getBufferLength(&statusWrapper);
 
-	startAction(std::vector<std::uint8_t>(buffer, buffer + length));
-	waitForCompletion(options.getVerboseOutput(), true);
+	return {buffer, buffer + length};
 }
@@ -26,7 +26,9 @@
 #define FBCPP_BACKUP_MANAGER_H
 
 #include "ServiceManager.h"
+#include <chrono>
 #include <cstdint>
+#include <functional>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -38,6 +40,72 @@
 ///
 namespace fbcpp
 {
+	///
+	/// Progress event parsed from one verbose line of a backup or restore, with the statistics columns that
+	/// gbak adds when asked for them.
+	///
+	struct BackupProgress final
+	{
+		///
+		/// Text of the line, without the `gbak:` prefix, the statistics columns and the indentation.
+		///
+		std::string message;
+
+		///
+		/// Last top-level activity reported by gbak, such as `writing data for table EMPLOYEE`.
+		///
+		std::string phase;
+
+		///
+		/// Table whose data is being written or restored, or empty outside of data phases.
+		///
+		std::string relation;
+
+		///
+		/// Number of records reported by a `N records written` (or restored) line.
+		///
+		std::optional<std::uint64_t> records;
+
+		///
+		/// Time since the operation started.
+		///
+		std::chrono::duration<double> elapsed{};
+
+		///
+		/// Time since the previous line.
+		///
+		std::chrono::duration<double> delta{};
+
+		///
+		/// Time since the current phase started.
+		///
+		std::chrono::duration<double> phaseElapsed{};
+
+		///
+		/// Page reads since the previous line.
+		///
+		std::uint64_t pageReads = 0u;
+
+		///
+		/// Page writes since the previous line.
+		///
+		std::uint64_t pageWrites = 0u;
+
+		///
+		/// Returns the records per second of the current phase, for events with a number of records.
+		///
+		double getRecordsPerSecond() const noexcept
+		{
+			const auto seconds = phaseElapsed.count();
+			return records && seconds > 0 ? static_cast<double>(*records) / seconds : 0.0;
+		}
+	};
+
+	///
+	/// Function invoked for every progress event of a backup or restore.
+	///
+	using BackupProgressOutput = std::function<void(const BackupProgress& progress)>;
+
 	///
 	/// Represents options used to run a backup operation through the service manager.
 	///
@@ -132,6 +200,25 @@ namespace fbcpp
 			return *this;
 		}
 
+		///
+		/// Returns the progress output callback.
+		///
+		const BackupProgressOutput& getProgressOutput() const
+		{
+			return progressOutput;
+		}
+
+		///
+		/// Sets the progress output callback.
+		/// It makes the service report verbose output with the time, delta, page reads and page writes
+		/// statistics on every line.
+		///
+		BackupOptions& setProgressOutput(BackupProgressOutput value)
+		{
+			progressOutput = std::move(value);
+			return *this;
+		}
+
 		///
 		/// Returns the requested number of parallel workers.
 		///
@@ -153,6 +240,7 @@ namespace fbcpp
 		std::string database;
 		std::vector<BackupFileSpec> backupFiles;
 		ServiceManager::VerboseOutput verboseOutput;
+		BackupProgressOutput progressOutput;
 		std::optional<std::uint32_t> parallelWorkers;
 	};
 
@@ -279,6 +367,25 @@ namespace fbcpp
 			return *this;
 		}
 
+		///
+		/// Returns the progress output callback.
+		///
+		const BackupProgressOutput& getProgressOutput() const
+		{
+			return progressOutput;
+		}
+
+		///
+		/// Sets the progress output callback.
+		/// It makes the service report verbose output with the time, delta, page reads and page writes
+		/// statistics on every line.
+		///
+		RestoreOptions& setProgressOutput(BackupProgressOutput value)
+		{
+			progressOutput = std::move(value);
+			return *this;
+		}
+
 		///
 		/// Returns the requested number of parallel workers.
 		///
@@ -301,6 +408,7 @@ namespace fbcpp
 		std::vector<std::string> backupFiles;
 		bool replace = false;
 		ServiceManager::VerboseOutput verboseOutput;
+		BackupProgressOutput progressOutput;
 		std::optional<std::uint32_t> parallelWorkers;
 	};
 
@@ -318,10 +426,29 @@ namespace fbcpp
 		///
 		void backup(const BackupOptions& options);
 
+		///
+		/// Runs a backup operation to the service `stdout`, delivering the backup chunk by chunk to the sink
+		/// instead of writing it to server-side files.
+		/// The options must have no backup files and neither verbose nor progress output, which would share the
+		/// stream.
+		///
+		void backup(const BackupOptions& options, const ServiceManager::DataSink& sink);
+
 		///
 		/// Runs a restore operation using the provided options.
 		///
 		void restore(const RestoreOptions& options);
+
+		///
+		/// Runs a restore operation from the service `stdin`, reading the backup from the source as the
+		/// service requests it instead of from server-side files.
+		/// The options must have no backup files.
+		///
+		void restore(const RestoreOptions& options, const ServiceManager::DataSource& source);
+
+	private:
+		std::vector<std::uint8_t> buildBackupSpb(const BackupOptions& options, bool toStdout);
+		std::vector<std::uint8_t> buildRestoreSpb(const RestoreOptions& options, bool fromStdin);
 	};
 }  // namespace fbcpp
 
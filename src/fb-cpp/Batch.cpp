@@ -25,6 +25,7 @@
 #include "Batch.h"
 #include "Attachment.h"
 #include "Client.h"
+#include "MappedFile.h"
 #include "Statement.h"
 #include "Transaction.h"
 
@@ -32,6 +33,45 @@ using namespace fbcpp;
 using namespace fbcpp::impl;
 
 
+// --- BatchOptions ---
+
+static std::vector<std::uint8_t> buildParametersBlock(
+	Client& client, StatusWrapper& statusWrapper, const BatchOptions& options)
+{
+	auto builder = fbUnique(client.getUtil()->getXpbBuilder(&statusWrapper, fb::IXpbBuilder::BATCH, nullptr, 0));
+
+	if (options.getMultiError())
+		builder->insertInt(&statusWrapper, fb::IBatch::TAG_MULTIERROR, 1);
+
+	if (options.getRecordCounts())
+		builder->insertInt(&statusWrapper, fb::IBatch::TAG_RECORD_COUNTS, 1);
+
+	if (const auto bufferSize = options.getBufferBytesSize(); bufferSize.has_value())
+		builder->insertInt(&statusWrapper, fb::IBatch::TAG_BUFFER_BYTES_SIZE, static_cast<int>(bufferSize.value()));
+
+	if (options.getBlobPolicy() != BlobPolicy::NONE)
+		builder->insertInt(&statusWrapper, fb::IBatch::TAG_BLOB_POLICY, static_cast<int>(options.getBlobPolicy()));
+
+	if (options.getDetailedErrors() != 64)
+	{
+		builder->insertInt(
+			&statusWrapper, fb::IBatch::TAG_DETAILED_ERRORS, static_cast<int>(options.getDetailedErrors()));
+	}
+
+	const auto buffer = builder->getBuffer(&statusWrapper);
+	const auto length = builder->getBufferLength(&statusWrapper);
+
+	return {buffer, buffer + length};
+}
+
+ParameterBlock BatchOptions::compile(Client& client) const
+{
+	StatusWrapper statusWrapper{client};
+
+	return ParameterBlock{ParameterBlockType::BATCH, buildParametersBlock(client, statusWrapper, *this)};
+}
+
+
 // --- BatchCompletionState ---
 
 BatchCompletionState::BatchCompletionState(Client& client, FbUniquePtr<fb::IBatchCompletionState> handle) noexcept
@@ -100,12 +140,16 @@ Batch::Batch(Statement& statement, Transaction& transaction, const BatchOptions&
 	: client{&statement.getAttachment().getClient()},
 	  transaction{&transaction},
 	  statement{&statement},
-	  statusWrapper{*client}
+	  options{options},
+	  statusWrapper{*client},
+	  messageFormat{statement.getInputMessageFormat()},
+	  observer{statement.getObserver()},
+	  sql{statement.getSql()}
 {
 	assert(statement.isValid());
 	assert(transaction.isValid());
 
-	const auto parBlock = buildParametersBlock(options);
+	const auto parBlock = buildParametersBlock(*client, statusWrapper, options);
 
 	handle.reset(statement.getStatementHandle()->createBatch(
 		&statusWrapper, statement.getInputMetadata().get(), static_cast<unsigned>(parBlock.size()), parBlock.data()));
@@ -115,24 +159,73 @@ Batch::Batch(Attachment& attachment, Transaction& transaction, std::string_view
 	const BatchOptions& options)
 	: client{&attachment.getClient()},
 	  transaction{&transaction},
-	  statusWrapper{*client}
+	  options{options},
+	  statusWrapper{*client},
+	  observer{attachment.getObserver()},
+	  sql{sql}
 {
 	assert(attachment.isValid());
 	assert(transaction.isValid());
 
-	const auto parBlock = buildParametersBlock(options);
+	const auto parBlock = buildParametersBlock(*client, statusWrapper, options);
 
 	handle.reset(attachment.getHandle()->createBatch(&statusWrapper, transaction.getHandle().get(),
 		static_cast<unsigned>(sql.length()), sql.data(), dialect, nullptr, static_cast<unsigned>(parBlock.size()),
 		parBlock.data()));
 }
 
+Batch::Batch(Statement& statement, Transaction& transaction, const BatchOptions& options,
+	const ParameterBlock& parameters)
+	: client{&statement.getAttachment().getClient()},
+	  transaction{&transaction},
+	  statement{&statement},
+	  options{options},
+	  statusWrapper{*client},
+	  messageFormat{statement.getInputMessageFormat()},
+	  observer{statement.getObserver()},
+	  sql{statement.getSql()}
+{
+	assert(statement.isValid());
+	assert(transaction.isValid());
+
+	parameters.checkType(ParameterBlockType::BATCH);
+
+	handle.reset(statement.getStatementHandle()->createBatch(
+		&statusWrapper, statement.getInputMetadata().get(), parameters.getLength(), parameters.getData()));
+}
+
+Batch::Batch(Attachment& attachment, Transaction& transaction, std::string_view sql, unsigned dialect,
+	const BatchOptions& options, const ParameterBlock& parameters)
+	: client{&attachment.getClient()},
+	  transaction{&transaction},
+	  options{options},
+	  statusWrapper{*client},
+	  observer{attachment.getObserver()},
+	  sql{sql}
+{
+	assert(attachment.isValid());
+	assert(transaction.isValid());
+
+	parameters.checkType(ParameterBlockType::BATCH);
+
+	handle.reset(attachment.getHandle()->createBatch(&statusWrapper, transaction.getHandle().get(),
+		static_cast<unsigned>(sql.length()), sql.data(), dialect, nullptr, parameters.getLength(),
+		parameters.getData()));
+}
+
 Batch::Batch(Batch&& o) noexcept
 	: client{o.client},
 	  transaction{o.transaction},
 	  statement{o.statement},
+	  options{std::move(o.options)},
 	  statusWrapper{std::move(o.statusWrapper)},
-	  handle{std::move(o.handle)}
+	  handle{std::move(o.handle)},
+	  messageFormat{o.messageFormat},
+	  inputDescriptors{std::move(o.inputDescriptors)},
+	  alignedMessageLength{o.alignedMessageLength},
+	  rangeBuffer{std::move(o.rangeBuffer)},
+	  observer{std::move(o.observer)},
+	  sql{std::move(o.sql)}
 {
 }
 
@@ -142,6 +235,8 @@ Batch::Batch(Batch&& o) noexcept
 void Batch::add(unsigned count, const void* inBuffer)
 {
 	assert(isValid());
+
+	MetricsScope metrics{client->getMetricsRegistry(), MetricsCall::BATCH_ADD};
 	handle->add(&statusWrapper, count, inBuffer);
 }
 
@@ -149,6 +244,8 @@ void Batch::addMessage()
 {
 	assert(isValid());
 	assert(statement);
+
+	MetricsScope metrics{client->getMetricsRegistry(), MetricsCall::BATCH_ADD};
 	handle->add(&statusWrapper, 1, statement->getInputMessage().data());
 }
 
@@ -168,6 +265,42 @@ BlobId Batch::addBlob(std::span<const std::byte> data, const BlobOptions& bpb)
 	return blobId;
 }
 
+BlobId Batch::addBlob(std::span<const std::byte> data, const ParameterBlock& bpb)
+{
+	assert(isValid());
+
+	bpb.checkType(ParameterBlockType::BPB);
+
+	BlobId blobId;
+	handle->addBlob(
+		&statusWrapper, static_cast<unsigned>(data.size()), data.data(), &blobId.id, bpb.getLength(), bpb.getData());
+
+	return blobId;
+}
+
+BlobId Batch::addBlobFromFile(const std::filesystem::path& path, const BlobOptions& bpb)
+{
+	assert(isValid());
+
+	MappedFile file{path};
+
+	if (file.getSize() == 0u)
+		return addBlob({}, bpb);
+
+	std::optional<BlobId> blobId;
+
+	file.forEachView(
+		[&](std::span<const std::byte> view)
+		{
+			if (blobId)
+				appendBlobData(view);
+			else
+				blobId = addBlob(view, bpb);
+		});
+
+	return blobId.value();
+}
+
 void Batch::appendBlobData(std::span<const std::byte> data)
 {
 	assert(isValid());
@@ -198,6 +331,15 @@ void Batch::setDefaultBpb(const BlobOptions& bpb)
 	handle->setDefaultBpb(&statusWrapper, static_cast<unsigned>(preparedBpb.size()), preparedBpb.data());
 }
 
+void Batch::setDefaultBpb(const ParameterBlock& bpb)
+{
+	assert(isValid());
+
+	bpb.checkType(ParameterBlockType::BPB);
+
+	handle->setDefaultBpb(&statusWrapper, bpb.getLength(), bpb.getData());
+}
+
 unsigned Batch::getBlobAlignment()
 {
 	assert(isValid());
@@ -211,9 +353,24 @@ BatchCompletionState Batch::execute()
 {
 	assert(isValid());
 
-	auto completionState = fbUnique(handle->execute(&statusWrapper, transaction->getHandle().get()));
+	OperationScope scope{observer.get(), OperationType::BATCH_EXECUTE, sql};
+	FbUniquePtr<fb::IBatchCompletionState> completionState;
 
-	return BatchCompletionState{*client, std::move(completionState)};
+	try
+	{
+		MetricsScope metrics{client->getMetricsRegistry(), MetricsCall::BATCH_EXECUTE};
+		completionState = fbUnique(handle->execute(&statusWrapper, transaction->getHandle().get()));
+	}
+	catch (...)
+	{
+		scope.fail();
+		throw;
+	}
+
+	BatchCompletionState result{*client, std::move(completionState)};
+	scope.finish(observer ? result.getSize() : 0u);
+
+	return result;
 }
 
 void Batch::cancel()
@@ -241,10 +398,15 @@ FbRef<fb::IMessageMetadata> Batch::getInputMetadata()
 }
 
 const std::vector<Descriptor>& Batch::getInputDescriptors()
+{
+	return getInputDescriptorSet()->getDescriptors();
+}
+
+const DescriptorSetPtr& Batch::getInputDescriptorSet()
 {
 	assert(isValid());
 
-	if (inputDescriptors.empty())
+	if (!inputDescriptors)
 		buildInputDescriptors();
 
 	return inputDescriptors;
@@ -253,34 +415,6 @@ const std::vector<Descriptor>& Batch::getInputDescriptors()
 
 // --- Internal helpers ---
 
-std::vector<std::uint8_t> Batch::buildParametersBlock(const BatchOptions& options)
-{
-	auto builder = fbUnique(client->getUtil()->getXpbBuilder(&statusWrapper, fb::IXpbBuilder::BATCH, nullptr, 0));
-
-	if (options.getMultiError())
-		builder->insertInt(&statusWrapper, fb::IBatch::TAG_MULTIERROR, 1);
-
-	if (options.getRecordCounts())
-		builder->insertInt(&statusWrapper, fb::IBatch::TAG_RECORD_COUNTS, 1);
-
-	if (const auto bufferSize = options.getBufferBytesSize(); bufferSize.has_value())
-		builder->insertInt(&statusWrapper, fb::IBatch::TAG_BUFFER_BYTES_SIZE, static_cast<int>(bufferSize.value()));
-
-	if (options.getBlobPolicy() != BlobPolicy::NONE)
-		builder->insertInt(&statusWrapper, fb::IBatch::TAG_BLOB_POLICY, static_cast<int>(options.getBlobPolicy()));
-
-	if (options.getDetailedErrors() != 64)
-	{
-		builder->insertInt(
-			&statusWrapper, fb::IBatch::TAG_DETAILED_ERRORS, static_cast<int>(options.getDetailedErrors()));
-	}
-
-	const auto buffer = builder->getBuffer(&statusWrapper);
-	const auto length = builder->getBufferLength(&statusWrapper);
-
-	return {buffer, buffer + length};
-}
-
 std::vector<std::uint8_t> Batch::prepareBpb(const BlobOptions& bpb)
 {
 	auto builder = fbUnique(client->getUtil()->getXpbBuilder(&statusWrapper, fb::IXpbBuilder::BPB,
@@ -303,11 +437,12 @@ void Batch::buildInputDescriptors()
 	auto metadata = getInputMetadata();
 	const auto count = metadata->getCount(&statusWrapper);
 
-	inputDescriptors.reserve(count);
+	std::vector<Descriptor> descriptors;
+	descriptors.reserve(count);
 
 	for (unsigned index = 0u; index < count; ++index)
 	{
-		inputDescriptors.push_back(Descriptor{
+		descriptors.push_back(Descriptor{
 			.originalType = static_cast<DescriptorOriginalType>(metadata->getType(&statusWrapper, index)),
 			.adjustedType = static_cast<DescriptorAdjustedType>(metadata->getType(&statusWrapper, index)),
 			.scale = metadata->getScale(&statusWrapper, index),
@@ -323,4 +458,14 @@ void Batch::buildInputDescriptors()
 			.subType = metadata->getSubType(&statusWrapper, index),
 		});
 	}
+
+	inputDescriptors = std::make_shared<const DescriptorSet>(std::move(descriptors));
+}
+
+unsigned Batch::getAlignedMessageLength()
+{
+	if (alignedMessageLength == 0)
+		alignedMessageLength = getInputMetadata()->getAlignedLength(&statusWrapper);
+
+	return alignedMessageLength;
 }
@@ -27,12 +27,16 @@
 
 #include "fb-api.h"
 #include "Blob.h"
+#include "BindingPlan.h"
 #include "Descriptor.h"
 #include "SmartPtrs.h"
+#include "Statement.h"
 #include "Exception.h"
+#include "ParameterBlock.h"
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
 #include <optional>
 #include <span>
 #include <string_view>
@@ -169,6 +173,12 @@ namespace fbcpp
 			return *this;
 		}
 
+		///
+		/// Encodes these options in a batch parameter block that can be passed to the Batch constructors
+		/// together with these options, so that creating batches with the same options does not build it again.
+		///
+		ParameterBlock compile(Client& client) const;
+
 	private:
 		bool multiError = false;
 		bool recordCounts = false;
@@ -286,6 +296,20 @@ namespace fbcpp
 		explicit Batch(Attachment& attachment, Transaction& transaction, std::string_view sql, unsigned dialect = 3,
 			const BatchOptions& options = {});
 
+		///
+		/// Creates a Batch from a prepared Statement, using a block returned by `options.compile()`.
+		///
+		/// The Statement must remain valid for the lifetime of the Batch.
+		///
+		explicit Batch(Statement& statement, Transaction& transaction, const BatchOptions& options,
+			const ParameterBlock& parameters);
+
+		///
+		/// Creates a Batch from an Attachment and SQL text, using a block returned by `options.compile()`.
+		///
+		explicit Batch(Attachment& attachment, Transaction& transaction, std::string_view sql, unsigned dialect,
+			const BatchOptions& options, const ParameterBlock& parameters);
+
 		///
 		/// Transfers ownership of another Batch into this one.
 		///
@@ -333,6 +357,46 @@ namespace fbcpp
 			return handle != nullptr;
 		}
 
+		///
+		/// Returns the options this batch was created with.
+		///
+		const BatchOptions& getOptions() const noexcept
+		{
+			return options;
+		}
+
+		///
+		/// Returns the Client object reference used to create this Batch object.
+		///
+		Client& getClient() noexcept
+		{
+			return *client;
+		}
+
+		///
+		/// Returns the transaction the batch executes in.
+		///
+		Transaction& getTransaction() noexcept
+		{
+			return *transaction;
+		}
+
+		///
+		/// Returns the Statement the batch was created from, or nullptr for the SQL-text constructors.
+		///
+		Statement* getStatement() noexcept
+		{
+			return statement;
+		}
+
+		///
+		/// Returns the message struct format bound to the Statement when the batch was created, if any.
+		///
+		const impl::MessageFormat* getMessageFormat() const noexcept
+		{
+			return messageFormat;
+		}
+
 		///
 		/// @name Adding messages
 		/// @{
@@ -357,6 +421,81 @@ namespace fbcpp
 		///
 		void addMessage();
 
+		///
+		/// Encodes a range of aggregate or tuple-like values straight into one contiguous multi-message
+		/// buffer and adds them all with a single `IBatch::add()` call.
+		///
+		/// Fields whose C++ type matches the parameter representation are written in place, the others
+		/// go through the converting setters of the Statement (see BindingPlan). Requires the
+		/// Statement-based constructor.
+		/// Typical usage:
+		/// ```
+		/// std::vector<Record> records = ...;
+		/// batch.addRange(std::span{records});
+		/// ```
+		///
+		template <typename T>
+			requires(Aggregate<T> || TupleLike<T>)
+		void addRange(std::span<const T> values)
+		{
+			assert(isValid());
+			assert(statement);
+
+			if (values.empty())
+				return;
+
+			const BindingPlan<T> plan{statement->getInputDescriptorSet()};
+			const auto messageLength = getAlignedMessageLength();
+
+			// Reused between calls; every field and null flag of each message is written below.
+			rangeBuffer.resize(values.size() * messageLength);
+
+			auto* message = rangeBuffer.data();
+
+			for (const auto& value : values)
+			{
+				plan.write(*statement, message, value);
+				message += messageLength;
+			}
+
+			add(static_cast<unsigned>(values.size()), rangeBuffer.data());
+		}
+
+		///
+		/// Convenience overload of `addRange()` for mutable spans.
+		///
+		template <typename T>
+			requires(Aggregate<T> || TupleLike<T>)
+		void addRange(std::span<T> values)
+		{
+			addRange(std::span<const T>{values});
+		}
+
+		///
+		/// Adds an array of message structs with a single `IBatch::add()` call, without encoding them.
+		///
+		/// Requires the Statement-based constructor, called after `Statement::bindInputMessage<T>()`.
+		/// Typical usage:
+		/// ```
+		/// stmt.bindInputMessage<Message>();
+		/// Batch batch{stmt, transaction};
+		/// batch.addMessages(std::span{messages});
+		/// ```
+		///
+		/// @throws FbCppException if the batch was not created for this message struct.
+		///
+		template <MessageStruct T>
+		void addMessages(std::span<const T> messages)
+		{
+			assert(isValid());
+
+			if (messageFormat != &impl::getMessageFormat<T>())
+				throw FbCppException("Batch was not created for this message struct");
+
+			if (!messages.empty())
+				add(static_cast<unsigned>(messages.size()), messages.data());
+		}
+
 		///
 		/// @}
 		///
@@ -373,6 +512,22 @@ namespace fbcpp
 		///
 		BlobId addBlob(std::span<const std::byte> data, const BlobOptions& bpb = {});
 
+		///
+		/// Adds an inline blob using a BPB returned by `BlobOptions::compile()` and returns its batch-local ID.
+		///
+		/// Only valid when `BlobPolicy` is `ID_ENGINE` or `ID_USER`. The batch accepts only the type and
+		/// storage of the BlobOptions.
+		///
+		BlobId addBlob(std::span<const std::byte> data, const ParameterBlock& bpb);
+
+		///
+		/// Adds an inline blob with the whole contents of a file and returns its batch-local ID.
+		///
+		/// The file is memory-mapped and passed to the batch in slices straight from the mapping,
+		/// one bounded view at a time. Only valid when `BlobPolicy` is `ID_ENGINE` or `ID_USER`.
+		///
+		BlobId addBlobFromFile(const std::filesystem::path& path, const BlobOptions& bpb = {});
+
 		///
 		/// Appends more data to the last blob added with `addBlob()`.
 		///
@@ -394,6 +549,11 @@ namespace fbcpp
 		///
 		void setDefaultBpb(const BlobOptions& bpb);
 
+		///
+		/// Sets the default BPB for blobs in this batch, using a block returned by `BlobOptions::compile()`.
+		///
+		void setDefaultBpb(const ParameterBlock& bpb);
+
 		///
 		/// Returns the blob alignment requirement for this batch.
 		///
@@ -433,22 +593,33 @@ namespace fbcpp
 		///
 		const std::vector<Descriptor>& getInputDescriptors();
 
+		///
+		/// Returns the shared, immutable input parameter descriptor set for this batch.
+		///
+		const DescriptorSetPtr& getInputDescriptorSet();
+
 		///
 		/// @}
 		///
 
 	private:
-		std::vector<std::uint8_t> buildParametersBlock(const BatchOptions& options);
 		std::vector<std::uint8_t> prepareBpb(const BlobOptions& bpb);
 		void buildInputDescriptors();
+		unsigned getAlignedMessageLength();
 
 	private:
 		Client* client;
 		Transaction* transaction;
 		Statement* statement = nullptr;
+		BatchOptions options;
 		impl::StatusWrapper statusWrapper;
 		FbRef<fb::IBatch> handle;
-		std::vector<Descriptor> inputDescriptors;
+		const impl::MessageFormat* messageFormat = nullptr;
+		DescriptorSetPtr inputDescriptors;
+		unsigned alignedMessageLength = 0;
+		std::vector<std::byte> rangeBuffer;
+		std::shared_ptr<OperationObserver> observer;
+		std::string sql;
 	};
 }  // namespace fbcpp
 
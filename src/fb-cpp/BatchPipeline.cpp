@@ -0,0 +1,215 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "BatchPipeline.h"
+#include "Client.h"
+#include "Statement.h"
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include <utility>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+BatchPipeline::BatchPipeline(Batch& batch, unsigned bufferCount)
+	: batch{batch},
+	  bufferCount{bufferCount}
+{
+	assert(batch.isValid());
+
+	if (bufferCount == 0)
+		throw std::invalid_argument{"BatchPipeline bufferCount must be greater than zero"};
+
+	StatusWrapper statusWrapper{batch.getClient()};
+	messageLength = batch.getInputMetadata()->getAlignedLength(&statusWrapper);
+
+	freeBuffers.reserve(bufferCount);
+
+	worker = std::thread{&BatchPipeline::work, this};
+}
+
+void BatchPipeline::add(unsigned count, const void* inBuffer)
+{
+	auto& buffer = getCurrentBuffer();
+	const auto data = static_cast<const std::byte*>(inBuffer);
+
+	buffer.data.insert(buffer.data.end(), data, data + static_cast<std::size_t>(count) * messageLength);
+	buffer.count += count;
+}
+
+void BatchPipeline::addMessage()
+{
+	const auto statement = batch.getStatement();
+	assert(statement);
+
+	const auto& message = statement->getInputMessage();
+	assert(message.size() <= messageLength);
+
+	auto& buffer = getCurrentBuffer();
+	const auto start = buffer.data.size();
+
+	// The padding up to the aligned length is zeroed by resize().
+	buffer.data.resize(start + messageLength);
+	std::copy(message.begin(), message.end(), buffer.data.begin() + static_cast<std::ptrdiff_t>(start));
+	++buffer.count;
+}
+
+std::future<BatchCompletionState> BatchPipeline::submit()
+{
+	if (!current || current->count == 0)
+		throw FbCppException("BatchPipeline has no messages to submit");
+
+	std::future<BatchCompletionState> future;
+
+	{  // scope
+		std::lock_guard mutexGuard{mutex};
+
+		// Checked before taking the buffer, so a failed submit keeps it and its messages.
+		if (stopping)
+			throw FbCppException("BatchPipeline is closed");
+
+		Job job{.buffer = std::move(current), .promise = {}};
+		future = job.promise.get_future();
+		queue.push_back(std::move(job));
+	}
+
+	condition.notify_all();
+
+	return future;
+}
+
+void BatchPipeline::drain()
+{
+	std::unique_lock mutexGuard{mutex};
+	condition.wait(mutexGuard, [this] { return queue.empty() && !executing; });
+}
+
+void BatchPipeline::close()
+{
+	{  // scope
+		std::lock_guard mutexGuard{mutex};
+		stopping = true;
+	}
+
+	condition.notify_all();
+
+	if (worker.joinable())
+		worker.join();
+
+	current.reset();
+	freeBuffers.clear();
+}
+
+unsigned BatchPipeline::getQueuedBuffers()
+{
+	std::lock_guard mutexGuard{mutex};
+	return static_cast<unsigned>(queue.size()) + (executing ? 1u : 0u);
+}
+
+BatchPipeline::Buffer& BatchPipeline::getCurrentBuffer()
+{
+	if (current)
+		return *current;
+
+	std::unique_lock mutexGuard{mutex};
+
+	// A close() from another thread wakes a producer waiting for a buffer.
+	condition.wait(mutexGuard, [this] { return stopping || !freeBuffers.empty() || createdBuffers < bufferCount; });
+
+	if (stopping)
+		throw FbCppException("BatchPipeline is closed");
+
+	if (!freeBuffers.empty())
+	{
+		current = std::move(freeBuffers.back());
+		freeBuffers.pop_back();
+	}
+	else
+	{
+		current = std::make_unique<Buffer>();
+		++createdBuffers;
+	}
+
+	return *current;
+}
+
+void BatchPipeline::work()
+{
+	while (true)
+	{
+		Job job;
+
+		{  // scope
+			std::unique_lock mutexGuard{mutex};
+
+			// Stopping still executes everything already submitted, so all the futures are satisfied.
+			condition.wait(mutexGuard, [this] { return stopping || !queue.empty(); });
+
+			if (queue.empty())
+				return;
+
+			job = std::move(queue.front());
+			queue.pop_front();
+			executing = true;
+		}
+
+		if (error)
+			job.promise.set_exception(error);
+		else
+		{
+			try
+			{
+				batch.add(job.buffer->count, job.buffer->data.data());
+				job.promise.set_value(batch.execute());
+			}
+			catch (...)
+			{
+				error = std::current_exception();
+				job.promise.set_exception(error);
+
+				try
+				{
+					batch.cancel();
+				}
+				catch (...)
+				{
+					// swallow
+				}
+			}
+		}
+
+		job.buffer->data.clear();
+		job.buffer->count = 0;
+
+		{  // scope
+			std::lock_guard mutexGuard{mutex};
+			freeBuffers.push_back(std::move(job.buffer));
+			executing = false;
+		}
+
+		condition.notify_all();
+	}
+}
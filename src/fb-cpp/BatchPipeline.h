@@ -0,0 +1,188 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_BATCH_PIPELINE_H
+#define FBCPP_BATCH_PIPELINE_H
+
+#include "Batch.h"
+#include "Exception.h"
+#include "MessageStruct.h"
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// @brief Overlaps the encoding of batch messages with the execution of the previous ones.
+	///
+	/// Messages are copied into client-side buffers; `submit()` hands the current buffer to a worker
+	/// thread, which adds it to the batch and executes it while the caller fills the next buffer. At most
+	/// `bufferCount` buffers exist at once (including the one being filled): two gives double buffering.
+	/// When all of them are in use, the next add waits for the oldest execution to finish.
+	///
+	/// Executions run one at a time and in submission order, so the single transaction of the batch sees
+	/// them exactly as consecutive `Batch::execute()` calls. If one of them throws, the batch is cancelled
+	/// and the buffers submitted after it are not executed: their futures get the same exception.
+	///
+	/// While buffers are pending, the batch, its transaction and its attachment belong to the worker
+	/// thread; the caller may only keep setting the input parameters of the batch's Statement. Call
+	/// `drain()` before committing. Messages must not reference batch-local blob IDs.
+	///
+	class BatchPipeline final
+	{
+	public:
+		///
+		/// @brief Starts the worker thread of a pipeline over `batch`, which must outlive it.
+		/// @param batch The batch the messages are executed with.
+		/// @param bufferCount Maximum number of message buffers alive at once.
+		///
+		explicit BatchPipeline(Batch& batch, unsigned bufferCount = 2);
+
+		///
+		/// @brief Waits for the submitted executions and stops the worker thread.
+		///
+		~BatchPipeline() noexcept
+		{
+			try
+			{
+				close();
+			}
+			catch (...)
+			{
+				// swallow
+			}
+		}
+
+		BatchPipeline(const BatchPipeline&) = delete;
+		BatchPipeline& operator=(const BatchPipeline&) = delete;
+
+		BatchPipeline(BatchPipeline&&) = delete;
+		BatchPipeline& operator=(BatchPipeline&&) = delete;
+
+	public:
+		///
+		/// Copies `count` aligned raw messages into the current buffer.
+		///
+		void add(unsigned count, const void* inBuffer);
+
+		///
+		/// Copies the current input message of the batch's Statement into the current buffer.
+		///
+		void addMessage();
+
+		///
+		/// Copies message structs into the current buffer, as `Batch::addMessages()` does.
+		///
+		/// @throws FbCppException if the batch was not created for this message struct.
+		///
+		template <MessageStruct T>
+		void addMessages(std::span<const T> messages)
+		{
+			if (batch.getMessageFormat() != &impl::getMessageFormat<T>())
+				throw FbCppException("Batch was not created for this message struct");
+
+			if (!messages.empty())
+				add(static_cast<unsigned>(messages.size()), messages.data());
+		}
+
+		///
+		/// @brief Queues the current buffer for execution.
+		/// @return A future with the completion state of its execution, or its exception.
+		/// @throws FbCppException if no message was added since the last submit.
+		///
+		std::future<BatchCompletionState> submit();
+
+		///
+		/// Waits until all submitted buffers are executed.
+		///
+		void drain();
+
+		///
+		/// Waits until all submitted buffers are executed and stops the worker thread. The messages not
+		/// submitted are discarded.
+		///
+		void close();
+
+		///
+		/// Returns the number of messages added and not yet submitted.
+		///
+		unsigned getPendingMessages() const noexcept
+		{
+			return current ? current->count : 0u;
+		}
+
+		///
+		/// Returns the number of submitted buffers not yet executed, including the one executing.
+		///
+		unsigned getQueuedBuffers();
+
+	private:
+		struct Buffer final
+		{
+			std::vector<std::byte> data;
+			unsigned count = 0;
+		};
+
+		struct Job final
+		{
+			std::unique_ptr<Buffer> buffer;
+			std::promise<BatchCompletionState> promise;
+		};
+
+	private:
+		Buffer& getCurrentBuffer();
+		void work();
+
+	private:
+		Batch& batch;
+		unsigned bufferCount;
+		unsigned messageLength;
+		unsigned createdBuffers = 0;
+		std::unique_ptr<Buffer> current;
+		std::deque<Job> queue;
+		std::vector<std::unique_ptr<Buffer>> freeBuffers;
+		std::exception_ptr error;
+		std::mutex mutex;
+		std::condition_variable condition;
+		std::thread worker;
+		bool executing = false;
+		bool stopping = false;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_BATCH_PIPELINE_H
@@ -0,0 +1,171 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "BatchWriter.h"
+#include "Client.h"
+#include "Statement.h"
+#include "Transaction.h"
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+// Per-blob header (batch blob ID, length, BPB length) stored by Firebird before the blob data.
+static constexpr std::size_t BLOB_HEADER_SIZE = sizeof(ISC_QUAD) + 2 * sizeof(std::uint32_t);
+
+static std::size_t alignUp(std::size_t value, unsigned alignment) noexcept
+{
+	return alignment <= 1 ? value : (value + alignment - 1) / alignment * alignment;
+}
+
+
+BatchWriter::BatchWriter(Batch& batch, const BatchWriterOptions& options)
+	: batch{batch},
+	  options{options}
+{
+	assert(batch.isValid());
+
+	limit = options.getFlushBytes().value_or(
+		batch.getOptions().getBufferBytesSize().value_or(DEFAULT_BUFFER_BYTES_SIZE));
+
+	StatusWrapper statusWrapper{batch.getClient()};
+	messageLength = batch.getInputMetadata()->getAlignedLength(&statusWrapper);
+
+	if (batch.getOptions().getBlobPolicy() != BlobPolicy::NONE)
+		blobAlignment = batch.getBlobAlignment();
+}
+
+void BatchWriter::add(unsigned count, const void* inBuffer)
+{
+	auto data = static_cast<const std::byte*>(inBuffer);
+
+	while (count > 0)
+	{
+		if (inBlobGroup)
+		{
+			// The first message belongs to the blobs already queued and must not be separated from them.
+			inBlobGroup = false;
+		}
+		else
+			reserve(messageLength);
+
+		const auto room = limit > pendingBytes ? (limit - pendingBytes) / std::max(messageLength, 1u) : 0u;
+		const auto chunk = static_cast<unsigned>(std::clamp<std::size_t>(room, 1u, count));
+
+		batch.add(chunk, data);
+
+		pendingMessages += chunk;
+		pendingBytes += static_cast<std::size_t>(chunk) * messageLength;
+		data += static_cast<std::size_t>(chunk) * messageLength;
+		count -= chunk;
+	}
+}
+
+void BatchWriter::addMessage()
+{
+	if (inBlobGroup)
+		inBlobGroup = false;
+	else
+		reserve(messageLength);
+
+	batch.addMessage();
+
+	++pendingMessages;
+	pendingBytes += messageLength;
+}
+
+BlobId BatchWriter::addBlob(std::span<const std::byte> data, const BlobOptions& bpb)
+{
+	const auto bytes = getBlobBytes(data.size(), bpb);
+
+	if (!inBlobGroup)
+	{
+		reserve(bytes + messageLength);
+		inBlobGroup = true;
+	}
+
+	const auto blobId = batch.addBlob(data, bpb);
+	pendingBytes += bytes;
+
+	return blobId;
+}
+
+void BatchWriter::appendBlobData(std::span<const std::byte> data)
+{
+	batch.appendBlobData(data);
+	pendingBytes += alignUp(data.size(), blobAlignment);
+}
+
+void BatchWriter::flush()
+{
+	if (pendingMessages == 0)
+		return;
+
+	auto completionState = batch.execute();
+
+	const auto size = completionState.getSize();
+	report.states.reserve(report.states.size() + size);
+
+	for (unsigned pos = 0u; pos < size; ++pos)
+		report.states.push_back(completionState.getState(pos));
+
+	for (auto pos = completionState.findError(0); pos.has_value(); pos = completionState.findError(pos.value() + 1))
+		report.errors.push_back({flushedMessages + pos.value(), completionState.getStatus(pos.value())});
+
+	flushedMessages += pendingMessages;
+	pendingMessages = 0;
+	pendingBytes = 0;
+	inBlobGroup = false;
+	++report.flushCount;
+
+	if (const auto commitEvery = options.getCommitEvery(); commitEvery != 0 && report.flushCount % commitEvery == 0)
+	{
+		batch.getTransaction().commitRetaining();
+		++report.commitCount;
+	}
+}
+
+BatchWriterReport BatchWriter::finish()
+{
+	flush();
+
+	flushedMessages = 0;
+
+	return std::exchange(report, BatchWriterReport{});
+}
+
+void BatchWriter::reserve(std::size_t bytes)
+{
+	if (pendingMessages != 0 && pendingBytes + bytes > limit)
+		flush();
+}
+
+std::size_t BatchWriter::getBlobBytes(std::size_t dataLength, const BlobOptions& bpb) const noexcept
+{
+	return alignUp(BLOB_HEADER_SIZE + bpb.getBpb().size() + dataLength, blobAlignment);
+}
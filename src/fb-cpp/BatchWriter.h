@@ -0,0 +1,244 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_BATCH_WRITER_H
+#define FBCPP_BATCH_WRITER_H
+
+#include "Batch.h"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// Represents options used when creating a BatchWriter object.
+	///
+	class BatchWriterOptions final
+	{
+	public:
+		///
+		/// Returns the number of flushes after which the transaction is committed with
+		/// `commitRetaining()`, or zero if the writer never commits.
+		///
+		unsigned getCommitEvery() const
+		{
+			return commitEvery;
+		}
+
+		///
+		/// Sets the number of flushes after which the transaction is committed with
+		/// `commitRetaining()`. Zero disables committing.
+		///
+		BatchWriterOptions& setCommitEvery(unsigned value)
+		{
+			commitEvery = value;
+			return *this;
+		}
+
+		///
+		/// Returns the byte limit at which the writer flushes, or nullopt to use the batch buffer size.
+		///
+		std::optional<unsigned> getFlushBytes() const
+		{
+			return flushBytes;
+		}
+
+		///
+		/// Sets the byte limit at which the writer flushes. It should not exceed the batch buffer size.
+		///
+		BatchWriterOptions& setFlushBytes(unsigned value)
+		{
+			flushBytes = value;
+			return *this;
+		}
+
+	private:
+		unsigned commitEvery = 0;
+		std::optional<unsigned> flushBytes;
+	};
+
+	///
+	/// Error reported for one message written through a BatchWriter.
+	///
+	struct BatchWriterError final
+	{
+		///
+		/// Zero-based index of the message among all messages written.
+		///
+		unsigned index;
+
+		///
+		/// Detailed status vector, in `IStatus::getErrors()` format. Empty when the batch
+		/// ran out of detailed error slots (see `BatchOptions::setDetailedErrors()`).
+		///
+		std::vector<std::intptr_t> status;
+	};
+
+	///
+	/// Merged completion states of all the executions done by a BatchWriter.
+	///
+	struct BatchWriterReport final
+	{
+		///
+		/// Per-message states indexed by global message index, with the same meaning as
+		/// `BatchCompletionState::getState()`.
+		///
+		std::vector<int> states;
+
+		///
+		/// Failed messages, in message order.
+		///
+		std::vector<BatchWriterError> errors;
+
+		///
+		/// Number of batch executions.
+		///
+		unsigned flushCount = 0;
+
+		///
+		/// Number of times the transaction was committed with `commitRetaining()`.
+		///
+		unsigned commitCount = 0;
+	};
+
+	///
+	/// @brief Streams messages into a Batch, executing it automatically before its buffer fills up.
+	///
+	/// The writer tracks the bytes queued in the batch buffer (aligned messages plus inline blobs)
+	/// and executes the batch whenever the next message would exceed the batch buffer size
+	/// (`BatchOptions::getBufferBytesSize()`, or the Firebird default of 16 MB). The completion
+	/// states of all executions are merged into a single report indexed by global message number.
+	///
+	/// Batch-local blob IDs are only valid until the batch is executed, so the writer never flushes
+	/// between `addBlob()` and the message referencing it: the room check for a message is done
+	/// before its first blob is added.
+	///
+	class BatchWriter final
+	{
+	public:
+		///
+		/// Default batch buffer size used by Firebird when `BatchOptions::getBufferBytesSize()` is not set.
+		///
+		static constexpr unsigned DEFAULT_BUFFER_BYTES_SIZE = 16u * 1024u * 1024u;
+
+	public:
+		///
+		/// Creates a writer over the given batch. The batch must outlive the writer.
+		///
+		explicit BatchWriter(Batch& batch, const BatchWriterOptions& options = {});
+
+		BatchWriter(const BatchWriter&) = delete;
+		BatchWriter& operator=(const BatchWriter&) = delete;
+
+	public:
+		///
+		/// Adds `count` aligned raw messages, flushing between them as needed.
+		///
+		void add(unsigned count, const void* inBuffer);
+
+		///
+		/// Adds the current input message of the batch's Statement.
+		///
+		void addMessage();
+
+		///
+		/// Adds an inline blob for the next message and returns its batch-local ID.
+		///
+		BlobId addBlob(std::span<const std::byte> data, const BlobOptions& bpb = {});
+
+		///
+		/// Appends more data to the last blob added with `addBlob()`.
+		///
+		void appendBlobData(std::span<const std::byte> data);
+
+		///
+		/// Executes the queued messages, if any, and merges their completion state into the report.
+		///
+		void flush();
+
+		///
+		/// Flushes the remaining messages and returns the merged report, leaving the writer empty.
+		///
+		BatchWriterReport finish();
+
+		///
+		/// Returns the report of the executions done so far.
+		///
+		const BatchWriterReport& getReport() const noexcept
+		{
+			return report;
+		}
+
+		///
+		/// Returns the number of messages queued and not yet executed.
+		///
+		unsigned getPendingMessages() const noexcept
+		{
+			return pendingMessages;
+		}
+
+		///
+		/// Returns the estimated number of bytes queued in the batch buffer.
+		///
+		std::size_t getPendingBytes() const noexcept
+		{
+			return pendingBytes;
+		}
+
+		///
+		/// Returns the number of messages written, queued ones included.
+		///
+		unsigned getMessageCount() const noexcept
+		{
+			return flushedMessages + pendingMessages;
+		}
+
+	private:
+		void reserve(std::size_t bytes);
+		std::size_t getBlobBytes(std::size_t dataLength, const BlobOptions& bpb) const noexcept;
+
+	private:
+		Batch& batch;
+		BatchWriterOptions options;
+		std::size_t limit;
+		unsigned messageLength;
+		unsigned blobAlignment = 0;
+		unsigned pendingMessages = 0;
+		unsigned flushedMessages = 0;
+		std::size_t pendingBytes = 0;
+		bool inBlobGroup = false;
+		BatchWriterReport report;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_BATCH_WRITER_H
@@ -0,0 +1,595 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_BINDING_PLAN_H
+#define FBCPP_BINDING_PLAN_H
+
+#include "fb-api.h"
+#include "types.h"
+#include "Blob.h"
+#include "Descriptor.h"
+#include "Exception.h"
+#include "StructBinding.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+namespace fbcpp::impl
+{
+	///
+	/// Direct message codec for a C++ type. Specializations are provided for types whose in-message
+	/// representation is identical to a Firebird column type, so they can be copied without conversion.
+	///
+	template <typename T>
+	struct DirectCodec final
+	{
+		static constexpr bool supported = false;
+	};
+
+	///
+	/// Direct codec for trivially copyable values stored as-is in the message.
+	///
+	template <typename T, DescriptorAdjustedType TYPE, bool UNSCALED>
+	struct TrivialDirectCodec
+	{
+		static constexpr bool supported = true;
+
+		static bool matches(const DescriptorLayout& descriptor) noexcept
+		{
+			return descriptor.adjustedType == TYPE && (!UNSCALED || descriptor.scale == 0);
+		}
+
+		static T decode(const std::byte* data, const DescriptorLayout&) noexcept
+		{
+			return *reinterpret_cast<const T*>(data);
+		}
+
+		static bool encode(std::byte* data, const DescriptorLayout&, const T& value) noexcept
+		{
+			*reinterpret_cast<T*>(data) = value;
+			return true;
+		}
+	};
+
+	///
+	/// Direct codec for scaled integers. Encoding only succeeds when the value scale matches the column scale.
+	///
+	template <typename T, DescriptorAdjustedType TYPE>
+	struct ScaledDirectCodec
+	{
+		static constexpr bool supported = true;
+
+		static bool matches(const DescriptorLayout& descriptor) noexcept
+		{
+			return descriptor.adjustedType == TYPE;
+		}
+
+		static ScaledNumber<T> decode(const std::byte* data, const DescriptorLayout& descriptor) noexcept
+		{
+			return ScaledNumber<T>{*reinterpret_cast<const T*>(data), descriptor.scale};
+		}
+
+		static bool encode(std::byte* data, const DescriptorLayout& descriptor, const ScaledNumber<T>& value) noexcept
+		{
+			if (value.scale != descriptor.scale)
+				return false;
+
+			*reinterpret_cast<T*>(data) = value.value;
+			return true;
+		}
+	};
+
+	template <>
+	struct DirectCodec<std::int16_t> final : TrivialDirectCodec<std::int16_t, DescriptorAdjustedType::INT16, true>
+	{
+	};
+
+	template <>
+	struct DirectCodec<std::int32_t> final : TrivialDirectCodec<std::int32_t, DescriptorAdjustedType::INT32, true>
+	{
+	};
+
+	template <>
+	struct DirectCodec<std::int64_t> final : TrivialDirectCodec<std::int64_t, DescriptorAdjustedType::INT64, true>
+	{
+	};
+
+	template <>
+	struct DirectCodec<OpaqueInt128> final : TrivialDirectCodec<OpaqueInt128, DescriptorAdjustedType::INT128, true>
+	{
+	};
+
+	template <>
+	struct DirectCodec<float> final : TrivialDirectCodec<float, DescriptorAdjustedType::FLOAT, false>
+	{
+	};
+
+	template <>
+	struct DirectCodec<double> final : TrivialDirectCodec<double, DescriptorAdjustedType::DOUBLE, false>
+	{
+	};
+
+	template <>
+	struct DirectCodec<OpaqueDecFloat16> final
+		: TrivialDirectCodec<OpaqueDecFloat16, DescriptorAdjustedType::DECFLOAT16, false>
+	{
+	};
+
+	template <>
+	struct DirectCodec<OpaqueDecFloat34> final
+		: TrivialDirectCodec<OpaqueDecFloat34, DescriptorAdjustedType::DECFLOAT34, false>
+	{
+	};
+
+	template <>
+	struct DirectCodec<OpaqueDate> final : TrivialDirectCodec<OpaqueDate, DescriptorAdjustedType::DATE, false>
+	{
+	};
+
+	template <>
+	struct DirectCodec<OpaqueTime> final : TrivialDirectCodec<OpaqueTime, DescriptorAdjustedType::TIME, false>
+	{
+	};
+
+	template <>
+	struct DirectCodec<OpaqueTimestamp> final
+		: TrivialDirectCodec<OpaqueTimestamp, DescriptorAdjustedType::TIMESTAMP, false>
+	{
+	};
+
+	template <>
+	struct DirectCodec<OpaqueTimeTz> final : TrivialDirectCodec<OpaqueTimeTz, DescriptorAdjustedType::TIME_TZ, false>
+	{
+	};
+
+	template <>
+	struct DirectCodec<OpaqueTimestampTz> final
+		: TrivialDirectCodec<OpaqueTimestampTz, DescriptorAdjustedType::TIMESTAMP_TZ, false>
+	{
+	};
+
+	template <>
+	struct DirectCodec<ScaledInt16> final : ScaledDirectCodec<std::int16_t, DescriptorAdjustedType::INT16>
+	{
+	};
+
+	template <>
+	struct DirectCodec<ScaledInt32> final : ScaledDirectCodec<std::int32_t, DescriptorAdjustedType::INT32>
+	{
+	};
+
+	template <>
+	struct DirectCodec<ScaledInt64> final : ScaledDirectCodec<std::int64_t, DescriptorAdjustedType::INT64>
+	{
+	};
+
+	template <>
+	struct DirectCodec<ScaledOpaqueInt128> final : ScaledDirectCodec<OpaqueInt128, DescriptorAdjustedType::INT128>
+	{
+	};
+
+	template <>
+	struct DirectCodec<bool> final
+	{
+		static constexpr bool supported = true;
+
+		static bool matches(const DescriptorLayout& descriptor) noexcept
+		{
+			return descriptor.adjustedType == DescriptorAdjustedType::BOOLEAN;
+		}
+
+		static bool decode(const std::byte* data, const DescriptorLayout&) noexcept
+		{
+			return *data != std::byte{0};
+		}
+
+		static bool encode(std::byte* data, const DescriptorLayout&, bool value) noexcept
+		{
+			*data = value ? std::byte{1} : std::byte{0};
+			return true;
+		}
+	};
+
+	template <>
+	struct DirectCodec<BlobId> final
+	{
+		static constexpr bool supported = true;
+
+		static bool matches(const DescriptorLayout& descriptor) noexcept
+		{
+			return descriptor.adjustedType == DescriptorAdjustedType::BLOB;
+		}
+
+		static BlobId decode(const std::byte* data, const DescriptorLayout&) noexcept
+		{
+			BlobId value;
+			value.id = *reinterpret_cast<const ISC_QUAD*>(data);
+			return value;
+		}
+
+		static bool encode(std::byte* data, const DescriptorLayout&, const BlobId& value) noexcept
+		{
+			*reinterpret_cast<ISC_QUAD*>(data) = value.id;
+			return true;
+		}
+	};
+
+	///
+	/// Direct codec for VARCHAR columns. Encoding falls back to the checked path when the value does not
+	/// fit, so the usual truncation error is raised.
+	///
+	template <>
+	struct DirectCodec<std::string> final
+	{
+		static constexpr bool supported = true;
+
+		static bool matches(const DescriptorLayout& descriptor) noexcept
+		{
+			return descriptor.adjustedType == DescriptorAdjustedType::STRING;
+		}
+
+		static std::string decode(const std::byte* data, const DescriptorLayout&)
+		{
+			return std::string{reinterpret_cast<const char*>(data + sizeof(std::uint16_t)),
+				*reinterpret_cast<const std::uint16_t*>(data)};
+		}
+
+		static bool encode(std::byte* data, const DescriptorLayout& descriptor, std::string_view value) noexcept
+		{
+			if (value.length() > descriptor.length)
+				return false;
+
+			*reinterpret_cast<std::uint16_t*>(data) = static_cast<std::uint16_t>(value.length());
+			std::copy(value.begin(), value.end(), reinterpret_cast<char*>(data + sizeof(std::uint16_t)));
+			return true;
+		}
+	};
+
+	///
+	/// Direct codec for VARCHAR columns read or bound as non-owning views. Decoded views point into the message.
+	///
+	template <>
+	struct DirectCodec<std::string_view> final
+	{
+		static constexpr bool supported = true;
+
+		static bool matches(const DescriptorLayout& descriptor) noexcept
+		{
+			return DirectCodec<std::string>::matches(descriptor);
+		}
+
+		static std::string_view decode(const std::byte* data, const DescriptorLayout&) noexcept
+		{
+			return std::string_view{reinterpret_cast<const char*>(data + sizeof(std::uint16_t)),
+				*reinterpret_cast<const std::uint16_t*>(data)};
+		}
+
+		static bool encode(std::byte* data, const DescriptorLayout& descriptor, std::string_view value) noexcept
+		{
+			return DirectCodec<std::string>::encode(data, descriptor, value);
+		}
+	};
+
+	///
+	/// Strips std::optional from a bound field type.
+	///
+	template <typename T>
+	struct BindingValueType final
+	{
+		using Type = T;
+	};
+
+	template <typename T>
+	struct BindingValueType<std::optional<T>> final
+	{
+		using Type = T;
+	};
+
+	///
+	/// Resolves the type of the I-th field of an aggregate or tuple-like type.
+	///
+	template <typename T, std::size_t I, bool = TupleLike<T>>
+	struct BindingFieldType final
+	{
+		using Type = std::tuple_element_t<I, T>;
+	};
+
+	template <typename T, std::size_t I>
+	struct BindingFieldType<T, I, false> final
+	{
+		using Type = reflection::FieldType<T, I>;
+	};
+
+	///
+	/// Number of fields of an aggregate or tuple-like type.
+	///
+	template <typename T>
+	consteval std::size_t bindingFieldCount()
+	{
+		if constexpr (TupleLike<T>)
+			return std::tuple_size_v<T>;
+		else
+			return reflection::fieldCountV<T>;
+	}
+}  // namespace fbcpp::impl
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// @brief Precomputed column binding of an aggregate or tuple-like type to a descriptor set.
+	///
+	/// Building a plan validates the field count once and resolves, per field, whether the field type
+	/// exactly matches the in-message representation of its column. Matching fields are then copied
+	/// to and from the message without type dispatch; all others use the regular converting accessors
+	/// of Row and Statement. A plan is immutable and can be shared by any number of rows or
+	/// statements that use the same descriptor set.
+	///
+	template <typename T>
+		requires(Aggregate<T> || TupleLike<T>)
+	class BindingPlan final
+	{
+	public:
+		///
+		/// Number of fields in `T`.
+		///
+		static constexpr std::size_t FIELD_COUNT = impl::bindingFieldCount<T>();
+
+	public:
+		///
+		/// @brief Creates the plan for the given descriptor set.
+		/// @throws FbCppException if the field count of `T` does not match the descriptor count.
+		///
+		explicit BindingPlan(DescriptorSetPtr descriptorSet)
+			: descriptorSet{std::move(descriptorSet)}
+		{
+			if (!this->descriptorSet)
+				throw std::invalid_argument{"descriptorSet must not be null"};
+
+			if (FIELD_COUNT != this->descriptorSet->size())
+			{
+				throw FbCppException("Struct field count (" + std::to_string(FIELD_COUNT) +
+					") does not match descriptor count (" + std::to_string(this->descriptorSet->size()) + ")");
+			}
+
+			initFields(std::make_index_sequence<FIELD_COUNT>{});
+		}
+
+	public:
+		///
+		/// @brief Returns the descriptor set this plan was built for.
+		///
+		const DescriptorSetPtr& getDescriptorSet() const noexcept
+		{
+			return descriptorSet;
+		}
+
+		///
+		/// @brief Reports whether the given field is copied directly, bypassing type conversion.
+		///
+		bool isDirect(unsigned index) const
+		{
+			if (index >= FIELD_COUNT)
+				throw std::out_of_range("index out of range");
+
+			return fields[index].direct;
+		}
+
+		///
+		/// @brief Decodes a value from a message laid out by the plan descriptor set.
+		/// @param row Object used for fields that need conversion; must expose `get<F>(unsigned)`.
+		/// @param message Start of the message buffer.
+		///
+		template <typename R>
+		T read(R& row, const std::byte* message) const
+		{
+			return readFields<R>(row, message, std::make_index_sequence<FIELD_COUNT>{});
+		}
+
+		///
+		/// @brief Encodes a value into a message laid out by the plan descriptor set.
+		/// @param statement Object used for fields that need conversion; must expose `set(unsigned, F)`
+		/// and `getInputMessage()`. Converted fields are copied from its input message when `message`
+		/// is a different buffer.
+		/// @param message Start of the message buffer.
+		/// @param value The value to encode.
+		///
+		template <typename S>
+		void write(S& statement, std::byte* message, const T& value) const
+		{
+			if constexpr (TupleLike<T>)
+				writeFields(statement, message, value, std::make_index_sequence<FIELD_COUNT>{});
+			else
+			{
+				const auto tuple = impl::reflection::toTupleRef(value);
+				writeFields(statement, message, tuple, std::make_index_sequence<FIELD_COUNT>{});
+			}
+		}
+
+	private:
+		template <std::size_t I>
+		using Field = typename impl::BindingFieldType<T, I>::Type;
+
+		template <std::size_t... Is>
+		void initFields(std::index_sequence<Is...>)
+		{
+			(initField<Is>(), ...);
+		}
+
+		template <std::size_t I>
+		void initField()
+		{
+			using F = Field<I>;
+			using V = typename impl::BindingValueType<F>::Type;
+
+			auto& field = fields[I];
+			field.layout = descriptorSet->getLayout(static_cast<unsigned>(I));
+
+			if constexpr (!impl::reflection::isVariantV<F> && impl::DirectCodec<V>::supported)
+				field.direct = impl::DirectCodec<V>::matches(field.layout);
+		}
+
+		template <typename R, std::size_t... Is>
+		T readFields(R& row, const std::byte* message, std::index_sequence<Is...>) const
+		{
+			return T{readField<Is>(row, message)...};
+		}
+
+		template <std::size_t I, typename R>
+		Field<I> readField(R& row, const std::byte* message) const
+		{
+			using namespace impl::reflection;
+			using F = Field<I>;
+			using V = typename impl::BindingValueType<F>::Type;
+
+			constexpr auto index = static_cast<unsigned>(I);
+
+			if constexpr (isVariantV<F>)
+				return row.template get<F>(index);
+			else
+			{
+				if constexpr (impl::DirectCodec<V>::supported)
+				{
+					const auto& field = fields[I];
+
+					if (field.direct)
+					{
+						if (*reinterpret_cast<const std::int16_t*>(&message[field.layout.nullOffset]) != FB_FALSE)
+						{
+							if constexpr (isOptionalV<F>)
+								return std::nullopt;
+							else
+								throwNullField(index);
+						}
+
+						return impl::DirectCodec<V>::decode(&message[field.layout.offset], field.layout);
+					}
+				}
+
+				if constexpr (isOptionalV<F>)
+					return row.template get<F>(index);
+				else
+				{
+					auto opt = row.template get<std::optional<F>>(index);
+
+					if (!opt.has_value())
+						throwNullField(index);
+
+					return std::move(opt.value());
+				}
+			}
+		}
+
+		template <typename S, typename Tuple, std::size_t... Is>
+		void writeFields(S& statement, std::byte* message, const Tuple& tuple, std::index_sequence<Is...>) const
+		{
+			(writeField<Is>(statement, message, std::get<Is>(tuple)), ...);
+		}
+
+		template <std::size_t I, typename S>
+		void writeField(S& statement, std::byte* message, const Field<I>& value) const
+		{
+			using namespace impl::reflection;
+			using F = Field<I>;
+			using V = typename impl::BindingValueType<F>::Type;
+
+			constexpr auto index = static_cast<unsigned>(I);
+
+			if constexpr (!isVariantV<F> && impl::DirectCodec<V>::supported)
+			{
+				const auto& field = fields[I];
+
+				if (field.direct)
+				{
+					const auto nullFlag = reinterpret_cast<std::int16_t*>(&message[field.layout.nullOffset]);
+
+					if constexpr (isOptionalV<F>)
+					{
+						if (!value.has_value())
+						{
+							*nullFlag = FB_TRUE;
+							return;
+						}
+
+						if (impl::DirectCodec<V>::encode(&message[field.layout.offset], field.layout, value.value()))
+						{
+							*nullFlag = FB_FALSE;
+							return;
+						}
+					}
+					else if (impl::DirectCodec<V>::encode(&message[field.layout.offset], field.layout, value))
+					{
+						*nullFlag = FB_FALSE;
+						return;
+					}
+				}
+			}
+
+			statement.set(index, value);
+
+			// The converting setters write into the statement input message; copy the field when
+			// encoding into another buffer laid out the same way.
+			if (const auto source = statement.getInputMessage().data(); source != message)
+			{
+				const auto& field = fields[I];
+				const auto size = field.layout.length +
+					(field.layout.adjustedType == DescriptorAdjustedType::STRING ? sizeof(std::uint16_t) : 0u);
+
+				std::copy_n(source + field.layout.offset, size, message + field.layout.offset);
+				std::copy_n(source + field.layout.nullOffset, sizeof(std::int16_t), message + field.layout.nullOffset);
+			}
+		}
+
+		[[noreturn]] static void throwNullField(unsigned index)
+		{
+			throw FbCppException("Null value encountered for non-optional field at index " + std::to_string(index));
+		}
+
+	private:
+		struct FieldPlan final
+		{
+			DescriptorLayout layout{};
+			bool direct = false;
+		};
+
+		DescriptorSetPtr descriptorSet;
+		std::array<FieldPlan, FIELD_COUNT> fields{};
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_BINDING_PLAN_H
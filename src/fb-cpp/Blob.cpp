@@ -26,49 +26,22 @@
 #include "Attachment.h"
 #include "Client.h"
 #include "Transaction.h"
+#include "MappedFile.h"
 #include "firebird/impl/inf_pub.h"
 #include <cstdint>
 #include <cstring>
+#include <fstream>
 #include <limits>
+#include <memory>
 #include <vector>
 
 using namespace fbcpp;
 using namespace fbcpp::impl;
 
-Blob::Blob(Attachment& attachment, Transaction& transaction, const BlobOptions& options)
-	: attachment{attachment},
-	  transaction{transaction},
-	  statusWrapper{attachment.getClient()}
-{
-	assert(attachment.isValid());
-	assert(transaction.isValid());
-
-	const auto preparedBpb = prepareBpb(options);
-
-	handle.reset(attachment.getHandle()->createBlob(&statusWrapper, transaction.getHandle().get(), &id.id,
-		static_cast<unsigned>(preparedBpb.size()), preparedBpb.data()));
-}
 
-Blob::Blob(Attachment& attachment, Transaction& transaction, const BlobId& blobId, const BlobOptions& options)
-	: attachment{attachment},
-	  transaction{transaction},
-	  id{blobId},
-	  statusWrapper{attachment.getClient()}
+static std::vector<std::uint8_t> buildBpb(Client& client, StatusWrapper& statusWrapper, const BlobOptions& options)
 {
-	assert(attachment.isValid());
-	assert(transaction.isValid());
-
-	const auto preparedBpb = prepareBpb(options);
-
-	handle.reset(attachment.getHandle()->openBlob(&statusWrapper, transaction.getHandle().get(), &id.id,
-		static_cast<unsigned>(preparedBpb.size()), preparedBpb.data()));
-}
-
-std::vector<std::uint8_t> Blob::prepareBpb(const BlobOptions& options)
-{
-	const auto util = attachment.getClient().getUtil();
-
-	auto builder = fbUnique(util->getXpbBuilder(&statusWrapper, fb::IXpbBuilder::BPB,
+	auto builder = fbUnique(client.getUtil()->getXpbBuilder(&statusWrapper, fb::IXpbBuilder::BPB,
 		reinterpret_cast<const std::uint8_t*>(options.getBpb().data()),
 		static_cast<unsigned>(options.getBpb().size())));
 
@@ -101,6 +74,78 @@ std::vector<std::uint8_t> Blob::prepareBpb(const BlobOptions& options)
 	return bpb;
 }
 
+
+ParameterBlock BlobOptions::compile(Client& client) const
+{
+	StatusWrapper statusWrapper{client};
+
+	return ParameterBlock{ParameterBlockType::BPB, buildBpb(client, statusWrapper, *this)};
+}
+
+
+Blob::Blob(Attachment& attachment, Transaction& transaction, const BlobOptions& options)
+	: attachment{attachment},
+	  transaction{transaction},
+	  statusWrapper{attachment.getClient()},
+	  observer{attachment.getObserver()}
+{
+	assert(attachment.isValid());
+	assert(transaction.isValid());
+
+	const auto preparedBpb = buildBpb(attachment.getClient(), statusWrapper, options);
+
+	handle.reset(attachment.getHandle()->createBlob(&statusWrapper, transaction.getHandle().get(), &id.id,
+		static_cast<unsigned>(preparedBpb.size()), preparedBpb.data()));
+}
+
+Blob::Blob(Attachment& attachment, Transaction& transaction, const BlobId& blobId, const BlobOptions& options)
+	: attachment{attachment},
+	  transaction{transaction},
+	  id{blobId},
+	  statusWrapper{attachment.getClient()},
+	  observer{attachment.getObserver()}
+{
+	assert(attachment.isValid());
+	assert(transaction.isValid());
+
+	const auto preparedBpb = buildBpb(attachment.getClient(), statusWrapper, options);
+
+	handle.reset(attachment.getHandle()->openBlob(&statusWrapper, transaction.getHandle().get(), &id.id,
+		static_cast<unsigned>(preparedBpb.size()), preparedBpb.data()));
+}
+
+Blob::Blob(Attachment& attachment, Transaction& transaction, const ParameterBlock& bpb)
+	: attachment{attachment},
+	  transaction{transaction},
+	  statusWrapper{attachment.getClient()},
+	  observer{attachment.getObserver()}
+{
+	assert(attachment.isValid());
+	assert(transaction.isValid());
+
+	bpb.checkType(ParameterBlockType::BPB);
+
+	handle.reset(attachment.getHandle()->createBlob(
+		&statusWrapper, transaction.getHandle().get(), &id.id, bpb.getLength(), bpb.getData()));
+}
+
+Blob::Blob(Attachment& attachment, Transaction& transaction, const BlobId& blobId, const ParameterBlock& bpb)
+	: attachment{attachment},
+	  transaction{transaction},
+	  id{blobId},
+	  statusWrapper{attachment.getClient()},
+	  observer{attachment.getObserver()}
+{
+	assert(attachment.isValid());
+	assert(transaction.isValid());
+
+	bpb.checkType(ParameterBlockType::BPB);
+
+	handle.reset(attachment.getHandle()->openBlob(
+		&statusWrapper, transaction.getHandle().get(), &id.id, bpb.getLength(), bpb.getData()));
+}
+
+
 unsigned Blob::getLength()
 {
 	assert(isValid());
@@ -155,21 +200,33 @@ unsigned Blob::read(std::span<std::byte> buffer)
 {
 	assert(isValid());
 
+	OperationScope scope{observer.get(), OperationType::BLOB_READ};
 	unsigned totalRead = 0;
-	const unsigned maxChunkSize = std::numeric_limits<std::uint16_t>::max();
 
-	while (!buffer.empty())
+	try
 	{
-		const auto chunkSize = buffer.size() < maxChunkSize ? buffer.size() : maxChunkSize;
-		const auto chunk = buffer.first(chunkSize);
-		const auto readNow = readSegment(chunk);
+		const unsigned maxChunkSize = std::numeric_limits<std::uint16_t>::max();
 
-		if (readNow == 0)
-			break;
+		while (!buffer.empty())
+		{
+			const auto chunkSize = buffer.size() < maxChunkSize ? buffer.size() : maxChunkSize;
+			const auto chunk = buffer.first(chunkSize);
+			const auto readNow = getSegment(chunk);
 
-		totalRead += readNow;
-		buffer = buffer.subspan(readNow);
+			if (readNow == 0)
+				break;
+
+			totalRead += readNow;
+			buffer = buffer.subspan(readNow);
+		}
 	}
+	catch (...)
+	{
+		scope.fail();
+		throw;
+	}
+
+	scope.finish(0u, totalRead);
 
 	return totalRead;
 }
@@ -178,10 +235,78 @@ unsigned Blob::readSegment(std::span<std::byte> buffer)
 {
 	assert(isValid());
 
+	OperationScope scope{observer.get(), OperationType::BLOB_READ};
+	unsigned segmentLength;
+
+	try
+	{
+		segmentLength = getSegment(buffer);
+	}
+	catch (...)
+	{
+		scope.fail();
+		throw;
+	}
+
+	scope.finish(0u, segmentLength);
+
+	return segmentLength;
+}
+
+void Blob::write(std::span<const std::byte> buffer)
+{
+	assert(isValid());
+
+	OperationScope scope{observer.get(), OperationType::BLOB_WRITE};
+	const auto totalSize = buffer.size();
+
+	try
+	{
+		const unsigned maxChunkSize = std::numeric_limits<std::uint16_t>::max();
+
+		while (!buffer.empty())
+		{
+			const auto chunkSize = buffer.size() < maxChunkSize ? buffer.size() : maxChunkSize;
+			const auto chunk = buffer.first(chunkSize);
+			putSegment(chunk);
+			buffer = buffer.subspan(chunkSize);
+		}
+	}
+	catch (...)
+	{
+		scope.fail();
+		throw;
+	}
+
+	scope.finish(0u, totalSize);
+}
+
+void Blob::writeSegment(std::span<const std::byte> buffer)
+{
+	assert(isValid());
+
+	OperationScope scope{observer.get(), OperationType::BLOB_WRITE};
+
+	try
+	{
+		putSegment(buffer);
+	}
+	catch (...)
+	{
+		scope.fail();
+		throw;
+	}
+
+	scope.finish(0u, buffer.size());
+}
+
+unsigned Blob::getSegment(std::span<std::byte> buffer)
+{
 	if (buffer.empty())
 		return 0;
 
 	unsigned segmentLength = 0;
+	MetricsScope metrics{attachment.getClient().getMetricsRegistry(), MetricsCall::GET_SEGMENT};
 	const auto result =
 		handle->getSegment(&statusWrapper, static_cast<unsigned>(buffer.size()), buffer.data(), &segmentLength);
 
@@ -199,32 +324,73 @@ unsigned Blob::readSegment(std::span<std::byte> buffer)
 	}
 }
 
-void Blob::write(std::span<const std::byte> buffer)
+void Blob::putSegment(std::span<const std::byte> buffer)
+{
+	if (buffer.empty())
+		return;
+
+	if (buffer.size() > std::numeric_limits<unsigned>::max())
+		throw FbCppException("Segment too large");
+
+	MetricsScope metrics{attachment.getClient().getMetricsRegistry(), MetricsCall::PUT_SEGMENT};
+	handle->putSegment(&statusWrapper, static_cast<unsigned>(buffer.size()), buffer.data());
+}
+
+std::uint64_t Blob::writeFromFile(const std::filesystem::path& path)
 {
 	assert(isValid());
 
-	const unsigned maxChunkSize = std::numeric_limits<std::uint16_t>::max();
+	MappedFile file{path};
+	file.forEachView([this](std::span<const std::byte> view) { write(view); });
 
-	while (!buffer.empty())
-	{
-		const auto chunkSize = buffer.size() < maxChunkSize ? buffer.size() : maxChunkSize;
-		const auto chunk = buffer.first(chunkSize);
-		writeSegment(chunk);
-		buffer = buffer.subspan(chunkSize);
-	}
+	return file.getSize();
 }
 
-void Blob::writeSegment(std::span<const std::byte> buffer)
+std::uint64_t Blob::readToFile(const std::filesystem::path& path)
 {
 	assert(isValid());
 
-	if (buffer.empty())
-		return;
+	constexpr std::size_t bufferSize = 1024u * 1024u;
+	const auto buffer = std::make_unique_for_overwrite<std::byte[]>(bufferSize);
 
-	if (buffer.size() > std::numeric_limits<unsigned>::max())
-		throw FbCppException("Segment too large");
+	std::ofstream out;
+	out.rdbuf()->pubsetbuf(nullptr, 0);
+	out.open(path, std::ios::binary | std::ios::trunc);
 
-	handle->putSegment(&statusWrapper, static_cast<unsigned>(buffer.size()), buffer.data());
+	if (!out)
+		throw FbCppException("Cannot open file '" + path.string() + "' for writing");
+
+	std::uint64_t total = 0u;
+
+	while (true)
+	{
+		const auto count = read(std::span<std::byte>{buffer.get(), bufferSize});
+
+		if (count != 0u && !out.write(reinterpret_cast<const char*>(buffer.get()), count))
+			throw FbCppException("Cannot write file '" + path.string() + "'");
+
+		total += count;
+
+		if (count < bufferSize)
+			break;
+	}
+
+	out.close();
+
+	if (!out)
+		throw FbCppException("Cannot write file '" + path.string() + "'");
+
+	return total;
+}
+
+AsyncOperation<unsigned> Blob::readAsync(AsyncExecutor& executor, std::span<std::byte> buffer)
+{
+	return executor.run(&attachment, [this, buffer] { return read(buffer); });
+}
+
+AsyncOperation<void> Blob::writeAsync(AsyncExecutor& executor, std::span<const std::byte> buffer)
+{
+	return executor.run(&attachment, [this, buffer] { write(buffer); });
 }
 
 int Blob::seek(BlobSeekMode mode, int offset)
@@ -28,9 +28,14 @@
 #include "fb-api.h"
 #include "SmartPtrs.h"
 #include "Exception.h"
+#include "Observer.h"
+#include "AsyncExecutor.h"
+#include "ParameterBlock.h"
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
+#include <memory>
 #include <optional>
 #include <span>
 #include <utility>
@@ -43,6 +48,7 @@
 namespace fbcpp
 {
 	class Attachment;
+	class Client;
 	class Transaction;
 
 	///
@@ -230,6 +236,12 @@ namespace fbcpp
 			return *this;
 		}
 
+		///
+		/// Encodes these options in a BPB that can be passed to the Blob constructors, so that creating or
+		/// opening blobs with the same options does not build the BPB again.
+		///
+		ParameterBlock compile(Client& client) const;
+
 	private:
 		std::vector<std::uint8_t> bpb;
 		std::optional<BlobType> type;
@@ -277,6 +289,16 @@ namespace fbcpp
 		///
 		Blob(Attachment& attachment, Transaction& transaction, const BlobId& blobId, const BlobOptions& options = {});
 
+		///
+		/// Creates and opens a new blob for writing, using a BPB returned by `BlobOptions::compile()`.
+		///
+		Blob(Attachment& attachment, Transaction& transaction, const ParameterBlock& bpb);
+
+		///
+		/// Opens an existing blob for reading or writing, using a BPB returned by `BlobOptions::compile()`.
+		///
+		Blob(Attachment& attachment, Transaction& transaction, const BlobId& blobId, const ParameterBlock& bpb);
+
 		///
 		/// Transfers blob ownership from another instance.
 		///
@@ -285,7 +307,8 @@ namespace fbcpp
 			  transaction{o.transaction},
 			  id{o.id},
 			  statusWrapper{std::move(o.statusWrapper)},
-			  handle{std::move(o.handle)}
+			  handle{std::move(o.handle)},
+			  observer{std::move(o.observer)}
 		{
 		}
 
@@ -404,6 +427,41 @@ namespace fbcpp
 			writeSegment(std::as_bytes(buffer));
 		}
 
+		///
+		/// @brief Writes the whole contents of a file into the blob.
+		///
+		/// The file is memory-mapped and sent in segment-sized slices straight from the mapping,
+		/// one bounded view at a time, so it is never copied into an intermediate buffer.
+		///
+		/// @return The number of bytes written.
+		///
+		std::uint64_t writeFromFile(const std::filesystem::path& path);
+
+		///
+		/// @brief Reads the remaining blob contents into a file, replacing it.
+		///
+		/// Data is accumulated in a large buffer and written to the file in whole buffer-sized
+		/// blocks at block-aligned offsets.
+		///
+		/// @return The number of bytes read.
+		///
+		std::uint64_t readToFile(const std::filesystem::path& path);
+
+		///
+		/// Returns an awaitable that reads data into the buffer on an I/O thread of the executor.
+		///
+		/// Calls on the same Attachment are serialized. The blob and the buffer must remain valid until
+		/// the operation completes.
+		///
+		AsyncOperation<unsigned> readAsync(AsyncExecutor& executor, std::span<std::byte> buffer);
+
+		///
+		/// Returns an awaitable that writes the buffer on an I/O thread of the executor.
+		///
+		/// The blob and the buffer must remain valid until the operation completes.
+		///
+		AsyncOperation<void> writeAsync(AsyncExecutor& executor, std::span<const std::byte> buffer);
+
 		///
 		/// Repositions the blob read/write cursor.
 		///
@@ -420,7 +478,8 @@ namespace fbcpp
 		void close();
 
 	private:
-		std::vector<std::uint8_t> prepareBpb(const BlobOptions& options);
+		unsigned getSegment(std::span<std::byte> buffer);
+		void putSegment(std::span<const std::byte> buffer);
 
 	private:
 		Attachment& attachment;
@@ -428,6 +487,7 @@ namespace fbcpp
 		BlobId id;
 		impl::StatusWrapper statusWrapper;
 		FbRef<fb::IBlob> handle;
+		std::shared_ptr<OperationObserver> observer;
 	};
 }  // namespace fbcpp
 
@@ -0,0 +1,474 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "BlobStream.h"
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+static void validateOptions(const char* className, const BlobStreamOptions& options)
+{
+	if (options.getBufferSize() == 0 ||
+		options.getBufferSize() > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+	{
+		throw std::invalid_argument{std::string{className} + " bufferSize is out of range"};
+	}
+
+	if (options.getBufferCount() == 0)
+		throw std::invalid_argument{std::string{className} + " bufferCount must be greater than zero"};
+}
+
+static BlobStreamChunk allocateChunk(std::size_t bufferSize)
+{
+	return BlobStreamChunk{.data = std::make_unique_for_overwrite<std::byte[]>(bufferSize), .size = 0};
+}
+
+static std::size_t readChunk(Blob& blob, BlobStreamChunk& chunk, std::size_t bufferSize)
+{
+	chunk.size = blob.read(std::span<std::byte>{chunk.data.get(), bufferSize});
+	return chunk.size;
+}
+
+
+BlobReader::BlobReader(Blob& blob, const BlobStreamOptions& options)
+	: blob{blob},
+	  bufferSize{options.getBufferSize()},
+	  bufferCount{options.getBufferCount()},
+	  async{options.getAsync()}
+{
+	assert(blob.isValid());
+
+	validateOptions("BlobReader", options);
+
+	if (async)
+	{
+		freeChunks.reserve(bufferCount);
+		producer = std::thread{&BlobReader::produce, this};
+	}
+}
+
+std::size_t BlobReader::read(std::span<std::byte> buffer)
+{
+	return static_cast<std::size_t>(
+		sgetn(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size())));
+}
+
+std::uint64_t BlobReader::copyTo(std::ostream& out)
+{
+	std::uint64_t total = 0;
+
+	while (gptr() < egptr() || nextChunk())
+	{
+		const auto available = egptr() - gptr();
+
+		if (!out.write(gptr(), available))
+			throw FbCppException("BlobReader::copyTo failed writing to the output stream");
+
+		gbump(static_cast<int>(available));
+		total += static_cast<std::uint64_t>(available);
+	}
+
+	return total;
+}
+
+void BlobReader::close()
+{
+	{  // scope
+		std::lock_guard mutexGuard{mutex};
+		stopping = true;
+		finished = true;
+	}
+
+	condition.notify_all();
+
+	if (producer.joinable())
+		producer.join();
+
+	std::lock_guard mutexGuard{mutex};
+	setg(nullptr, nullptr, nullptr);
+	current = {};
+	filledChunks.clear();
+	freeChunks.clear();
+	error = nullptr;
+}
+
+BlobReader::int_type BlobReader::underflow()
+{
+	if (gptr() == egptr() && !nextChunk())
+		return traits_type::eof();
+
+	return traits_type::to_int_type(*gptr());
+}
+
+bool BlobReader::nextChunk()
+{
+	if (!async)
+	{
+		if (finished)
+			return false;
+
+		if (!current.data)
+			current = allocateChunk(bufferSize);
+
+		if (readChunk(blob, current, bufferSize) < bufferSize)
+			finished = true;
+	}
+	else
+	{
+		std::unique_lock mutexGuard{mutex};
+
+		if (current.data)
+		{
+			freeChunks.push_back(std::move(current));
+			current = {};
+			condition.notify_all();
+		}
+
+		condition.wait(mutexGuard, [this] { return !filledChunks.empty() || finished; });
+
+		if (!filledChunks.empty())
+		{
+			current = std::move(filledChunks.front());
+			filledChunks.pop_front();
+		}
+		else if (error)
+		{
+			setg(nullptr, nullptr, nullptr);
+			std::rethrow_exception(std::exchange(error, nullptr));
+		}
+	}
+
+	if (current.size == 0)
+	{
+		setg(nullptr, nullptr, nullptr);
+		return false;
+	}
+
+	const auto begin = reinterpret_cast<char*>(current.data.get());
+	setg(begin, begin, begin + current.size);
+
+	return true;
+}
+
+void BlobReader::produce()
+{
+	while (true)
+	{
+		BlobStreamChunk chunk;
+
+		{  // scope
+			std::unique_lock mutexGuard{mutex};
+
+			condition.wait(
+				mutexGuard, [this] { return stopping || !freeChunks.empty() || createdChunks < bufferCount; });
+
+			if (stopping)
+				return;
+
+			if (!freeChunks.empty())
+			{
+				chunk = std::move(freeChunks.back());
+				freeChunks.pop_back();
+			}
+			else
+				++createdChunks;
+		}
+
+		bool eof;
+
+		try
+		{
+			if (!chunk.data)
+				chunk = allocateChunk(bufferSize);
+
+			eof = readChunk(blob, chunk, bufferSize) < bufferSize;
+		}
+		catch (...)
+		{
+			std::lock_guard mutexGuard{mutex};
+			error = std::current_exception();
+			finished = true;
+			condition.notify_all();
+			return;
+		}
+
+		{  // scope
+			std::lock_guard mutexGuard{mutex};
+
+			if (chunk.size != 0)
+				filledChunks.push_back(std::move(chunk));
+
+			if (eof)
+				finished = true;
+		}
+
+		condition.notify_all();
+
+		if (eof)
+			return;
+	}
+}
+
+
+BlobWriter::BlobWriter(Blob& blob, const BlobStreamOptions& options)
+	: blob{blob},
+	  bufferSize{options.getBufferSize()},
+	  bufferCount{options.getBufferCount()},
+	  async{options.getAsync()}
+{
+	assert(blob.isValid());
+
+	validateOptions("BlobWriter", options);
+
+	current = allocateChunk(bufferSize);
+	createdChunks = 1;
+	resetPutArea();
+
+	if (async)
+	{
+		freeChunks.reserve(bufferCount);
+		consumer = std::thread{&BlobWriter::consume, this};
+	}
+}
+
+void BlobWriter::write(std::span<const std::byte> buffer)
+{
+	assert(!closed);
+
+	while (!buffer.empty())
+	{
+		if (pptr() == epptr())
+			submit();
+
+		const auto count = std::min(buffer.size(), static_cast<std::size_t>(epptr() - pptr()));
+		traits_type::copy(pptr(), reinterpret_cast<const char*>(buffer.data()), count);
+		pbump(static_cast<int>(count));
+		buffer = buffer.subspan(count);
+	}
+}
+
+std::uint64_t BlobWriter::copyFrom(std::istream& in)
+{
+	assert(!closed);
+
+	std::uint64_t total = 0;
+
+	while (true)
+	{
+		if (pptr() == epptr())
+			submit();
+
+		const auto requested = epptr() - pptr();
+		in.read(pptr(), requested);
+
+		const auto count = in.gcount();
+		pbump(static_cast<int>(count));
+		total += static_cast<std::uint64_t>(count);
+
+		if (count < requested)
+		{
+			if (in.bad())
+				throw FbCppException("BlobWriter::copyFrom failed reading from the input stream");
+
+			break;
+		}
+	}
+
+	return total;
+}
+
+void BlobWriter::flush()
+{
+	assert(!closed);
+
+	if (pptr() != pbase())
+		submit();
+
+	if (async)
+	{
+		std::unique_lock mutexGuard{mutex};
+
+		condition.wait(mutexGuard, [this] { return error || (pendingChunks.empty() && !busy); });
+
+		if (error)
+			std::rethrow_exception(error);
+	}
+}
+
+void BlobWriter::close()
+{
+	if (closed)
+		return;
+
+	std::exception_ptr flushError;
+
+	try
+	{
+		flush();
+	}
+	catch (...)
+	{
+		flushError = std::current_exception();
+	}
+
+	{  // scope
+		std::lock_guard mutexGuard{mutex};
+		stopping = true;
+	}
+
+	condition.notify_all();
+
+	if (consumer.joinable())
+		consumer.join();
+
+	closed = true;
+	setp(nullptr, nullptr);
+	current = {};
+	pendingChunks.clear();
+	freeChunks.clear();
+	error = nullptr;
+
+	if (flushError)
+		std::rethrow_exception(flushError);
+}
+
+BlobWriter::int_type BlobWriter::overflow(int_type ch)
+{
+	assert(!closed);
+
+	if (pptr() == epptr())
+		submit();
+
+	if (!traits_type::eq_int_type(ch, traits_type::eof()))
+	{
+		*pptr() = traits_type::to_char_type(ch);
+		pbump(1);
+	}
+
+	return traits_type::not_eof(ch);
+}
+
+int BlobWriter::sync()
+{
+	flush();
+	return 0;
+}
+
+void BlobWriter::submit()
+{
+	current.size = static_cast<std::size_t>(pptr() - pbase());
+
+	if (!async)
+	{
+		blob.write(std::span<const std::byte>{current.data.get(), current.size});
+		resetPutArea();
+		return;
+	}
+
+	std::unique_lock mutexGuard{mutex};
+
+	if (error)
+		std::rethrow_exception(error);
+
+	pendingChunks.push_back(std::move(current));
+	current = {};
+	setp(nullptr, nullptr);
+	condition.notify_all();
+
+	condition.wait(mutexGuard, [this] { return error || !freeChunks.empty() || createdChunks < bufferCount; });
+
+	if (error)
+		std::rethrow_exception(error);
+
+	if (!freeChunks.empty())
+	{
+		current = std::move(freeChunks.back());
+		freeChunks.pop_back();
+	}
+	else
+	{
+		current = allocateChunk(bufferSize);
+		++createdChunks;
+	}
+
+	resetPutArea();
+}
+
+void BlobWriter::resetPutArea()
+{
+	const auto begin = reinterpret_cast<char*>(current.data.get());
+	current.size = 0;
+	setp(begin, begin + bufferSize);
+}
+
+void BlobWriter::consume()
+{
+	while (true)
+	{
+		BlobStreamChunk chunk;
+
+		{  // scope
+			std::unique_lock mutexGuard{mutex};
+
+			condition.wait(mutexGuard, [this] { return stopping || !pendingChunks.empty(); });
+
+			if (pendingChunks.empty())
+				return;
+
+			chunk = std::move(pendingChunks.front());
+			pendingChunks.pop_front();
+			busy = true;
+		}
+
+		try
+		{
+			blob.write(std::span<const std::byte>{chunk.data.get(), chunk.size});
+		}
+		catch (...)
+		{
+			std::lock_guard mutexGuard{mutex};
+			error = std::current_exception();
+			busy = false;
+			pendingChunks.clear();
+			condition.notify_all();
+			return;
+		}
+
+		{  // scope
+			std::lock_guard mutexGuard{mutex};
+			busy = false;
+			freeChunks.push_back(std::move(chunk));
+		}
+
+		condition.notify_all();
+	}
+}
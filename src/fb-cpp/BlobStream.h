@@ -0,0 +1,376 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_BLOB_STREAM_H
+#define FBCPP_BLOB_STREAM_H
+
+#include "Blob.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <span>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// Options used by BlobReader and BlobWriter.
+	///
+	class BlobStreamOptions final
+	{
+	public:
+		///
+		/// Returns the size in bytes of each internal buffer.
+		///
+		std::size_t getBufferSize() const noexcept
+		{
+			return bufferSize;
+		}
+
+		///
+		/// Sets the size in bytes of each internal buffer.
+		///
+		BlobStreamOptions& setBufferSize(std::size_t value) noexcept
+		{
+			bufferSize = value;
+			return *this;
+		}
+
+		///
+		/// Returns the maximum number of buffers alive at once, including the one used by the caller.
+		///
+		unsigned getBufferCount() const noexcept
+		{
+			return bufferCount;
+		}
+
+		///
+		/// Sets the maximum number of buffers alive at once, including the one used by the caller.
+		///
+		BlobStreamOptions& setBufferCount(unsigned value) noexcept
+		{
+			bufferCount = value;
+			return *this;
+		}
+
+		///
+		/// Returns whether blob segments are transferred on a background thread.
+		///
+		bool getAsync() const noexcept
+		{
+			return async;
+		}
+
+		///
+		/// Sets whether blob segments are transferred on a background thread.
+		/// When disabled, buffers are read or written on the caller thread.
+		///
+		BlobStreamOptions& setAsync(bool value) noexcept
+		{
+			async = value;
+			return *this;
+		}
+
+	private:
+		std::size_t bufferSize = 1024 * 1024;
+		unsigned bufferCount = 2;
+		bool async = true;
+	};
+
+	namespace impl
+	{
+		///
+		/// Buffer exchanged between a blob stream and its background thread.
+		///
+		struct BlobStreamChunk final
+		{
+			std::unique_ptr<std::byte[]> data;
+			std::size_t size = 0;
+		};
+	}  // namespace impl
+
+	///
+	/// @brief Stream buffer reading a blob through large buffers.
+	///
+	/// With async enabled, a background thread reads the next buffers from the blob while the
+	/// caller consumes the current one, so segment round trips overlap with processing.
+	/// The blob must stay open and must not be used by the caller while the reader exists.
+	///
+	class BlobReader final : public std::streambuf
+	{
+	public:
+		///
+		/// @brief Starts reading `blob` from its current position.
+		///
+		explicit BlobReader(Blob& blob, const BlobStreamOptions& options = {});
+
+		///
+		/// @brief Stops the background thread, waiting for an in-flight read to complete.
+		///
+		~BlobReader() noexcept override
+		{
+			try
+			{
+				close();
+			}
+			catch (...)
+			{
+				// swallow
+			}
+		}
+
+		BlobReader(const BlobReader&) = delete;
+		BlobReader& operator=(const BlobReader&) = delete;
+
+		BlobReader(BlobReader&&) = delete;
+		BlobReader& operator=(BlobReader&&) = delete;
+
+	public:
+		///
+		/// @brief Reads up to `buffer.size()` bytes.
+		/// @return The number of bytes read, less than requested only at the end of the blob.
+		///
+		std::size_t read(std::span<std::byte> buffer);
+
+		///
+		/// @brief Reads up to `buffer.size()` bytes.
+		/// @return The number of bytes read, less than requested only at the end of the blob.
+		///
+		std::size_t read(std::span<char> buffer)
+		{
+			return read(std::as_writable_bytes(buffer));
+		}
+
+		///
+		/// @brief Copies the remaining blob contents to `out`, buffer by buffer.
+		/// @return The number of bytes copied.
+		///
+		std::uint64_t copyTo(std::ostream& out);
+
+		///
+		/// @brief Stops reading. Further reads report the end of the blob.
+		///
+		void close();
+
+	protected:
+		int_type underflow() override;
+
+	private:
+		bool nextChunk();
+		void produce();
+
+	private:
+		Blob& blob;
+		std::size_t bufferSize;
+		unsigned bufferCount;
+		bool async;
+		unsigned createdChunks = 0;
+		impl::BlobStreamChunk current;
+		std::deque<impl::BlobStreamChunk> filledChunks;
+		std::vector<impl::BlobStreamChunk> freeChunks;
+		std::exception_ptr error;
+		std::mutex mutex;
+		std::condition_variable condition;
+		std::thread producer;
+		bool finished = false;
+		bool stopping = false;
+	};
+
+	///
+	/// @brief Stream buffer writing a blob through large buffers.
+	///
+	/// With async enabled, full buffers are handed to a background thread that writes them to
+	/// the blob while the caller fills the next one. Write errors raised by the background thread
+	/// are rethrown by the next write, `flush()` or `close()`.
+	/// The blob must stay open and must not be used by the caller until the writer is closed.
+	/// Closing the writer does not close the blob.
+	///
+	class BlobWriter final : public std::streambuf
+	{
+	public:
+		///
+		/// @brief Starts writing `blob` at its current position.
+		///
+		explicit BlobWriter(Blob& blob, const BlobStreamOptions& options = {});
+
+		///
+		/// @brief Writes the buffered data and stops the background thread.
+		///
+		~BlobWriter() noexcept override
+		{
+			try
+			{
+				close();
+			}
+			catch (...)
+			{
+				// swallow
+			}
+		}
+
+		BlobWriter(const BlobWriter&) = delete;
+		BlobWriter& operator=(const BlobWriter&) = delete;
+
+		BlobWriter(BlobWriter&&) = delete;
+		BlobWriter& operator=(BlobWriter&&) = delete;
+
+	public:
+		///
+		/// @brief Appends `buffer` to the blob.
+		///
+		void write(std::span<const std::byte> buffer);
+
+		///
+		/// @brief Appends `buffer` to the blob.
+		///
+		void write(std::span<const char> buffer)
+		{
+			write(std::as_bytes(buffer));
+		}
+
+		///
+		/// @brief Appends the remaining contents of `in` to the blob, reading directly into the internal buffers.
+		/// @return The number of bytes copied.
+		///
+		std::uint64_t copyFrom(std::istream& in);
+
+		///
+		/// @brief Writes all buffered data to the blob and waits for completion.
+		///
+		void flush();
+
+		///
+		/// @brief Flushes the buffered data and stops the background thread.
+		///
+		void close();
+
+	protected:
+		int_type overflow(int_type ch) override;
+		int sync() override;
+
+	private:
+		void submit();
+		void resetPutArea();
+		void consume();
+
+	private:
+		Blob& blob;
+		std::size_t bufferSize;
+		unsigned bufferCount;
+		bool async;
+		unsigned createdChunks = 0;
+		impl::BlobStreamChunk current;
+		std::deque<impl::BlobStreamChunk> pendingChunks;
+		std::vector<impl::BlobStreamChunk> freeChunks;
+		std::exception_ptr error;
+		std::mutex mutex;
+		std::condition_variable condition;
+		std::thread consumer;
+		bool busy = false;
+		bool stopping = false;
+		bool closed = false;
+	};
+
+	///
+	/// Input stream reading a blob through a BlobReader.
+	///
+	class BlobInputStream final : public std::istream
+	{
+	public:
+		///
+		/// @brief Starts reading `blob` from its current position.
+		///
+		explicit BlobInputStream(Blob& blob, const BlobStreamOptions& options = {})
+			: std::istream{nullptr},
+			  reader{blob, options}
+		{
+			rdbuf(&reader);
+		}
+
+	public:
+		///
+		/// Returns the underlying reader.
+		///
+		BlobReader& getReader() noexcept
+		{
+			return reader;
+		}
+
+	private:
+		BlobReader reader;
+	};
+
+	///
+	/// Output stream writing a blob through a BlobWriter.
+	///
+	class BlobOutputStream final : public std::ostream
+	{
+	public:
+		///
+		/// @brief Starts writing `blob` at its current position.
+		///
+		explicit BlobOutputStream(Blob& blob, const BlobStreamOptions& options = {})
+			: std::ostream{nullptr},
+			  writer{blob, options}
+		{
+			rdbuf(&writer);
+		}
+
+	public:
+		///
+		/// Returns the underlying writer.
+		///
+		BlobWriter& getWriter() noexcept
+		{
+			return writer;
+		}
+
+		///
+		/// @brief Flushes the buffered data and stops the background thread.
+		///
+		void close()
+		{
+			writer.close();
+		}
+
+	private:
+		BlobWriter writer;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_BLOB_STREAM_H
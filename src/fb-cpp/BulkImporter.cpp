@@ -0,0 +1,607 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "BulkImporter.h"
+#include "Batch.h"
+#include "Client.h"
+#include "Exception.h"
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+namespace
+{
+	constexpr unsigned CS_BINARY = 1u;
+	constexpr int BLOB_SUB_TYPE_TEXT = 1;
+
+	template <typename T>
+	void write(std::byte* data, T value) noexcept
+	{
+		std::memcpy(data, &value, sizeof(value));
+	}
+
+	[[noreturn]] void throwInvalidText(std::string_view text, std::string_view type)
+	{
+		throw FbCppException("Cannot convert '" + std::string{text} + "' to " + std::string{type});
+	}
+
+	int hexValue(char c) noexcept
+	{
+		if (c >= '0' && c <= '9')
+			return c - '0';
+		else if (c >= 'a' && c <= 'f')
+			return c - 'a' + 10;
+		else if (c >= 'A' && c <= 'F')
+			return c - 'A' + 10;
+
+		return -1;
+	}
+
+	bool decodeHex(std::string_view text, std::vector<std::byte>& out)
+	{
+		if (text.size() % 2u != 0u)
+			return false;
+
+		out.resize(text.size() / 2u);
+
+		for (std::size_t i = 0u; i < out.size(); ++i)
+		{
+			const auto high = hexValue(text[i * 2u]);
+			const auto low = hexValue(text[i * 2u + 1u]);
+
+			if (high < 0 || low < 0)
+				return false;
+
+			out[i] = static_cast<std::byte>(high << 4 | low);
+		}
+
+		return true;
+	}
+
+	///
+	/// One parsed field of a record.
+	///
+	struct Field final
+	{
+		std::string_view text;
+		bool isNull;
+	};
+
+
+	///
+	/// State of one import: record parser, message buffer and the BatchWriter they feed.
+	///
+	class ImportSession final
+	{
+	public:
+		ImportSession(Batch& batch, const BulkImportOptions& options)
+			: options{options},
+			  writer{batch, options.getWriterOptions()},
+			  encoder{batch.getClient(), batch.getInputDescriptorSet(),
+				  [this](std::span<const std::byte> data) { return writer.addBlob(data); }},
+			  columnCount{static_cast<unsigned>(batch.getInputDescriptorSet()->size())},
+			  headerPending{options.getHeader()}
+		{
+			StatusWrapper statusWrapper{batch.getClient()};
+			messageLength = batch.getInputMetadata()->getAlignedLength(&statusWrapper);
+			maxQueued = encoder.hasBlobs() ? 1u : options.getMessagesPerAdd();
+			messages.resize(static_cast<std::size_t>(maxQueued) * messageLength);
+			fields.reserve(columnCount);
+		}
+
+		ImportSession(const ImportSession&) = delete;
+		ImportSession& operator=(const ImportSession&) = delete;
+
+	public:
+		// Parses the complete records of `data` and returns the number of bytes consumed. When `last` is
+		// set, the end of `data` also ends the last record.
+		std::size_t parse(std::string_view data, bool last)
+		{
+			auto pos = data.data();
+			const auto end = pos + data.size();
+
+			while (pos != end)
+			{
+				const auto next = options.getFormat() == ImportFormat::CSV ? parseCsvRecord(pos, end, last)
+																			: parseTsvRecord(pos, end, last);
+
+				if (!next)
+					break;
+
+				pos = next;
+				++recordNumber;
+
+				if (headerPending)
+					headerPending = false;
+				else
+					addRecord();
+			}
+
+			return static_cast<std::size_t>(pos - data.data());
+		}
+
+		BatchWriterReport finish()
+		{
+			flush();
+			return writer.finish();
+		}
+
+	private:
+		[[noreturn]] void throwRecordError(const std::string& message) const
+		{
+			throw FbCppException("Record " + std::to_string(recordNumber) + ": " + message);
+		}
+
+		std::string& getScratch(std::size_t index)
+		{
+			while (scratch.size() <= index)
+				scratch.emplace_back();
+
+			auto& result = scratch[index];
+			result.clear();
+
+			return result;
+		}
+
+		// Returns the position after the record, or nullptr when the record does not end in [pos, end).
+		const char* parseCsvRecord(const char* pos, const char* end, bool last)
+		{
+			const auto delimiter = options.getDelimiter();
+
+			fields.clear();
+
+			while (true)
+			{
+				if (pos != end && *pos == '"')
+				{
+					auto& unquoted = getScratch(fields.size());
+
+					for (++pos;;)
+					{
+						const auto quote = static_cast<const char*>(std::memchr(pos, '"', end - pos));
+
+						if (!quote || (quote + 1 == end && !last))
+						{
+							if (last)
+								throwRecordError("unterminated quoted field");
+
+							return nullptr;
+						}
+
+						unquoted.append(pos, quote);
+						pos = quote + 1;
+
+						if (pos == end || *pos != '"')
+							break;
+
+						unquoted.push_back('"');
+						++pos;
+					}
+
+					fields.push_back({unquoted, false});
+				}
+				else
+				{
+					const auto start = pos;
+
+					while (pos != end && *pos != delimiter && *pos != '\n' && *pos != '\r')
+						++pos;
+
+					fields.push_back({{start, static_cast<std::size_t>(pos - start)}, pos == start});
+				}
+
+				if (pos == end)
+					return last ? pos : nullptr;
+
+				if (*pos == delimiter)
+				{
+					++pos;
+					continue;
+				}
+
+				if (*pos == '\r')
+				{
+					if (++pos == end)
+						return last ? pos : nullptr;
+
+					return *pos == '\n' ? pos + 1 : pos;
+				}
+
+				if (*pos == '\n')
+					return pos + 1;
+
+				throwRecordError("unexpected character after a quoted field");
+			}
+		}
+
+		// Returns the position after the record, or nullptr when the record does not end in [pos, end).
+		const char* parseTsvRecord(const char* pos, const char* end, bool last)
+		{
+			fields.clear();
+
+			while (true)
+			{
+				const auto start = pos;
+				bool escaped = false;
+
+				while (pos != end && *pos != '\t' && *pos != '\n')
+				{
+					if (*pos == '\\')
+					{
+						escaped = true;
+
+						if (++pos == end)
+							break;
+					}
+
+					++pos;
+				}
+
+				if (pos == end && !last)
+					return nullptr;
+
+				std::string_view text{start, static_cast<std::size_t>(pos - start)};
+
+				if ((pos == end || *pos == '\n') && !text.empty() && text.back() == '\r')
+					text.remove_suffix(1);
+
+				if (text == "\\N")
+					fields.push_back({{}, true});
+				else if (escaped)
+				{
+					auto& unescaped = getScratch(fields.size());
+
+					for (std::size_t i = 0u; i < text.size(); ++i)
+					{
+						if (text[i] != '\\' || i + 1u == text.size())
+						{
+							unescaped.push_back(text[i]);
+							continue;
+						}
+
+						switch (const auto c = text[++i])
+						{
+							case 't':
+								unescaped.push_back('\t');
+								break;
+
+							case 'n':
+								unescaped.push_back('\n');
+								break;
+
+							case 'r':
+								unescaped.push_back('\r');
+								break;
+
+							default:
+								unescaped.push_back(c);
+								break;
+						}
+					}
+
+					fields.push_back({unescaped, false});
+				}
+				else
+					fields.push_back({text, false});
+
+				if (pos == end)
+					return pos;
+
+				if (*pos++ == '\n')
+					return pos;
+			}
+		}
+
+		void addRecord()
+		{
+			if (fields.size() != columnCount)
+			{
+				throwRecordError("expected " + std::to_string(columnCount) + " fields, found " +
+					std::to_string(fields.size()));
+			}
+
+			const auto message = &messages[static_cast<std::size_t>(queued) * messageLength];
+
+			for (unsigned i = 0u; i < columnCount; ++i)
+			{
+				if (fields[i].isNull)
+				{
+					encoder.encodeNull(message, i);
+					continue;
+				}
+
+				try
+				{
+					encoder.encodeText(message, i, fields[i].text);
+				}
+				catch (const std::exception& e)
+				{
+					throwRecordError("column " + std::to_string(i + 1u) + ": " + e.what());
+				}
+			}
+
+			if (++queued == maxQueued)
+				flush();
+		}
+
+		void flush()
+		{
+			if (queued != 0u)
+			{
+				writer.add(queued, messages.data());
+				queued = 0u;
+			}
+		}
+
+	private:
+		const BulkImportOptions& options;
+		BatchWriter writer;
+		FieldEncoder encoder;
+		unsigned columnCount;
+		unsigned messageLength = 0u;
+		unsigned maxQueued = 1u;
+		unsigned queued = 0u;
+		std::vector<std::byte> messages;
+		std::vector<Field> fields;
+		std::deque<std::string> scratch;
+		std::uint64_t recordNumber = 0u;
+		bool headerPending;
+	};
+}  // namespace
+
+
+FieldEncoder::FieldEncoder(Client& client, DescriptorSetPtr descriptors, BlobSink blobSink)
+	: client{client},
+	  descriptors{std::move(descriptors)},
+	  blobSink{std::move(blobSink)},
+	  statusWrapper{client},
+	  numericConverter{client},
+	  calendarConverter{client}
+{
+	for (unsigned i = 0u; i < this->descriptors->size(); ++i)
+	{
+		if (this->descriptors->getLayout(i).adjustedType == DescriptorAdjustedType::BLOB)
+			blobs = true;
+	}
+}
+
+void FieldEncoder::encodeText(std::byte* message, unsigned index, std::string_view text)
+{
+	const auto& layout = descriptors->getLayout(index);
+	const auto data = &message[layout.offset];
+
+	switch (layout.adjustedType)
+	{
+		case DescriptorAdjustedType::BOOLEAN:
+			*data = numericConverter.stringToBoolean(text);
+			break;
+
+		case DescriptorAdjustedType::INT16:
+		{
+			const auto value = numericConverter.stringToScaledInt64(text);
+			write(data, numericConverter.numberToNumber<std::int16_t>(value, layout.scale));
+			break;
+		}
+
+		case DescriptorAdjustedType::INT32:
+		{
+			const auto value = numericConverter.stringToScaledInt64(text);
+			write(data, numericConverter.numberToNumber<std::int32_t>(value, layout.scale));
+			break;
+		}
+
+		case DescriptorAdjustedType::INT64:
+		{
+			const auto value = numericConverter.stringToScaledInt64(text);
+			write(data, numericConverter.numberToNumber<std::int64_t>(value, layout.scale));
+			break;
+		}
+
+		case DescriptorAdjustedType::INT128:
+			write(data, numericConverter.stringToOpaqueInt128(&statusWrapper, text, layout.scale));
+			break;
+
+		case DescriptorAdjustedType::FLOAT:
+			write(data, static_cast<float>(numericConverter.stringToDouble(text)));
+			break;
+
+		case DescriptorAdjustedType::DOUBLE:
+			write(data, numericConverter.stringToDouble(text));
+			break;
+
+		case DescriptorAdjustedType::DECFLOAT16:
+			write(data, numericConverter.stringToOpaqueDecFloat16(&statusWrapper, text));
+			break;
+
+		case DescriptorAdjustedType::DECFLOAT34:
+			write(data, numericConverter.stringToOpaqueDecFloat34(&statusWrapper, text));
+			break;
+
+		case DescriptorAdjustedType::DATE:
+			write(data, calendarConverter.stringToOpaqueDate(text));
+			break;
+
+		case DescriptorAdjustedType::TIME:
+			write(data, calendarConverter.stringToOpaqueTime(text));
+			break;
+
+		case DescriptorAdjustedType::TIMESTAMP:
+			write(data, calendarConverter.stringToOpaqueTimestamp(text));
+			break;
+
+		// The EX layouts start with the plain one; the server ignores the offset on input.
+		case DescriptorAdjustedType::TIME_TZ:
+		case DescriptorAdjustedType::TIME_TZ_EX:
+			write(data, calendarConverter.stringToOpaqueTimeTz(&statusWrapper, text));
+			break;
+
+		case DescriptorAdjustedType::TIMESTAMP_TZ:
+		case DescriptorAdjustedType::TIMESTAMP_TZ_EX:
+			write(data, calendarConverter.stringToOpaqueTimestampTz(&statusWrapper, text));
+			break;
+
+		case DescriptorAdjustedType::STRING:
+			if (descriptors->getDescriptors()[index].charSetId != CS_BINARY)
+				encodeBytes(message, index, std::as_bytes(std::span{text}));
+			else if (decodeHex(text, binary))
+				encodeBytes(message, index, binary);
+			else
+				throwInvalidText(text, "OCTETS");
+			return;
+
+		case DescriptorAdjustedType::BLOB:
+			if (descriptors->getDescriptors()[index].subType == BLOB_SUB_TYPE_TEXT)
+				encodeBytes(message, index, std::as_bytes(std::span{text}));
+			else if (decodeHex(text, binary))
+				encodeBytes(message, index, binary);
+			else
+				throwInvalidText(text, "BLOB");
+			return;
+
+		case DescriptorAdjustedType::NULL_TYPE:
+			break;
+	}
+
+	write(&message[layout.nullOffset], static_cast<std::int16_t>(FB_FALSE));
+}
+
+void FieldEncoder::encodeBytes(std::byte* message, unsigned index, std::span<const std::byte> bytes)
+{
+	const auto& layout = descriptors->getLayout(index);
+	const auto data = &message[layout.offset];
+
+	switch (layout.adjustedType)
+	{
+		case DescriptorAdjustedType::STRING:
+			if (bytes.size() > layout.length)
+			{
+				throw FbCppException("String of " + std::to_string(bytes.size()) +
+					" bytes exceeds the field length of " + std::to_string(layout.length));
+			}
+
+			write(data, static_cast<std::uint16_t>(bytes.size()));
+			std::copy(bytes.begin(), bytes.end(), data + sizeof(std::uint16_t));
+			break;
+
+		case DescriptorAdjustedType::BLOB:
+			if (!blobSink)
+				throw FbCppException("Blob fields cannot be encoded without a blob sink");
+
+			write(data, blobSink(bytes).id);
+			break;
+
+		default:
+			throw FbCppException("Binary values can only be encoded into string or blob fields");
+	}
+
+	write(&message[layout.nullOffset], static_cast<std::int16_t>(FB_FALSE));
+}
+
+
+BulkImporter::BulkImporter(Batch& batch, const BulkImportOptions& options)
+	: batch{batch},
+	  options{options}
+{
+	assert(batch.isValid());
+
+	if (options.getChunkSize() == 0u)
+		throw std::invalid_argument{"BulkImporter chunkSize must be greater than zero"};
+
+	if (options.getMessagesPerAdd() == 0u)
+		throw std::invalid_argument{"BulkImporter messagesPerAdd must be greater than zero"};
+
+	if (options.getFormat() == ImportFormat::CSV &&
+		(options.getDelimiter() == '"' || options.getDelimiter() == '\n' || options.getDelimiter() == '\r'))
+	{
+		throw std::invalid_argument{"BulkImporter delimiter cannot be a quote or a line break"};
+	}
+
+	const auto& layouts = batch.getInputDescriptorSet()->getLayouts();
+	const auto hasBlobs = std::any_of(layouts.begin(), layouts.end(),
+		[](const DescriptorLayout& layout) { return layout.adjustedType == DescriptorAdjustedType::BLOB; });
+
+	if (hasBlobs && batch.getOptions().getBlobPolicy() != BlobPolicy::ID_ENGINE)
+		throw std::invalid_argument{"BulkImporter requires BlobPolicy::ID_ENGINE for blob parameters"};
+}
+
+BatchWriterReport BulkImporter::importFrom(std::istream& stream)
+{
+	ImportSession session{batch, options};
+	std::vector<char> buffer(options.getChunkSize());
+	std::size_t filled = 0u;
+
+	while (true)
+	{
+		// A record longer than the buffer: grow it so the record fits.
+		if (filled == buffer.size())
+			buffer.resize(buffer.size() * 2u);
+
+		stream.read(buffer.data() + filled, static_cast<std::streamsize>(buffer.size() - filled));
+		filled += static_cast<std::size_t>(stream.gcount());
+
+		if (stream.bad())
+			throw FbCppException("Cannot read the import stream");
+
+		const auto last = stream.eof();
+		const auto consumed = session.parse({buffer.data(), filled}, last);
+
+		if (last)
+			break;
+
+		std::copy(buffer.begin() + static_cast<std::ptrdiff_t>(consumed),
+			buffer.begin() + static_cast<std::ptrdiff_t>(filled), buffer.begin());
+		filled -= consumed;
+	}
+
+	return session.finish();
+}
+
+BatchWriterReport BulkImporter::importFrom(const std::filesystem::path& path)
+{
+	std::ifstream in;
+	in.rdbuf()->pubsetbuf(nullptr, 0);
+	in.open(path, std::ios::binary);
+
+	if (!in)
+		throw FbCppException("Cannot open file '" + path.string() + "' for reading");
+
+	return importFrom(in);
+}
+
+BatchWriterReport BulkImporter::importFrom(std::string_view data)
+{
+	ImportSession session{batch, options};
+	session.parse(data, true);
+	return session.finish();
+}
@@ -0,0 +1,314 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_BULK_IMPORTER_H
+#define FBCPP_BULK_IMPORTER_H
+
+#include "fb-api.h"
+#include "BatchWriter.h"
+#include "CalendarConverter.h"
+#include "Descriptor.h"
+#include "Exception.h"
+#include "NumericConverter.h"
+#include "types.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <istream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	class Batch;
+	class Client;
+
+	///
+	/// Input format of a BulkImporter, mirroring the text formats written by ResultExporter.
+	///
+	enum class ImportFormat
+	{
+		///
+		/// Delimiter separated values. Fields may be quoted with `"`, doubling embedded quotes.
+		/// An empty unquoted field is NULL and `""` is an empty string.
+		///
+		CSV,
+
+		///
+		/// Tab separated values with `\\`, `\t`, `\n` and `\r` backslash escapes and `\N` for NULL.
+		///
+		TSV
+	};
+
+	///
+	/// Represents options used by BulkImporter.
+	///
+	class BulkImportOptions final
+	{
+	public:
+		///
+		/// Returns the input format.
+		///
+		ImportFormat getFormat() const
+		{
+			return format;
+		}
+
+		///
+		/// Sets the input format.
+		///
+		BulkImportOptions& setFormat(ImportFormat value)
+		{
+			format = value;
+			return *this;
+		}
+
+		///
+		/// Returns the CSV field delimiter.
+		///
+		char getDelimiter() const
+		{
+			return delimiter;
+		}
+
+		///
+		/// Sets the CSV field delimiter.
+		///
+		BulkImportOptions& setDelimiter(char value)
+		{
+			delimiter = value;
+			return *this;
+		}
+
+		///
+		/// Returns whether the first record is a header line to be skipped.
+		///
+		bool getHeader() const
+		{
+			return header;
+		}
+
+		///
+		/// Sets whether the first record is a header line to be skipped.
+		///
+		BulkImportOptions& setHeader(bool value)
+		{
+			header = value;
+			return *this;
+		}
+
+		///
+		/// Returns the number of bytes read from the input at once.
+		///
+		std::size_t getChunkSize() const
+		{
+			return chunkSize;
+		}
+
+		///
+		/// Sets the number of bytes read from the input at once. Records longer than a chunk are still
+		/// accepted; the read buffer grows to hold them.
+		///
+		BulkImportOptions& setChunkSize(std::size_t value)
+		{
+			chunkSize = value;
+			return *this;
+		}
+
+		///
+		/// Returns the maximum number of messages encoded before they are passed to the batch at once.
+		///
+		unsigned getMessagesPerAdd() const
+		{
+			return messagesPerAdd;
+		}
+
+		///
+		/// Sets the maximum number of messages encoded before they are passed to the batch at once.
+		/// Rows with blob columns are always added one by one, right after their blobs.
+		///
+		BulkImportOptions& setMessagesPerAdd(unsigned value)
+		{
+			messagesPerAdd = value;
+			return *this;
+		}
+
+		///
+		/// Returns the options of the BatchWriter executing the batch.
+		///
+		const BatchWriterOptions& getWriterOptions() const
+		{
+			return writerOptions;
+		}
+
+		///
+		/// Sets the options of the BatchWriter executing the batch.
+		///
+		BulkImportOptions& setWriterOptions(const BatchWriterOptions& value)
+		{
+			writerOptions = value;
+			return *this;
+		}
+
+	private:
+		ImportFormat format = ImportFormat::CSV;
+		char delimiter = ',';
+		bool header = true;
+		std::size_t chunkSize = 4u * 1024u * 1024u;
+		unsigned messagesPerAdd = 1024u;
+		BatchWriterOptions writerOptions;
+	};
+
+	namespace impl
+	{
+		///
+		/// Encodes field values straight into raw input messages, using the descriptor layouts.
+		///
+		/// Text is parsed with the same rules as Statement::setString, which accept the formats written by
+		/// ResultExporter; OCTETS strings and non-text blobs are hex-encoded.
+		/// Blob values are handed to a sink that stores them and returns their ID.
+		///
+		class FieldEncoder final
+		{
+		public:
+			///
+			/// Stores the contents of a blob and returns the ID to be written in the message.
+			///
+			using BlobSink = std::function<BlobId(std::span<const std::byte>)>;
+
+		public:
+			///
+			/// Creates an encoder for messages described by `descriptors`.
+			///
+			explicit FieldEncoder(Client& client, DescriptorSetPtr descriptors, BlobSink blobSink = {});
+
+		public:
+			///
+			/// Returns the descriptors of the encoded messages.
+			///
+			const DescriptorSetPtr& getDescriptorSet() const noexcept
+			{
+				return descriptors;
+			}
+
+			///
+			/// Returns whether any field is a blob.
+			///
+			bool hasBlobs() const noexcept
+			{
+				return blobs;
+			}
+
+			///
+			/// Sets the field at `index` of `message` to NULL.
+			///
+			void encodeNull(std::byte* message, unsigned index) const noexcept
+			{
+				const auto& layout = descriptors->getLayout(index);
+				const std::int16_t nullFlag = FB_TRUE;
+				std::memcpy(&message[layout.nullOffset], &nullFlag, sizeof(nullFlag));
+			}
+
+			///
+			/// Converts `text` into the field at `index` of `message`.
+			/// Throws FbCppException when the text is not valid for the field type.
+			///
+			void encodeText(std::byte* message, unsigned index, std::string_view text);
+
+			///
+			/// Copies `bytes` as-is into the string or blob field at `index` of `message`.
+			/// Throws FbCppException for other field types or strings that do not fit.
+			///
+			void encodeBytes(std::byte* message, unsigned index, std::span<const std::byte> bytes);
+
+		private:
+			Client& client;
+			DescriptorSetPtr descriptors;
+			BlobSink blobSink;
+			bool blobs = false;
+			StatusWrapper statusWrapper;
+			NumericConverter numericConverter;
+			CalendarConverter calendarConverter;
+			std::vector<std::byte> binary;
+		};
+	}  // namespace impl
+
+	///
+	/// @brief Loads CSV or TSV input into a Batch at the speed of the batch protocol.
+	///
+	/// The input is read in large chunks and each record is converted straight into a multi-message
+	/// buffer using the batch's input descriptor layouts, which is then passed to the batch with a
+	/// single `add(count, buffer)` call. Execution goes through a BatchWriter, so the batch never
+	/// overflows and per-row errors are reported from the merged BatchCompletionState, indexed by
+	/// record number (the header excluded).
+	///
+	/// Malformed records and values that cannot be converted throw FbCppException naming the record and
+	/// column; rows rejected by the server are reported instead.
+	///
+	class BulkImporter final
+	{
+	public:
+		///
+		/// Creates an importer over the given batch. The batch must outlive the importer.
+		///
+		/// Blob columns require a batch created with `BlobPolicy::ID_ENGINE`.
+		///
+		explicit BulkImporter(Batch& batch, const BulkImportOptions& options = {});
+
+		BulkImporter(const BulkImporter&) = delete;
+		BulkImporter& operator=(const BulkImporter&) = delete;
+
+	public:
+		///
+		/// Imports all records of `stream` and executes the batch.
+		///
+		BatchWriterReport importFrom(std::istream& stream);
+
+		///
+		/// Imports all records of the file at `path` and executes the batch.
+		///
+		BatchWriterReport importFrom(const std::filesystem::path& path);
+
+		///
+		/// Imports all records held in `data` and executes the batch.
+		///
+		BatchWriterReport importFrom(std::string_view data);
+
+	private:
+		Batch& batch;
+		BulkImportOptions options;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_BULK_IMPORTER_H
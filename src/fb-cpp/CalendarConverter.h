@@ -27,6 +27,7 @@
 
 #include "config.h"
 #include "fb-api.h"
+#include "Arena.h"
 #include "Client.h"
 #include "Exception.h"
 #include "types.h"
@@ -34,8 +35,6 @@
 #include <charconv>
 #include <chrono>
 #include <cstdlib>
-#include <format>
-#include <regex>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -82,38 +81,16 @@ namespace fbcpp::impl
 
 		Date stringToDate(std::string_view value)
 		{
-			static const std::regex pattern(R"(^\s*([0-9]{4})\s*-\s*([0-9]{2})\s*-\s*([0-9]{2})\s*$)");
-
-			const std::string stringValue{value};
+			std::size_t pos = 0;
+			unsigned year;
+			unsigned month;
+			unsigned day;
 
-			std::smatch matches;
-			if (!std::regex_match(stringValue, matches, pattern))
+			if (!parseDate(value, pos, year, month, day) || !parseEnd(value, pos))
 				throwConversionErrorFromString(std::string{value});
 
-			const auto makeComponentView = [&](const std::size_t index)
-			{
-				return std::string_view{stringValue.data() + static_cast<std::size_t>(matches.position(index)),
-					static_cast<std::size_t>(matches.length(index))};
-			};
-
-			const auto parseComponent = [&](const std::size_t index)
-			{
-				int result;
-				const auto component = makeComponentView(index);
-				const auto [ptr, ec] =
-					std::from_chars(component.data(), component.data() + component.size(), result, 10);
-
-				if (ec != std::errc{} || ptr != component.data() + component.size())
-					throwConversionErrorFromString(std::string{value});
-
-				return result;
-			};
-
-			const int year = parseComponent(1);
-			const unsigned month = static_cast<unsigned>(parseComponent(2));
-			const unsigned day = static_cast<unsigned>(parseComponent(3));
-
-			const Date date{std::chrono::year{year}, std::chrono::month{month}, std::chrono::day{day}};
+			const Date date{
+				std::chrono::year{static_cast<int>(year)}, std::chrono::month{month}, std::chrono::day{day}};
 
 			if (!date.ok())
 				throwInvalidDateValue();
@@ -128,7 +105,21 @@ namespace fbcpp::impl
 
 		std::string opaqueDateToString(OpaqueDate date)
 		{
-			return std::format("{:%Y-%m-%d}", std::chrono::local_days{opaqueDateToDate(date)});
+			std::string result;
+			appendOpaqueDateString(result, date);
+			return result;
+		}
+
+		void appendOpaqueDateString(std::string& result, OpaqueDate date)
+		{
+			unsigned year;
+			unsigned month;
+			unsigned day;
+
+			client->getUtil()->decodeDate(date.value, &year, &month, &day);
+
+			result.reserve(result.size() + 10);
+			appendDate(result, year, month, day);
 		}
 
 		OpaqueTime timeToOpaqueTime(const Time& time)
@@ -162,51 +153,19 @@ namespace fbcpp::impl
 
 		Time stringToTime(std::string_view value)
 		{
-			static const std::regex pattern(
-				R"(^\s*([0-9]{2})\s*:\s*([0-9]{2})\s*:\s*([0-9]{2})(?:\s*\.\s*([0-9]{1,4}))?\s*$)");
-
-			const std::string stringValue{value};
+			std::size_t pos = 0;
+			unsigned hours;
+			unsigned minutes;
+			unsigned seconds;
+			unsigned fractions = 0;
 
-			std::smatch matches;
-			if (!std::regex_match(stringValue, matches, pattern))
+			if (!parseTime(value, pos, hours, minutes, seconds))
 				throwConversionErrorFromString(std::string{value});
 
-			const auto makeComponentView = [&](const std::size_t index)
-			{
-				return std::string_view{stringValue.data() + static_cast<std::size_t>(matches.position(index)),
-					static_cast<std::size_t>(matches.length(index))};
-			};
-
-			const auto parseComponent = [&](const std::size_t index)
-			{
-				unsigned result;
-				const auto component = makeComponentView(index);
-				const auto [ptr, ec] =
-					std::from_chars(component.data(), component.data() + component.size(), result, 10);
-
-				if (ec != std::errc{} || ptr != component.data() + component.size())
-					throwConversionErrorFromString(std::string{value});
-
-				return result;
-			};
-
-			const auto hours = parseComponent(1);
-			const auto minutes = parseComponent(2);
-			const auto seconds = parseComponent(3);
-
-			unsigned fractions = 0;
-			if (matches[4].matched && matches.length(4) > 0)
-			{
-				const auto fractionComponent = makeComponentView(4);
-				const auto [ptr, ec] = std::from_chars(
-					fractionComponent.data(), fractionComponent.data() + fractionComponent.size(), fractions, 10);
-
-				if (ec != std::errc{} || ptr != fractionComponent.data() + fractionComponent.size())
-					throwConversionErrorFromString(std::string{value});
+			parseFraction(value, pos, fractions);
 
-				for (auto remaining = 4 - static_cast<int>(fractionComponent.size()); remaining > 0; --remaining)
-					fractions *= 10;
-			}
+			if (!parseEnd(value, pos))
+				throwConversionErrorFromString(std::string{value});
 
 			if (hours >= 24 || minutes >= 60 || seconds >= 60)
 				throwInvalidTimeValue();
@@ -227,12 +186,22 @@ namespace fbcpp::impl
 
 		std::string opaqueTimeToString(OpaqueTime time)
 		{
-			const auto converted = opaqueTimeToTime(time);
-			const auto subseconds = static_cast<unsigned>(converted.subseconds().count() / 100);
+			std::string result;
+			appendOpaqueTimeString(result, time);
+			return result;
+		}
 
-			return std::format("{:02}:{:02}:{:02}.{:04}", static_cast<unsigned>(converted.hours().count()),
-				static_cast<unsigned>(converted.minutes().count()), static_cast<unsigned>(converted.seconds().count()),
-				subseconds);
+		void appendOpaqueTimeString(std::string& result, OpaqueTime time)
+		{
+			unsigned hours;
+			unsigned minutes;
+			unsigned seconds;
+			unsigned fractions;
+
+			client->getUtil()->decodeTime(time.value, &hours, &minutes, &seconds, &fractions);
+
+			result.reserve(result.size() + 13);
+			appendTime(result, hours, minutes, seconds, fractions);
 		}
 
 		OpaqueTimeTz timeTzToOpaqueTimeTz(StatusWrapper* statusWrapper, const TimeTz& timeTz)
@@ -251,33 +220,38 @@ namespace fbcpp::impl
 
 			OpaqueTimeTz opaque{};
 
-			client->getUtil()->encodeTimeTz(statusWrapper, &opaque.value, 0u, 0u, 0u, 0u, timeTz.zone.c_str());
+			auto& timeZoneCache = client->getTimeZoneCache();
+
+			if (const auto zoneId = timeZoneCache.findId(timeTz.zone))
+				opaque.value.time_zone = *zoneId;
+			else
+			{
+				client->getUtil()->encodeTimeTz(statusWrapper, &opaque.value, 0u, 0u, 0u, 0u, timeTz.zone.c_str());
+				timeZoneCache.addId(timeTz.zone, opaque.value.time_zone);
+			}
 
 			opaque.value.utc_time = static_cast<ISC_TIME>(duration.count() / 100);
 
 			return opaque;
 		}
 
-		TimeTz opaqueTimeTzToTimeTz(
-			StatusWrapper* statusWrapper, const OpaqueTimeTz& opaqueTime, std::string* decodedTimeZoneName = nullptr)
+		TimeTz opaqueTimeTzToTimeTz(StatusWrapper* statusWrapper, const OpaqueTimeTz& opaqueTime)
 		{
 			const auto ticks = static_cast<std::int64_t>(opaqueTime.value.utc_time) * 100;
 
-			unsigned hours;
-			unsigned minutes;
-			unsigned seconds;
-			unsigned fractions;
-			std::array<char, 128> timeZoneBuffer;
-
-			client->getUtil()->decodeTimeTz(statusWrapper, &opaqueTime.value, &hours, &minutes, &seconds, &fractions,
-				static_cast<unsigned>(timeZoneBuffer.size()), timeZoneBuffer.data());
-
 			TimeTz timeTz;
 			timeTz.utcTime = Time{std::chrono::microseconds{ticks}};
-			timeTz.zone = timeZoneBuffer.data();
-
-			if (decodedTimeZoneName)
-				*decodedTimeZoneName = timeTz.zone;
+			timeTz.zone = getTimeZoneName(opaqueTime.value.time_zone,
+				[&](unsigned bufferLength, char* buffer)
+				{
+					unsigned hours;
+					unsigned minutes;
+					unsigned seconds;
+					unsigned fractions;
+
+					client->getUtil()->decodeTimeTz(statusWrapper, &opaqueTime.value, &hours, &minutes, &seconds,
+						&fractions, bufferLength, buffer);
+				});
 
 			return timeTz;
 		}
@@ -288,6 +262,13 @@ namespace fbcpp::impl
 		}
 
 		std::string opaqueTimeTzToString(StatusWrapper* statusWrapper, const OpaqueTimeTz& time)
+		{
+			std::string result;
+			appendOpaqueTimeTzString(result, statusWrapper, time);
+			return result;
+		}
+
+		void appendOpaqueTimeTzString(std::string& result, StatusWrapper* statusWrapper, const OpaqueTimeTz& time)
 		{
 			unsigned hours;
 			unsigned minutes;
@@ -298,55 +279,27 @@ namespace fbcpp::impl
 			client->getUtil()->decodeTimeTz(statusWrapper, &time.value, &hours, &minutes, &seconds, &fractions,
 				static_cast<unsigned>(timeZoneBuffer.size()), timeZoneBuffer.data());
 
-			return std::format("{:02}:{:02}:{:02}.{:04} {}", hours, minutes, seconds, fractions, timeZoneBuffer.data());
+			const std::string_view timeZone{timeZoneBuffer.data()};
+
+			result.reserve(result.size() + 14 + timeZone.length());
+			appendTime(result, hours, minutes, seconds, fractions);
+			result += ' ';
+			result += timeZone;
 		}
 
 		TimeTz stringToTimeTz(StatusWrapper* statusWrapper, std::string_view value)
 		{
-			static const std::regex pattern(
-				R"(^\s*([0-9]{2})\s*:\s*([0-9]{2})\s*:\s*([0-9]{2})(?:\s*\.\s*([0-9]{1,4}))?\s+([^\s]+)\s*$)");
-
-			const std::string stringValue{value};
-
-			std::smatch matches;
-			if (!std::regex_match(stringValue, matches, pattern))
-				throwConversionErrorFromString(std::string{value});
-
-			const auto makeComponentView = [&](const std::size_t index)
-			{
-				return std::string_view{stringValue.data() + static_cast<std::size_t>(matches.position(index)),
-					static_cast<std::size_t>(matches.length(index))};
-			};
-
-			const auto parseComponent = [&](const std::size_t index)
-			{
-				unsigned result;
-				const auto component = makeComponentView(index);
-				const auto [ptr, ec] =
-					std::from_chars(component.data(), component.data() + component.size(), result, 10);
-
-				if (ec != std::errc{} || ptr != component.data() + component.size())
-					throwConversionErrorFromString(std::string{value});
-
-				return result;
-			};
-
-			const auto hours = parseComponent(1);
-			const auto minutes = parseComponent(2);
-			const auto seconds = parseComponent(3);
-
+			std::size_t pos = 0;
+			unsigned hours;
+			unsigned minutes;
+			unsigned seconds;
 			unsigned fractions = 0;
-			if (matches[4].matched && matches.length(4) > 0)
-			{
-				const auto fractionComponent = makeComponentView(4);
-				const auto [ptr, ec] = std::from_chars(
-					fractionComponent.data(), fractionComponent.data() + fractionComponent.size(), fractions, 10);
+			std::string_view timeZone;
 
-				if (ec != std::errc{} || ptr != fractionComponent.data() + fractionComponent.size())
-					throwConversionErrorFromString(std::string{value});
-
-				for (auto remaining = 4 - static_cast<int>(fractionComponent.size()); remaining > 0; --remaining)
-					fractions *= 10;
+			if (!parseTime(value, pos, hours, minutes, seconds) ||
+				!parseFractionAndTimeZone(value, pos, fractions, timeZone))
+			{
+				throwConversionErrorFromString(std::string{value});
 			}
 
 			if (hours >= 24 || minutes >= 60 || seconds >= 60)
@@ -359,9 +312,9 @@ namespace fbcpp::impl
 				throwInvalidTimeValue();
 
 			OpaqueTimeTz encoded;
-			const std::string timeZoneString{makeComponentView(5)};
+			const CString timeZoneString{timeZone};
 			client->getUtil()->encodeTimeTz(
-				statusWrapper, &encoded.value, hours, minutes, seconds, fractions, timeZoneString.c_str());
+				statusWrapper, &encoded.value, hours, minutes, seconds, fractions, timeZoneString.get());
 
 			return opaqueTimeTzToTimeTz(statusWrapper, encoded);
 		}
@@ -424,56 +377,28 @@ namespace fbcpp::impl
 
 		Timestamp stringToTimestamp(std::string_view value)
 		{
-			static const std::regex pattern(
-				R"(^\s*([0-9]{4})\s*-\s*([0-9]{2})\s*-\s*([0-9]{2})\s+([0-9]{2})\s*:\s*([0-9]{2})\s*:\s*([0-9]{2})(?:\s*\.\s*([0-9]{1,4}))?\s*$)");
-
-			const std::string stringValue{value};
-
-			std::smatch matches;
-			if (!std::regex_match(stringValue, matches, pattern))
-				throwConversionErrorFromString(std::string{value});
-
-			const auto makeComponentView = [&](const std::size_t index)
-			{
-				return std::string_view{stringValue.data() + static_cast<std::size_t>(matches.position(index)),
-					static_cast<std::size_t>(matches.length(index))};
-			};
-
-			const auto parseComponent = [&](const std::size_t index)
-			{
-				unsigned result;
-				const auto component = makeComponentView(index);
-				const auto [ptr, ec] =
-					std::from_chars(component.data(), component.data() + component.size(), result, 10);
-
-				if (ec != std::errc{} || ptr != component.data() + component.size())
-					throwConversionErrorFromString(std::string{value});
-
-				return result;
-			};
-
-			const int year = static_cast<int>(parseComponent(1));
-			const unsigned month = parseComponent(2);
-			const unsigned day = parseComponent(3);
-			const auto hours = parseComponent(4);
-			const auto minutes = parseComponent(5);
-			const auto seconds = parseComponent(6);
-
+			std::size_t pos = 0;
+			unsigned year;
+			unsigned month;
+			unsigned day;
+			unsigned hours;
+			unsigned minutes;
+			unsigned seconds;
 			unsigned fractions = 0;
-			if (matches[7].matched && matches.length(7) > 0)
+
+			if (!parseDate(value, pos, year, month, day) || !parseSpaces(value, pos) ||
+				!parseTime(value, pos, hours, minutes, seconds))
 			{
-				const auto fractionComponent = makeComponentView(7);
-				const auto [ptr, ec] = std::from_chars(
-					fractionComponent.data(), fractionComponent.data() + fractionComponent.size(), fractions, 10);
+				throwConversionErrorFromString(std::string{value});
+			}
 
-				if (ec != std::errc{} || ptr != fractionComponent.data() + fractionComponent.size())
-					throwConversionErrorFromString(std::string{value});
+			parseFraction(value, pos, fractions);
 
-				for (auto remaining = 4 - static_cast<int>(fractionComponent.size()); remaining > 0; --remaining)
-					fractions *= 10;
-			}
+			if (!parseEnd(value, pos))
+				throwConversionErrorFromString(std::string{value});
 
-			const Date date{std::chrono::year{year}, std::chrono::month{month}, std::chrono::day{day}};
+			const Date date{
+				std::chrono::year{static_cast<int>(year)}, std::chrono::month{month}, std::chrono::day{day}};
 
 			if (!date.ok())
 				throwInvalidTimestampValue();
@@ -497,24 +422,45 @@ namespace fbcpp::impl
 
 		std::string opaqueTimestampToString(OpaqueTimestamp timestamp)
 		{
-			const auto converted = opaqueTimestampToTimestamp(timestamp);
-			const auto subseconds = static_cast<unsigned>(converted.time.subseconds().count() / 100);
+			std::string result;
+			appendOpaqueTimestampString(result, timestamp);
+			return result;
+		}
 
-			const auto dateString = std::format("{:%Y-%m-%d}", std::chrono::local_days{converted.date});
-			const auto timeString =
-				std::format("{:02}:{:02}:{:02}.{:04}", static_cast<unsigned>(converted.time.hours().count()),
-					static_cast<unsigned>(converted.time.minutes().count()),
-					static_cast<unsigned>(converted.time.seconds().count()), subseconds);
+		void appendOpaqueTimestampString(std::string& result, OpaqueTimestamp timestamp)
+		{
+			unsigned year;
+			unsigned month;
+			unsigned day;
+			unsigned hours;
+			unsigned minutes;
+			unsigned seconds;
+			unsigned fractions;
 
-			return std::format("{} {}", dateString, timeString);
+			const auto util = client->getUtil();
+			util->decodeDate(timestamp.value.timestamp_date, &year, &month, &day);
+			util->decodeTime(timestamp.value.timestamp_time, &hours, &minutes, &seconds, &fractions);
+
+			result.reserve(result.size() + 24);
+			appendDate(result, year, month, day);
+			result += ' ';
+			appendTime(result, hours, minutes, seconds, fractions);
 		}
 
 		OpaqueTimestampTz timestampTzToOpaqueTimestampTz(StatusWrapper* statusWrapper, const TimestampTz& timestampTz)
 		{
-			OpaqueTimestampTz opaque;
+			OpaqueTimestampTz opaque{};
 
-			client->getUtil()->encodeTimeStampTz(
-				statusWrapper, &opaque.value, 1u, 1u, 1u, 0u, 0u, 0u, 0u, timestampTz.zone.c_str());
+			auto& timeZoneCache = client->getTimeZoneCache();
+
+			if (const auto zoneId = timeZoneCache.findId(timestampTz.zone))
+				opaque.value.time_zone = *zoneId;
+			else
+			{
+				client->getUtil()->encodeTimeStampTz(
+					statusWrapper, &opaque.value, 1u, 1u, 1u, 0u, 0u, 0u, 0u, timestampTz.zone.c_str());
+				timeZoneCache.addId(timestampTz.zone, opaque.value.time_zone);
+			}
 
 			const auto utcOpaque = timestampToOpaqueTimestamp(timestampTz.utcTimestamp);
 			opaque.value.utc_timestamp = utcOpaque.value;
@@ -522,33 +468,31 @@ namespace fbcpp::impl
 			return opaque;
 		}
 
-		TimestampTz opaqueTimestampTzToTimestampTz(StatusWrapper* statusWrapper,
-			const OpaqueTimestampTz& opaqueTimestamp, std::string* decodedTimeZoneName = nullptr)
+		TimestampTz opaqueTimestampTzToTimestampTz(
+			StatusWrapper* statusWrapper, const OpaqueTimestampTz& opaqueTimestamp)
 		{
 			const auto ticks =
 				(static_cast<std::int64_t>(opaqueTimestamp.value.utc_timestamp.timestamp_date) * TICKS_PER_DAY +
 					static_cast<std::int64_t>(opaqueTimestamp.value.utc_timestamp.timestamp_time)) *
 				100;
 
-			unsigned year;
-			unsigned month;
-			unsigned day;
-			unsigned hours;
-			unsigned minutes;
-			unsigned seconds;
-			unsigned subseconds;
-			std::array<char, 128> timeZoneBuffer;
-
-			client->getUtil()->decodeTimeStampTz(statusWrapper, &opaqueTimestamp.value, &year, &month, &day, &hours,
-				&minutes, &seconds, &subseconds, static_cast<unsigned>(timeZoneBuffer.size()), timeZoneBuffer.data());
-
 			TimestampTz timestampTz;
 			const auto utcLocalTime = BASE_EPOCH + std::chrono::microseconds{ticks};
 			timestampTz.utcTimestamp = Timestamp::fromLocalTime(utcLocalTime);
-			timestampTz.zone = timeZoneBuffer.data();
-
-			if (decodedTimeZoneName)
-				*decodedTimeZoneName = timestampTz.zone;
+			timestampTz.zone = getTimeZoneName(opaqueTimestamp.value.time_zone,
+				[&](unsigned bufferLength, char* buffer)
+				{
+					unsigned year;
+					unsigned month;
+					unsigned day;
+					unsigned hours;
+					unsigned minutes;
+					unsigned seconds;
+					unsigned subseconds;
+
+					client->getUtil()->decodeTimeStampTz(statusWrapper, &opaqueTimestamp.value, &year, &month, &day,
+						&hours, &minutes, &seconds, &subseconds, bufferLength, buffer);
+				});
 
 			return timestampTz;
 		}
@@ -559,6 +503,14 @@ namespace fbcpp::impl
 		}
 
 		std::string opaqueTimestampTzToString(StatusWrapper* statusWrapper, const OpaqueTimestampTz& timestamp)
+		{
+			std::string result;
+			appendOpaqueTimestampTzString(result, statusWrapper, timestamp);
+			return result;
+		}
+
+		void appendOpaqueTimestampTzString(
+			std::string& result, StatusWrapper* statusWrapper, const OpaqueTimestampTz& timestamp)
 		{
 			unsigned year;
 			unsigned month;
@@ -572,62 +524,37 @@ namespace fbcpp::impl
 			client->getUtil()->decodeTimeStampTz(statusWrapper, &timestamp.value, &year, &month, &day, &hours, &minutes,
 				&seconds, &subseconds, static_cast<unsigned>(timeZoneBuffer.size()), timeZoneBuffer.data());
 
-			return std::format("{:04}-{:02}-{:02} {:02}:{:02}:{:02}.{:04} {}", year, month, day, hours, minutes,
-				seconds, subseconds, timeZoneBuffer.data());
+			const std::string_view timeZone{timeZoneBuffer.data()};
+
+			result.reserve(result.size() + 25 + timeZone.length());
+			appendDate(result, year, month, day);
+			result += ' ';
+			appendTime(result, hours, minutes, seconds, subseconds);
+			result += ' ';
+			result += timeZone;
 		}
 
 		TimestampTz stringToTimestampTz(StatusWrapper* statusWrapper, std::string_view value)
 		{
-			static const std::regex pattern(
-				R"(^\s*([0-9]{4})\s*-\s*([0-9]{2})\s*-\s*([0-9]{2})\s+([0-9]{2})\s*:\s*([0-9]{2})\s*:\s*([0-9]{2})(?:\s*\.\s*([0-9]{1,4}))?\s+([^\s]+)\s*$)");
-
-			const std::string stringValue{value};
-
-			std::smatch matches;
-			if (!std::regex_match(stringValue, matches, pattern))
-				throwConversionErrorFromString(std::string{value});
-
-			const auto makeComponentView = [&](const std::size_t index)
-			{
-				return std::string_view{stringValue.data() + static_cast<std::size_t>(matches.position(index)),
-					static_cast<std::size_t>(matches.length(index))};
-			};
-
-			const auto parseComponent = [&](const std::size_t index)
-			{
-				unsigned result;
-				const auto component = makeComponentView(index);
-				const auto [ptr, ec] =
-					std::from_chars(component.data(), component.data() + component.size(), result, 10);
-
-				if (ec != std::errc{} || ptr != component.data() + component.size())
-					throwConversionErrorFromString(std::string{value});
-
-				return result;
-			};
-
-			const int year = static_cast<int>(parseComponent(1));
-			const unsigned month = parseComponent(2);
-			const unsigned day = parseComponent(3);
-			const auto hours = parseComponent(4);
-			const auto minutes = parseComponent(5);
-			const auto seconds = parseComponent(6);
-
+			std::size_t pos = 0;
+			unsigned year;
+			unsigned month;
+			unsigned day;
+			unsigned hours;
+			unsigned minutes;
+			unsigned seconds;
 			unsigned fractions = 0;
-			if (matches[7].matched && matches.length(7) > 0)
-			{
-				const auto fractionComponent = makeComponentView(7);
-				const auto [ptr, ec] = std::from_chars(
-					fractionComponent.data(), fractionComponent.data() + fractionComponent.size(), fractions, 10);
-
-				if (ec != std::errc{} || ptr != fractionComponent.data() + fractionComponent.size())
-					throwConversionErrorFromString(std::string{value});
+			std::string_view timeZone;
 
-				for (auto remaining = 4 - static_cast<int>(fractionComponent.size()); remaining > 0; --remaining)
-					fractions *= 10;
+			if (!parseDate(value, pos, year, month, day) || !parseSpaces(value, pos) ||
+				!parseTime(value, pos, hours, minutes, seconds) ||
+				!parseFractionAndTimeZone(value, pos, fractions, timeZone))
+			{
+				throwConversionErrorFromString(std::string{value});
 			}
 
-			const Date date{std::chrono::year{year}, std::chrono::month{month}, std::chrono::day{day}};
+			const Date date{
+				std::chrono::year{static_cast<int>(year)}, std::chrono::month{month}, std::chrono::day{day}};
 
 			if (!date.ok())
 				throwInvalidTimestampValue();
@@ -647,10 +574,10 @@ namespace fbcpp::impl
 			const auto dayValue = static_cast<unsigned>(date.day());
 
 			OpaqueTimestampTz encoded;
-			const std::string timeZoneString{makeComponentView(8)};
+			const CString timeZoneString{timeZone};
 			client->getUtil()->encodeTimeStampTz(statusWrapper, &encoded.value,
 				static_cast<unsigned>(static_cast<int>(date.year())), monthValue, dayValue, hours, minutes, seconds,
-				fractions, timeZoneString.c_str());
+				fractions, timeZoneString.get());
 
 			const OpaqueTimestamp utcOpaque{encoded.value.utc_timestamp};
 			const auto utcTimestamp = opaqueTimestampToTimestamp(utcOpaque);
@@ -659,13 +586,201 @@ namespace fbcpp::impl
 			if (offsetDuration % std::chrono::minutes{1} != std::chrono::microseconds::zero())
 				throwInvalidTimestampValue();
 
-			std::string resolvedTimeZoneName;
-			opaqueTimestampTzToTimestampTz(statusWrapper, encoded, &resolvedTimeZoneName);
-
-			return TimestampTz{utcTimestamp, resolvedTimeZoneName};
+			return TimestampTz{utcTimestamp, opaqueTimestampTzToTimestampTz(statusWrapper, encoded).zone};
 		}
 
 	private:
+		// Returns the interned name of the time zone, calling `decode` to fill a name buffer for unknown IDs.
+		template <typename Decode>
+		TimeZoneName getTimeZoneName(ISC_USHORT zoneId, Decode&& decode)
+		{
+			auto& timeZoneCache = client->getTimeZoneCache();
+
+			if (auto name = timeZoneCache.findName(zoneId))
+				return std::move(*name);
+
+			std::array<char, 128> timeZoneBuffer;
+			decode(static_cast<unsigned>(timeZoneBuffer.size()), timeZoneBuffer.data());
+
+			return timeZoneCache.intern(zoneId, timeZoneBuffer.data());
+		}
+
+		static bool isSpace(char c) noexcept
+		{
+			return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+		}
+
+		static bool isDigit(char c) noexcept
+		{
+			return c >= '0' && c <= '9';
+		}
+
+		static void skipSpaces(std::string_view value, std::size_t& pos) noexcept
+		{
+			while (pos < value.length() && isSpace(value[pos]))
+				++pos;
+		}
+
+		// Matches one or more whitespace characters.
+		static bool parseSpaces(std::string_view value, std::size_t& pos) noexcept
+		{
+			const auto start = pos;
+			skipSpaces(value, pos);
+			return pos != start;
+		}
+
+		// Matches optional whitespace followed by the end of the string.
+		static bool parseEnd(std::string_view value, std::size_t& pos) noexcept
+		{
+			skipSpaces(value, pos);
+			return pos == value.length();
+		}
+
+		// Matches exactly `count` decimal digits.
+		static bool parseDigits(std::string_view value, std::size_t& pos, unsigned count, unsigned& result) noexcept
+		{
+			if (value.length() - pos < count)
+				return false;
+
+			result = 0;
+
+			for (const auto end = pos + count; pos < end; ++pos)
+			{
+				if (!isDigit(value[pos]))
+					return false;
+
+				result = result * 10 + static_cast<unsigned>(value[pos] - '0');
+			}
+
+			return true;
+		}
+
+		// Matches a separator character surrounded by optional whitespace.
+		static bool parseSeparator(std::string_view value, std::size_t& pos, char separator) noexcept
+		{
+			skipSpaces(value, pos);
+
+			if (pos >= value.length() || value[pos] != separator)
+				return false;
+
+			++pos;
+			skipSpaces(value, pos);
+			return true;
+		}
+
+		// Matches `\s*YYYY\s*-\s*MM\s*-\s*DD`.
+		static bool parseDate(
+			std::string_view value, std::size_t& pos, unsigned& year, unsigned& month, unsigned& day) noexcept
+		{
+			skipSpaces(value, pos);
+
+			return parseDigits(value, pos, 4, year) && parseSeparator(value, pos, '-') &&
+				parseDigits(value, pos, 2, month) && parseSeparator(value, pos, '-') && parseDigits(value, pos, 2, day);
+		}
+
+		// Matches `\s*HH\s*:\s*MM\s*:\s*SS`.
+		static bool parseTime(
+			std::string_view value, std::size_t& pos, unsigned& hours, unsigned& minutes, unsigned& seconds) noexcept
+		{
+			skipSpaces(value, pos);
+
+			return parseDigits(value, pos, 2, hours) && parseSeparator(value, pos, ':') &&
+				parseDigits(value, pos, 2, minutes) && parseSeparator(value, pos, ':') &&
+				parseDigits(value, pos, 2, seconds);
+		}
+
+		// Matches the optional `\s*.\s*F{1,4}` group, scaling the fraction to ten-thousandths of a second.
+		// Leaves `pos` untouched when the group does not match.
+		static bool parseFraction(std::string_view value, std::size_t& pos, unsigned& fractions) noexcept
+		{
+			auto current = pos;
+
+			if (!parseSeparator(value, current, '.'))
+				return false;
+
+			unsigned result = 0;
+			unsigned digits = 0;
+
+			for (; digits < 4 && current < value.length() && isDigit(value[current]); ++digits, ++current)
+				result = result * 10 + static_cast<unsigned>(value[current] - '0');
+
+			if (digits == 0 || (current < value.length() && isDigit(value[current])))
+				return false;
+
+			for (; digits < 4; ++digits)
+				result *= 10;
+
+			fractions = result;
+			pos = current;
+			return true;
+		}
+
+		// Matches `\s+ZONE\s*$`, where ZONE is a run of non-whitespace characters.
+		static bool parseTimeZone(std::string_view value, std::size_t pos, std::string_view& timeZone) noexcept
+		{
+			if (!parseSpaces(value, pos))
+				return false;
+
+			const auto start = pos;
+
+			while (pos < value.length() && !isSpace(value[pos]))
+				++pos;
+
+			if (pos == start)
+				return false;
+
+			timeZone = value.substr(start, pos - start);
+			return parseEnd(value, pos);
+		}
+
+		// Matches the optional fraction followed by the time zone, retrying without the fraction on failure.
+		static bool parseFractionAndTimeZone(
+			std::string_view value, std::size_t pos, unsigned& fractions, std::string_view& timeZone) noexcept
+		{
+			const auto start = pos;
+
+			if (parseFraction(value, pos, fractions) && parseTimeZone(value, pos, timeZone))
+				return true;
+
+			fractions = 0;
+			return parseTimeZone(value, start, timeZone);
+		}
+
+		static void appendNumber(std::string& result, unsigned value, unsigned width)
+		{
+			std::array<char, 16> buffer;
+			const auto [ptr, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+			const auto length = static_cast<unsigned>(ptr - buffer.data());
+
+			if (length < width)
+				result.append(width - length, '0');
+
+			result.append(buffer.data(), ptr);
+		}
+
+		// Appends `YYYY-MM-DD`.
+		static void appendDate(std::string& result, unsigned year, unsigned month, unsigned day)
+		{
+			appendNumber(result, year, 4);
+			result += '-';
+			appendNumber(result, month, 2);
+			result += '-';
+			appendNumber(result, day, 2);
+		}
+
+		// Appends `HH:MM:SS.FFFF`.
+		static void appendTime(
+			std::string& result, unsigned hours, unsigned minutes, unsigned seconds, unsigned fractions)
+		{
+			appendNumber(result, hours, 2);
+			result += ':';
+			appendNumber(result, minutes, 2);
+			result += ':';
+			appendNumber(result, seconds, 2);
+			result += '.';
+			appendNumber(result, fractions, 4);
+		}
+
 		[[noreturn]] void throwConversionErrorFromString(const std::string& str)
 		{
 			const std::intptr_t STATUS_CONVERSION_ERROR_FROM_STRING[] = {
@@ -27,7 +27,12 @@
 
 #include "config.h"
 #include "fb-api.h"
+#include "Metrics.h"
 #include "SmartPtrs.h"
+#include "Observer.h"
+#include "PooledStatus.h"
+#include "TimeZoneCache.h"
+#include <atomic>
 #include <cassert>
 #include <concepts>
 #include <memory>
@@ -49,6 +54,15 @@ namespace fbcpp
 	/// The Client must exist and remain valid while there are other objects using it, such as Attachment, Transaction
 	/// and Statement.
 	///
+	/// A single Client may be shared by any number of threads. The IUtil interface is fetched when the Client is
+	/// constructed and the numeric utility interfaces are published atomically the first time they are needed,
+	/// so every getter may be called concurrently. Only construction, move, setObserver() and shutdown() must not
+	/// race with other uses of the Client.
+	///
+	/// The objects created through a Client have their own rules: an Attachment may be used concurrently by threads
+	/// creating Transaction, Statement and Blob objects on it, while each Transaction, Statement, RowSet and Blob
+	/// object must be used by one thread at a time.
+	///
 	class Client final
 	{
 	public:
@@ -59,6 +73,7 @@ namespace fbcpp
 			: master{master}
 		{
 			assert(master);
+			util = master->getUtilInterface();
 		}
 
 #if FB_CPP_USE_BOOST_DLL != 0
@@ -84,6 +99,7 @@ namespace fbcpp
 				fbclientLib.get<decltype(fb::fb_get_master_interface)>("fb_get_master_interface");
 			master = fbGetMasterInterface();
 			assert(master);
+			util = master->getUtilInterface();
 		}
 #endif
 
@@ -94,9 +110,15 @@ namespace fbcpp
 		Client(Client&& o) noexcept
 			: master{o.master},
 			  util{o.util},
-			  int128Util{o.int128Util},
-			  decFloat16Util{o.decFloat16Util},
-			  decFloat34Util{o.decFloat34Util}
+			  int128Util{o.int128Util.load(std::memory_order_acquire)},
+			  decFloat16Util{o.decFloat16Util.load(std::memory_order_acquire)},
+			  decFloat34Util{o.decFloat34Util.load(std::memory_order_acquire)},
+			  observer{std::move(o.observer)},
+			  timeZoneCache{std::move(o.timeZoneCache)}
+#if FB_CPP_ENABLE_METRICS != 0
+			  ,
+			  metricsRegistry{std::move(o.metricsRegistry)}
+#endif
 #if FB_CPP_USE_BOOST_DLL != 0
 			  ,
 			  fbclientLib{std::move(o.fbclientLib)}
@@ -104,9 +126,9 @@ namespace fbcpp
 		{
 			o.master = nullptr;
 			o.util = nullptr;
-			o.int128Util = nullptr;
-			o.decFloat16Util = nullptr;
-			o.decFloat34Util = nullptr;
+			o.int128Util.store(nullptr, std::memory_order_relaxed);
+			o.decFloat16Util.store(nullptr, std::memory_order_relaxed);
+			o.decFloat34Util.store(nullptr, std::memory_order_relaxed);
 		}
 
 		///
@@ -141,13 +163,9 @@ namespace fbcpp
 		///
 		/// Returns a Firebird IUtil interface.
 		///
-		fb::IUtil* getUtil()
+		fb::IUtil* getUtil() noexcept
 		{
-			assert(master);
-
-			if (!util)
-				util = master->getUtilInterface();
-
+			assert(util);
 			return util;
 		}
 
@@ -158,11 +176,7 @@ namespace fbcpp
 		fb::IInt128* getInt128Util(StatusType* status)
 		{
 			assert(status);
-
-			if (!int128Util)
-				int128Util = getUtil()->getInt128(status);
-
-			return int128Util;
+			return getUtilInterface(int128Util, [&] { return getUtil()->getInt128(status); });
 		}
 
 		///
@@ -172,11 +186,7 @@ namespace fbcpp
 		fb::IDecFloat16* getDecFloat16Util(StatusType* status)
 		{
 			assert(status);
-
-			if (!decFloat16Util)
-				decFloat16Util = getUtil()->getDecFloat16(status);
-
-			return decFloat16Util;
+			return getUtilInterface(decFloat16Util, [&] { return getUtil()->getDecFloat16(status); });
 		}
 
 		///
@@ -186,20 +196,71 @@ namespace fbcpp
 		fb::IDecFloat34* getDecFloat34Util(StatusType* status)
 		{
 			assert(status);
+			return getUtilInterface(decFloat34Util, [&] { return getUtil()->getDecFloat34(status); });
+		}
 
-			if (!decFloat34Util)
-				decFloat34Util = getUtil()->getDecFloat34(status);
+		///
+		/// Returns the cache of time zone names shared by the objects created through this Client.
+		///
+		impl::TimeZoneCache& getTimeZoneCache() noexcept
+		{
+			assert(timeZoneCache);
+			return *timeZoneCache;
+		}
 
-			return decFloat34Util;
+		///
+		/// Returns the registry of the fbclient call counters, or nullptr when fb-cpp is built without
+		/// `FB_CPP_ENABLE_METRICS`.
+		///
+		impl::MetricsRegistry* getMetricsRegistry() noexcept
+		{
+#if FB_CPP_ENABLE_METRICS != 0
+			return metricsRegistry.get();
+#else
+			return nullptr;
+#endif
 		}
 
 		///
-		/// Creates and returns a Firebird IStatus instance.
+		/// Returns the counts and times of the fbclient calls made so far by all threads through this Client.
+		/// Does not lock, so the counters of calls made concurrently may be missed.
+		/// All counters are zero when fb-cpp is built without `FB_CPP_ENABLE_METRICS`.
+		///
+		MetricsSnapshot metricsSnapshot() const noexcept
+		{
+#if FB_CPP_ENABLE_METRICS != 0
+			return metricsRegistry ? metricsRegistry->snapshot() : MetricsSnapshot{};
+#else
+			return MetricsSnapshot{};
+#endif
+		}
+
+		///
+		/// Returns an empty IStatus instance taken from the calling thread's pool.
+		/// Disposing it returns it to the pool.
 		///
 		FbUniquePtr<fb::IStatus> newStatus()
 		{
 			assert(master);
-			return fbUnique(master->getStatus());
+			return fbUnique<fb::IStatus>(impl::PooledStatus::acquire());
+		}
+
+		///
+		/// Returns the observer notified of the operations of objects created through this Client, if any.
+		///
+		const std::shared_ptr<OperationObserver>& getObserver() const noexcept
+		{
+			return observer;
+		}
+
+		///
+		/// Sets (or clears, with nullptr) the observer notified of the operations of objects created
+		/// afterwards through this Client, unless their Attachment has its own observer.
+		/// It should be set before the Client is used by other threads.
+		///
+		void setObserver(std::shared_ptr<OperationObserver> value) noexcept
+		{
+			observer = std::move(value);
 		}
 
 		///
@@ -207,12 +268,34 @@ namespace fbcpp
 		///
 		void shutdown();
 
+	private:
+		// Threads racing on the first call fetch the same process-wide interface, so publishing it
+		// with a plain atomic store is enough.
+		template <typename T, typename F>
+		static T* getUtilInterface(std::atomic<T*>& cached, F&& fetch)
+		{
+			auto value = cached.load(std::memory_order_acquire);
+
+			if (!value)
+			{
+				value = fetch();
+				cached.store(value, std::memory_order_release);
+			}
+
+			return value;
+		}
+
 	private:
 		fb::IMaster* master;
 		fb::IUtil* util = nullptr;
-		fb::IInt128* int128Util = nullptr;
-		fb::IDecFloat16* decFloat16Util = nullptr;
-		fb::IDecFloat34* decFloat34Util = nullptr;
+		std::atomic<fb::IInt128*> int128Util = nullptr;
+		std::atomic<fb::IDecFloat16*> decFloat16Util = nullptr;
+		std::atomic<fb::IDecFloat34*> decFloat34Util = nullptr;
+		std::shared_ptr<OperationObserver> observer;
+		std::unique_ptr<impl::TimeZoneCache> timeZoneCache = std::make_unique<impl::TimeZoneCache>();
+#if FB_CPP_ENABLE_METRICS != 0
+		std::unique_ptr<impl::MetricsRegistry> metricsRegistry = std::make_unique<impl::MetricsRegistry>();
+#endif
 #if FB_CPP_USE_BOOST_DLL != 0
 		boost::dll::shared_library fbclientLib;
 #endif
@@ -0,0 +1,212 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "ColumnarRowSet.h"
+#include "Client.h"
+#include "RowSet.h"
+#include "Statement.h"
+#include <algorithm>
+#include <chrono>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+static unsigned getElementSize(DescriptorAdjustedType type)
+{
+	switch (type)
+	{
+		case DescriptorAdjustedType::BOOLEAN:
+			return sizeof(bool);
+
+		case DescriptorAdjustedType::INT16:
+			return sizeof(std::int16_t);
+
+		case DescriptorAdjustedType::INT32:
+			return sizeof(std::int32_t);
+
+		case DescriptorAdjustedType::INT64:
+			return sizeof(std::int64_t);
+
+		case DescriptorAdjustedType::INT128:
+			return sizeof(OpaqueInt128);
+
+		case DescriptorAdjustedType::FLOAT:
+			return sizeof(float);
+
+		case DescriptorAdjustedType::DOUBLE:
+			return sizeof(double);
+
+		case DescriptorAdjustedType::DECFLOAT16:
+			return sizeof(OpaqueDecFloat16);
+
+		case DescriptorAdjustedType::DECFLOAT34:
+			return sizeof(OpaqueDecFloat34);
+
+		case DescriptorAdjustedType::DATE:
+			return sizeof(OpaqueDate);
+
+		case DescriptorAdjustedType::TIME:
+			return sizeof(OpaqueTime);
+
+		case DescriptorAdjustedType::TIMESTAMP:
+			return sizeof(OpaqueTimestamp);
+
+		case DescriptorAdjustedType::TIME_TZ:
+			return sizeof(OpaqueTimeTz);
+
+		case DescriptorAdjustedType::TIMESTAMP_TZ:
+			return sizeof(OpaqueTimestampTz);
+
+		case DescriptorAdjustedType::BLOB:
+			return sizeof(BlobId);
+
+		default:
+			return 0;
+	}
+}
+
+
+ColumnarRowSet::ColumnarRowSet(Statement& statement, unsigned maxRows)
+{
+	assert(statement.isValid());
+	assert(statement.getResultSetHandle());
+
+	descriptors = statement.getOutputDescriptorSet();
+	prepareColumns(maxRows);
+
+	StatusWrapper statusWrapper{statement.getAttachment().getClient()};
+
+	auto outMetadata = statement.getOutputMetadata();
+	std::vector<std::byte> message(outMetadata->getMessageLength(&statusWrapper));
+
+	auto resultSet = statement.getResultSetHandle();
+	const auto timed = statement.getSlowQueryLog() != nullptr;
+	const auto start = timed ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+	unsigned count = 0;
+	bool eof = false;
+
+	auto* const metricsRegistry = statement.getAttachment().getClient().getMetricsRegistry();
+
+	for (; count < maxRows; ++count)
+	{
+		const auto status = [&]
+		{
+			MetricsScope metrics{metricsRegistry, MetricsCall::FETCH};
+			return resultSet->fetchNext(&statusWrapper, message.data());
+		}();
+
+		if (status != fb::IStatus::RESULT_OK)
+		{
+			eof = true;
+			break;
+		}
+
+		appendRow(message.data());
+	}
+
+	if (timed) [[unlikely]]
+		statement.addExternalFetch(std::chrono::steady_clock::now() - start, count, eof);
+}
+
+ColumnarRowSet::ColumnarRowSet(const RowSet& rowSet)
+	: descriptors{rowSet.getDescriptorSet()}
+{
+	prepareColumns(rowSet.getCount());
+
+	for (unsigned i = 0; i < rowSet.getCount(); ++i)
+		appendRow(rowSet.getRawRow(i).data());
+}
+
+void ColumnarRowSet::prepareColumns(unsigned expectedRows)
+{
+	columns.resize(descriptors->size());
+
+	for (std::size_t i = 0; i < descriptors->size(); ++i)
+	{
+		const auto& descriptor = descriptors->getLayout(i);
+		auto& column = columns[i];
+
+		column.nulls.reserve((expectedRows + 63u) / 64u);
+
+		if (descriptor.adjustedType == DescriptorAdjustedType::STRING)
+		{
+			column.stringOffsets.reserve(static_cast<std::size_t>(expectedRows) + 1u);
+			column.stringOffsets.push_back(0u);
+		}
+		else
+		{
+			column.elementSize = getElementSize(descriptor.adjustedType);
+			column.values.reserve(static_cast<std::size_t>(expectedRows) * column.elementSize);
+		}
+	}
+}
+
+void ColumnarRowSet::appendRow(const std::byte* message)
+{
+	const auto row = count;
+
+	for (std::size_t i = 0; i < descriptors->size(); ++i)
+	{
+		const auto& descriptor = descriptors->getLayout(i);
+		auto& column = columns[i];
+
+		if (row % 64u == 0u)
+			column.nulls.push_back(0u);
+
+		const bool isNull = *reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE;
+
+		if (isNull)
+		{
+			column.nulls.back() |= std::uint64_t{1u} << (row % 64u);
+			++column.nullCount;
+		}
+
+		const auto data = &message[descriptor.offset];
+
+		if (descriptor.adjustedType == DescriptorAdjustedType::STRING)
+		{
+			if (!isNull)
+			{
+				const auto length = *reinterpret_cast<const std::uint16_t*>(data);
+				const auto chars = reinterpret_cast<const char*>(data + sizeof(std::uint16_t));
+				column.chars.insert(column.chars.end(), chars, chars + length);
+			}
+
+			column.stringOffsets.push_back(static_cast<std::uint32_t>(column.chars.size()));
+		}
+		else if (column.elementSize != 0u)
+		{
+			const auto newSize = column.values.size() + column.elementSize;
+
+			if (!isNull)
+				column.values.insert(column.values.end(), data, data + std::min(column.elementSize, descriptor.length));
+
+			column.values.resize(newSize);
+		}
+	}
+
+	++count;
+}
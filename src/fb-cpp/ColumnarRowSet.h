@@ -0,0 +1,289 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_COLUMNAR_ROWSET_H
+#define FBCPP_COLUMNAR_ROWSET_H
+
+#include "fb-api.h"
+#include "types.h"
+#include "Blob.h"
+#include "Descriptor.h"
+#include "Exception.h"
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	class RowSet;
+	class Statement;
+
+	///
+	/// @brief A disconnected, column-oriented (struct-of-arrays) buffer of rows.
+	///
+	/// Each column is stored as one contiguous vector of values of its native
+	/// type plus a null bitmap, so scanning a column does not stride over whole
+	/// messages nor re-check the column type for every cell. Values of null
+	/// cells are stored as zero, so columns can be aggregated without checking
+	/// the bitmap when zero is a neutral value.
+	///
+	/// Column values are accessed with `getValues<T>()`, where `T` is the
+	/// native type of the column:
+	///
+	/// | Column type   | T                 |
+	/// |---------------|-------------------|
+	/// | BOOLEAN       | bool              |
+	/// | SMALLINT      | std::int16_t      |
+	/// | INTEGER       | std::int32_t      |
+	/// | BIGINT        | std::int64_t      |
+	/// | INT128        | OpaqueInt128      |
+	/// | FLOAT         | float             |
+	/// | DOUBLE        | double            |
+	/// | DECFLOAT(16)  | OpaqueDecFloat16  |
+	/// | DECFLOAT(34)  | OpaqueDecFloat34  |
+	/// | DATE          | OpaqueDate        |
+	/// | TIME          | OpaqueTime        |
+	/// | TIMESTAMP     | OpaqueTimestamp   |
+	/// | TIME WITH TZ  | OpaqueTimeTz      |
+	/// | TIMESTAMP TZ  | OpaqueTimestampTz |
+	/// | BLOB          | BlobId            |
+	///
+	/// Scaled numeric columns store their unscaled values; use `getScale()`.
+	/// String columns are accessed with `getString()`.
+	///
+	class ColumnarRowSet final
+	{
+	public:
+		///
+		/// @brief Fetches up to `maxRows` rows from the current result set of
+		/// `statement`, transposing them into columns.
+		///
+		/// The statement must have an open result set.
+		///
+		explicit ColumnarRowSet(Statement& statement, unsigned maxRows);
+
+		///
+		/// @brief Transposes the rows of an existing RowSet into columns.
+		///
+		explicit ColumnarRowSet(const RowSet& rowSet);
+
+	public:
+		///
+		/// @brief Returns the number of rows.
+		///
+		unsigned getCount() const noexcept
+		{
+			return count;
+		}
+
+		///
+		/// @brief Returns the number of columns.
+		///
+		unsigned getColumnCount() const noexcept
+		{
+			return static_cast<unsigned>(columns.size());
+		}
+
+		///
+		/// @brief Returns the column descriptors.
+		///
+		const std::vector<Descriptor>& getDescriptors() const noexcept
+		{
+			return descriptors->getDescriptors();
+		}
+
+		///
+		/// @brief Returns the shared descriptor set of the columns.
+		///
+		const DescriptorSetPtr& getDescriptorSet() const noexcept
+		{
+			return descriptors;
+		}
+
+		///
+		/// @brief Returns the scale of the column at `column`.
+		///
+		int getScale(unsigned column) const
+		{
+			return getDescriptor(column).scale;
+		}
+
+		///
+		/// @brief Returns the contiguous values of the column at `column`.
+		/// @throws FbCppException if `T` is not the native type of the column.
+		///
+		template <typename T>
+		std::span<const T> getValues(unsigned column) const
+		{
+			const auto& descriptor = getDescriptor(column);
+
+			if (descriptor.adjustedType != nativeType<T>())
+			{
+				throw FbCppException("Invalid column type: descriptor type " +
+					std::to_string(static_cast<unsigned>(descriptor.adjustedType)) + " for column " +
+					std::to_string(column));
+			}
+
+			const auto& values = columns[column].values;
+			return {reinterpret_cast<const T*>(values.data()), count};
+		}
+
+		///
+		/// @brief Returns the null bitmap of the column at `column`.
+		///
+		/// Bit `row % 64` of word `row / 64` is set when the cell is null.
+		///
+		std::span<const std::uint64_t> getNullBitmap(unsigned column) const
+		{
+			getDescriptor(column);
+			return columns[column].nulls;
+		}
+
+		///
+		/// @brief Returns the number of null cells of the column at `column`.
+		///
+		unsigned getNullCount(unsigned column) const
+		{
+			getDescriptor(column);
+			return columns[column].nullCount;
+		}
+
+		///
+		/// @brief Reports whether the cell at `column` and `row` is null.
+		///
+		bool isNull(unsigned column, unsigned row) const
+		{
+			getDescriptor(column);
+			assert(row < count);
+			return (columns[column].nulls[row / 64u] >> (row % 64u)) & 1u;
+		}
+
+		///
+		/// @brief Returns the value of a string cell, viewing the internal storage.
+		/// @throws FbCppException if the column is not a string column.
+		///
+		std::optional<std::string_view> getString(unsigned column, unsigned row) const
+		{
+			const auto& descriptor = getDescriptor(column);
+
+			if (descriptor.adjustedType != DescriptorAdjustedType::STRING)
+			{
+				throw FbCppException("Invalid column type: descriptor type " +
+					std::to_string(static_cast<unsigned>(descriptor.adjustedType)) + " for column " +
+					std::to_string(column));
+			}
+
+			assert(row < count);
+
+			if (isNull(column, row))
+				return std::nullopt;
+
+			const auto& columnData = columns[column];
+			const auto begin = columnData.stringOffsets[row];
+			const auto end = columnData.stringOffsets[row + 1u];
+
+			return std::string_view{columnData.chars.data() + begin, end - begin};
+		}
+
+	private:
+		struct Column final
+		{
+			std::vector<std::byte> values;
+			std::vector<std::uint64_t> nulls;
+			std::vector<std::uint32_t> stringOffsets;
+			std::vector<char> chars;
+			unsigned elementSize = 0;
+			unsigned nullCount = 0;
+		};
+
+	private:
+		template <typename T>
+		static constexpr DescriptorAdjustedType nativeType()
+		{
+			if constexpr (std::is_same_v<T, bool>)
+				return DescriptorAdjustedType::BOOLEAN;
+			else if constexpr (std::is_same_v<T, std::int16_t>)
+				return DescriptorAdjustedType::INT16;
+			else if constexpr (std::is_same_v<T, std::int32_t>)
+				return DescriptorAdjustedType::INT32;
+			else if constexpr (std::is_same_v<T, std::int64_t>)
+				return DescriptorAdjustedType::INT64;
+			else if constexpr (std::is_same_v<T, OpaqueInt128>)
+				return DescriptorAdjustedType::INT128;
+			else if constexpr (std::is_same_v<T, float>)
+				return DescriptorAdjustedType::FLOAT;
+			else if constexpr (std::is_same_v<T, double>)
+				return DescriptorAdjustedType::DOUBLE;
+			else if constexpr (std::is_same_v<T, OpaqueDecFloat16>)
+				return DescriptorAdjustedType::DECFLOAT16;
+			else if constexpr (std::is_same_v<T, OpaqueDecFloat34>)
+				return DescriptorAdjustedType::DECFLOAT34;
+			else if constexpr (std::is_same_v<T, OpaqueDate>)
+				return DescriptorAdjustedType::DATE;
+			else if constexpr (std::is_same_v<T, OpaqueTime>)
+				return DescriptorAdjustedType::TIME;
+			else if constexpr (std::is_same_v<T, OpaqueTimestamp>)
+				return DescriptorAdjustedType::TIMESTAMP;
+			else if constexpr (std::is_same_v<T, OpaqueTimeTz>)
+				return DescriptorAdjustedType::TIME_TZ;
+			else if constexpr (std::is_same_v<T, OpaqueTimestampTz>)
+				return DescriptorAdjustedType::TIMESTAMP_TZ;
+			else if constexpr (std::is_same_v<T, BlobId>)
+				return DescriptorAdjustedType::BLOB;
+			else
+				static_assert(sizeof(T) == 0, "Unsupported column value type");
+		}
+
+		const DescriptorLayout& getDescriptor(unsigned column) const
+		{
+			if (column >= columns.size())
+				throw std::out_of_range("index out of range");
+
+			return descriptors->getLayout(column);
+		}
+
+		void prepareColumns(unsigned expectedRows);
+		void appendRow(const std::byte* message);
+
+	private:
+		unsigned count = 0;
+		DescriptorSetPtr descriptors;
+		std::vector<Column> columns;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_COLUMNAR_ROWSET_H
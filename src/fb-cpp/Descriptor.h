@@ -26,7 +26,15 @@
 #define FBCPP_DESCRIPTOR_H
 
 #include "fb-api.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 
 ///
@@ -241,6 +249,155 @@ namespace fbcpp
 		BOOLEAN = SQL_BOOLEAN,
 	};
 
+	namespace impl
+	{
+		constexpr char toUpperAscii(char c) noexcept
+		{
+			return c >= 'a' && c <= 'z' ? static_cast<char>(c - 'a' + 'A') : c;
+		}
+
+		///
+		/// Case-insensitive (ASCII) FNV-1a hash of a column or parameter name.
+		///
+		constexpr std::size_t hashDescriptorName(std::string_view name) noexcept
+		{
+			std::uint64_t hash = 14695981039346656037ull;
+
+			for (const auto c : name)
+			{
+				hash ^= static_cast<unsigned char>(toUpperAscii(c));
+				hash *= 1099511628211ull;
+			}
+
+			return static_cast<std::size_t>(hash);
+		}
+
+		///
+		/// Case-insensitive (ASCII) comparison of column or parameter names.
+		///
+		constexpr bool equalDescriptorNames(std::string_view a, std::string_view b) noexcept
+		{
+			if (a.size() != b.size())
+				return false;
+
+			for (std::size_t i = 0; i < a.size(); ++i)
+			{
+				if (toUpperAscii(a[i]) != toUpperAscii(b[i]))
+					return false;
+			}
+
+			return true;
+		}
+	}  // namespace impl
+
+	///
+	/// Name of a column or parameter used for name-based lookups, together with its case-insensitive hash.
+	///
+	/// The hash is computed on construction, so a `constexpr` instance (e.g.
+	/// `static constexpr DescriptorName ID{"ID"};`) looks up a name without hashing it at run time.
+	/// Names compare case-insensitively, matching how Firebird treats unquoted identifiers.
+	///
+	class DescriptorName final
+	{
+	public:
+		///
+		/// Constructs a name from a string literal.
+		///
+		template <std::size_t N>
+		constexpr DescriptorName(const char (&name)[N]) noexcept
+			: DescriptorName{std::string_view{name}}
+		{
+		}
+
+		///
+		/// Constructs a name from a string view. The referenced characters must outlive this object.
+		///
+		constexpr DescriptorName(std::string_view name) noexcept
+			: name{name},
+			  hash{impl::hashDescriptorName(name)}
+		{
+		}
+
+		///
+		/// Constructs a name from a string. The string must outlive this object.
+		///
+		DescriptorName(const std::string& name) noexcept
+			: DescriptorName{std::string_view{name}}
+		{
+		}
+
+	public:
+		///
+		/// Returns the name.
+		///
+		constexpr std::string_view getName() const noexcept
+		{
+			return name;
+		}
+
+		///
+		/// Returns the case-insensitive hash of the name.
+		///
+		constexpr std::size_t getHash() const noexcept
+		{
+			return hash;
+		}
+
+	private:
+		std::string_view name;
+		std::size_t hash;
+	};
+
+	namespace impl
+	{
+		///
+		/// Case-insensitive hash of DescriptorNameMap keys, accepting DescriptorName keys with their cached hash.
+		///
+		struct DescriptorNameHash final
+		{
+			using is_transparent = void;
+
+			std::size_t operator()(const std::string& name) const noexcept
+			{
+				return hashDescriptorName(name);
+			}
+
+			std::size_t operator()(const DescriptorName& name) const noexcept
+			{
+				return name.getHash();
+			}
+		};
+
+		///
+		/// Case-insensitive equality of DescriptorNameMap keys.
+		///
+		struct DescriptorNameEqual final
+		{
+			using is_transparent = void;
+
+			bool operator()(const std::string& a, const std::string& b) const noexcept
+			{
+				return equalDescriptorNames(a, b);
+			}
+
+			bool operator()(const std::string& a, const DescriptorName& b) const noexcept
+			{
+				return equalDescriptorNames(a, b.getName());
+			}
+
+			bool operator()(const DescriptorName& a, const std::string& b) const noexcept
+			{
+				return equalDescriptorNames(a.getName(), b);
+			}
+		};
+
+		///
+		/// Hash map keyed by case-insensitive column or parameter names.
+		///
+		template <typename T>
+		using DescriptorNameMap = std::unordered_map<std::string, T, DescriptorNameHash, DescriptorNameEqual>;
+	}  // namespace impl
+
 	///
 	/// Describes a parameter or column.
 	///
@@ -311,6 +468,205 @@ namespace fbcpp
 		///
 		int subType;
 	};
+
+	///
+	/// Hot subset of a Descriptor: the fields needed to encode and decode message buffers,
+	/// packed together without the naming strings.
+	///
+	struct DescriptorLayout final
+	{
+		///
+		/// Original SQL type as reported by Firebird.
+		///
+		DescriptorOriginalType originalType;
+
+		///
+		/// Adjusted type after normalization for easier handling.
+		///
+		DescriptorAdjustedType adjustedType;
+
+		///
+		/// Decimal scale for numeric types; zero for non-numeric types.
+		///
+		int scale;
+
+		///
+		/// Length in bytes of the column or parameter data.
+		///
+		unsigned length;
+
+		///
+		/// Byte offset of this field within the message buffer.
+		///
+		unsigned offset;
+
+		///
+		/// Byte offset of the null indicator within the message buffer.
+		///
+		unsigned nullOffset;
+
+		///
+		/// Indicates whether the column or parameter can contain null values.
+		///
+		bool isNullable;
+	};
+
+	///
+	/// Immutable list of the descriptors of a message, shared (through DescriptorSetPtr) by all the objects
+	/// reading or writing messages of the same format, such as Statement, Row, RowSet and Batch.
+	/// The layout fields are also kept in a separate contiguous array, so decoding does not touch the naming
+	/// strings.
+	///
+	class DescriptorSet final
+	{
+	public:
+		///
+		/// Constructs a DescriptorSet from the specified descriptors.
+		///
+		explicit DescriptorSet(std::vector<Descriptor> descriptors)
+			: descriptors{std::move(descriptors)}
+		{
+			layouts.reserve(this->descriptors.size());
+
+			for (const auto& descriptor : this->descriptors)
+			{
+				layouts.push_back(DescriptorLayout{
+					.originalType = descriptor.originalType,
+					.adjustedType = descriptor.adjustedType,
+					.scale = descriptor.scale,
+					.length = descriptor.length,
+					.offset = descriptor.offset,
+					.nullOffset = descriptor.nullOffset,
+					.isNullable = descriptor.isNullable,
+				});
+			}
+
+			// Aliases take precedence over field names; the first column with a given name wins.
+			for (unsigned index = 0u; index < this->descriptors.size(); ++index)
+			{
+				if (const auto& alias = this->descriptors[index].alias; !alias.empty())
+					nameIndexes.emplace(alias, index);
+			}
+
+			for (unsigned index = 0u; index < this->descriptors.size(); ++index)
+			{
+				if (const auto& name = this->descriptors[index].name; !name.empty())
+					nameIndexes.emplace(name, index);
+			}
+		}
+
+		DescriptorSet(const DescriptorSet&) = delete;
+		DescriptorSet& operator=(const DescriptorSet&) = delete;
+
+	public:
+		///
+		/// Returns a shared set without descriptors, held by objects that have none, such as moved-from ones.
+		///
+		static const std::shared_ptr<const DescriptorSet>& getEmpty()
+		{
+			static const auto empty = std::make_shared<const DescriptorSet>(std::vector<Descriptor>{});
+			return empty;
+		}
+
+	public:
+		///
+		/// Returns the number of descriptors.
+		///
+		std::size_t size() const noexcept
+		{
+			return descriptors.size();
+		}
+
+		///
+		/// Returns whether there are no descriptors.
+		///
+		bool empty() const noexcept
+		{
+			return descriptors.empty();
+		}
+
+		///
+		/// Returns the full descriptor at the specified index.
+		///
+		const Descriptor& operator[](std::size_t index) const noexcept
+		{
+			return descriptors[index];
+		}
+
+		///
+		/// Returns an iterator to the first full descriptor.
+		///
+		std::vector<Descriptor>::const_iterator begin() const noexcept
+		{
+			return descriptors.begin();
+		}
+
+		///
+		/// Returns an iterator past the last full descriptor.
+		///
+		std::vector<Descriptor>::const_iterator end() const noexcept
+		{
+			return descriptors.end();
+		}
+
+		///
+		/// Returns the full descriptors.
+		///
+		const std::vector<Descriptor>& getDescriptors() const noexcept
+		{
+			return descriptors;
+		}
+
+		///
+		/// Returns the layout of the descriptor at the specified index.
+		///
+		const DescriptorLayout& getLayout(std::size_t index) const noexcept
+		{
+			return layouts[index];
+		}
+
+		///
+		/// Returns the layouts of all descriptors.
+		///
+		const std::vector<DescriptorLayout>& getLayouts() const noexcept
+		{
+			return layouts;
+		}
+
+		///
+		/// Returns the index of the descriptor with the given alias or, failing that, field name.
+		/// The lookup is case-insensitive and costs a single hash probe.
+		///
+		std::optional<unsigned> findIndex(const DescriptorName& name) const
+		{
+			if (const auto it = nameIndexes.find(name); it != nameIndexes.end())
+				return it->second;
+
+			return std::nullopt;
+		}
+
+		///
+		/// Returns the index of the descriptor with the given alias or, failing that, field name.
+		/// @throws std::out_of_range if no descriptor has that name.
+		///
+		unsigned getIndex(const DescriptorName& name) const
+		{
+			if (const auto index = findIndex(name))
+				return *index;
+
+			throw std::out_of_range("unknown name: " + std::string{name.getName()});
+		}
+
+	private:
+		std::vector<Descriptor> descriptors;
+		std::vector<DescriptorLayout> layouts;
+		impl::DescriptorNameMap<unsigned> nameIndexes;
+	};
+
+	///
+	/// Shared pointer to an immutable DescriptorSet.
+	///
+	using DescriptorSetPtr = std::shared_ptr<const DescriptorSet>;
 }  // namespace fbcpp
 
 
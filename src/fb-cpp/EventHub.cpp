@@ -0,0 +1,735 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "EventHub.h"
+#include "Client.h"
+#include "Exception.h"
+#include "SmartPtrs.h"
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+namespace
+{
+	std::uint32_t readUint32LE(const std::uint8_t* data) noexcept
+	{
+		return static_cast<std::uint32_t>(data[0]) | (static_cast<std::uint32_t>(data[1]) << 8) |
+			(static_cast<std::uint32_t>(data[2]) << 16) | (static_cast<std::uint32_t>(data[3]) << 24);
+	}
+
+	void writeUint32LE(std::uint8_t* data, std::uint32_t value) noexcept
+	{
+		data[0] = static_cast<std::uint8_t>(value & 0xFF);
+		data[1] = static_cast<std::uint8_t>((value >> 8) & 0xFF);
+		data[2] = static_cast<std::uint8_t>((value >> 16) & 0xFF);
+		data[3] = static_cast<std::uint8_t>((value >> 24) & 0xFF);
+	}
+
+	void cancelEvents(Client& client, FbRef<fb::IEvents>& handle) noexcept
+	{
+		if (!handle)
+			return;
+
+		try
+		{
+			StatusWrapper statusWrapper{client};
+			handle->cancel(&statusWrapper);
+		}
+		catch (...)
+		{
+			// swallow
+		}
+
+		handle.reset();
+	}
+
+	// Callback state of a subscription, shared with its queued notifications.
+	struct Delivery final
+	{
+		explicit Delivery(EventHub::Callback callback)
+			: callback{std::move(callback)}
+		{
+		}
+
+		EventHub::Callback callback;
+		std::atomic<bool> active{true};
+	};
+
+	struct Notification final
+	{
+		std::shared_ptr<Delivery> delivery;
+		std::vector<EventCount> counts;
+	};
+
+	class Dispatcher final
+	{
+	public:
+		Dispatcher()
+			: thread{&Dispatcher::run, this}
+		{
+		}
+
+		~Dispatcher() noexcept
+		{
+			stop();
+		}
+
+		Dispatcher(const Dispatcher&) = delete;
+		Dispatcher& operator=(const Dispatcher&) = delete;
+
+	public:
+		void post(Notification notification)
+		{
+			{  // scope
+				std::lock_guard mutexGuard{mutex};
+				notifications.push_back(std::move(notification));
+			}
+
+			condition.notify_one();
+		}
+
+		void stop() noexcept
+		{
+			{  // scope
+				std::lock_guard mutexGuard{mutex};
+				running = false;
+				notifications.clear();
+			}
+
+			condition.notify_all();
+
+			if (thread.joinable())
+				thread.join();
+		}
+
+	private:
+		void run()
+		{
+			while (true)
+			{
+				Notification notification;
+
+				{  // scope
+					std::unique_lock mutexGuard{mutex};
+					condition.wait(mutexGuard, [this] { return !notifications.empty() || !running; });
+
+					if (!running)
+						break;
+
+					notification = std::move(notifications.front());
+					notifications.pop_front();
+				}
+
+				if (!notification.delivery->active.load(std::memory_order_acquire))
+					continue;
+
+				try
+				{
+					notification.delivery->callback(notification.counts);
+				}
+				catch (...)
+				{
+					assert(false);
+				}
+			}
+		}
+
+	private:
+		std::mutex mutex;
+		std::condition_variable condition;
+		std::deque<Notification> notifications;
+		bool running = true;
+		std::thread thread;
+	};
+}  // namespace
+
+
+struct EventHub::Core final : std::enable_shared_from_this<EventHub::Core>
+{
+	class Registration;
+	struct Shard;
+	struct AttachmentEvents;
+
+	struct NameEntry final
+	{
+		std::vector<SubscriptionId> subscribers;
+		Shard* shard = nullptr;
+	};
+
+	struct Subscription final
+	{
+		AttachmentEvents* attachmentEvents;
+		std::vector<std::string> eventNames;
+		std::shared_ptr<Delivery> delivery;
+		Dispatcher* dispatcher;
+	};
+
+	struct Shard final
+	{
+		AttachmentEvents* owner;
+		std::vector<std::string> names;
+		FbRef<Registration> registration;
+		bool dirty = false;
+	};
+
+	struct AttachmentEvents final
+	{
+		Attachment* attachment;
+		std::map<std::string, NameEntry, std::less<>> names;
+		std::vector<std::unique_ptr<Shard>> shards;
+	};
+
+	// One Firebird event registration of a shard. Reference counted, as Firebird keeps it while an event request
+	// is queued; its `shard` is reset (under the core mutex) when it is replaced or the hub stops.
+	class Registration final : public fb::IEventCallbackImpl<Registration, StatusWrapper>
+	{
+	public:
+		Registration(std::shared_ptr<Core> core, Shard& shard)
+			: core{std::move(core)},
+			  shard{&shard},
+			  attachment{shard.owner->attachment},
+			  names{shard.names}
+		{
+			std::size_t bufferLength = 1;  // Event block version byte
+
+			for (const auto& name : names)
+				bufferLength += 1 + name.size() + sizeof(std::uint32_t);
+
+			eventBuffer.assign(bufferLength, 0);
+			resultBuffer.assign(bufferLength, 0);
+			countOffsets.resize(names.size());
+			baselined.assign(names.size(), false);
+
+			auto* eventBufferPtr = eventBuffer.data();
+			*eventBufferPtr++ = 1;  // Event parameter block version.
+
+			for (std::size_t i = 0; i < names.size(); ++i)
+			{
+				const auto& name = names[i];
+				*eventBufferPtr++ = static_cast<std::uint8_t>(name.size());
+				std::memcpy(eventBufferPtr, name.data(), name.size());
+				eventBufferPtr += name.size();
+				countOffsets[i] = static_cast<unsigned>(eventBufferPtr - eventBuffer.data());
+				eventBufferPtr += sizeof(std::uint32_t);
+			}
+
+			assert(static_cast<std::size_t>(eventBufferPtr - eventBuffer.data()) == eventBuffer.size());
+		}
+
+		Registration(const Registration&) = delete;
+		Registration& operator=(const Registration&) = delete;
+
+	public:
+		void eventCallbackFunction(unsigned length, const std::uint8_t* events) override
+		{
+			core->handleEvent(*this, length, events);
+		}
+
+		void addRef() override
+		{
+			refCount.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		int release() override
+		{
+			if (refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				delete this;
+				return 0;
+			}
+
+			return 1;
+		}
+
+	public:
+		// Starts with the counts of the names kept from the replaced registration, so their occurrences since its
+		// last notification are reported by the first notification of this one.
+		void carryCounts(const Registration& previous)
+		{
+			for (std::size_t i = 0; i < previous.names.size(); ++i)
+			{
+				if (!previous.baselined[i])
+					continue;
+
+				const auto it = std::find(names.begin(), names.end(), previous.names[i]);
+
+				if (it == names.end())
+					continue;
+
+				const auto index = static_cast<std::size_t>(it - names.begin());
+				std::memcpy(&eventBuffer[countOffsets[index]], &previous.eventBuffer[previous.countOffsets[i]],
+					sizeof(std::uint32_t));
+				baselined[index] = true;
+			}
+		}
+
+	public:
+		std::shared_ptr<Core> core;
+		Shard* shard;
+		Attachment* attachment;
+		std::vector<std::string> names;
+		std::vector<std::uint8_t> eventBuffer;
+		std::vector<std::uint8_t> resultBuffer;
+		std::vector<unsigned> countOffsets;
+		std::vector<bool> baselined;
+		FbRef<fb::IEvents> handle;
+		bool first = true;
+
+	private:
+		std::atomic<int> refCount{1};
+	};
+
+	void handleEvent(Registration& registration, unsigned length, const std::uint8_t* events) noexcept;
+	void synchronize(AttachmentEvents& attachmentEvents);
+	void removeSubscription(SubscriptionId id);
+
+	std::mutex subscriptionMutex;  // Serializes the changes of the subscriptions, held while calling Firebird.
+	std::mutex mutex;  // Protects the state below and the registrations.
+	std::vector<std::unique_ptr<Dispatcher>> dispatchers;
+	std::unordered_map<SubscriptionId, Subscription> subscriptions;
+	std::unordered_map<Attachment*, std::unique_ptr<AttachmentEvents>> attachments;
+	SubscriptionId nextId = 1u;
+	bool stopped = false;
+};
+
+
+void EventHub::Core::handleEvent(Registration& registration, unsigned length, const std::uint8_t* events) noexcept
+{
+	try
+	{
+		Attachment* attachment;
+
+		{  // scope
+			std::lock_guard mutexGuard{mutex};
+
+			if (stopped || !registration.shard)
+				return;
+
+			attachment = registration.attachment;
+
+			const auto copyLength = std::min<std::size_t>(length, registration.resultBuffer.size());
+			std::memcpy(registration.resultBuffer.data(), events, copyLength);
+
+			const auto& attachmentNames = registration.shard->owner->names;
+			std::vector<std::pair<SubscriptionId, EventCount>> fired;
+
+			for (std::size_t i = 0; i < registration.names.size(); ++i)
+			{
+				const auto offset = registration.countOffsets[i];
+
+				if (offset + sizeof(std::uint32_t) > copyLength)
+					continue;
+
+				const auto newValue = readUint32LE(registration.resultBuffer.data() + offset);
+				const auto oldValue = readUint32LE(registration.eventBuffer.data() + offset);
+				const bool report = registration.baselined[i] || !registration.first;
+
+				registration.baselined[i] = true;
+				writeUint32LE(registration.eventBuffer.data() + offset, newValue);
+
+				if (!report || newValue <= oldValue)
+					continue;
+
+				const auto entry = attachmentNames.find(registration.names[i]);
+
+				if (entry == attachmentNames.end())
+					continue;
+
+				for (const auto id : entry->second.subscribers)
+					fired.emplace_back(id, EventCount{registration.names[i], newValue - oldValue});
+			}
+
+			registration.first = false;
+
+			std::stable_sort(
+				fired.begin(), fired.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+			for (auto it = fired.begin(); it != fired.end();)
+			{
+				const auto subscription = subscriptions.find(it->first);
+				Notification notification;
+
+				for (; it != fired.end() && it->first == subscription->first; ++it)
+					notification.counts.push_back(std::move(it->second));
+
+				notification.delivery = subscription->second.delivery;
+				subscription->second.dispatcher->post(std::move(notification));
+			}
+		}
+
+		auto attachmentHandle = attachment->getHandle();
+
+		if (!attachmentHandle)
+			return;
+
+		StatusWrapper statusWrapper{attachment->getClient()};
+		FbRef<fb::IEvents> newHandle{attachmentHandle->queEvents(&statusWrapper, &registration,
+			static_cast<unsigned>(registration.eventBuffer.size()), registration.eventBuffer.data())};
+
+		FbRef<fb::IEvents> previousHandle;
+
+		{  // scope
+			std::lock_guard mutexGuard{mutex};
+
+			if (registration.shard && !stopped)
+			{
+				previousHandle = std::move(registration.handle);
+				registration.handle = std::move(newHandle);
+			}
+		}
+
+		cancelEvents(attachment->getClient(), newHandle);
+	}
+	catch (...)
+	{
+		// Prevent exceptions from escaping into Firebird's C API callback.
+	}
+}
+
+// Replaces the registrations of the shards whose names changed and removes the empty ones.
+void EventHub::Core::synchronize(AttachmentEvents& attachmentEvents)
+{
+	auto& client = attachmentEvents.attachment->getClient();
+
+	for (std::size_t shardIndex = 0; shardIndex < attachmentEvents.shards.size();)
+	{
+		auto& shard = *attachmentEvents.shards[shardIndex];
+		FbRef<Registration> newRegistration;
+		FbRef<fb::IEvents> oldHandle;
+
+		{  // scope
+			std::lock_guard mutexGuard{mutex};
+
+			if (!shard.dirty)
+			{
+				++shardIndex;
+				continue;
+			}
+
+			shard.dirty = false;
+
+			if (!shard.names.empty())
+				newRegistration.reset(new Registration{shared_from_this(), shard});
+
+			if (shard.registration)
+			{
+				if (newRegistration)
+					newRegistration->carryCounts(*shard.registration.get());
+
+				shard.registration->shard = nullptr;
+				oldHandle = std::move(shard.registration->handle);
+				shard.registration.reset();
+			}
+
+			shard.registration = newRegistration;
+		}
+
+		cancelEvents(client, oldHandle);
+
+		if (!newRegistration)
+		{
+			std::lock_guard mutexGuard{mutex};
+			attachmentEvents.shards.erase(attachmentEvents.shards.begin() + static_cast<std::ptrdiff_t>(shardIndex));
+			continue;
+		}
+
+		try
+		{
+			StatusWrapper statusWrapper{client};
+			FbRef<fb::IEvents> handle{attachmentEvents.attachment->getHandle()->queEvents(&statusWrapper,
+				newRegistration.get(), static_cast<unsigned>(newRegistration->eventBuffer.size()),
+				newRegistration->eventBuffer.data())};
+
+			std::lock_guard mutexGuard{mutex};
+
+			// A notification may already have queued the next request.
+			if (newRegistration->shard && !newRegistration->handle)
+				newRegistration->handle = std::move(handle);
+		}
+		catch (...)
+		{
+			std::lock_guard mutexGuard{mutex};
+			newRegistration->shard = nullptr;
+			shard.registration.reset();
+			shard.dirty = true;
+			throw;
+		}
+
+		++shardIndex;
+	}
+}
+
+// Removes the subscription from the maps, marking the shards that lose names. Called with the mutex locked.
+void EventHub::Core::removeSubscription(SubscriptionId id)
+{
+	const auto subscription = subscriptions.find(id);
+
+	if (subscription == subscriptions.end())
+		return;
+
+	subscription->second.delivery->active.store(false, std::memory_order_release);
+
+	auto& attachmentNames = subscription->second.attachmentEvents->names;
+
+	for (const auto& name : subscription->second.eventNames)
+	{
+		const auto entry = attachmentNames.find(name);
+		assert(entry != attachmentNames.end());
+
+		auto& subscribers = entry->second.subscribers;
+		subscribers.erase(std::find(subscribers.begin(), subscribers.end(), id));
+
+		if (subscribers.empty())
+		{
+			auto& shardNames = entry->second.shard->names;
+			shardNames.erase(std::find(shardNames.begin(), shardNames.end(), name));
+			entry->second.shard->dirty = true;
+			attachmentNames.erase(entry);
+		}
+	}
+
+	subscriptions.erase(subscription);
+}
+
+
+EventHub::EventHub(unsigned dispatcherThreads)
+	: core{std::make_shared<Core>()}
+{
+	if (dispatcherThreads == 0)
+		throw std::invalid_argument{"An EventHub requires at least one dispatcher thread"};
+
+	core->dispatchers.reserve(dispatcherThreads);
+
+	for (unsigned i = 0; i < dispatcherThreads; ++i)
+		core->dispatchers.push_back(std::make_unique<Dispatcher>());
+}
+
+EventHub::SubscriptionId EventHub::subscribe(
+	Attachment& attachment, const std::vector<std::string>& eventNames, Callback callback)
+{
+	assert(attachment.isValid());
+
+	if (eventNames.empty())
+		throw std::invalid_argument{"A subscription requires at least one event"};
+
+	if (!callback)
+		throw std::invalid_argument{"EventHub callback must not be empty"};
+
+	for (const auto& name : eventNames)
+	{
+		if (name.empty())
+			throw std::invalid_argument{"Event names must not be empty"};
+
+		if (name.size() > std::numeric_limits<std::uint8_t>::max())
+			throw std::invalid_argument{"Event names must be shorter than 256 bytes"};
+	}
+
+	auto names = eventNames;
+	std::sort(names.begin(), names.end());
+	names.erase(std::unique(names.begin(), names.end()), names.end());
+
+	std::lock_guard subscriptionGuard{core->subscriptionMutex};
+	Core::AttachmentEvents* attachmentEvents;
+	SubscriptionId id;
+
+	{  // scope
+		std::lock_guard mutexGuard{core->mutex};
+
+		if (core->stopped)
+			throw FbCppException{"EventHub is stopped"};
+
+		auto& attachmentEventsPtr = core->attachments[&attachment];
+
+		if (!attachmentEventsPtr)
+		{
+			attachmentEventsPtr = std::make_unique<Core::AttachmentEvents>();
+			attachmentEventsPtr->attachment = &attachment;
+		}
+
+		attachmentEvents = attachmentEventsPtr.get();
+		id = core->nextId++;
+
+		for (const auto& name : names)
+		{
+			auto& entry = attachmentEvents->names[name];
+
+			if (!entry.shard)
+			{
+				auto& shards = attachmentEvents->shards;
+				const auto shard = std::find_if(shards.begin(), shards.end(),
+					[](const auto& shard) { return shard->names.size() < MAX_EVENTS_PER_REGISTRATION; });
+
+				if (shard == shards.end())
+				{
+					shards.push_back(std::make_unique<Core::Shard>());
+					shards.back()->owner = attachmentEvents;
+					entry.shard = shards.back().get();
+				}
+				else
+					entry.shard = shard->get();
+
+				entry.shard->names.push_back(name);
+				entry.shard->dirty = true;
+			}
+
+			entry.subscribers.push_back(id);
+		}
+
+		core->subscriptions.emplace(id,
+			Core::Subscription{
+				.attachmentEvents = attachmentEvents,
+				.eventNames = std::move(names),
+				.delivery = std::make_shared<Delivery>(std::move(callback)),
+				.dispatcher = core->dispatchers[id % core->dispatchers.size()].get(),
+			});
+	}
+
+	try
+	{
+		core->synchronize(*attachmentEvents);
+	}
+	catch (...)
+	{
+		{  // scope
+			std::lock_guard mutexGuard{core->mutex};
+			core->removeSubscription(id);
+		}
+
+		try
+		{
+			core->synchronize(*attachmentEvents);
+		}
+		catch (...)
+		{
+			// swallow
+		}
+
+		throw;
+	}
+
+	return id;
+}
+
+void EventHub::unsubscribe(SubscriptionId id)
+{
+	std::lock_guard subscriptionGuard{core->subscriptionMutex};
+	Core::AttachmentEvents* attachmentEvents;
+
+	{  // scope
+		std::lock_guard mutexGuard{core->mutex};
+
+		const auto subscription = core->subscriptions.find(id);
+
+		if (subscription == core->subscriptions.end())
+			return;
+
+		attachmentEvents = subscription->second.attachmentEvents;
+		core->removeSubscription(id);
+	}
+
+	core->synchronize(*attachmentEvents);
+
+	std::lock_guard mutexGuard{core->mutex};
+
+	if (attachmentEvents->names.empty() && attachmentEvents->shards.empty())
+		core->attachments.erase(attachmentEvents->attachment);
+}
+
+std::size_t EventHub::getSubscriptionCount()
+{
+	std::lock_guard mutexGuard{core->mutex};
+	return core->subscriptions.size();
+}
+
+std::size_t EventHub::getRegistrationCount()
+{
+	std::lock_guard mutexGuard{core->mutex};
+	std::size_t count = 0;
+
+	for (const auto& [attachment, attachmentEvents] : core->attachments)
+	{
+		for (const auto& shard : attachmentEvents->shards)
+		{
+			if (shard->registration)
+				++count;
+		}
+	}
+
+	return count;
+}
+
+void EventHub::stop()
+{
+	std::lock_guard subscriptionGuard{core->subscriptionMutex};
+	std::vector<std::pair<Client*, FbRef<fb::IEvents>>> handles;
+
+	{  // scope
+		std::lock_guard mutexGuard{core->mutex};
+
+		if (core->stopped)
+			return;
+
+		core->stopped = true;
+
+		for (auto& [attachment, attachmentEvents] : core->attachments)
+		{
+			for (auto& shard : attachmentEvents->shards)
+			{
+				if (!shard->registration)
+					continue;
+
+				shard->registration->shard = nullptr;
+				handles.emplace_back(&attachment->getClient(), std::move(shard->registration->handle));
+				shard->registration.reset();
+			}
+		}
+
+		for (auto& [id, subscription] : core->subscriptions)
+			subscription.delivery->active.store(false, std::memory_order_release);
+
+		core->subscriptions.clear();
+		core->attachments.clear();
+	}
+
+	for (auto& [client, handle] : handles)
+		cancelEvents(*client, handle);
+
+	for (auto& dispatcher : core->dispatchers)
+		dispatcher->stop();
+}
@@ -0,0 +1,141 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_EVENT_HUB_H
+#define FBCPP_EVENT_HUB_H
+
+#include "Attachment.h"
+#include "EventListener.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// @brief Multiplexes any number of event subscriptions, on any number of attachments, over few
+	/// Firebird event registrations and a small shared pool of dispatcher threads.
+	///
+	/// The event names of each attachment are sharded into registrations (`IEvents`) of at most
+	/// `MAX_EVENTS_PER_REGISTRATION` names. Subscribing or unsubscribing re-registers only the shard whose names
+	/// changed; the counts of the other names in that shard are carried over, so no occurrence is lost or
+	/// delivered twice.
+	///
+	/// The callbacks of a subscription are always delivered in order by the same dispatcher thread, and the
+	/// callbacks of different subscriptions may run concurrently when more than one dispatcher thread is used.
+	/// Attachments must remain valid while they have subscriptions.
+	///
+	class EventHub final
+	{
+	public:
+		///
+		/// Function invoked with the counts of the events of a subscription that fired since the last notification.
+		///
+		using Callback = std::function<void(const std::vector<EventCount>& counts)>;
+
+		///
+		/// Identifies a subscription.
+		///
+		using SubscriptionId = std::uint64_t;
+
+		///
+		/// Maximum number of event names of a single Firebird event registration.
+		///
+		static constexpr std::size_t MAX_EVENTS_PER_REGISTRATION = 255u;
+
+	public:
+		///
+		/// Creates an event hub delivering the callbacks on the specified number of dispatcher threads.
+		///
+		explicit EventHub(unsigned dispatcherThreads = 1u);
+
+		///
+		/// Cancels all subscriptions and waits for the dispatcher threads to finish.
+		///
+		~EventHub() noexcept
+		{
+			try
+			{
+				stop();
+			}
+			catch (...)
+			{
+				// swallow
+			}
+		}
+
+		EventHub(const EventHub&) = delete;
+		EventHub& operator=(const EventHub&) = delete;
+
+		EventHub(EventHub&&) = delete;
+		EventHub& operator=(EventHub&&) = delete;
+
+	public:
+		///
+		/// Subscribes to the specified events of the attachment and returns the subscription identifier.
+		/// Occurrences that happened before the subscription are not reported.
+		///
+		SubscriptionId subscribe(Attachment& attachment, const std::vector<std::string>& eventNames, Callback callback);
+
+		///
+		/// Cancels the subscription. Notifications already queued for it are discarded, but a callback already
+		/// running is not waited for. Unknown identifiers are ignored.
+		///
+		void unsubscribe(SubscriptionId id);
+
+		///
+		/// Returns the number of active subscriptions.
+		///
+		std::size_t getSubscriptionCount();
+
+		///
+		/// Returns the number of Firebird event registrations currently used by the subscriptions.
+		///
+		std::size_t getRegistrationCount();
+
+		///
+		/// Cancels all subscriptions and stops the dispatcher threads.
+		/// The hub cannot be used after being stopped.
+		///
+		void stop();
+
+	private:
+		struct Core;
+
+	private:
+		// Shared with the Firebird event callbacks, which may outlive the hub.
+		std::shared_ptr<Core> core;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_EVENT_HUB_H
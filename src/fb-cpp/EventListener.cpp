@@ -55,15 +55,64 @@ EventListener::EventListener(Attachment& attachment, const std::vector<std::stri
 	  eventNames{eventNames},
 	  callback{callback},
 	  firebirdCallback{*this}
+{
+	if (!this->callback)
+		throw std::invalid_argument{"EventListener callback must not be empty"};
+
+	initialize();
+
+	listening = true;
+	running = true;
+
+	StatusWrapper statusWrapper{client};
+
+	eventsHandle.reset(attachment.getHandle()->queEvents(
+		&statusWrapper, &firebirdCallback, static_cast<unsigned>(eventBuffer.size()), eventBuffer.data()));
+
+	dispatcher = std::thread{&EventListener::dispatchLoop, this};
+}
+
+EventListener::EventListener(Attachment& attachment, const std::vector<std::string>& eventNames,
+	IndexedCallback callback, std::size_t ringCapacity)
+	: attachment{attachment},
+	  client{attachment.getClient()},
+	  eventNames{eventNames},
+	  firebirdCallback{*this},
+	  indexedCallback{std::move(callback)}
+{
+	if (!indexedCallback)
+		throw std::invalid_argument{"EventListener callback must not be empty"};
+
+	if (ringCapacity == 0)
+		throw std::invalid_argument{"EventListener ring capacity must not be zero"};
+
+	initialize();
+
+	ring = std::make_unique<impl::SpscRing<IndexedEventCount>>(ringCapacity);
+	overflowCounts = std::make_unique<std::atomic<std::uint32_t>[]>(eventNames.size());
+	active.store(true, std::memory_order_release);
+	running = true;
+
+	StatusWrapper statusWrapper{client};
+
+	const auto handle = attachment.getHandle()->queEvents(
+		&statusWrapper, &firebirdCallback, static_cast<unsigned>(eventBuffer.size()), eventBuffer.data());
+
+	// The first notification may have already queued the next request.
+	fb::IEvents* expected = nullptr;
+	if (!lockFreeEventsHandle.compare_exchange_strong(expected, handle, std::memory_order_acq_rel))
+		handle->release();
+
+	dispatcher = std::thread{&EventListener::dispatchLoopLockFree, this};
+}
+
+void EventListener::initialize()
 {
 	assert(attachment.isValid());
 
 	if (eventNames.empty())
 		throw std::invalid_argument{"An EventListener requires at least one event"};
 
-	if (!callback)
-		throw std::invalid_argument{"EventListener callback must not be empty"};
-
 	for (const auto& name : eventNames)
 	{
 		if (name.empty())
@@ -101,25 +150,25 @@ EventListener::EventListener(Attachment& attachment, const std::vector<std::stri
 	assert(static_cast<std::size_t>(eventBufferPtr - eventBuffer.data()) == eventBuffer.size());
 
 	rawCounts.resize(eventNames.size());
-	listening = true;
-	running = true;
-
-	StatusWrapper statusWrapper{client};
-
-	eventsHandle.reset(attachment.getHandle()->queEvents(
-		&statusWrapper, &firebirdCallback, static_cast<unsigned>(eventBuffer.size()), eventBuffer.data()));
-
-	dispatcher = std::thread{&EventListener::dispatchLoop, this};
 }
 
 bool EventListener::isListening() noexcept
 {
+	if (indexedCallback)
+		return active.load(std::memory_order_acquire);
+
 	std::lock_guard mutexGuard{mutex};
 	return listening;
 }
 
 void EventListener::stop()
 {
+	if (indexedCallback)
+	{
+		stopLockFree();
+		return;
+	}
+
 	std::unique_lock mutexGuard{mutex};
 
 	if (!running)
@@ -179,6 +228,12 @@ void EventListener::decodeEventCounts()
 
 void EventListener::handleEvent(unsigned length, const std::uint8_t* events)
 {
+	if (indexedCallback)
+	{
+		handleEventLockFree(length, events);
+		return;
+	}
+
 	try
 	{
 		const auto eventBlockLength = static_cast<unsigned>(eventBuffer.size());
@@ -337,6 +392,173 @@ void EventListener::dispatchLoop()
 	}
 }
 
+// Runs on the Firebird callback thread, the only producer of the ring. Everything it touches was allocated by the
+// constructor, and the listener state is shared with the other threads only through atomics.
+void EventListener::handleEventLockFree(unsigned length, const std::uint8_t* events) noexcept
+{
+	try
+	{
+		if (!active.load(std::memory_order_acquire))
+			return;
+
+		const auto copyLength = std::min<std::size_t>(length, resultBuffer.size());
+
+		if (copyLength == 0)
+			return;
+
+		std::memcpy(resultBuffer.data(), events, copyLength);
+
+		decodeEventCounts();
+
+		if (first)
+		{
+			bool fired = false;
+
+			for (std::size_t i = 0; i < eventNames.size(); ++i)
+			{
+				const auto value = rawCounts[i];
+
+				if (value == 0)
+					continue;
+
+				fired = true;
+
+				if (!ring->tryPush(IndexedEventCount{static_cast<std::uint32_t>(i), value}))
+				{
+					overflowCounts[i].fetch_add(value, std::memory_order_relaxed);
+					overflowPending.store(true, std::memory_order_release);
+				}
+			}
+
+			if (fired)
+				wakeDispatcher();
+		}
+		else
+			first = true;
+
+		auto attachmentHandle = attachment.getHandle();
+
+		if (!attachmentHandle)
+		{
+			active.store(false, std::memory_order_release);
+			wakeDispatcher();
+			return;
+		}
+
+		StatusWrapper statusWrapper{client};
+
+		const auto newHandle = attachmentHandle->queEvents(
+			&statusWrapper, &firebirdCallback, static_cast<unsigned>(eventBuffer.size()), eventBuffer.data());
+
+		if (const auto previousHandle = lockFreeEventsHandle.exchange(newHandle, std::memory_order_acq_rel))
+			previousHandle->release();
+
+		// stop() may have run meanwhile and missed the new request.
+		if (!active.load(std::memory_order_acquire))
+		{
+			if (const auto handle = lockFreeEventsHandle.exchange(nullptr, std::memory_order_acq_rel))
+			{
+				StatusWrapper cancelStatusWrapper{client};
+				handle->cancel(&cancelStatusWrapper);
+				handle->release();
+			}
+		}
+	}
+	catch (...)
+	{
+		// Prevent exceptions from escaping into Firebird's C API callback.
+		active.store(false, std::memory_order_release);
+		wakeDispatcher();
+	}
+}
+
+void EventListener::wakeDispatcher() noexcept
+{
+	wakeups.fetch_add(1u, std::memory_order_release);
+	wakeups.notify_one();
+}
+
+void EventListener::dispatchLoopLockFree()
+{
+	std::vector<std::uint32_t> counts(eventNames.size());
+
+	while (true)
+	{
+		const auto seenWakeups = wakeups.load(std::memory_order_acquire);
+		bool fired = false;
+		IndexedEventCount item;
+
+		while (ring->tryPop(item))
+		{
+			counts[item.index] += item.count;
+			fired = true;
+		}
+
+		if (overflowPending.exchange(false, std::memory_order_acq_rel))
+		{
+			for (std::size_t i = 0; i < counts.size(); ++i)
+			{
+				if (const auto value = overflowCounts[i].exchange(0u, std::memory_order_relaxed))
+				{
+					counts[i] += value;
+					fired = true;
+				}
+			}
+		}
+
+		if (fired)
+		{
+			try
+			{
+				indexedCallback(counts);
+			}
+			catch (...)
+			{
+				assert(false);
+			}
+
+			std::fill(counts.begin(), counts.end(), 0u);
+		}
+
+		if (!active.load(std::memory_order_acquire))
+			break;
+
+		wakeups.wait(seenWakeups, std::memory_order_acquire);
+	}
+}
+
+void EventListener::stopLockFree()
+{
+	if (!running)
+		return;
+
+	active.store(false, std::memory_order_release);
+
+	if (const auto handle = lockFreeEventsHandle.exchange(nullptr, std::memory_order_acq_rel))
+	{
+		try
+		{
+			StatusWrapper statusWrapper{client};
+			handle->cancel(&statusWrapper);
+		}
+		catch (...)
+		{
+			// swallow
+		}
+
+		handle->release();
+	}
+
+	firebirdCallback.detach();
+
+	wakeDispatcher();
+
+	if (dispatcher.joinable())
+		dispatcher.join();
+
+	running = false;
+}
+
 void EventListener::cancelEventsHandle()
 {
 	FbRef<fb::IEvents> handle;
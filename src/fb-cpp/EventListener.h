@@ -28,12 +28,17 @@
 #include "Client.h"
 #include "Exception.h"
 #include "SmartPtrs.h"
+#include "SpscRing.h"
 #include "fb-api.h"
+#include <atomic>
 #include <condition_variable>
+#include <cstddef>
 #include <cstdint>
 #include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <span>
 #include <string>
 #include <thread>
 #include <vector>
@@ -63,6 +68,11 @@ namespace fbcpp
 	///
 	/// Observes Firebird events and forwards aggregated counts to a callback on a background thread.
 	///
+	/// A listener created with an IndexedCallback uses a lock-free mode: the Firebird callback thread pushes
+	/// (event index, count) pairs into a bounded single-producer/single-consumer ring, with no heap allocation and no
+	/// lock, and the dispatcher thread hands the callback the counts indexed by event name position. Counts that do
+	/// not fit in the ring are accumulated in per-event atomic counters, so they are never lost.
+	///
 	class EventListener final
 	{
 	public:
@@ -71,6 +81,18 @@ namespace fbcpp
 		///
 		using Callback = std::function<void(const std::vector<EventCount>& counts)>;
 
+		///
+		/// Function invoked by the lock-free mode when new event counts are available.
+		/// `counts[i]` is the number of occurrences of `getEventNames()[i]` since the last notification (0 if it
+		/// did not fire). The span is only valid during the call.
+		///
+		using IndexedCallback = std::function<void(std::span<const std::uint32_t> counts)>;
+
+		///
+		/// Default number of (event index, count) pairs of the lock-free mode ring.
+		///
+		static constexpr std::size_t DEFAULT_RING_CAPACITY = 1024u;
+
 	private:
 		class FirebirdCallback final : public fb::IEventCallbackImpl<FirebirdCallback, impl::StatusWrapper>
 		{
@@ -112,6 +134,12 @@ namespace fbcpp
 		///
 		explicit EventListener(Attachment& attachment, const std::vector<std::string>& eventNames, Callback callback);
 
+		///
+		/// Creates an event listener in lock-free mode for the specified attachment and event names.
+		///
+		explicit EventListener(Attachment& attachment, const std::vector<std::string>& eventNames,
+			IndexedCallback callback, std::size_t ringCapacity = DEFAULT_RING_CAPACITY);
+
 		///
 		/// Stops the listener and waits for any background work to finish.
 		///
@@ -134,6 +162,14 @@ namespace fbcpp
 		EventListener& operator=(EventListener&&) = delete;
 
 	public:
+		///
+		/// Returns the event names, in the order used by IndexedCallback.
+		///
+		const std::vector<std::string>& getEventNames() const noexcept
+		{
+			return eventNames;
+		}
+
 		///
 		/// Returns true if the listener is currently registered for event notifications.
 		///
@@ -145,8 +181,20 @@ namespace fbcpp
 		void stop();
 
 	private:
+		struct IndexedEventCount final
+		{
+			std::uint32_t index;
+			std::uint32_t count;
+		};
+
+	private:
+		void initialize();
 		void handleEvent(unsigned length, const std::uint8_t* events);
+		void handleEventLockFree(unsigned length, const std::uint8_t* events) noexcept;
 		void dispatchLoop();
+		void dispatchLoopLockFree();
+		void wakeDispatcher() noexcept;
+		void stopLockFree();
 		void cancelEventsHandle();
 		void decodeEventCounts();
 
@@ -168,6 +216,15 @@ namespace fbcpp
 		bool listening = false;
 		bool running = false;
 		bool first = false;
+
+		// Lock-free mode.
+		IndexedCallback indexedCallback;
+		std::unique_ptr<impl::SpscRing<IndexedEventCount>> ring;
+		std::unique_ptr<std::atomic<std::uint32_t>[]> overflowCounts;
+		std::atomic<bool> overflowPending{false};
+		std::atomic<bool> active{false};
+		std::atomic<std::uint32_t> wakeups{0u};
+		std::atomic<fb::IEvents*> lockFreeEventsHandle{nullptr};
 	};
 }  // namespace fbcpp
 
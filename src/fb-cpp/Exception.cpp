@@ -24,6 +24,8 @@
 
 #include "Exception.h"
 #include "Client.h"
+#include "PooledStatus.h"
+#include <cstring>
 #include <string>
 #include <vector>
 #include <cassert>
@@ -55,111 +57,167 @@ void StatusWrapper::catchException(fb::IStatus* status) noexcept
 }
 
 
-std::string DatabaseException::buildMessage(Client& client, const std::intptr_t* statusVector)
+void StatusVector::assign(const std::intptr_t* value, unsigned length)
 {
-	constexpr char DEFAULT_MESSAGE[] = "Unknown database error";
-
-	if (!statusVector)
-		return DEFAULT_MESSAGE;
-
-	const auto util = client.getUtil();
-
-	const auto status = client.newStatus();
-	status->setErrors(statusVector);
+	if (!items.empty() && value == items.data())
+		return;
 
-	constexpr unsigned MAX_BUFFER_SIZE = 32u * 1024u;
-	unsigned bufferSize = 256u;
-	std::string message;
+	// Sizes the string storage first so the pointers stored in the items stay valid.
+	std::size_t stringsLength = 0;
 
-	while (bufferSize <= MAX_BUFFER_SIZE)
+	for (unsigned i = 0; i < length && value[i] != isc_arg_end;)
 	{
-		std::string buffer(bufferSize, '\0');
-		const auto written = util->formatStatus(buffer.data(), bufferSize, status.get());
-
-		if (written < bufferSize && buffer[0] != '\0')
+		switch (value[i])
 		{
-			message = written == 0 ? std::string{buffer.c_str()} : std::string{buffer.data(), written};
-			break;
-		}
+			case isc_arg_string:
+			case isc_arg_interpreted:
+			case isc_arg_sql_state:
+				stringsLength += std::strlen(reinterpret_cast<const char*>(value[i + 1])) + 1;
+				i += 2;
+				break;
 
-		if (bufferSize == MAX_BUFFER_SIZE)
-		{
-			message = buffer.c_str();
-			break;
-		}
+			case isc_arg_cstring:
+				stringsLength += static_cast<std::size_t>(value[i + 1]) + 1;
+				i += 3;
+				break;
 
-		bufferSize = (bufferSize > MAX_BUFFER_SIZE / 2u) ? MAX_BUFFER_SIZE : bufferSize * 2u;
+			default:
+				i += 2;
+				break;
+		}
 	}
 
-	if (message.empty())
-		message = DEFAULT_MESSAGE;
-
-	return message;
-}
-
-void DatabaseException::copyErrorVector(const std::intptr_t* statusVector)
-{
-	if (!statusVector)
-		return;
+	items.clear();
+	strings.resize(stringsLength);
 
-	const auto* p = statusVector;
+	auto* stringsPos = strings.data();
+	const auto appendString = [&](const char* str, std::size_t len)
+	{
+		std::memcpy(stringsPos, str, len);
+		stringsPos[len] = '\0';
+		items.push_back(reinterpret_cast<std::intptr_t>(stringsPos));
+		stringsPos += len + 1;
+	};
 
-	while (*p != isc_arg_end)
+	for (unsigned i = 0; i < length && value[i] != isc_arg_end;)
 	{
-		const auto argType = *p++;
+		const auto argType = value[i];
 
 		switch (argType)
 		{
-			case isc_arg_gds:
-			case isc_arg_number:
-				errorVector.push_back(argType);
-				errorVector.push_back(*p++);
-				break;
-
 			case isc_arg_string:
 			case isc_arg_interpreted:
 			case isc_arg_sql_state:
-				errorVector.push_back(argType);
-				errorStrings.emplace_back(reinterpret_cast<const char*>(*p++));
-				errorVector.push_back(0);  // placeholder for string pointer
+			{
+				const auto str = reinterpret_cast<const char*>(value[i + 1]);
+				items.push_back(argType);
+				appendString(str, std::strlen(str));
+				i += 2;
 				break;
+			}
 
 			case isc_arg_cstring:
-			{
-				const auto len = static_cast<size_t>(*p++);
-				const auto str = reinterpret_cast<const char*>(*p++);
-				errorVector.push_back(isc_arg_string);
-				errorStrings.emplace_back(str, len);
-				errorVector.push_back(0);  // placeholder for string pointer
+				items.push_back(isc_arg_string);
+				appendString(reinterpret_cast<const char*>(value[i + 2]), static_cast<std::size_t>(value[i + 1]));
+				i += 3;
 				break;
-			}
 
 			default:
-				errorVector.push_back(argType);
-				errorVector.push_back(*p++);
+				items.push_back(argType);
+				items.push_back(value[i + 1]);
+				i += 2;
 				break;
 		}
 	}
 
-	errorVector.push_back(isc_arg_end);
+	items.push_back(isc_arg_end);
+}
+
+
+DatabaseException::DatabaseException(Client& client, const std::intptr_t* statusVector)
+	: FbCppException{""},
+	  state{std::make_shared<State>()}
+{
+	state->util = client.getUtil();
+
+	if (statusVector)
+	{
+		state->errors.assign(statusVector);
+		state->sqlState = extractSqlState(statusVector);
+	}
+}
+
+const char* DatabaseException::what() const noexcept
+{
+	std::call_once(state->messageFlag,
+		[this]
+		{
+			const auto& errors = state->errors.getItems();
+
+			try
+			{
+				state->message = buildMessage(state->util, errors.empty() ? nullptr : errors.data());
+			}
+			catch (...)
+			{
+				// swallow
+			}
+		});
 
-	fixupStringPointers();
+	return state->message.empty() ? "Unknown database error" : state->message.c_str();
 }
 
-void DatabaseException::fixupStringPointers()
+bool DatabaseException::hasErrorCode(std::intptr_t code) const noexcept
 {
-	size_t strIdx = 0;
-	size_t i = 0;
+	const auto& errorVector = getErrors();
+
+	for (std::size_t i = 0; i + 1 < errorVector.size() && errorVector[i] != isc_arg_end; i += 2)
+	{
+		if (errorVector[i] == isc_arg_gds && errorVector[i + 1] == code)
+			return true;
+	}
+
+	return false;
+}
+
+std::string DatabaseException::buildMessage(fb::IUtil* util, const std::intptr_t* statusVector)
+{
+	constexpr char DEFAULT_MESSAGE[] = "Unknown database error";
+
+	if (!statusVector || !util)
+		return DEFAULT_MESSAGE;
 
-	while (i < errorVector.size() && errorVector[i] != isc_arg_end)
+	const auto status = fbUnique(PooledStatus::acquire());
+	status->setErrors(statusVector);
+
+	constexpr unsigned MAX_BUFFER_SIZE = 32u * 1024u;
+	unsigned bufferSize = 256u;
+	std::string message;
+
+	while (bufferSize <= MAX_BUFFER_SIZE)
 	{
-		const auto argType = errorVector[i];
+		std::string buffer(bufferSize, '\0');
+		const auto written = util->formatStatus(buffer.data(), bufferSize, status.get());
+
+		if (written < bufferSize && buffer[0] != '\0')
+		{
+			message = written == 0 ? std::string{buffer.c_str()} : std::string{buffer.data(), written};
+			break;
+		}
 
-		if (argType == isc_arg_string || argType == isc_arg_interpreted || argType == isc_arg_sql_state)
-			errorVector[i + 1] = reinterpret_cast<std::intptr_t>(errorStrings[strIdx++].c_str());
+		if (bufferSize == MAX_BUFFER_SIZE)
+		{
+			message = buffer.c_str();
+			break;
+		}
 
-		i += 2;
+		bufferSize = (bufferSize > MAX_BUFFER_SIZE / 2u) ? MAX_BUFFER_SIZE : bufferSize * 2u;
 	}
+
+	if (message.empty())
+		message = DEFAULT_MESSAGE;
+
+	return message;
 }
 
 std::string DatabaseException::extractSqlState(const std::intptr_t* statusVector)
@@ -26,6 +26,9 @@
 #define FBCPP_EXCEPTION_H
 
 #include "fb-api.h"
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -215,6 +218,74 @@ namespace fbcpp::impl
 			return clean;
 		}
 	};
+
+	///
+	/// @brief Owned copy of a Firebird status vector, including the strings it references.
+	///
+	/// `isc_arg_cstring` arguments are stored as `isc_arg_string`. The storage is kept between assignments, so
+	/// reusing the same object does not allocate once its capacity is large enough.
+	///
+	class StatusVector final
+	{
+	public:
+		StatusVector() = default;
+
+		StatusVector(const StatusVector&) = delete;
+		StatusVector& operator=(const StatusVector&) = delete;
+
+	public:
+		///
+		/// Replaces the contents with a copy of the status vector, reading at most `length` elements or up
+		/// to `isc_arg_end`.
+		///
+		void assign(const std::intptr_t* value, unsigned length = std::numeric_limits<unsigned>::max());
+
+		///
+		/// Preallocates storage for `itemCount` elements and `stringsLength` bytes of strings.
+		///
+		void reserve(std::size_t itemCount, std::size_t stringsLength)
+		{
+			items.reserve(itemCount);
+			strings.reserve(stringsLength);
+		}
+
+		///
+		/// Removes the contents, keeping the storage.
+		///
+		void clear() noexcept
+		{
+			items.clear();
+			strings.clear();
+		}
+
+		///
+		/// Returns whether nothing was assigned.
+		///
+		bool empty() const noexcept
+		{
+			return items.empty();
+		}
+
+		///
+		/// Returns whether the vector contains a non-zero code.
+		///
+		bool hasData() const noexcept
+		{
+			return items.size() >= 2 && items[1] != 0;
+		}
+
+		///
+		/// Returns the vector, terminated by isc_arg_end, or empty if nothing was assigned.
+		///
+		const std::vector<std::intptr_t>& getItems() const noexcept
+		{
+			return items;
+		}
+
+	private:
+		std::vector<std::intptr_t> items;
+		std::vector<char> strings;
+	};
 }  // namespace fbcpp::impl
 
 
@@ -242,6 +313,10 @@ namespace fbcpp
 
 	///
 	/// Exception thrown when a Firebird database operation fails.
+	/// Only the status vector is copied when the exception is thrown: the message is formatted on the first call to
+	/// `what()`, and copies of the exception share the same state. That state is allocated once per exception, with
+	/// the status vector strings kept in a single buffer. Formatting uses the IUtil interface of the Firebird client
+	/// library, which must still be loaded at that point.
 	///
 	class DatabaseException final : public FbCppException
 	{
@@ -249,34 +324,26 @@ namespace fbcpp
 		///
 		/// Constructs a DatabaseException from a Firebird status vector.
 		///
-		explicit DatabaseException(Client& client, const std::intptr_t* statusVector)
-			: FbCppException{buildMessage(client, statusVector)},
-			  sqlState{extractSqlState(statusVector)}
-		{
-			copyErrorVector(statusVector);
-		}
-
-		DatabaseException(const DatabaseException& other)
-			: FbCppException{static_cast<const FbCppException&>(other)},
-			  errorVector{other.errorVector},
-			  errorStrings{other.errorStrings},
-			  sqlState{other.sqlState}
-		{
-			fixupStringPointers();
-		}
+		explicit DatabaseException(Client& client, const std::intptr_t* statusVector);
 
+		DatabaseException(const DatabaseException&) = default;
 		DatabaseException(DatabaseException&&) = default;
 
 		DatabaseException& operator=(const DatabaseException&) = delete;
 		DatabaseException& operator=(DatabaseException&&) = delete;
 
+		///
+		/// Returns the formatted error message.
+		///
+		const char* what() const noexcept override;
+
 		///
 		/// Returns the Firebird error vector.
 		/// The vector is terminated by isc_arg_end.
 		///
 		const std::vector<std::intptr_t>& getErrors() const noexcept
 		{
-			return errorVector;
+			return state->errors.getItems();
 		}
 
 		///
@@ -284,31 +351,44 @@ namespace fbcpp
 		///
 		std::intptr_t getErrorCode() const noexcept
 		{
+			const auto& errorVector = getErrors();
+
 			if (errorVector.size() >= 2 && errorVector[0] == isc_arg_gds)
 				return errorVector[1];
 			return 0;
 		}
 
+		///
+		/// Returns whether the specified ISC error code is present in the error vector, not only as the
+		/// primary code.
+		///
+		bool hasErrorCode(std::intptr_t code) const noexcept;
+
 		///
 		/// Returns the SQL state string (e.g. "42000") if present in the original status vector,
 		/// or empty otherwise.
 		///
 		const std::string& getSqlState() const noexcept
 		{
-			return sqlState;
+			return state->sqlState;
 		}
 
 	private:
-		static std::string buildMessage(Client& client, const std::intptr_t* statusVector);
-		static std::string extractSqlState(const std::intptr_t* statusVector);
+		struct State final
+		{
+			fb::IUtil* util = nullptr;
+			impl::StatusVector errors;
+			std::string sqlState;
+			std::once_flag messageFlag;
+			std::string message;
+		};
 
-		void copyErrorVector(const std::intptr_t* statusVector);
-		void fixupStringPointers();
+	private:
+		static std::string buildMessage(fb::IUtil* util, const std::intptr_t* statusVector);
+		static std::string extractSqlState(const std::intptr_t* statusVector);
 
 	private:
-		std::vector<std::intptr_t> errorVector;
-		std::vector<std::string> errorStrings;
-		std::string sqlState;
+		std::shared_ptr<State> state;
 	};
 }  // namespace fbcpp
 
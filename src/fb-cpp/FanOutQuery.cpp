@@ -0,0 +1,614 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "FanOutQuery.h"
+#include "Exception.h"
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+template <typename T>
+static T readValue(const std::byte* data) noexcept
+{
+	T value;
+	std::memcpy(&value, data, sizeof(value));
+	return value;
+}
+
+template <typename T>
+static int compareValues(const T& a, const T& b) noexcept
+{
+	return a < b ? -1 : b < a ? 1 : 0;
+}
+
+static bool isMergeable(DescriptorAdjustedType type) noexcept
+{
+	switch (type)
+	{
+		case DescriptorAdjustedType::BOOLEAN:
+		case DescriptorAdjustedType::INT16:
+		case DescriptorAdjustedType::INT32:
+		case DescriptorAdjustedType::INT64:
+		case DescriptorAdjustedType::INT128:
+		case DescriptorAdjustedType::FLOAT:
+		case DescriptorAdjustedType::DOUBLE:
+		case DescriptorAdjustedType::DATE:
+		case DescriptorAdjustedType::TIME:
+		case DescriptorAdjustedType::TIMESTAMP:
+		case DescriptorAdjustedType::TIME_TZ:
+		case DescriptorAdjustedType::TIMESTAMP_TZ:
+		case DescriptorAdjustedType::STRING:
+			return true;
+
+		default:
+			return false;
+	}
+}
+
+// Compares the values of a column in two messages with the same layout, NULLs first.
+static int compareColumns(const DescriptorLayout& layout, const std::byte* a, const std::byte* b) noexcept
+{
+	const bool aNull = readValue<std::int16_t>(a + layout.nullOffset) != FB_FALSE;
+	const bool bNull = readValue<std::int16_t>(b + layout.nullOffset) != FB_FALSE;
+
+	if (aNull || bNull)
+		return aNull == bNull ? 0 : aNull ? -1 : 1;
+
+	a += layout.offset;
+	b += layout.offset;
+
+	switch (layout.adjustedType)
+	{
+		case DescriptorAdjustedType::BOOLEAN:
+			return compareValues(readValue<std::uint8_t>(a) != 0, readValue<std::uint8_t>(b) != 0);
+
+		case DescriptorAdjustedType::INT16:
+			return compareValues(readValue<std::int16_t>(a), readValue<std::int16_t>(b));
+
+		case DescriptorAdjustedType::INT32:
+		case DescriptorAdjustedType::DATE:
+			return compareValues(readValue<std::int32_t>(a), readValue<std::int32_t>(b));
+
+		case DescriptorAdjustedType::INT64:
+			return compareValues(readValue<std::int64_t>(a), readValue<std::int64_t>(b));
+
+		case DescriptorAdjustedType::INT128:
+		{
+			// FB_I128 keeps the low word first on little-endian platforms.
+			constexpr unsigned high = std::endian::native == std::endian::little ? 1u : 0u;
+			const auto aValue = readValue<FB_I128>(a);
+			const auto bValue = readValue<FB_I128>(b);
+
+			if (const auto result = compareValues(static_cast<std::int64_t>(aValue.fb_data[high]),
+					static_cast<std::int64_t>(bValue.fb_data[high]));
+				result != 0)
+			{
+				return result;
+			}
+
+			return compareValues(aValue.fb_data[1u - high], bValue.fb_data[1u - high]);
+		}
+
+		case DescriptorAdjustedType::FLOAT:
+			return compareValues(readValue<float>(a), readValue<float>(b));
+
+		case DescriptorAdjustedType::DOUBLE:
+			return compareValues(readValue<double>(a), readValue<double>(b));
+
+		case DescriptorAdjustedType::TIME:
+		case DescriptorAdjustedType::TIME_TZ:
+			// The time zone part of TIME WITH TIME ZONE does not take part in the order.
+			return compareValues(readValue<std::uint32_t>(a), readValue<std::uint32_t>(b));
+
+		case DescriptorAdjustedType::TIMESTAMP:
+		case DescriptorAdjustedType::TIMESTAMP_TZ:
+		{
+			const auto aValue = readValue<ISC_TIMESTAMP>(a);
+			const auto bValue = readValue<ISC_TIMESTAMP>(b);
+
+			if (const auto result = compareValues(aValue.timestamp_date, bValue.timestamp_date); result != 0)
+				return result;
+
+			return compareValues(aValue.timestamp_time, bValue.timestamp_time);
+		}
+
+		case DescriptorAdjustedType::STRING:
+		{
+			const auto aLength = readValue<std::uint16_t>(a);
+			const auto bLength = readValue<std::uint16_t>(b);
+
+			if (const auto result = std::memcmp(a + sizeof(std::uint16_t), b + sizeof(std::uint16_t),
+					std::min(aLength, bLength));
+				result != 0)
+			{
+				return result < 0 ? -1 : 1;
+			}
+
+			return compareValues(aLength, bLength);
+		}
+
+		default:
+			assert(false);
+			return 0;
+	}
+}
+
+static void checkCompatibleLayouts(const DescriptorSet& first, const DescriptorSet& other, unsigned shard)
+{
+	if (other.size() != first.size())
+	{
+		throw FbCppException("Shard " + std::to_string(shard) + " returns " + std::to_string(other.size()) +
+			" columns but shard 0 returns " + std::to_string(first.size()));
+	}
+
+	for (unsigned index = 0u; index < first.size(); ++index)
+	{
+		const auto& a = first.getLayout(index);
+		const auto& b = other.getLayout(index);
+
+		if (a.adjustedType != b.adjustedType || a.scale != b.scale || a.length != b.length || a.offset != b.offset ||
+			a.nullOffset != b.nullOffset)
+		{
+			throw FbCppException("Column " + std::to_string(index) + " of shard " + std::to_string(shard) +
+				" does not have the same type as in shard 0");
+		}
+	}
+}
+
+
+// --- FanOutQuery::Run ---
+
+class FanOutQuery::Run final
+{
+public:
+	explicit Run(FanOutQuery& query)
+		: query{query},
+		  states(query.shards.size())
+	{
+	}
+
+	~Run() noexcept
+	{
+		stop(nullptr);
+
+		for (auto& thread : threads)
+		{
+			if (thread.joinable())
+				thread.join();
+		}
+	}
+
+	Run(const Run&) = delete;
+	Run& operator=(const Run&) = delete;
+
+public:
+	// Starts the shard threads and waits for all of them to prepare and check their layouts.
+	const DescriptorSet& start()
+	{
+		threads.reserve(states.size());
+
+		for (unsigned shard = 0u; shard < states.size(); ++shard)
+			threads.emplace_back(&Run::produce, this, shard);
+
+		std::unique_lock mutexGuard{mutex};
+		condition.wait(mutexGuard, [this] { return failure || prepared == states.size(); });
+		rethrowFailure();
+
+		const auto& first = *states[0].descriptors;
+
+		for (unsigned shard = 1u; shard < states.size(); ++shard)
+			checkCompatibleLayouts(first, *states[shard].descriptors, shard);
+
+		return first;
+	}
+
+	// Waits for the next window of any shard, or returns nullptr when all shards are exhausted.
+	std::unique_ptr<RowSet> nextAny(unsigned& shard)
+	{
+		std::unique_lock mutexGuard{mutex};
+
+		while (true)
+		{
+			rethrowFailure();
+
+			bool pending = false;
+
+			for (unsigned i = 0u; i < states.size(); ++i)
+			{
+				const auto candidate = (nextShard + i) % states.size();
+				auto& state = states[candidate];
+
+				if (!state.filled.empty())
+				{
+					auto window = std::move(state.filled.front());
+					state.filled.pop_front();
+					shard = static_cast<unsigned>(candidate);
+					nextShard = shard + 1u;
+					return window;
+				}
+
+				if (!state.finished)
+					pending = true;
+			}
+
+			if (!pending)
+				return nullptr;
+
+			condition.wait(mutexGuard);
+		}
+	}
+
+	// Waits for the next window of `shard`, or returns nullptr when it is exhausted.
+	std::unique_ptr<RowSet> next(unsigned shard)
+	{
+		std::unique_lock mutexGuard{mutex};
+		auto& state = states[shard];
+
+		condition.wait(mutexGuard, [&] { return failure || !state.filled.empty() || state.finished; });
+		rethrowFailure();
+
+		if (state.filled.empty())
+			return nullptr;
+
+		auto window = std::move(state.filled.front());
+		state.filled.pop_front();
+		return window;
+	}
+
+	// Hands a consumed window back to its shard for reuse.
+	void release(unsigned shard, std::unique_ptr<RowSet> window)
+	{
+		{  // scope
+			std::lock_guard mutexGuard{mutex};
+			states[shard].free.push_back(std::move(window));
+		}
+
+		condition.notify_all();
+	}
+
+	void stop(std::exception_ptr error) noexcept
+	{
+		{  // scope
+			std::lock_guard mutexGuard{mutex};
+
+			if (error && !failure)
+				failure = error;
+
+			stopping = true;
+		}
+
+		condition.notify_all();
+	}
+
+	void finish()
+	{
+		for (auto& thread : threads)
+			thread.join();
+
+		threads.clear();
+
+		std::lock_guard mutexGuard{mutex};
+		rethrowFailure();
+	}
+
+private:
+	struct ShardState final
+	{
+		DescriptorSetPtr descriptors;
+		std::deque<std::unique_ptr<RowSet>> filled;
+		std::vector<std::unique_ptr<RowSet>> free;
+		unsigned createdWindows = 0;
+		bool finished = false;
+	};
+
+	void rethrowFailure()
+	{
+		if (failure)
+			std::rethrow_exception(failure);
+	}
+
+	void produce(unsigned shard)
+	{
+		auto& state = states[shard];
+
+		try
+		{
+			const auto& info = query.shards[shard];
+			std::optional<AttachmentLease> lease;
+
+			if (query.pool)
+				lease.emplace(query.pool->acquire(info.uri, query.attachmentOptions));
+
+			auto& attachment = lease ? **lease : *info.attachment;
+
+			Transaction transaction{attachment, query.options.getTransactionOptions()};
+			Statement statement{attachment, transaction, query.sql};
+
+			if (query.setParameters)
+				query.setParameters(statement, shard);
+
+			{  // scope
+				std::lock_guard mutexGuard{mutex};
+				state.descriptors = statement.getOutputDescriptorSet();
+				++prepared;
+			}
+
+			condition.notify_all();
+
+			auto hasRow = statement.execute(transaction);
+
+			if (!statement.getResultSetHandle())
+				throw FbCppException("FanOutQuery requires a statement returning a result set");
+
+			for (bool first = true; hasRow; first = false)
+			{
+				std::unique_ptr<RowSet> window;
+
+				{  // scope
+					std::unique_lock mutexGuard{mutex};
+
+					condition.wait(mutexGuard,
+						[&]
+						{
+							return stopping || !state.free.empty() ||
+								state.createdWindows < query.options.getWindowCount();
+						});
+
+					if (stopping)
+						break;
+
+					if (!state.free.empty())
+					{
+						window = std::move(state.free.back());
+						state.free.pop_back();
+					}
+					else
+						++state.createdWindows;
+				}
+
+				const auto windowSize = query.options.getWindowSize();
+
+				if (first)
+					window = std::make_unique<RowSet>(RowSet::fromCurrentRow(statement, windowSize));
+				else if (window)
+					window->refill(statement);
+				else
+					window = std::make_unique<RowSet>(statement, windowSize);
+
+				hasRow = !window->isEof();
+
+				{  // scope
+					std::lock_guard mutexGuard{mutex};
+
+					if (window->getCount() != 0)
+						state.filled.push_back(std::move(window));
+				}
+
+				condition.notify_all();
+			}
+
+			bool stopped;
+
+			{  // scope
+				std::lock_guard mutexGuard{mutex};
+				stopped = stopping;
+			}
+
+			if (stopped)
+				transaction.rollback();
+			else
+				transaction.commit();
+		}
+		catch (...)
+		{
+			stop(std::current_exception());
+		}
+
+		{  // scope
+			std::lock_guard mutexGuard{mutex};
+			state.finished = true;
+		}
+
+		condition.notify_all();
+	}
+
+private:
+	FanOutQuery& query;
+	std::vector<ShardState> states;
+	std::vector<std::thread> threads;
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::exception_ptr failure;
+	std::size_t prepared = 0;
+	std::size_t nextShard = 0;
+	bool stopping = false;
+};
+
+
+// --- FanOutQuery ---
+
+FanOutQuery::FanOutQuery(std::vector<std::reference_wrapper<Attachment>> shards, std::string sql,
+	const FanOutQueryOptions& options, ParameterSetter setParameters)
+	: sql{std::move(sql)},
+	  options{options},
+	  setParameters{std::move(setParameters)}
+{
+	if (shards.empty())
+		throw std::invalid_argument{"FanOutQuery requires at least one shard"};
+
+	if (options.getWindowSize() == 0)
+		throw std::invalid_argument{"FanOutQuery windowSize must be greater than zero"};
+
+	if (options.getWindowCount() == 0)
+		throw std::invalid_argument{"FanOutQuery windowCount must be greater than zero"};
+
+	this->shards.reserve(shards.size());
+
+	for (auto& attachment : shards)
+		this->shards.push_back(Shard{.attachment = &attachment.get(), .uri = {}});
+}
+
+FanOutQuery::FanOutQuery(AttachmentPool& pool, std::vector<std::string> uris, AttachmentOptions attachmentOptions,
+	std::string sql, const FanOutQueryOptions& options, ParameterSetter setParameters)
+	: pool{&pool},
+	  attachmentOptions{std::move(attachmentOptions)},
+	  sql{std::move(sql)},
+	  options{options},
+	  setParameters{std::move(setParameters)}
+{
+	if (uris.empty())
+		throw std::invalid_argument{"FanOutQuery requires at least one shard"};
+
+	if (options.getWindowSize() == 0)
+		throw std::invalid_argument{"FanOutQuery windowSize must be greater than zero"};
+
+	if (options.getWindowCount() == 0)
+		throw std::invalid_argument{"FanOutQuery windowCount must be greater than zero"};
+
+	shards.reserve(uris.size());
+
+	for (auto& uri : uris)
+		shards.push_back(Shard{.attachment = nullptr, .uri = std::move(uri)});
+}
+
+void FanOutQuery::concatenate(const WindowConsumer& consumer)
+{
+	// On exceptions, the destructor of the run stops and joins the shard threads.
+	Run run{*this};
+	run.start();
+
+	unsigned shard;
+
+	while (auto window = run.nextAny(shard))
+	{
+		consumer(shard, *window);
+		run.release(shard, std::move(window));
+	}
+
+	run.finish();
+}
+
+void FanOutQuery::merge(unsigned column, const RowConsumer& consumer)
+{
+	// On exceptions, the destructor of the run stops and joins the shard threads.
+	Run run{*this};
+	const auto& descriptors = run.start();
+
+	if (column >= descriptors.size())
+		throw std::out_of_range("FanOutQuery merge column out of range");
+
+	const auto layout = descriptors.getLayout(column);
+
+	if (!isMergeable(layout.adjustedType))
+	{
+		throw FbCppException("FanOutQuery cannot merge on column " + std::to_string(column) + " of type " +
+			std::to_string(static_cast<unsigned>(layout.adjustedType)));
+	}
+
+	struct Cursor final
+	{
+		std::unique_ptr<RowSet> window;
+		unsigned position = 0;
+	};
+
+	const auto shardCount = getShardCount();
+	const auto descending = options.getDescending();
+
+	std::vector<Cursor> cursors(shardCount);
+	std::vector<unsigned> heap;
+	heap.reserve(shardCount);
+
+	const auto current = [&](unsigned shard)
+	{ return cursors[shard].window->getRawRow(cursors[shard].position).data(); };
+
+	// Heaps keep their greatest element first, so rows merged later compare greater.
+	const auto after = [&](unsigned a, unsigned b)
+	{
+		auto result = compareColumns(layout, current(a), current(b));
+
+		if (descending)
+			result = -result;
+
+		return result != 0 ? result > 0 : a > b;
+	};
+
+	const auto advance = [&](unsigned shard)
+	{
+		auto& cursor = cursors[shard];
+
+		if (cursor.window && ++cursor.position < cursor.window->getCount())
+			return true;
+
+		if (cursor.window)
+			run.release(shard, std::move(cursor.window));
+
+		cursor.window = run.next(shard);
+		cursor.position = 0;
+
+		return cursor.window != nullptr;
+	};
+
+	for (unsigned shard = 0u; shard < shardCount; ++shard)
+	{
+		if (advance(shard))
+		{
+			heap.push_back(shard);
+			std::push_heap(heap.begin(), heap.end(), after);
+		}
+	}
+
+	while (!heap.empty())
+	{
+		std::pop_heap(heap.begin(), heap.end(), after);
+		const auto shard = heap.back();
+		heap.pop_back();
+
+		auto& cursor = cursors[shard];
+		consumer(shard, cursor.window->getRow(cursor.position));
+
+		if (advance(shard))
+		{
+			heap.push_back(shard);
+			std::push_heap(heap.begin(), heap.end(), after);
+		}
+	}
+
+	run.finish();
+}
@@ -0,0 +1,225 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_FAN_OUT_QUERY_H
+#define FBCPP_FAN_OUT_QUERY_H
+
+#include "Attachment.h"
+#include "AttachmentPool.h"
+#include "Row.h"
+#include "RowSet.h"
+#include "Statement.h"
+#include "Transaction.h"
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// Represents options used when creating a FanOutQuery object.
+	///
+	class FanOutQueryOptions final
+	{
+	public:
+		///
+		/// Returns the maximum number of rows of each RowSet window.
+		///
+		unsigned getWindowSize() const
+		{
+			return windowSize;
+		}
+
+		///
+		/// Sets the maximum number of rows of each RowSet window.
+		///
+		FanOutQueryOptions& setWindowSize(unsigned value)
+		{
+			windowSize = value;
+			return *this;
+		}
+
+		///
+		/// Returns the maximum number of windows of each shard alive at once, including the one being
+		/// consumed.
+		///
+		unsigned getWindowCount() const
+		{
+			return windowCount;
+		}
+
+		///
+		/// Sets the maximum number of windows of each shard alive at once.
+		///
+		FanOutQueryOptions& setWindowCount(unsigned value)
+		{
+			windowCount = value;
+			return *this;
+		}
+
+		///
+		/// Returns whether `merge()` expects the shard results in descending order.
+		///
+		bool getDescending() const
+		{
+			return descending;
+		}
+
+		///
+		/// Sets whether `merge()` expects the shard results in descending order.
+		///
+		FanOutQueryOptions& setDescending(bool value)
+		{
+			descending = value;
+			return *this;
+		}
+
+		///
+		/// Returns the options of the transaction started on each shard.
+		///
+		const TransactionOptions& getTransactionOptions() const
+		{
+			return transactionOptions;
+		}
+
+		///
+		/// Sets the options of the transaction started on each shard.
+		///
+		FanOutQueryOptions& setTransactionOptions(const TransactionOptions& value)
+		{
+			transactionOptions = value;
+			return *this;
+		}
+
+	private:
+		unsigned windowSize = 1000;
+		unsigned windowCount = 2;
+		bool descending = false;
+		TransactionOptions transactionOptions = TransactionOptions().setAccessMode(TransactionAccessMode::READ_ONLY);
+	};
+
+	///
+	/// @brief Runs the same SELECT on several shard databases concurrently and combines their results.
+	///
+	/// Each shard gets its own thread, which starts a transaction, prepares the SQL text, sets the
+	/// parameters, executes it and fetches RowSet windows ahead of the consumer, so the latency is the
+	/// one of the slowest shard. Before any row is delivered, the output descriptors of all shards are
+	/// checked to have the same layout, so windows of different shards can be read alike.
+	///
+	/// Shard transactions are committed when their cursor is exhausted; blob IDs read from the rows
+	/// must not be used after that. If a shard or the consumer throws, the other shards stop, their
+	/// transactions are rolled back and the first exception is rethrown.
+	///
+	class FanOutQuery final
+	{
+	public:
+		///
+		/// Function setting the parameters of the statement of a shard. Called concurrently, from the
+		/// thread of each shard.
+		///
+		using ParameterSetter = std::function<void(Statement& statement, unsigned shard)>;
+
+		///
+		/// Function receiving a window of rows of a shard. The window is valid until the function returns.
+		///
+		using WindowConsumer = std::function<void(unsigned shard, RowSet& window)>;
+
+		///
+		/// Function receiving a row of a shard. The row is valid until the function returns.
+		///
+		using RowConsumer = std::function<void(unsigned shard, const Row& row)>;
+
+	public:
+		///
+		/// Creates a query running `sql` on `shards`. Each attachment must not be used by other threads
+		/// while results are consumed.
+		///
+		explicit FanOutQuery(std::vector<std::reference_wrapper<Attachment>> shards, std::string sql,
+			const FanOutQueryOptions& options = {}, ParameterSetter setParameters = {});
+
+		///
+		/// Creates a query running `sql` on the databases at `uris`, through attachments leased from
+		/// `pool`.
+		///
+		explicit FanOutQuery(AttachmentPool& pool, std::vector<std::string> uris, AttachmentOptions attachmentOptions,
+			std::string sql, const FanOutQueryOptions& options = {}, ParameterSetter setParameters = {});
+
+		FanOutQuery(const FanOutQuery&) = delete;
+		FanOutQuery& operator=(const FanOutQuery&) = delete;
+
+	public:
+		///
+		/// Returns the number of shards.
+		///
+		unsigned getShardCount() const noexcept
+		{
+			return static_cast<unsigned>(shards.size());
+		}
+
+		///
+		/// Runs the query and passes the windows of all shards to `consumer` as they arrive.
+		///
+		/// Windows of the same shard arrive in order; windows of different shards are interleaved.
+		///
+		void concatenate(const WindowConsumer& consumer);
+
+		///
+		/// Runs the query and passes the rows of all shards to `consumer` in the order of `column`, by a
+		/// k-way merge of the shard results, which must already be sorted by that column (ascending with
+		/// NULLs first, or descending with NULLs last, as Firebird sorts them by default).
+		///
+		/// Strings are compared byte by byte, so the shard order must be the binary one. Ties are
+		/// delivered in shard order.
+		///
+		/// @throws FbCppException if the column is out of range or is a BLOB or DECFLOAT column.
+		///
+		void merge(unsigned column, const RowConsumer& consumer);
+
+	private:
+		struct Shard final
+		{
+			Attachment* attachment;
+			std::string uri;
+		};
+
+		class Run;
+
+	private:
+		AttachmentPool* pool = nullptr;
+		AttachmentOptions attachmentOptions;
+		std::vector<Shard> shards;
+		std::string sql;
+		FanOutQueryOptions options;
+		ParameterSetter setParameters;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_FAN_OUT_QUERY_H
@@ -0,0 +1,181 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "MappedFile.h"
+#include "Exception.h"
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <string>
+#include <system_error>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+static int lastSystemError() noexcept
+{
+#ifdef _WIN32
+	return static_cast<int>(GetLastError());
+#else
+	return errno;
+#endif
+}
+
+[[noreturn]] static void throwFileError(const char* operation, const std::filesystem::path& path, int error)
+{
+	throw FbCppException(std::string{"Cannot "} + operation + " file '" + path.string() +
+		"': " + std::system_category().message(error));
+}
+
+
+MappedFile::MappedFile(const std::filesystem::path& path)
+	: path{path}
+{
+#ifdef _WIN32
+	const auto file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+	if (file == INVALID_HANDLE_VALUE)
+		throwFileError("open", path, lastSystemError());
+
+	fileHandle = file;
+
+	LARGE_INTEGER fileSize;
+
+	if (!GetFileSizeEx(file, &fileSize))
+	{
+		const auto error = lastSystemError();
+		CloseHandle(file);
+		throwFileError("stat", path, error);
+	}
+
+	size = static_cast<std::uint64_t>(fileSize.QuadPart);
+
+	if (size != 0u)
+	{
+		mappingHandle = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+		if (!mappingHandle)
+		{
+			const auto error = lastSystemError();
+			CloseHandle(file);
+			throwFileError("map", path, error);
+		}
+	}
+#else
+	fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+	if (fd < 0)
+		throwFileError("open", path, lastSystemError());
+
+	struct stat fileStat;
+
+	if (::fstat(fd, &fileStat) != 0)
+	{
+		const auto error = lastSystemError();
+		::close(fd);
+		throwFileError("stat", path, error);
+	}
+
+	size = static_cast<std::uint64_t>(fileStat.st_size);
+#endif
+}
+
+MappedFile::~MappedFile() noexcept
+{
+	unmap();
+
+#ifdef _WIN32
+	if (mappingHandle)
+		CloseHandle(mappingHandle);
+
+	CloseHandle(fileHandle);
+#else
+	::close(fd);
+#endif
+}
+
+std::span<const std::byte> MappedFile::map(std::uint64_t offset, std::size_t length)
+{
+	assert(offset % VIEW_ALIGNMENT == 0u);
+
+	unmap();
+
+	if (offset >= size)
+		return {};
+
+	length = static_cast<std::size_t>(std::min<std::uint64_t>(length, size - offset));
+
+#ifdef _WIN32
+	const auto address = MapViewOfFile(mappingHandle, FILE_MAP_READ, static_cast<DWORD>(offset >> 32),
+		static_cast<DWORD>(offset & 0xFFFFFFFFu), length);
+
+	if (!address)
+		throwFileError("map", path, lastSystemError());
+#else
+	const auto address = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(offset));
+
+	if (address == MAP_FAILED)
+		throwFileError("map", path, lastSystemError());
+
+	::madvise(address, length, MADV_SEQUENTIAL);
+#endif
+
+	view = static_cast<const std::byte*>(address);
+	viewLength = length;
+
+	return {view, viewLength};
+}
+
+void MappedFile::unmap() noexcept
+{
+	if (!view)
+		return;
+
+#ifdef _WIN32
+	UnmapViewOfFile(view);
+#else
+	::munmap(const_cast<std::byte*>(view), viewLength);
+#endif
+
+	view = nullptr;
+	viewLength = 0u;
+}
@@ -0,0 +1,119 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_MAPPED_FILE_H
+#define FBCPP_MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp::impl
+{
+	///
+	/// @brief Read-only memory mapping of a file, one view at a time.
+	///
+	/// Only the current view is mapped, so large files can be streamed without keeping all their
+	/// pages mapped. View offsets must be multiples of `VIEW_ALIGNMENT`.
+	///
+	class MappedFile final
+	{
+	public:
+		///
+		/// Offset alignment accepted by `map()` on all supported platforms.
+		///
+		static constexpr std::size_t VIEW_ALIGNMENT = 64u * 1024u;
+
+		///
+		/// Default size of the views used to stream a file.
+		///
+		static constexpr std::size_t DEFAULT_VIEW_SIZE = 16u * 1024u * 1024u;
+
+	public:
+		///
+		/// @brief Opens `path` for reading.
+		///
+		explicit MappedFile(const std::filesystem::path& path);
+
+		///
+		/// @brief Unmaps the current view and closes the file.
+		///
+		~MappedFile() noexcept;
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		MappedFile(MappedFile&&) = delete;
+		MappedFile& operator=(MappedFile&&) = delete;
+
+	public:
+		///
+		/// Returns the file size in bytes.
+		///
+		std::uint64_t getSize() const noexcept
+		{
+			return size;
+		}
+
+		///
+		/// @brief Maps `length` bytes starting at `offset`, replacing the previous view.
+		/// The length is clamped to the end of the file.
+		///
+		std::span<const std::byte> map(std::uint64_t offset, std::size_t length);
+
+		///
+		/// @brief Calls `sink` with consecutive views covering the whole file.
+		///
+		template <typename F>
+		void forEachView(F&& sink, std::size_t viewSize = DEFAULT_VIEW_SIZE)
+		{
+			for (std::uint64_t offset = 0u; offset < size; offset += viewSize)
+				sink(map(offset, viewSize));
+		}
+
+	private:
+		void unmap() noexcept;
+
+	private:
+		std::filesystem::path path;
+		std::uint64_t size = 0u;
+		const std::byte* view = nullptr;
+		std::size_t viewLength = 0u;
+#ifdef _WIN32
+		void* fileHandle = nullptr;
+		void* mappingHandle = nullptr;
+#else
+		int fd = -1;
+#endif
+	};
+}  // namespace fbcpp::impl
+
+
+#endif  // FBCPP_MAPPED_FILE_H
@@ -0,0 +1,240 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_MESSAGE_STRUCT_H
+#define FBCPP_MESSAGE_STRUCT_H
+
+#include "fb-api.h"
+#include "types.h"
+#include "Blob.h"
+#include "Exception.h"
+#include "StructBinding.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// VARCHAR(N) field of a message struct, laid out as in the Firebird message: a length followed by the
+	/// characters.
+	///
+	template <std::size_t N>
+	struct MessageVarChar final
+	{
+		static_assert(N > 0u && N <= 32765u, "MessageVarChar length must be between 1 and 32765");
+
+		///
+		/// Returns the characters as a view into the field.
+		///
+		std::string_view get() const noexcept
+		{
+			return std::string_view{data, std::min<std::size_t>(length, N)};
+		}
+
+		///
+		/// Sets the characters of the field.
+		/// @throws FbCppException if the value is longer than `N` bytes.
+		///
+		void set(std::string_view value)
+		{
+			if (value.length() > N)
+			{
+				throw FbCppException("String of " + std::to_string(value.length()) +
+					" bytes does not fit in a MessageVarChar of " + std::to_string(N) + " bytes");
+			}
+
+			length = static_cast<std::uint16_t>(value.length());
+			std::copy(value.begin(), value.end(), data);
+		}
+
+		///
+		/// Number of characters used.
+		///
+		std::uint16_t length;
+
+		///
+		/// Characters of the value.
+		///
+		char data[N];
+	};
+}  // namespace fbcpp
+
+namespace fbcpp::impl
+{
+	///
+	/// Firebird type of a value field of a message struct. Integers, INT128 and blobs keep the scale or
+	/// subtype of their column; VARCHARs keep its character set.
+	///
+	template <typename T>
+	struct MessageFieldType final
+	{
+		static constexpr bool supported = false;
+	};
+
+	template <unsigned TYPE, unsigned LENGTH, bool KEEP_SCALE = false>
+	struct MessageFieldTypeOf
+	{
+		static constexpr bool supported = true;
+		static constexpr unsigned type = TYPE;
+		static constexpr unsigned length = LENGTH;
+		static constexpr bool keepScale = KEEP_SCALE;
+	};
+
+	// clang-format off
+	template <> struct MessageFieldType<bool> final : MessageFieldTypeOf<SQL_BOOLEAN, 1u> {};
+	template <> struct MessageFieldType<std::int16_t> final : MessageFieldTypeOf<SQL_SHORT, 2u, true> {};
+	template <> struct MessageFieldType<std::int32_t> final : MessageFieldTypeOf<SQL_LONG, 4u, true> {};
+	template <> struct MessageFieldType<std::int64_t> final : MessageFieldTypeOf<SQL_INT64, 8u, true> {};
+	template <> struct MessageFieldType<OpaqueInt128> final : MessageFieldTypeOf<SQL_INT128, 16u, true> {};
+	template <> struct MessageFieldType<float> final : MessageFieldTypeOf<SQL_FLOAT, 4u> {};
+	template <> struct MessageFieldType<double> final : MessageFieldTypeOf<SQL_DOUBLE, 8u> {};
+	template <> struct MessageFieldType<OpaqueDecFloat16> final : MessageFieldTypeOf<SQL_DEC16, 8u> {};
+	template <> struct MessageFieldType<OpaqueDecFloat34> final : MessageFieldTypeOf<SQL_DEC34, 16u> {};
+	template <> struct MessageFieldType<OpaqueDate> final : MessageFieldTypeOf<SQL_TYPE_DATE, 4u> {};
+	template <> struct MessageFieldType<OpaqueTime> final : MessageFieldTypeOf<SQL_TYPE_TIME, 4u> {};
+	template <> struct MessageFieldType<OpaqueTimestamp> final : MessageFieldTypeOf<SQL_TIMESTAMP, 8u> {};
+	template <> struct MessageFieldType<OpaqueTimeTz> final : MessageFieldTypeOf<SQL_TIME_TZ, 8u> {};
+	template <> struct MessageFieldType<OpaqueTimestampTz> final : MessageFieldTypeOf<SQL_TIMESTAMP_TZ, 12u> {};
+	template <> struct MessageFieldType<BlobId> final : MessageFieldTypeOf<SQL_BLOB, 8u, true> {};
+	// clang-format on
+
+	template <std::size_t N>
+	struct MessageFieldType<MessageVarChar<N>> final : MessageFieldTypeOf<SQL_VARYING, static_cast<unsigned>(N)>
+	{
+	};
+
+	///
+	/// Layout of one column of a message struct.
+	///
+	struct MessageFieldFormat final
+	{
+		unsigned type;
+		unsigned length;
+		bool keepScale;
+		unsigned offset;
+		unsigned nullOffset;
+	};
+
+	///
+	/// Layout of a message struct, computed once per type.
+	///
+	struct MessageFormat final
+	{
+		std::vector<MessageFieldFormat> fields;
+		unsigned size;
+	};
+
+	template <typename T, std::size_t... Is>
+	consteval bool hasMessageFields(std::index_sequence<Is...>)
+	{
+		using namespace reflection;
+
+		return ((MessageFieldType<FieldType<T, Is * 2u>>::supported &&
+					std::is_same_v<FieldType<T, Is * 2u + 1u>, std::int16_t>) &&
+			...);
+	}
+
+	template <typename T>
+	consteval bool isMessageStruct()
+	{
+		if constexpr (!Aggregate<T> || !std::is_trivially_copyable_v<T> || !std::is_standard_layout_v<T>)
+			return false;
+		else
+		{
+			constexpr auto fieldCount = reflection::fieldCountV<T>;
+
+			if constexpr (fieldCount == 0u || fieldCount % 2u != 0u)
+				return false;
+			else
+				return hasMessageFields<T>(std::make_index_sequence<fieldCount / 2u>{});
+		}
+	}
+}  // namespace fbcpp::impl
+
+namespace fbcpp
+{
+	///
+	/// @brief Concept for message structs: aggregates laid out as a Firebird message, like the ones declared by
+	/// Firebird's `FB_MESSAGE` macro.
+	///
+	/// Each column is a value field followed by its `std::int16_t` NULL flag (non-zero meaning NULL). Value
+	/// fields may be `bool`, `std::int16_t`, `std::int32_t`, `std::int64_t`, `float`, `double`, `BlobId`,
+	/// MessageVarChar and the opaque number, date and time types. Up to 16 columns are supported.
+	///
+	template <typename T>
+	concept MessageStruct = impl::isMessageStruct<T>();
+}  // namespace fbcpp
+
+namespace fbcpp::impl
+{
+	///
+	/// Returns the layout of a message struct, with the offsets of its fields as compiled.
+	///
+	template <MessageStruct T>
+	const MessageFormat& getMessageFormat()
+	{
+		static const MessageFormat format = []
+		{
+			static const T sample{};
+
+			const auto base = reinterpret_cast<const std::byte*>(&sample);
+			const auto fields = reflection::toTupleRef(sample);
+			const auto offsetOf = [base](const auto& field)
+			{ return static_cast<unsigned>(reinterpret_cast<const std::byte*>(&field) - base); };
+
+			MessageFormat result{.fields = {}, .size = static_cast<unsigned>(sizeof(T))};
+
+			[&]<std::size_t... Is>(std::index_sequence<Is...>)
+			{
+				(result.fields.push_back(MessageFieldFormat{
+					 .type = MessageFieldType<reflection::FieldType<T, Is * 2u>>::type,
+					 .length = MessageFieldType<reflection::FieldType<T, Is * 2u>>::length,
+					 .keepScale = MessageFieldType<reflection::FieldType<T, Is * 2u>>::keepScale,
+					 .offset = offsetOf(std::get<Is * 2u>(fields)),
+					 .nullOffset = offsetOf(std::get<Is * 2u + 1u>(fields)),
+				 }),
+					...);
+			}(std::make_index_sequence<reflection::fieldCountV<T> / 2u>{});
+
+			return result;
+		}();
+
+		return format;
+	}
+}  // namespace fbcpp::impl
+
+
+#endif  // FBCPP_MESSAGE_STRUCT_H
@@ -0,0 +1,135 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Metrics.h"
+
+#if FB_CPP_ENABLE_METRICS != 0
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+namespace
+{
+	std::atomic<std::uint64_t> nextRegistryId{1u};
+
+	struct ThreadSlotCache final
+	{
+		std::uint64_t registryId = 0u;
+		MetricsSlot* slot = nullptr;
+	};
+
+	thread_local ThreadSlotCache threadSlotCache;
+
+	// Single writer per slot, so a relaxed load and store is enough and avoids a locked instruction.
+	void add(std::atomic<std::uint64_t>& counter, std::uint64_t value) noexcept
+	{
+		counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+	}
+}  // namespace
+
+
+MetricsRegistry::MetricsRegistry()
+	: id{nextRegistryId.fetch_add(1u, std::memory_order_relaxed)}
+{
+}
+
+MetricsRegistry::~MetricsRegistry() noexcept
+{
+	for (auto slot = head.load(std::memory_order_acquire); slot;)
+	{
+		const auto next = slot->next;
+		delete slot;
+		slot = next;
+	}
+}
+
+void MetricsRegistry::record(MetricsCall call, std::chrono::steady_clock::duration duration) noexcept
+{
+	try
+	{
+		auto& slot = getThreadSlot();
+		const auto index = static_cast<std::size_t>(call);
+
+		add(slot.calls[index], 1u);
+		add(slot.nanoseconds[index],
+			static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()));
+	}
+	catch (...)
+	{
+		// swallow
+	}
+}
+
+MetricsSnapshot MetricsRegistry::snapshot() const noexcept
+{
+	MetricsSnapshot snapshot;
+
+	for (auto slot = head.load(std::memory_order_acquire); slot; slot = slot->next)
+	{
+		++snapshot.threads;
+
+		for (std::size_t i = 0u; i < METRICS_CALL_COUNT; ++i)
+		{
+			snapshot.calls[i].calls += slot->calls[i].load(std::memory_order_relaxed);
+			snapshot.calls[i].time += std::chrono::nanoseconds{
+				static_cast<std::chrono::nanoseconds::rep>(slot->nanoseconds[i].load(std::memory_order_relaxed))};
+		}
+	}
+
+	return snapshot;
+}
+
+MetricsSlot& MetricsRegistry::getThreadSlot()
+{
+	auto& cache = threadSlotCache;
+
+	if (cache.registryId == id) [[likely]]
+		return *cache.slot;
+
+	// The thread may have used this registry before, while alternating between clients.
+	const auto threadId = std::this_thread::get_id();
+	auto slot = head.load(std::memory_order_acquire);
+
+	while (slot && slot->owner != threadId)
+		slot = slot->next;
+
+	if (!slot)
+	{
+		slot = new MetricsSlot{};
+		slot->owner = threadId;
+		slot->next = head.load(std::memory_order_relaxed);
+
+		while (!head.compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed))
+			;
+	}
+
+	cache.registryId = id;
+	cache.slot = slot;
+
+	return *slot;
+}
+
+#endif  // FB_CPP_ENABLE_METRICS
@@ -0,0 +1,260 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_METRICS_H
+#define FBCPP_METRICS_H
+
+#include "config.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// Firebird client calls counted when fb-cpp is built with `FB_CPP_ENABLE_METRICS`.
+	///
+	enum class MetricsCall : unsigned
+	{
+		///
+		/// IAttachment::prepare.
+		///
+		PREPARE,
+
+		///
+		/// IStatement::openCursor.
+		///
+		OPEN_CURSOR,
+
+		///
+		/// IResultSet fetch methods.
+		///
+		FETCH,
+
+		///
+		/// IStatement::execute.
+		///
+		EXECUTE,
+
+		///
+		/// IBlob::getSegment.
+		///
+		GET_SEGMENT,
+
+		///
+		/// IBlob::putSegment.
+		///
+		PUT_SEGMENT,
+
+		///
+		/// IBatch::add.
+		///
+		BATCH_ADD,
+
+		///
+		/// IBatch::execute.
+		///
+		BATCH_EXECUTE,
+
+		///
+		/// IAttachment::startTransaction.
+		///
+		START_TRANSACTION,
+
+		///
+		/// ITransaction::commit and commitRetaining.
+		///
+		COMMIT,
+
+		///
+		/// ITransaction::rollback.
+		///
+		ROLLBACK,
+	};
+
+	///
+	/// Number of MetricsCall values.
+	///
+	inline constexpr std::size_t METRICS_CALL_COUNT = static_cast<std::size_t>(MetricsCall::ROLLBACK) + 1u;
+
+	///
+	/// Aggregated counters of one MetricsCall.
+	///
+	struct CallMetrics final
+	{
+		///
+		/// Number of calls, failed ones included.
+		///
+		std::uint64_t calls = 0u;
+
+		///
+		/// Total time spent inside the calls.
+		///
+		std::chrono::nanoseconds time{};
+
+		///
+		/// Returns the average time of a call.
+		///
+		std::chrono::nanoseconds getAverageTime() const noexcept
+		{
+			return calls ? time / static_cast<std::chrono::nanoseconds::rep>(calls) : std::chrono::nanoseconds{};
+		}
+	};
+
+	///
+	/// Aggregation of the Firebird client call counters of every thread that used a Client.
+	///
+	struct MetricsSnapshot final
+	{
+		///
+		/// Whether fb-cpp was built with `FB_CPP_ENABLE_METRICS`. Otherwise all counters are zero.
+		///
+		bool enabled = FB_CPP_ENABLE_METRICS != 0;
+
+		///
+		/// Number of threads that made counted calls.
+		///
+		std::size_t threads = 0u;
+
+		///
+		/// Counters indexed by MetricsCall.
+		///
+		std::array<CallMetrics, METRICS_CALL_COUNT> calls{};
+
+		///
+		/// Returns the counters of the given call.
+		///
+		const CallMetrics& get(MetricsCall call) const noexcept
+		{
+			return calls[static_cast<std::size_t>(call)];
+		}
+
+		///
+		/// Returns the counters of all calls added together.
+		///
+		CallMetrics getTotal() const noexcept
+		{
+			CallMetrics total;
+
+			for (const auto& call : calls)
+			{
+				total.calls += call.calls;
+				total.time += call.time;
+			}
+
+			return total;
+		}
+	};
+
+	namespace impl
+	{
+#if FB_CPP_ENABLE_METRICS != 0
+		///
+		/// Per-thread call counters of a Client, written only by their thread.
+		///
+		struct MetricsSlot final
+		{
+			std::array<std::atomic<std::uint64_t>, METRICS_CALL_COUNT> calls{};
+			std::array<std::atomic<std::uint64_t>, METRICS_CALL_COUNT> nanoseconds{};
+			std::thread::id owner;
+			MetricsSlot* next = nullptr;
+		};
+
+		///
+		/// Lock-free list of the per-thread counters of a Client.
+		/// Slots are added on the first call made by a thread and live as long as the registry.
+		///
+		class MetricsRegistry final
+		{
+		public:
+			MetricsRegistry();
+			~MetricsRegistry() noexcept;
+
+			MetricsRegistry(const MetricsRegistry&) = delete;
+			MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+		public:
+			void record(MetricsCall call, std::chrono::steady_clock::duration duration) noexcept;
+			MetricsSnapshot snapshot() const noexcept;
+
+		private:
+			MetricsSlot& getThreadSlot();
+
+		private:
+			const std::uint64_t id;
+			std::atomic<MetricsSlot*> head = nullptr;
+		};
+#else
+		class MetricsRegistry;
+#endif
+
+		///
+		/// Counts and times one Firebird client call, compiling to nothing without `FB_CPP_ENABLE_METRICS`.
+		///
+		class MetricsScope final
+		{
+		public:
+#if FB_CPP_ENABLE_METRICS != 0
+			MetricsScope(MetricsRegistry* registry, MetricsCall call) noexcept
+				: registry{registry},
+				  call{call}
+			{
+				if (registry)
+					start = std::chrono::steady_clock::now();
+			}
+
+			~MetricsScope() noexcept
+			{
+				if (registry)
+					registry->record(call, std::chrono::steady_clock::now() - start);
+			}
+#else
+			constexpr MetricsScope(MetricsRegistry*, MetricsCall) noexcept
+			{
+			}
+#endif
+
+			MetricsScope(const MetricsScope&) = delete;
+			MetricsScope& operator=(const MetricsScope&) = delete;
+
+#if FB_CPP_ENABLE_METRICS != 0
+		private:
+			MetricsRegistry* registry;
+			MetricsCall call;
+			std::chrono::steady_clock::time_point start;
+#endif
+		};
+	}  // namespace impl
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_METRICS_H
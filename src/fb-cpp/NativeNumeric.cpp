@@ -0,0 +1,954 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "NativeNumeric.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+namespace
+{
+	// Unsigned 128-bit magnitude handled as four 32-bit limbs, so no compiler extension is needed.
+	struct UInt128 final
+	{
+		std::uint64_t high = 0u;
+		std::uint64_t low = 0u;
+	};
+
+	constexpr std::uint32_t LIMB_MASK = 0xFFFFFFFFu;
+	constexpr std::uint32_t CHUNK_DIVISOR = 1'000'000'000u;
+	constexpr int CHUNK_DIGITS = 9;
+
+	constexpr std::uint32_t SMALL_POWERS_OF_TEN[] = {
+		1u,
+		10u,
+		100u,
+		1'000u,
+		10'000u,
+		100'000u,
+		1'000'000u,
+		10'000'000u,
+		100'000'000u,
+		1'000'000'000u,
+	};
+
+	bool isZero(const UInt128& value) noexcept
+	{
+		return value.high == 0u && value.low == 0u;
+	}
+
+	// Divides in place and returns the remainder.
+	std::uint32_t divideSmall(UInt128& value, std::uint32_t divisor) noexcept
+	{
+		std::uint32_t limbs[] = {
+			static_cast<std::uint32_t>(value.high >> 32),
+			static_cast<std::uint32_t>(value.high & LIMB_MASK),
+			static_cast<std::uint32_t>(value.low >> 32),
+			static_cast<std::uint32_t>(value.low & LIMB_MASK),
+		};
+
+		std::uint64_t remainder = 0u;
+
+		for (auto& limb : limbs)
+		{
+			const auto current = (remainder << 32) | limb;
+			limb = static_cast<std::uint32_t>(current / divisor);
+			remainder = current % divisor;
+		}
+
+		value.high = (static_cast<std::uint64_t>(limbs[0]) << 32) | limbs[1];
+		value.low = (static_cast<std::uint64_t>(limbs[2]) << 32) | limbs[3];
+
+		return static_cast<std::uint32_t>(remainder);
+	}
+
+	// Computes value * factor + addend in place; returns false on overflow.
+	bool multiplyAddSmall(UInt128& value, std::uint32_t factor, std::uint32_t addend) noexcept
+	{
+		std::uint32_t limbs[] = {
+			static_cast<std::uint32_t>(value.low & LIMB_MASK),
+			static_cast<std::uint32_t>(value.low >> 32),
+			static_cast<std::uint32_t>(value.high & LIMB_MASK),
+			static_cast<std::uint32_t>(value.high >> 32),
+		};
+
+		std::uint64_t carry = addend;
+
+		for (auto& limb : limbs)
+		{
+			const auto current = static_cast<std::uint64_t>(limb) * factor + carry;
+			limb = static_cast<std::uint32_t>(current & LIMB_MASK);
+			carry = current >> 32;
+		}
+
+		if (carry != 0u)
+			return false;
+
+		value.low = (static_cast<std::uint64_t>(limbs[1]) << 32) | limbs[0];
+		value.high = (static_cast<std::uint64_t>(limbs[3]) << 32) | limbs[2];
+
+		return true;
+	}
+
+	bool multiplyPowerOfTen(UInt128& value, int exponent) noexcept
+	{
+		while (exponent > 0)
+		{
+			const auto step = std::min(exponent, CHUNK_DIGITS);
+
+			if (!multiplyAddSmall(value, SMALL_POWERS_OF_TEN[step], 0u))
+				return false;
+
+			exponent -= step;
+		}
+
+		return true;
+	}
+
+	bool increment(UInt128& value) noexcept
+	{
+		if (++value.low == 0u && ++value.high == 0u)
+			return false;
+
+		return true;
+	}
+
+	// Rescales by 10^-exponent rounding half-up on the most significant discarded digit, like NumericConverter.
+	void dividePowerOfTenRounded(UInt128& value, int exponent) noexcept
+	{
+		if (exponent <= 0)
+			return;
+
+		// 2^128 has 39 digits, so more than that always leaves zero behind.
+		if (exponent > 40)
+		{
+			value = {};
+			return;
+		}
+
+		auto remaining = exponent - 1;
+
+		while (remaining > 0)
+		{
+			const auto step = std::min(remaining, CHUNK_DIGITS);
+			divideSmall(value, SMALL_POWERS_OF_TEN[step]);
+			remaining -= step;
+		}
+
+		if (divideSmall(value, 10u) >= 5u)
+			increment(value);
+	}
+
+	// Decimal digits of the magnitude, most significant first, without leading zeros ("0" for zero).
+	std::size_t toDigits(UInt128 value, char (&buffer)[40]) noexcept
+	{
+		char* end = buffer + sizeof(buffer);
+		char* pos = end;
+
+		do
+		{
+			auto chunk = divideSmall(value, CHUNK_DIVISOR);
+
+			for (int i = 0; i < CHUNK_DIGITS && (chunk != 0u || !isZero(value)); ++i)
+			{
+				*--pos = static_cast<char>('0' + chunk % 10u);
+				chunk /= 10u;
+			}
+		} while (!isZero(value));
+
+		if (pos == end)
+			*--pos = '0';
+
+		const auto length = static_cast<std::size_t>(end - pos);
+		std::copy(pos, end, buffer);
+
+		return length;
+	}
+
+	bool isNegative(const OpaqueInt128& value) noexcept
+	{
+		return (value.fb_data[1] >> 63) != 0u;
+	}
+
+	UInt128 negate(const UInt128& value) noexcept
+	{
+		UInt128 result{~value.high, ~value.low};
+		increment(result);
+		return result;
+	}
+
+	UInt128 magnitudeOf(const OpaqueInt128& value) noexcept
+	{
+		const UInt128 bits{value.fb_data[1], value.fb_data[0]};
+		return isNegative(value) ? negate(bits) : bits;
+	}
+
+	// Builds the two's complement value; returns nullopt if the magnitude is out of the INT128 range.
+	std::optional<OpaqueInt128> fromMagnitude(bool negative, const UInt128& magnitude) noexcept
+	{
+		constexpr std::uint64_t SIGN_BIT = std::uint64_t{1} << 63;
+
+		if (magnitude.high > SIGN_BIT || (magnitude.high == SIGN_BIT && (!negative || magnitude.low != 0u)))
+			return std::nullopt;
+
+		const auto bits = negative ? negate(magnitude) : magnitude;
+
+		OpaqueInt128 result;
+		result.fb_data[0] = bits.low;
+		result.fb_data[1] = bits.high;
+		return result;
+	}
+
+	std::optional<std::int64_t> narrowToInt64(bool negative, const UInt128& magnitude) noexcept
+	{
+		constexpr std::uint64_t MAX_MAGNITUDE = std::uint64_t{1} << 63;
+
+		if (magnitude.high != 0u || magnitude.low > MAX_MAGNITUDE || (!negative && magnitude.low == MAX_MAGNITUDE))
+			return std::nullopt;
+
+		return static_cast<std::int64_t>(negative ? 0u - magnitude.low : magnitude.low);
+	}
+
+	std::optional<std::int64_t> rescaleToInt64(bool negative, UInt128 magnitude, int fromScale, int toScale) noexcept
+	{
+		const auto scaleDiff = toScale - fromScale;
+
+		if (scaleDiff > 0)
+			dividePowerOfTenRounded(magnitude, scaleDiff);
+		else if (scaleDiff < 0 && !isZero(magnitude) && (scaleDiff < -39 || !multiplyPowerOfTen(magnitude, -scaleDiff)))
+			return std::nullopt;
+
+		return narrowToInt64(negative, magnitude);
+	}
+
+	double parseDouble(const std::string& text) noexcept
+	{
+#if defined(__APPLE__)
+		return std::strtod(text.c_str(), nullptr);
+#else
+		double result = 0.0;
+		const auto convResult = std::from_chars(text.data(), text.data() + text.size(), result);
+
+		if (convResult.ec == std::errc::result_out_of_range)
+		{
+			// from_chars leaves the value untouched on overflow or underflow; strtod returns the limits.
+			return std::strtod(text.c_str(), nullptr);
+		}
+
+		return result;
+#endif
+	}
+
+	// Parsed [+-]digits[.digits][E[+-]digits] text: significant digits (leading zeros removed) and
+	// the exponent of the last digit.
+	struct DecimalText final
+	{
+		bool negative = false;
+		std::string_view integralDigits;
+		std::string_view fractionalDigits;
+		int exponent = 0;
+	};
+
+	bool isDigits(std::string_view text) noexcept
+	{
+		return std::all_of(text.begin(), text.end(), [](char c) { return c >= '0' && c <= '9'; });
+	}
+
+	std::optional<DecimalText> parseDecimalText(std::string_view value, bool allowExponent) noexcept
+	{
+		DecimalText result;
+
+		if (!value.empty() && (value.front() == '-' || (allowExponent && value.front() == '+')))
+		{
+			result.negative = value.front() == '-';
+			value.remove_prefix(1);
+		}
+
+		if (allowExponent)
+		{
+			if (const auto exponentPos = value.find_first_of("eE"); exponentPos != std::string_view::npos)
+			{
+				auto exponentText = value.substr(exponentPos + 1);
+				value = value.substr(0, exponentPos);
+
+				const bool negativeExponent = !exponentText.empty() && exponentText.front() == '-';
+
+				if (!exponentText.empty() && (exponentText.front() == '-' || exponentText.front() == '+'))
+					exponentText.remove_prefix(1);
+
+				// Longer exponents are out of range for every DECFLOAT format anyway.
+				if (exponentText.empty() || exponentText.size() > 6u || !isDigits(exponentText))
+					return std::nullopt;
+
+				std::from_chars(exponentText.data(), exponentText.data() + exponentText.size(), result.exponent);
+
+				if (negativeExponent)
+					result.exponent = -result.exponent;
+			}
+		}
+
+		const auto dotPos = value.find('.');
+		result.integralDigits = value.substr(0, dotPos);
+		result.fractionalDigits = dotPos == std::string_view::npos ? std::string_view{} : value.substr(dotPos + 1);
+
+		if ((result.integralDigits.empty() && result.fractionalDigits.empty()) || !isDigits(result.integralDigits) ||
+			!isDigits(result.fractionalDigits))
+		{
+			return std::nullopt;
+		}
+
+		return result;
+	}
+
+	//--------------------------------------------------------------------------
+
+	// Densely packed decimal: each 10-bit declet holds three decimal digits.
+	constexpr std::array<std::uint16_t, 1024> makeDpdDecodeTable() noexcept
+	{
+		std::array<std::uint16_t, 1024> table{};
+
+		for (unsigned declet = 0u; declet < 1024u; ++declet)
+		{
+			const auto bit = [declet](unsigned n) { return (declet >> n) & 1u; };
+			const auto bits3 = [&](unsigned a, unsigned b, unsigned c)
+			{ return (bit(a) << 2) | (bit(b) << 1) | bit(c); };
+
+			unsigned d2;
+			unsigned d1;
+			unsigned d0;
+
+			if (bit(3) == 0u)
+			{
+				d2 = bits3(9, 8, 7);
+				d1 = bits3(6, 5, 4);
+				d0 = bits3(2, 1, 0);
+			}
+			else
+			{
+				switch ((bit(2) << 1) | bit(1))
+				{
+					case 0u:
+						d2 = bits3(9, 8, 7);
+						d1 = bits3(6, 5, 4);
+						d0 = 8u + bit(0);
+						break;
+
+					case 1u:
+						d2 = bits3(9, 8, 7);
+						d1 = 8u + bit(4);
+						d0 = bits3(6, 5, 0);
+						break;
+
+					case 2u:
+						d2 = 8u + bit(7);
+						d1 = bits3(6, 5, 4);
+						d0 = bits3(9, 8, 0);
+						break;
+
+					default:
+						switch ((bit(6) << 1) | bit(5))
+						{
+							case 0u:
+								d2 = 8u + bit(7);
+								d1 = 8u + bit(4);
+								d0 = bits3(9, 8, 0);
+								break;
+
+							case 1u:
+								d2 = 8u + bit(7);
+								d1 = bits3(9, 8, 4);
+								d0 = 8u + bit(0);
+								break;
+
+							case 2u:
+								d2 = bits3(9, 8, 7);
+								d1 = 8u + bit(4);
+								d0 = 8u + bit(0);
+								break;
+
+							default:
+								d2 = 8u + bit(7);
+								d1 = 8u + bit(4);
+								d0 = 8u + bit(0);
+								break;
+						}
+						break;
+				}
+			}
+
+			table[declet] = static_cast<std::uint16_t>(d2 * 100u + d1 * 10u + d0);
+		}
+
+		return table;
+	}
+
+	constexpr auto DPD_DECODE = makeDpdDecodeTable();
+
+	// The lowest declet decoding to each value is the canonical encoding.
+	constexpr std::array<std::uint16_t, 1000> makeDpdEncodeTable() noexcept
+	{
+		std::array<std::uint16_t, 1000> table{};
+		std::array<bool, 1000> assigned{};
+
+		for (unsigned declet = 0u; declet < 1024u; ++declet)
+		{
+			const auto value = DPD_DECODE[declet];
+
+			if (!assigned[value])
+			{
+				table[value] = static_cast<std::uint16_t>(declet);
+				assigned[value] = true;
+			}
+		}
+
+		return table;
+	}
+
+	constexpr auto DPD_ENCODE = makeDpdEncodeTable();
+
+	struct DecimalFormat final
+	{
+		unsigned totalBits;
+		unsigned digits;
+		unsigned exponentContinuationBits;
+		int bias;
+		int minExponent;
+		int maxExponent;
+	};
+
+	// IEEE 754 decimal64 and decimal128 interchange formats.
+	constexpr DecimalFormat DECIMAL64{64u, 16u, 8u, 398, -398, 369};
+	constexpr DecimalFormat DECIMAL128{128u, 34u, 12u, 6176, -6176, 6111};
+
+	enum class DecimalKind
+	{
+		FINITE,
+		INFINITE,
+		QUIET_NAN,
+		SIGNALING_NAN,
+	};
+
+	struct DecodedDecimal final
+	{
+		bool negative = false;
+		DecimalKind kind = DecimalKind::FINITE;
+		char digits[34]{};
+		unsigned digitCount = 0u;
+		int exponent = 0;
+	};
+
+	unsigned extractBits(const UInt128& value, unsigned pos, unsigned count) noexcept
+	{
+		std::uint64_t result;
+
+		if (pos >= 64u)
+			result = value.high >> (pos - 64u);
+		else if (pos + count <= 64u)
+			result = value.low >> pos;
+		else
+			result = (value.low >> pos) | (value.high << (64u - pos));
+
+		return static_cast<unsigned>(result & ((std::uint64_t{1} << count) - 1u));
+	}
+
+	void insertBits(UInt128& value, unsigned pos, std::uint64_t bits) noexcept
+	{
+		if (pos >= 64u)
+			value.high |= bits << (pos - 64u);
+		else
+		{
+			value.low |= bits << pos;
+
+			if (pos > 0u)
+				value.high |= bits >> (64u - pos);
+		}
+	}
+
+	DecodedDecimal decode(const UInt128& bits, const DecimalFormat& format) noexcept
+	{
+		DecodedDecimal result;
+		result.negative = extractBits(bits, format.totalBits - 1u, 1u) != 0u;
+
+		const auto combination = extractBits(bits, format.totalBits - 6u, 5u);
+		const auto continuationPos = format.totalBits - 6u - format.exponentContinuationBits;
+		unsigned mostSignificantDigit = 0u;
+
+		if ((combination & 0x1Eu) == 0x1Eu)
+		{
+			if ((combination & 1u) == 0u)
+			{
+				result.kind = DecimalKind::INFINITE;
+				return result;
+			}
+
+			result.kind = extractBits(bits, format.totalBits - 7u, 1u) != 0u ? DecimalKind::SIGNALING_NAN
+																			: DecimalKind::QUIET_NAN;
+		}
+		else
+		{
+			unsigned exponentHigh;
+
+			if ((combination & 0x18u) == 0x18u)
+			{
+				exponentHigh = (combination >> 1) & 3u;
+				mostSignificantDigit = 8u + (combination & 1u);
+			}
+			else
+			{
+				exponentHigh = combination >> 3;
+				mostSignificantDigit = combination & 7u;
+			}
+
+			const auto biasedExponent = (exponentHigh << format.exponentContinuationBits) |
+				extractBits(bits, continuationPos, format.exponentContinuationBits);
+			result.exponent = static_cast<int>(biasedExponent) - format.bias;
+		}
+
+		char digits[34];
+		unsigned count = 0u;
+		digits[count++] = static_cast<char>('0' + mostSignificantDigit);
+
+		for (auto declet = static_cast<int>((format.digits - 1u) / 3u) - 1; declet >= 0; --declet)
+		{
+			const auto value = DPD_DECODE[extractBits(bits, static_cast<unsigned>(declet) * 10u, 10u)];
+			digits[count++] = static_cast<char>('0' + value / 100u);
+			digits[count++] = static_cast<char>('0' + value / 10u % 10u);
+			digits[count++] = static_cast<char>('0' + value % 10u);
+		}
+
+		unsigned first = 0u;
+
+		while (first + 1u < count && digits[first] == '0')
+			++first;
+
+		result.digitCount = count - first;
+		std::copy(digits + first, digits + count, result.digits);
+
+		return result;
+	}
+
+	std::optional<UInt128> encode(std::string_view value, const DecimalFormat& format) noexcept
+	{
+		const auto text = parseDecimalText(value, true);
+
+		if (!text)
+			return std::nullopt;
+
+		char digits[34];
+		unsigned digitCount = 0u;
+
+		for (const auto part : {text->integralDigits, text->fractionalDigits})
+		{
+			for (const auto c : part)
+			{
+				if (c == '0' && digitCount == 0u)
+					continue;
+
+				if (digitCount == format.digits)
+					return std::nullopt;
+
+				digits[digitCount++] = c;
+			}
+		}
+
+		const auto exponent = static_cast<long>(text->exponent) - static_cast<long>(text->fractionalDigits.size());
+
+		if (exponent < format.minExponent || exponent > format.maxExponent)
+			return std::nullopt;
+
+		// Right-align the coefficient into all the digits of the format.
+		char coefficient[34];
+		std::fill(coefficient, coefficient + format.digits, '0');
+		std::copy(digits, digits + digitCount, coefficient + (format.digits - digitCount));
+
+		const auto biasedExponent = static_cast<unsigned>(exponent + format.bias);
+		const auto exponentHigh = biasedExponent >> format.exponentContinuationBits;
+		const auto mostSignificantDigit = static_cast<unsigned>(coefficient[0] - '0');
+		const auto combination = mostSignificantDigit < 8u
+			? (exponentHigh << 3) | mostSignificantDigit
+			: 0x18u | (exponentHigh << 1) | (mostSignificantDigit & 1u);
+
+		UInt128 bits;
+		insertBits(bits, format.totalBits - 1u, text->negative ? 1u : 0u);
+		insertBits(bits, format.totalBits - 6u, combination);
+		insertBits(bits, format.totalBits - 6u - format.exponentContinuationBits,
+			biasedExponent & ((1u << format.exponentContinuationBits) - 1u));
+
+		const auto decletCount = (format.digits - 1u) / 3u;
+
+		for (unsigned i = 0u; i < decletCount; ++i)
+		{
+			const auto* group = coefficient + 1u + i * 3u;
+			const auto groupValue = static_cast<unsigned>(group[0] - '0') * 100u +
+				static_cast<unsigned>(group[1] - '0') * 10u + static_cast<unsigned>(group[2] - '0');
+
+			insertBits(bits, (decletCount - 1u - i) * 10u, DPD_ENCODE[groupValue]);
+		}
+
+		return bits;
+	}
+
+	// Scientific string form, as produced by decNumber (and thus by fbclient).
+	void appendString(std::string& result, const DecodedDecimal& decoded)
+	{
+		if (decoded.negative)
+			result += '-';
+
+		switch (decoded.kind)
+		{
+			case DecimalKind::INFINITE:
+				result += "Infinity";
+				return;
+
+			case DecimalKind::QUIET_NAN:
+			case DecimalKind::SIGNALING_NAN:
+				result += decoded.kind == DecimalKind::SIGNALING_NAN ? "sNaN" : "NaN";
+
+				if (decoded.digitCount > 1u || decoded.digits[0] != '0')
+					result.append(decoded.digits, decoded.digitCount);
+
+				return;
+
+			default:
+				break;
+		}
+
+		const std::string_view digits{decoded.digits, decoded.digitCount};
+		const auto adjustedExponent = decoded.exponent + static_cast<int>(digits.size()) - 1;
+
+		if (decoded.exponent <= 0 && adjustedExponent >= -6)
+		{
+			appendScaledDigits(result, false, digits, decoded.exponent);
+			return;
+		}
+
+		result += digits.front();
+
+		if (digits.size() > 1u)
+		{
+			result += '.';
+			result += digits.substr(1);
+		}
+
+		result += adjustedExponent < 0 ? "E-" : "E+";
+		result += std::to_string(adjustedExponent < 0 ? -adjustedExponent : adjustedExponent);
+	}
+
+	double toDouble(const DecodedDecimal& decoded)
+	{
+		switch (decoded.kind)
+		{
+			case DecimalKind::INFINITE:
+				return decoded.negative ? -std::numeric_limits<double>::infinity()
+										: std::numeric_limits<double>::infinity();
+
+			case DecimalKind::QUIET_NAN:
+			case DecimalKind::SIGNALING_NAN:
+				return std::numeric_limits<double>::quiet_NaN();
+
+			default:
+				break;
+		}
+
+		std::string text;
+
+		if (decoded.negative)
+			text += '-';
+
+		text.append(decoded.digits, decoded.digitCount);
+		text += 'e';
+		text += std::to_string(decoded.exponent);
+
+		return parseDouble(text);
+	}
+
+	std::optional<std::int64_t> toInt64(const DecodedDecimal& decoded, int toScale)
+	{
+		if (decoded.kind != DecimalKind::FINITE)
+			return std::nullopt;
+
+		UInt128 magnitude;
+
+		for (unsigned i = 0u; i < decoded.digitCount; ++i)
+			multiplyAddSmall(magnitude, 10u, static_cast<std::uint32_t>(decoded.digits[i] - '0'));
+
+		return rescaleToInt64(decoded.negative, magnitude, decoded.exponent, toScale);
+	}
+
+	UInt128 decFloat16Bits(const OpaqueDecFloat16& value) noexcept
+	{
+		return UInt128{0u, value.fb_data[0]};
+	}
+
+	// decNumber keeps decimal128 words in memory order, so the high word depends on the byte order.
+	UInt128 decFloat34Bits(const OpaqueDecFloat34& value) noexcept
+	{
+		if constexpr (std::endian::native == std::endian::little)
+			return UInt128{value.fb_data[1], value.fb_data[0]};
+		else
+			return UInt128{value.fb_data[0], value.fb_data[1]};
+	}
+}  // namespace
+
+
+std::string impl::formatScaledDigits(bool isNegative, std::string_view digits, int scale)
+{
+	std::string result;
+	appendScaledDigits(result, isNegative, digits, scale);
+	return result;
+}
+
+void impl::appendScaledDigits(std::string& result, bool isNegative, std::string_view digits, int scale)
+{
+	const auto digitCount = static_cast<int>(digits.size());
+	const int decimalPlaces = scale < 0 ? -scale : 0;
+	const int integralDigits = std::max(digitCount - decimalPlaces, 1);
+
+	// Grow the result once: sign, integral part, optional point and fraction.
+	const auto length = static_cast<std::size_t>(isNegative) + static_cast<std::size_t>(integralDigits) +
+		(scale > 0 ? static_cast<std::size_t>(scale) : 0u) +
+		(decimalPlaces > 0 ? static_cast<std::size_t>(decimalPlaces) + 1u : 0u);
+
+	const auto start = result.size();
+	result.resize(start + length, '0');
+	auto* out = result.data() + start;
+
+	if (isNegative)
+		*out++ = '-';
+
+	if (decimalPlaces == 0)
+		std::copy(digits.begin(), digits.end(), out);
+	else if (decimalPlaces >= digitCount)
+	{
+		out[1] = '.';
+		std::copy(digits.begin(), digits.end(), out + 2 + (decimalPlaces - digitCount));
+	}
+	else
+	{
+		const auto integralPart = digits.substr(0, static_cast<std::size_t>(integralDigits));
+		out = std::copy(integralPart.begin(), integralPart.end(), out);
+		*out++ = '.';
+		const auto fractionalPart = digits.substr(integralPart.size());
+		std::copy(fractionalPart.begin(), fractionalPart.end(), out);
+	}
+}
+
+std::string impl::int128ToString(const OpaqueInt128& value, int scale)
+{
+	std::string result;
+	appendInt128String(result, value, scale);
+	return result;
+}
+
+void impl::appendInt128String(std::string& result, const OpaqueInt128& value, int scale)
+{
+	char digits[40];
+	const auto digitCount = toDigits(magnitudeOf(value), digits);
+
+	// Same as fbclient: scales beyond the INT128 precision print the exponent instead of the zeros.
+	if (scale < -38 || scale > 4)
+	{
+		if (isNegative(value))
+			result += '-';
+
+		result.append(digits, digitCount);
+		result += 'E';
+		result += std::to_string(scale);
+		return;
+	}
+
+	appendScaledDigits(result, isNegative(value), std::string_view{digits, digitCount}, scale);
+}
+
+std::optional<OpaqueInt128> impl::stringToInt128(std::string_view value, int scale)
+{
+	const auto text = parseDecimalText(value, false);
+
+	if (!text || scale > 0 || text->fractionalDigits.size() > static_cast<std::size_t>(-scale))
+		return std::nullopt;
+
+	UInt128 magnitude;
+
+	for (const auto part : {text->integralDigits, text->fractionalDigits})
+	{
+		for (const auto c : part)
+		{
+			if (!multiplyAddSmall(magnitude, 10u, static_cast<std::uint32_t>(c - '0')))
+				return std::nullopt;
+		}
+	}
+
+	if (!multiplyPowerOfTen(magnitude, -scale - static_cast<int>(text->fractionalDigits.size())))
+		return std::nullopt;
+
+	return fromMagnitude(text->negative, magnitude);
+}
+
+std::optional<std::int64_t> impl::int128ToInt64(const OpaqueInt128& value, int fromScale, int toScale)
+{
+	return rescaleToInt64(isNegative(value), magnitudeOf(value), fromScale, toScale);
+}
+
+std::optional<OpaqueInt128> impl::int64ToInt128(const ScaledInt64& value, int toScale)
+{
+	const bool negative = value.value < 0;
+	const auto bits = static_cast<std::uint64_t>(value.value);
+	UInt128 magnitude{0u, negative ? 0u - bits : bits};
+
+	const auto scaleDiff = toScale - value.scale;
+
+	if (scaleDiff > 0)
+		dividePowerOfTenRounded(magnitude, scaleDiff);
+	else if (scaleDiff < 0 && !isZero(magnitude) && (scaleDiff < -39 || !multiplyPowerOfTen(magnitude, -scaleDiff)))
+		return std::nullopt;
+
+	return fromMagnitude(negative, magnitude);
+}
+
+std::optional<OpaqueInt128> impl::doubleToInt128(double value, int toScale)
+{
+	if (!std::isfinite(value))
+		return std::nullopt;
+
+	if (toScale != 0)
+		value *= std::pow(10.0, -toScale);
+
+	// Rounds like NumericConverter does for 64-bit targets.
+	const bool negative = value < 0;
+	const auto magnitudeValue = std::trunc(std::abs(value) + 0.5 + 1e-14);
+
+	if (!(magnitudeValue < 0x1p128))
+		return std::nullopt;
+
+	// Both halves are exact: the value is integral and the split is a power of two.
+	const auto high = std::floor(std::ldexp(magnitudeValue, -64));
+	const auto low = magnitudeValue - std::ldexp(high, 64);
+
+	return fromMagnitude(negative, UInt128{static_cast<std::uint64_t>(high), static_cast<std::uint64_t>(low)});
+}
+
+double impl::int128ToDouble(const OpaqueInt128& value, int scale)
+{
+	char digits[40];
+	const auto digitCount = toDigits(magnitudeOf(value), digits);
+
+	std::string text;
+
+	if (isNegative(value))
+		text += '-';
+
+	text.append(digits, digitCount);
+	text += 'e';
+	text += std::to_string(scale);
+
+	return parseDouble(text);
+}
+
+std::string impl::decFloat16ToString(const OpaqueDecFloat16& value)
+{
+	std::string result;
+	appendDecFloat16String(result, value);
+	return result;
+}
+
+std::string impl::decFloat34ToString(const OpaqueDecFloat34& value)
+{
+	std::string result;
+	appendDecFloat34String(result, value);
+	return result;
+}
+
+void impl::appendDecFloat16String(std::string& result, const OpaqueDecFloat16& value)
+{
+	appendString(result, decode(decFloat16Bits(value), DECIMAL64));
+}
+
+void impl::appendDecFloat34String(std::string& result, const OpaqueDecFloat34& value)
+{
+	appendString(result, decode(decFloat34Bits(value), DECIMAL128));
+}
+
+std::optional<OpaqueDecFloat16> impl::stringToDecFloat16(std::string_view value)
+{
+	const auto bits = encode(value, DECIMAL64);
+
+	if (!bits)
+		return std::nullopt;
+
+	OpaqueDecFloat16 result;
+	result.fb_data[0] = bits->low;
+	return result;
+}
+
+std::optional<OpaqueDecFloat34> impl::stringToDecFloat34(std::string_view value)
+{
+	const auto bits = encode(value, DECIMAL128);
+
+	if (!bits)
+		return std::nullopt;
+
+	OpaqueDecFloat34 result;
+
+	if constexpr (std::endian::native == std::endian::little)
+	{
+		result.fb_data[0] = bits->low;
+		result.fb_data[1] = bits->high;
+	}
+	else
+	{
+		result.fb_data[0] = bits->high;
+		result.fb_data[1] = bits->low;
+	}
+
+	return result;
+}
+
+double impl::decFloat16ToDouble(const OpaqueDecFloat16& value)
+{
+	return toDouble(decode(decFloat16Bits(value), DECIMAL64));
+}
+
+double impl::decFloat34ToDouble(const OpaqueDecFloat34& value)
+{
+	return toDouble(decode(decFloat34Bits(value), DECIMAL128));
+}
+
+std::optional<std::int64_t> impl::decFloat16ToInt64(const OpaqueDecFloat16& value, int toScale)
+{
+	return toInt64(decode(decFloat16Bits(value), DECIMAL64), toScale);
+}
+
+std::optional<std::int64_t> impl::decFloat34ToInt64(const OpaqueDecFloat34& value, int toScale)
+{
+	return toInt64(decode(decFloat34Bits(value), DECIMAL128), toScale);
+}
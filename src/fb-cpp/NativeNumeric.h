@@ -0,0 +1,130 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_NATIVE_NUMERIC_H
+#define FBCPP_NATIVE_NUMERIC_H
+
+#include "types.h"
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp::impl
+{
+	///
+	/// @name In-library INT128 and DECFLOAT conversions
+	///
+	/// These functions convert Firebird's opaque INT128 (two's complement) and DECFLOAT (IEEE 754 decimal64 and
+	/// decimal128 in the DPD encoding used by Firebird) values without calling fbclient's IInt128/IDecFloat
+	/// utilities. Parsing functions only accept values they can represent exactly, and return `std::nullopt`
+	/// otherwise, so callers can fall back to fbclient for rounding and error reporting.
+	/// @{
+	///
+
+	///
+	/// @brief Formats sign, decimal digits and scale as a plain decimal number, e.g. ("-", "12345", -2) -> "-123.45".
+	///
+	std::string formatScaledDigits(bool isNegative, std::string_view digits, int scale);
+
+	///
+	/// @brief Appends the result of `formatScaledDigits()` to `result`.
+	///
+	void appendScaledDigits(std::string& result, bool isNegative, std::string_view digits, int scale);
+
+	std::string int128ToString(const OpaqueInt128& value, int scale);
+
+	void appendInt128String(std::string& result, const OpaqueInt128& value, int scale);
+
+	///
+	/// @brief Parses `[-]digits[.digits]` into an INT128 with the given (non-positive) scale.
+	/// @return `std::nullopt` if the text has more fractional digits than the scale or does not fit.
+	///
+	std::optional<OpaqueInt128> stringToInt128(std::string_view value, int scale);
+
+	///
+	/// @brief Rescales an INT128 half-up and narrows it to 64 bits.
+	/// @return `std::nullopt` if the result does not fit.
+	///
+	std::optional<std::int64_t> int128ToInt64(const OpaqueInt128& value, int fromScale, int toScale);
+
+	///
+	/// @brief Rescales a scaled 64-bit integer half-up into an INT128.
+	/// @return `std::nullopt` if the result does not fit.
+	///
+	std::optional<OpaqueInt128> int64ToInt128(const ScaledInt64& value, int toScale);
+
+	///
+	/// @brief Rescales a finite floating value half-up into an INT128 with scale `toScale`.
+	/// @return `std::nullopt` if the value is infinite, NaN or does not fit.
+	///
+	std::optional<OpaqueInt128> doubleToInt128(double value, int toScale);
+
+	double int128ToDouble(const OpaqueInt128& value, int scale);
+
+	std::string decFloat16ToString(const OpaqueDecFloat16& value);
+	std::string decFloat34ToString(const OpaqueDecFloat34& value);
+
+	void appendDecFloat16String(std::string& result, const OpaqueDecFloat16& value);
+	void appendDecFloat34String(std::string& result, const OpaqueDecFloat34& value);
+
+	///
+	/// @brief Parses `[+-]digits[.digits][E[+-]digits]` into a DECFLOAT(16).
+	/// @return `std::nullopt` if the value needs rounding, is out of the exponent range or is a special value.
+	///
+	std::optional<OpaqueDecFloat16> stringToDecFloat16(std::string_view value);
+
+	///
+	/// @brief Parses `[+-]digits[.digits][E[+-]digits]` into a DECFLOAT(34).
+	/// @return `std::nullopt` if the value needs rounding, is out of the exponent range or is a special value.
+	///
+	std::optional<OpaqueDecFloat34> stringToDecFloat34(std::string_view value);
+
+	double decFloat16ToDouble(const OpaqueDecFloat16& value);
+	double decFloat34ToDouble(const OpaqueDecFloat34& value);
+
+	///
+	/// @brief Rescales a finite DECFLOAT half-up to a 64-bit integer with scale `toScale`.
+	/// @return `std::nullopt` if the value is infinite, NaN or does not fit.
+	///
+	std::optional<std::int64_t> decFloat16ToInt64(const OpaqueDecFloat16& value, int toScale);
+
+	///
+	/// @brief Rescales a finite DECFLOAT half-up to a 64-bit integer with scale `toScale`.
+	/// @return `std::nullopt` if the value is infinite, NaN or does not fit.
+	///
+	std::optional<std::int64_t> decFloat34ToInt64(const OpaqueDecFloat34& value, int toScale);
+
+	///
+	/// @}
+	///
+}  // namespace fbcpp::impl
+
+
+#endif  // FBCPP_NATIVE_NUMERIC_H
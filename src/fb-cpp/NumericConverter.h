@@ -24,16 +24,22 @@
 
 #include "config.h"
 #include "fb-api.h"
+#include "Arena.h"
 #include "Client.h"
 #include "Exception.h"
+#include "NativeNumeric.h"
 #include "types.h"
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cctype>
+#include <cerrno>
 #include <charconv>
 #include <cmath>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
 #include <format>
 #include <limits>
@@ -144,6 +150,13 @@ namespace fbcpp::impl
 	template <typename T>
 	using MakeUnsignedType = typename MakeUnsigned<T>::type;
 
+	// Largest exponent whose power of ten is representable in T.
+	template <typename T>
+	inline constexpr int MaxPowerOfTen = std::numeric_limits<T>::digits10;
+
+	// Largest magnitude below which every integer converts to double exactly.
+	inline constexpr std::int64_t MAX_EXACT_DOUBLE_INTEGER = std::int64_t{1} << std::numeric_limits<double>::digits;
+
 	class NumericConverter final
 	{
 	public:
@@ -214,9 +227,9 @@ namespace fbcpp::impl
 			const ComputeType eps = conversionEpsilon<ComputeType>();
 
 			if (toScale > 0)
-				value /= powerOfTen(toScale);
+				value /= floatingPowerOfTen<ComputeType>(toScale);
 			else if (toScale < 0)
-				value *= powerOfTen(-toScale);
+				value *= floatingPowerOfTen<ComputeType>(-toScale);
 
 			if (value > 0)
 				value += 0.5f + eps;
@@ -250,19 +263,31 @@ namespace fbcpp::impl
 
 			using ComputeType = GreaterNumberType<double, To>;
 
-			ComputeType value = static_cast<ComputeType>(from.value);  // FIXME: decfloat
+			if (from.scale != 0 && std::abs(from.scale) > std::numeric_limits<To>::max_exponent10)
+				throwNumericOutOfRange();
 
-			if (from.scale != 0)
+			if constexpr (IntegralNumber<From>)
 			{
-				if (std::abs(from.scale) > std::numeric_limits<To>::max_exponent10)
-					throwNumericOutOfRange();
+				// Split the integral and fractional parts exactly when the value does not fit in the mantissa,
+				// so only the final division rounds.
+				if (from.scale < 0 && from.scale >= -MaxPowerOfTen<From> &&
+					(from.value > MAX_EXACT_DOUBLE_INTEGER || from.value < -MAX_EXACT_DOUBLE_INTEGER))
+				{
+					const auto& divisor = integerPowerOfTen<From>(-from.scale);
+					const auto floatingDivisor = floatingPowerOfTen<ComputeType>(-from.scale);
 
-				if (from.scale > 0)
-					value *= powerOfTen(from.scale);
-				else if (from.scale < 0)
-					value /= powerOfTen(-from.scale);
+					return static_cast<To>(static_cast<ComputeType>(from.value / divisor) +
+						static_cast<ComputeType>(from.value % divisor) / floatingDivisor);
+				}
 			}
 
+			ComputeType value = static_cast<ComputeType>(from.value);
+
+			if (from.scale > 0)
+				value *= floatingPowerOfTen<ComputeType>(from.scale);
+			else if (from.scale < 0)
+				value /= floatingPowerOfTen<ComputeType>(-from.scale);
+
 			return static_cast<To>(value);
 		}
 
@@ -280,7 +305,15 @@ namespace fbcpp::impl
 		template <IntegralNumber From>
 		std::string numberToString(const ScaledNumber<From>& from)
 		{
-			char buffer[64];
+			std::string result;
+			appendNumberString(result, from);
+			return result;
+		}
+
+		template <IntegralNumber From>
+		void appendNumberString(std::string& result, const ScaledNumber<From>& from)
+		{
+			char digits[64];
 
 			const bool isNegative = from.value < 0;
 			const bool isMinLimit = from.value == std::numeric_limits<decltype(from.value)>::min();
@@ -292,89 +325,169 @@ namespace fbcpp::impl
 
 			int digitCount = 0;
 
-			do
+			if constexpr (std::is_integral_v<UnsignedType>)
 			{
-				buffer[digitCount++] = static_cast<char>((unsignedValue % 10) + '0');
-				unsignedValue /= 10;
-			} while (unsignedValue > 0);
-
-			std::string result;
-
-			if (isNegative)
-				result += '-';
-
-			if (from.scale >= 0)
-			{
-				for (int i = digitCount - 1; i >= 0; --i)
-					result += buffer[i];
-
-				result.append(static_cast<std::string::size_type>(from.scale), '0');
+				const auto convResult = std::to_chars(digits, digits + sizeof(digits), unsignedValue);
+				digitCount = static_cast<int>(convResult.ptr - digits);
 			}
 			else
 			{
-				const int decimalPlaces = -from.scale;
+				char reversed[sizeof(digits)];
 
-				if (decimalPlaces >= static_cast<int>(digitCount))
-				{
-					result += "0.";
-					const int leadingZeros = decimalPlaces - digitCount;
-					result.append(static_cast<std::string::size_type>(leadingZeros), '0');
-
-					for (int i = digitCount - 1; i >= 0; --i)
-						result += buffer[i];
-				}
-				else
+				do
 				{
-					for (int i = digitCount - 1; i >= decimalPlaces; --i)
-						result += buffer[i];
+					reversed[digitCount++] = static_cast<char>(static_cast<unsigned>(unsignedValue % 10u) + '0');
+					unsignedValue /= 10u;
+				} while (unsignedValue > 0u);
 
-					result += '.';
-
-					for (int i = decimalPlaces - 1; i >= 0; --i)
-						result += buffer[i];
-				}
+				std::reverse_copy(reversed, reversed + digitCount, digits);
 			}
 
-			return result;
+			appendScaledDigits(
+				result, isNegative, std::string_view{digits, static_cast<std::size_t>(digitCount)}, from.scale);
 		}
 
 		template <FloatingNumber From>
 		std::string numberToString(const From& from)
+		{
+			std::string result;
+			appendNumberString(result, from);
+			return result;
+		}
+
+		template <FloatingNumber From>
+		void appendNumberString(std::string& result, const From& from)
 		{
 			if constexpr (std::is_floating_point_v<From>)
 			{
 				if (std::isnan(from))
-					return "NaN";
-				if (std::isinf(from))
-					return from > 0 ? "Infinity" : "-Infinity";
-				return std::to_string(from);
+					result += "NaN";
+				else if (std::isinf(from))
+					result += from > 0 ? "Infinity" : "-Infinity";
+				else
+				{
+					// Shortest representation that round-trips.
+					char buffer[64];
+#if defined(__APPLE__)
+					// No floating-point std::to_chars: try increasing precisions until the text parses back.
+					int length = 0;
+
+					for (int precision = 1; precision <= std::numeric_limits<From>::max_digits10; ++precision)
+					{
+						length = std::snprintf(buffer, sizeof(buffer), "%.*g", precision, static_cast<double>(from));
+
+						const auto parsed = std::is_same_v<From, float> ? std::strtof(buffer, nullptr)
+																		: std::strtod(buffer, nullptr);
+
+						if (static_cast<From>(parsed) == from)
+							break;
+					}
+
+					result.append(buffer, static_cast<std::size_t>(length));
+#else
+					const auto convResult = std::to_chars(buffer, buffer + sizeof(buffer), from);
+					result.append(buffer, convResult.ptr);
+#endif
+				}
 			}
 			else
-				return from.str();
+				result += from.str();
 		}
 
 		std::string opaqueInt128ToString(StatusWrapper* statusWrapper, const OpaqueInt128& opaqueInt128, int scale)
 		{
+			std::string result;
+			appendOpaqueInt128String(result, statusWrapper, opaqueInt128, scale);
+			return result;
+		}
+
+		void appendOpaqueInt128String(std::string& result, [[maybe_unused]] StatusWrapper* statusWrapper,
+			const OpaqueInt128& opaqueInt128, int scale)
+		{
+#if FB_CPP_USE_NATIVE_NUMERIC != 0
+			appendInt128String(result, opaqueInt128, scale);
+#else
 			const auto int128Util = client->getInt128Util(statusWrapper);
 			char buffer[fb::IInt128::STRING_SIZE + 1];
 			int128Util->toString(statusWrapper, &opaqueInt128, scale, static_cast<unsigned>(sizeof(buffer)), buffer);
-			return buffer;
+			result += buffer;
+#endif
 		}
 
 		std::string opaqueDecFloat16ToString(StatusWrapper* statusWrapper, const OpaqueDecFloat16& opaqueDecFloat16)
 		{
+			std::string result;
+			appendOpaqueDecFloat16String(result, statusWrapper, opaqueDecFloat16);
+			return result;
+		}
+
+		void appendOpaqueDecFloat16String(std::string& result, [[maybe_unused]] StatusWrapper* statusWrapper,
+			const OpaqueDecFloat16& opaqueDecFloat16)
+		{
+#if FB_CPP_USE_NATIVE_NUMERIC != 0
+			appendDecFloat16String(result, opaqueDecFloat16);
+#else
 			const auto decFloat16Util = client->getDecFloat16Util(statusWrapper);
 			char buffer[fb::IDecFloat16::STRING_SIZE + 1];
 			decFloat16Util->toString(statusWrapper, &opaqueDecFloat16, static_cast<unsigned>(sizeof(buffer)), buffer);
-			return buffer;
+			result += buffer;
+#endif
 		}
 
 		std::string opaqueDecFloat34ToString(StatusWrapper* statusWrapper, const OpaqueDecFloat34& opaqueDecFloat34)
 		{
+			std::string result;
+			appendOpaqueDecFloat34String(result, statusWrapper, opaqueDecFloat34);
+			return result;
+		}
+
+		void appendOpaqueDecFloat34String(std::string& result, [[maybe_unused]] StatusWrapper* statusWrapper,
+			const OpaqueDecFloat34& opaqueDecFloat34)
+		{
+#if FB_CPP_USE_NATIVE_NUMERIC != 0
+			appendDecFloat34String(result, opaqueDecFloat34);
+#else
 			const auto decFloat34Util = client->getDecFloat34Util(statusWrapper);
 			char buffer[fb::IDecFloat34::STRING_SIZE + 1];
 			decFloat34Util->toString(statusWrapper, &opaqueDecFloat34, static_cast<unsigned>(sizeof(buffer)), buffer);
-			return buffer;
+			result += buffer;
+#endif
+		}
+
+		OpaqueInt128 stringToOpaqueInt128(StatusWrapper* statusWrapper, std::string_view value, int scale)
+		{
+#if FB_CPP_USE_NATIVE_NUMERIC != 0
+			if (const auto opaqueInt128 = stringToInt128(value, scale))
+				return opaqueInt128.value();
+#endif
+			const CString strValue{value};
+			OpaqueInt128 opaqueInt128;
+			client->getInt128Util(statusWrapper)->fromString(statusWrapper, scale, strValue.get(), &opaqueInt128);
+			return opaqueInt128;
+		}
+
+		OpaqueDecFloat16 stringToOpaqueDecFloat16(StatusWrapper* statusWrapper, std::string_view value)
+		{
+#if FB_CPP_USE_NATIVE_NUMERIC != 0
+			if (const auto opaqueDecFloat16 = stringToDecFloat16(value))
+				return opaqueDecFloat16.value();
+#endif
+			const CString strValue{value};
+			OpaqueDecFloat16 opaqueDecFloat16;
+			client->getDecFloat16Util(statusWrapper)->fromString(statusWrapper, strValue.get(), &opaqueDecFloat16);
+			return opaqueDecFloat16;
+		}
+
+		OpaqueDecFloat34 stringToOpaqueDecFloat34(StatusWrapper* statusWrapper, std::string_view value)
+		{
+#if FB_CPP_USE_NATIVE_NUMERIC != 0
+			if (const auto opaqueDecFloat34 = stringToDecFloat34(value))
+				return opaqueDecFloat34.value();
+#endif
+			const CString strValue{value};
+			OpaqueDecFloat34 opaqueDecFloat34;
+			client->getDecFloat34Util(statusWrapper)->fromString(statusWrapper, strValue.get(), &opaqueDecFloat34);
+			return opaqueDecFloat34;
 		}
 
 #if FB_CPP_USE_BOOST_MULTIPRECISION != 0
@@ -401,10 +514,7 @@ namespace fbcpp::impl
 		OpaqueDecFloat16 boostDecFloat16ToOpaqueDecFloat16(
 			StatusWrapper* statusWrapper, const BoostDecFloat16& boostDecFloat16)
 		{
-			const auto decFloat16Util = client->getDecFloat16Util(statusWrapper);
-			OpaqueDecFloat16 opaqueDecFloat16;
-			decFloat16Util->fromString(statusWrapper, boostDecFloat16.str().c_str(), &opaqueDecFloat16);
-			return opaqueDecFloat16;
+			return stringToOpaqueDecFloat16(statusWrapper, boostDecFloat16.str());
 		}
 
 		BoostDecFloat16 opaqueDecFloat16ToBoostDecFloat16(
@@ -416,10 +526,7 @@ namespace fbcpp::impl
 		OpaqueDecFloat34 boostDecFloat34ToOpaqueDecFloat34(
 			StatusWrapper* statusWrapper, const BoostDecFloat34& boostDecFloat34)
 		{
-			const auto decFloat34Util = client->getDecFloat34Util(statusWrapper);
-			OpaqueDecFloat34 opaqueDecFloat34;
-			decFloat34Util->fromString(statusWrapper, boostDecFloat34.str().c_str(), &opaqueDecFloat34);
-			return opaqueDecFloat34;
+			return stringToOpaqueDecFloat34(statusWrapper, boostDecFloat34.str());
 		}
 
 		BoostDecFloat34 opaqueDecFloat34ToBoostDecFloat34(
@@ -429,6 +536,93 @@ namespace fbcpp::impl
 		}
 #endif
 
+		// Parses [-]digits[.digits] keeping every fractional digit that fits, so the result is usually exact and
+		// rescaling rounds once. Digits beyond 19, or beyond what fits in 64 bits, are rounded away half-up.
+		ScaledInt64 stringToScaledInt64(std::string_view value)
+		{
+			const bool isNegative = value.starts_with('-');
+			const auto unsignedPart = isNegative ? value.substr(1) : value;
+			const auto dotPos = unsignedPart.find('.');
+			const auto integralPart = unsignedPart.substr(0, dotPos);
+			const auto fractionalPart =
+				dotPos == std::string_view::npos ? std::string_view{} : unsignedPart.substr(dotPos + 1);
+
+			const auto parseDigits = [](std::string_view digits, std::uint64_t& result)
+			{
+				result = 0u;
+
+				if (digits.empty())
+					return true;
+
+				const auto convResult = std::from_chars(digits.data(), digits.data() + digits.size(), result);
+				return convResult.ec == std::errc{} && convResult.ptr == digits.data() + digits.size();
+			};
+
+			std::uint64_t integralValue = 0u;
+
+			if ((integralPart.empty() && fractionalPart.empty()) || !parseDigits(integralPart, integralValue) ||
+				!std::all_of(fractionalPart.begin(), fractionalPart.end(),
+					[](char c) { return c >= '0' && c <= '9'; }))
+			{
+				throwConversionErrorFromString(std::string{value});
+			}
+
+			const auto limit = isNegative ? std::uint64_t{1} << 63
+										  : static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max());
+
+			// Keeps as many fractional digits as fit, rounding on the first dropped one.
+			auto fractionalDigits = std::min(static_cast<int>(fractionalPart.size()), MaxPowerOfTen<std::uint64_t>);
+
+			for (; fractionalDigits >= 0; --fractionalDigits)
+			{
+				const auto factor = integerPowerOfTen<std::uint64_t>(fractionalDigits);
+				auto roundedIntegral = integralValue;
+				std::uint64_t fractionalValue;
+				parseDigits(fractionalPart.substr(0, static_cast<std::size_t>(fractionalDigits)), fractionalValue);
+
+				if (static_cast<std::size_t>(fractionalDigits) < fractionalPart.size() &&
+					fractionalPart[static_cast<std::size_t>(fractionalDigits)] >= '5' && ++fractionalValue == factor)
+				{
+					fractionalValue = 0u;
+					++roundedIntegral;
+				}
+
+				// Checked without intermediate overflow: a 19-digit fraction may alone exceed the limit.
+				if (roundedIntegral < integralValue || fractionalValue > limit ||
+					roundedIntegral > (limit - fractionalValue) / factor)
+				{
+					continue;
+				}
+
+				const auto magnitude = roundedIntegral * factor + fractionalValue;
+
+				return ScaledInt64{
+					static_cast<std::int64_t>(isNegative ? 0u - magnitude : magnitude),
+					-fractionalDigits,
+				};
+			}
+
+			throwConversionErrorFromString(std::string{value});
+		}
+
+		double stringToDouble(std::string_view value)
+		{
+			double result;
+#if defined(__APPLE__)
+			errno = 0;
+			std::string valueString{value};
+			char* parseEnd = nullptr;
+			result = std::strtod(valueString.c_str(), &parseEnd);
+			if (valueString.empty() || parseEnd != valueString.c_str() + valueString.size() || errno == ERANGE)
+				throwConversionErrorFromString(std::move(valueString));
+#else
+			const auto convResult = std::from_chars(value.data(), value.data() + value.size(), result);
+			if (convResult.ec != std::errc{} || convResult.ptr != value.data() + value.size())
+				throwConversionErrorFromString(std::string{value});
+#endif
+			return result;
+		}
+
 		// FIXME: move
 		std::byte stringToBoolean(std::string_view value)
 		{
@@ -440,28 +634,68 @@ namespace fbcpp::impl
 			while (!trimmed.empty() && std::isspace(static_cast<unsigned char>(trimmed.back())))
 				trimmed.remove_suffix(1);
 
-			std::string normalized{trimmed};
-			std::transform(normalized.begin(), normalized.end(), normalized.begin(),
-				[](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
+			const auto equalsIgnoreCase = [&trimmed](std::string_view expected)
+			{
+				return std::equal(trimmed.begin(), trimmed.end(), expected.begin(), expected.end(),
+					[](unsigned char ch, char expectedCh) { return std::tolower(ch) == expectedCh; });
+			};
 
-			if (normalized == "true")
+			if (equalsIgnoreCase("true"))
 				return std::byte{1};
-			else if (normalized == "false")
+			else if (equalsIgnoreCase("false"))
 				return std::byte{0};
 
 			throwConversionErrorFromString(std::string{value});
 		}
 
 	private:
-		double powerOfTen(int scale) noexcept  // FIXME: only for double?
+		template <typename T>
+		static constexpr std::array<T, MaxPowerOfTen<T> + 1> makeIntegerPowersOfTen()
+		{
+			std::array<T, MaxPowerOfTen<T> + 1> powers{};
+			T power{1};
+
+			for (std::size_t i = 0u; i < powers.size(); ++i)
+			{
+				powers[i] = power;
+
+				if (i + 1u < powers.size())
+					power = static_cast<T>(power * 10);
+			}
+
+			return powers;
+		}
+
+		template <typename T>
+		static const T& integerPowerOfTen(int exponent) noexcept
 		{
-			/* FIXME:
-			BoostDecFloat34 powerOfTenDecInternal(unsigned scale)
+			assert(exponent >= 0 && exponent <= MaxPowerOfTen<T>);
+
+			if constexpr (std::is_integral_v<T>)
+			{
+				static constexpr auto POWERS = makeIntegerPowersOfTen<T>();
+				return POWERS[static_cast<std::size_t>(exponent)];
+			}
+			else
 			{
-			    return boost::multiprecision::pow(BoostDecFloat34{10}, scale);
+				static const auto powers = makeIntegerPowersOfTen<T>();
+				return powers[static_cast<std::size_t>(exponent)];
 			}
-			*/
+		}
 
+		template <typename T>
+		T floatingPowerOfTen(int exponent) noexcept
+		{
+#if FB_CPP_USE_BOOST_MULTIPRECISION != 0
+			if constexpr (std::same_as<T, BoostDecFloat16> || std::same_as<T, BoostDecFloat34>)
+				return boost::multiprecision::pow(T{10}, exponent);
+			else
+#endif
+				return static_cast<T>(powerOfTen(exponent));
+		}
+
+		double powerOfTen(int scale) noexcept
+		{
 			static constexpr double UPPER_PART[] = {
 				1.e000,
 				1.e032,
@@ -523,14 +757,17 @@ namespace fbcpp::impl
 		{
 			if (scale > 0)
 			{
+				// Rounds on the most significant discarded digit. The table reaches 10^MaxPowerOfTen and every
+				// value is below 10^(MaxPowerOfTen + 1), so a larger scale always rounds to zero.
 				int fraction = 0;
 
-				do
+				if (scale <= MaxPowerOfTen<T> + 1)
 				{
-					if (scale == 1)
-						fraction = int(val % 10);
-					val /= 10;
-				} while (--scale);
+					fraction = static_cast<int>((val / integerPowerOfTen<T>(scale - 1)) % 10);
+					val = scale <= MaxPowerOfTen<T> ? static_cast<T>(val / integerPowerOfTen<T>(scale)) : T{0};
+				}
+				else
+					val = T{0};
 
 				if (fraction > 4)
 					++val;
@@ -544,16 +781,18 @@ namespace fbcpp::impl
 			}
 			else if (scale < 0)
 			{
-				do
-				{
-					if ((val > maxLimit / 10) || (val < minLimit / 10))
-						throwNumericOutOfRange();
+				if (val == 0)
+					return;
 
-					val *= 10;
+				if (-scale > MaxPowerOfTen<T>)
+					throwNumericOutOfRange();
+
+				const auto& factor = integerPowerOfTen<T>(-scale);
+
+				if ((val > maxLimit / factor) || (val < minLimit / factor))
+					throwNumericOutOfRange();
 
-					if (val > maxLimit || val < minLimit)
-						throwNumericOutOfRange();
-				} while (++scale);
+				val = static_cast<T>(val * factor);
 			}
 		}
 
@@ -0,0 +1,257 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_OBSERVER_H
+#define FBCPP_OBSERVER_H
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <string_view>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// Operation reported to an OperationObserver.
+	///
+	enum class OperationType : std::uint8_t
+	{
+		///
+		/// Statement preparation (`Statement` constructor).
+		///
+		PREPARE,
+
+		///
+		/// Statement execution, including the fetch of the first row of a result set.
+		///
+		EXECUTE,
+
+		///
+		/// Single-row fetch (`Statement::fetch*`).
+		///
+		FETCH,
+
+		///
+		/// Multi-row fetch of a RowSet window (`RowSet` constructor and `refill()`).
+		///
+		ROW_SET_FETCH,
+
+		///
+		/// Batch execution (`Batch::execute()`).
+		///
+		BATCH_EXECUTE,
+
+		///
+		/// Transaction commit.
+		///
+		COMMIT,
+
+		///
+		/// Transaction commit retaining the context.
+		///
+		COMMIT_RETAINING,
+
+		///
+		/// Transaction rollback.
+		///
+		ROLLBACK,
+
+		///
+		/// Transaction rollback retaining the context.
+		///
+		ROLLBACK_RETAINING,
+
+		///
+		/// Blob read (`Blob::read()` and `Blob::readSegment()`).
+		///
+		BLOB_READ,
+
+		///
+		/// Blob write (`Blob::write()` and `Blob::writeSegment()`).
+		///
+		BLOB_WRITE,
+
+		///
+		/// Failed attempt of `runInTransaction()` that is going to be retried.
+		///
+		TRANSACTION_RETRY,
+
+		///
+		/// Whole `runInTransaction()` call, including the failed attempts and the backoff delays.
+		///
+		RUN_IN_TRANSACTION
+	};
+
+	///
+	/// Completed operation reported to an OperationObserver.
+	///
+	struct OperationEvent final
+	{
+		///
+		/// Operation performed.
+		///
+		OperationType type;
+
+		///
+		/// Elapsed time of the operation, measured with `std::chrono::steady_clock`.
+		///
+		std::chrono::nanoseconds duration;
+
+		///
+		/// SQL text of the statement involved, or empty when the operation is not tied to a statement.
+		/// Only valid during the notification.
+		///
+		std::string_view sql;
+
+		///
+		/// Number of rows fetched (FETCH, ROW_SET_FETCH, EXECUTE of a cursor) or messages executed (BATCH_EXECUTE).
+		///
+		std::uint64_t rows = 0;
+
+		///
+		/// Number of bytes transferred (BLOB_READ, BLOB_WRITE, ROW_SET_FETCH).
+		///
+		std::uint64_t bytes = 0;
+
+		///
+		/// Number of attempts made so far (TRANSACTION_RETRY, RUN_IN_TRANSACTION).
+		///
+		std::uint32_t attempts = 0;
+
+		///
+		/// Exception raised by the operation, or null when it succeeded.
+		///
+		std::exception_ptr error;
+	};
+
+	///
+	/// @brief Receives timing notifications for the operations performed through fb-cpp.
+	///
+	/// An observer is registered with `Client::setObserver()` or `Attachment::setObserver()` and is
+	/// captured by the objects created afterwards (statements, transactions, row sets, batches and blobs).
+	/// It may be invoked concurrently from the threads using those objects. Exceptions thrown by
+	/// `onOperation()` are ignored. When no observer is registered, operations are not timed at all.
+	///
+	class OperationObserver
+	{
+	public:
+		virtual ~OperationObserver() = default;
+
+	public:
+		///
+		/// Called after each observed operation completes or fails.
+		///
+		virtual void onOperation(const OperationEvent& event) = 0;
+	};
+
+	namespace impl
+	{
+		///
+		/// Times an operation and reports it to an observer, doing nothing when the observer is null.
+		///
+		class OperationScope final
+		{
+		public:
+			OperationScope(OperationObserver* observer, OperationType type, std::string_view sql = {}) noexcept
+				: observer{observer},
+				  type{type},
+				  sql{sql}
+			{
+				if (observer) [[unlikely]]
+					start = std::chrono::steady_clock::now();
+			}
+
+			OperationScope(const OperationScope&) = delete;
+			OperationScope& operator=(const OperationScope&) = delete;
+
+		public:
+			///
+			/// Sets the number of attempts reported with the operation.
+			///
+			void setAttempts(std::uint32_t value) noexcept
+			{
+				attempts = value;
+			}
+
+			///
+			/// Reports the successful completion of the operation.
+			///
+			void finish(std::uint64_t rows = 0, std::uint64_t bytes = 0) noexcept
+			{
+				if (observer) [[unlikely]]
+					notify(rows, bytes, nullptr);
+			}
+
+			///
+			/// Reports the failure of the operation. Must be called from a catch handler.
+			///
+			void fail() noexcept
+			{
+				if (observer) [[unlikely]]
+					notify(0, 0, std::current_exception());
+			}
+
+		private:
+			void notify(std::uint64_t rows, std::uint64_t bytes, std::exception_ptr error) noexcept
+			{
+				const OperationEvent event{
+					.type = type,
+					.duration = std::chrono::steady_clock::now() - start,
+					.sql = sql,
+					.rows = rows,
+					.bytes = bytes,
+					.attempts = attempts,
+					.error = std::move(error),
+				};
+
+				try
+				{
+					observer->onOperation(event);
+				}
+				catch (...)
+				{
+					// swallow
+				}
+
+				observer = nullptr;
+			}
+
+		private:
+			OperationObserver* observer;
+			OperationType type;
+			std::string_view sql;
+			std::uint32_t attempts = 0;
+			std::chrono::steady_clock::time_point start;
+		};
+	}  // namespace impl
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_OBSERVER_H
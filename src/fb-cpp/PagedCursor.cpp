@@ -0,0 +1,239 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "PagedCursor.h"
+#include "Statement.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+PagedCursor::PagedCursor(Statement& statement, unsigned pageSize, unsigned maxPages, unsigned prefetchPages)
+	: statement{statement},
+	  pageSize{pageSize},
+	  maxPages{maxPages},
+	  prefetchPages{prefetchPages}
+{
+	assert(statement.isValid());
+	assert(statement.getResultSetHandle());
+
+	if (statement.getCursorType() != CursorType::SCROLLABLE)
+		throw std::invalid_argument{"PagedCursor requires a statement with a scrollable cursor"};
+
+	if (pageSize == 0)
+		throw std::invalid_argument{"PagedCursor pageSize must be greater than zero"};
+
+	if (maxPages <= prefetchPages)
+		throw std::invalid_argument{"PagedCursor maxPages must be greater than prefetchPages"};
+
+	pagesByNumber.reserve(maxPages);
+}
+
+bool PagedCursor::fetchLast()
+{
+	if (!rowCount.has_value())
+	{
+		// Exponential then binary search of the first missing page, probing its first row.
+		std::optional<unsigned> lowPage;
+
+		for (const auto& page : pages)
+			lowPage = std::max(lowPage.value_or(0), page.number);
+
+		if (!lowPage.has_value() && getPage(0))
+			lowPage = 0;
+
+		if (!rowCount.has_value())
+		{
+			assert(lowPage.has_value());
+
+			auto low = lowPage.value();
+			auto high = low;
+
+			for (unsigned step = 1; !rowCount.has_value(); step *= 2)
+			{
+				high = low + step;
+
+				if (!pageExists(high))
+					break;
+
+				low = high;
+			}
+
+			while (!rowCount.has_value() && high - low > 1)
+			{
+				const auto middle = low + (high - low) / 2;
+
+				if (pageExists(middle))
+					low = middle;
+				else
+					high = middle;
+			}
+
+			if (!rowCount.has_value())
+			{
+				if (const auto lastPage = getPage(low); lastPage && !rowCount.has_value())
+					rowCount = low * pageSize + lastPage->getCount();
+			}
+		}
+	}
+
+	return moveTo(rowCount.value_or(0), -1);
+}
+
+bool PagedCursor::moveTo(std::int64_t target, int direction)
+{
+	currentPage = nullptr;
+
+	if (target < 1)
+	{
+		position = 0;
+		return false;
+	}
+
+	if (rowCount.has_value() && target > static_cast<std::int64_t>(rowCount.value()))
+	{
+		position = rowCount.value() + 1;
+		return false;
+	}
+
+	const auto rowPosition = static_cast<unsigned>(
+		std::min<std::int64_t>(target, static_cast<std::int64_t>(std::numeric_limits<int>::max())));
+	const auto number = (rowPosition - 1) / pageSize;
+	const auto index = (rowPosition - 1) % pageSize;
+	const auto page = getPage(number);
+
+	if (!page || index >= page->getCount())
+	{
+		position = rowCount.has_value() ? rowCount.value() + 1 : rowPosition;
+		return false;
+	}
+
+	position = rowPosition;
+	currentPage = page;
+	currentIndex = index;
+
+	for (unsigned i = 1; i <= prefetchPages; ++i)
+	{
+		if (direction < 0 && number < i)
+			break;
+
+		const auto neighbour = direction < 0 ? number - i : number + i;
+
+		if (rowCount.has_value() && static_cast<std::uint64_t>(neighbour) * pageSize >= rowCount.value())
+			break;
+
+		if (!pagesByNumber.contains(neighbour) && !loadPage(neighbour))
+			break;
+	}
+
+	return true;
+}
+
+RowSet* PagedCursor::getPage(unsigned number)
+{
+	if (const auto it = pagesByNumber.find(number); it != pagesByNumber.end())
+	{
+		pages.splice(pages.begin(), pages, it->second);
+		return it->second->rows.get();
+	}
+
+	return loadPage(number);
+}
+
+RowSet* PagedCursor::loadPage(unsigned number)
+{
+	const auto first = static_cast<std::uint64_t>(number) * pageSize + 1;
+
+	if ((rowCount.has_value() && first > rowCount.value()) || first > std::numeric_limits<int>::max())
+		return nullptr;
+
+	++pageLoadCount;
+
+	// Fetch into a spare RowSet first, so a page is evicted only to cache a non-empty one.
+	auto rows = std::move(spare);
+
+	if (rows)
+		rows->refillAt(statement, static_cast<unsigned>(first));
+	else
+		rows = std::make_unique<RowSet>(statement, pageSize, static_cast<unsigned>(first));
+
+	const auto count = rows->getCount();
+
+	if (count == 0)
+	{
+		if (number == 0)
+			rowCount = 0;
+		else if (const auto previous = pagesByNumber.find(number - 1);
+				 previous != pagesByNumber.end() && previous->second->rows->getCount() == pageSize)
+		{
+			rowCount = number * pageSize;
+		}
+
+		spare = std::move(rows);
+		return nullptr;
+	}
+
+	if (count < pageSize)
+		rowCount = static_cast<unsigned>(first) - 1 + count;
+
+	if (pages.size() >= maxPages)
+	{
+		auto& victim = pages.back();
+		pagesByNumber.erase(victim.number);
+		spare = std::move(victim.rows);
+		pages.pop_back();
+	}
+
+	pages.push_front(Page{number, std::move(rows)});
+	pagesByNumber[number] = pages.begin();
+
+	return pages.front().rows.get();
+}
+
+bool PagedCursor::pageExists(unsigned number)
+{
+	const auto first = static_cast<std::uint64_t>(number) * pageSize + 1;
+
+	if (first > std::numeric_limits<int>::max())
+		return false;
+
+	if (pagesByNumber.contains(number))
+		return true;
+
+	if (!statement.fetchAbsolute(static_cast<unsigned>(first)))
+	{
+		if (number == 0)
+			rowCount = 0;
+
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,210 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef FBCPP_PAGED_CURSOR_H
+#define FBCPP_PAGED_CURSOR_H
+
+#include "RowSet.h"
+#include "Row.h"
+#include <cassert>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	class Statement;
+
+	///
+	/// @brief Caches fixed-size pages of a scrollable cursor to answer random positioning locally.
+	///
+	/// Rows `page * pageSize + 1` to `(page + 1) * pageSize` form a page, fetched with one `fetchAbsolute()`
+	/// followed by `fetchNext()` calls into a RowSet. At most `maxPages` pages are kept, the least recently
+	/// used being evicted, and its buffer reused, when another page is loaded. After each move, the next
+	/// `prefetchPages` pages in the scroll direction are loaded unless already cached, so scrolling on hits
+	/// the cache.
+	///
+	/// Positions are 1-based, as in `Statement::fetchAbsolute()`; position 0 is before the first row. The
+	/// row already fetched by `Statement::execute()` is not used. The statement must have been prepared
+	/// with CursorType::SCROLLABLE and must not be used by the caller while the cursor exists.
+	///
+	class PagedCursor final
+	{
+	public:
+		///
+		/// @brief Creates an empty cache over the current result set of `statement`.
+		/// @param statement The statement with an open scrollable result set.
+		/// @param pageSize Number of rows per page.
+		/// @param maxPages Maximum number of cached pages. Must be greater than `prefetchPages`.
+		/// @param prefetchPages Number of pages loaded ahead in the scroll direction.
+		///
+		explicit PagedCursor(
+			Statement& statement, unsigned pageSize, unsigned maxPages = 8, unsigned prefetchPages = 1);
+
+		PagedCursor(const PagedCursor&) = delete;
+		PagedCursor& operator=(const PagedCursor&) = delete;
+
+		PagedCursor(PagedCursor&&) = delete;
+		PagedCursor& operator=(PagedCursor&&) = delete;
+
+	public:
+		///
+		/// @name Cursor movement
+		/// @{
+
+		///
+		/// @brief Moves to the next row.
+		///
+		bool fetchNext()
+		{
+			return moveTo(static_cast<std::int64_t>(position) + 1, 1);
+		}
+
+		///
+		/// @brief Moves to the previous row.
+		///
+		bool fetchPrior()
+		{
+			return moveTo(static_cast<std::int64_t>(position) - 1, -1);
+		}
+
+		///
+		/// @brief Moves to the first row.
+		///
+		bool fetchFirst()
+		{
+			return moveTo(1, 1);
+		}
+
+		///
+		/// @brief Moves to the last row.
+		///
+		/// The first call determines the row count with a search of `fetchAbsolute()` probes, taking a number of
+		/// round trips logarithmic in the number of pages.
+		///
+		bool fetchLast();
+
+		///
+		/// @brief Moves to the given absolute row number.
+		///
+		bool fetchAbsolute(unsigned newPosition)
+		{
+			return moveTo(newPosition, newPosition >= position ? 1 : -1);
+		}
+
+		///
+		/// @brief Moves by the requested relative offset.
+		///
+		bool fetchRelative(int offset)
+		{
+			return moveTo(static_cast<std::int64_t>(position) + offset, offset >= 0 ? 1 : -1);
+		}
+
+		///
+		/// @}
+		///
+
+		///
+		/// @brief Returns the current position. It is 0 before the first row and past the last row after the end
+		/// was reached.
+		///
+		unsigned getPosition() const noexcept
+		{
+			return position;
+		}
+
+		///
+		/// @brief Returns whether the cursor is on a row.
+		///
+		bool hasRow() const noexcept
+		{
+			return currentPage != nullptr;
+		}
+
+		///
+		/// @brief Returns the current row.
+		///
+		/// The row stays valid until the next cursor movement.
+		///
+		Row getRow()
+		{
+			assert(currentPage);
+			return currentPage->getRow(currentIndex);
+		}
+
+		///
+		/// @brief Returns the number of rows of the result set, once it is known.
+		///
+		std::optional<unsigned> getRowCount() const noexcept
+		{
+			return rowCount;
+		}
+
+		///
+		/// @brief Returns the number of page fetches done so far, including prefetches.
+		///
+		unsigned getPageLoadCount() const noexcept
+		{
+			return pageLoadCount;
+		}
+
+	private:
+		struct Page final
+		{
+			unsigned number;
+			std::unique_ptr<RowSet> rows;
+		};
+
+	private:
+		bool moveTo(std::int64_t target, int direction);
+		RowSet* getPage(unsigned number);
+		RowSet* loadPage(unsigned number);
+		bool pageExists(unsigned number);
+
+	private:
+		Statement& statement;
+		unsigned pageSize;
+		unsigned maxPages;
+		unsigned prefetchPages;
+		std::list<Page> pages;  // Most recently used first.
+		std::unordered_map<unsigned, std::list<Page>::iterator> pagesByNumber;
+		std::unique_ptr<RowSet> spare;
+		std::optional<unsigned> rowCount;
+		unsigned position = 0;
+		RowSet* currentPage = nullptr;
+		unsigned currentIndex = 0;
+		unsigned pageLoadCount = 0;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_PAGED_CURSOR_H
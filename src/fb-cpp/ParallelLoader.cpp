@@ -0,0 +1,202 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "ParallelLoader.h"
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+void ParallelLoader::Worker::flush()
+{
+	if (rowIndices.empty())
+		return;
+
+	auto completionState = batch.execute();
+
+	++stats.batches;
+	stats.rows += rowIndices.size();
+
+	for (auto pos = completionState.findError(0); pos.has_value(); pos = completionState.findError(pos.value() + 1))
+	{
+		errors.push_back({rowIndices[pos.value()], completionState.getStatus(pos.value())});
+		++stats.failedRows;
+	}
+
+	rowIndices.clear();
+}
+
+
+ParallelLoader::ParallelLoader(AttachmentPool& pool, std::string uri, AttachmentOptions attachmentOptions,
+	std::string sql, const ParallelLoaderOptions& options)
+	: pool{pool},
+	  uri{std::move(uri)},
+	  attachmentOptions{std::move(attachmentOptions)},
+	  sql{std::move(sql)},
+	  options{options}
+{
+	if (options.getWorkerCount() == 0)
+		throw std::invalid_argument{"ParallelLoader workerCount must be greater than zero"};
+
+	if (options.getBatchSize() == 0)
+		throw std::invalid_argument{"ParallelLoader batchSize must be greater than zero"};
+}
+
+ParallelLoaderResult ParallelLoader::load(const RowSource& source)
+{
+	std::mutex sourceMutex;
+	std::uint64_t nextIndex = 0;
+	bool exhausted = false;
+	const auto batchSize = options.getBatchSize();
+
+	return run(
+		[&](Worker& worker, unsigned, unsigned)
+		{
+			while (!worker.isStopping())
+			{
+				unsigned queued = 0;
+
+				for (; queued < batchSize; ++queued)
+				{
+					std::uint64_t index;
+
+					{  // scope
+						std::lock_guard mutexGuard{sourceMutex};
+
+						if (exhausted || !source(worker.getStatement()))
+						{
+							exhausted = true;
+							break;
+						}
+
+						index = nextIndex++;
+					}
+
+					worker.getBatch().addMessage();
+					worker.enqueue(index, 1);
+				}
+
+				worker.flush();
+
+				if (queued < batchSize)
+					break;
+			}
+		});
+}
+
+ParallelLoaderResult ParallelLoader::run(const WorkerBody& body)
+{
+	const auto workerCount = options.getWorkerCount();
+
+	ParallelLoaderResult result;
+	result.workers.resize(workerCount);
+
+	std::vector<std::vector<ParallelLoaderError>> workerErrors(workerCount);
+	std::atomic_bool stopping = false;
+	std::exception_ptr failure;
+	std::mutex failureMutex;
+
+	std::vector<std::thread> threads;
+	threads.reserve(workerCount);
+
+	// The workers reference locals of this frame, so the ones already started are joined if a spawn fails.
+	try
+	{
+		for (unsigned workerIndex = 0u; workerIndex < workerCount; ++workerIndex)
+		{
+			threads.emplace_back(
+				[&, workerIndex]
+				{
+					auto& stats = result.workers[workerIndex];
+					const auto start = std::chrono::steady_clock::now();
+
+					try
+					{
+						auto lease = pool.acquire(uri, attachmentOptions);
+						Transaction transaction{*lease, options.getTransactionOptions()};
+						Statement statement{*lease, transaction, sql};
+						Batch batch{statement, transaction, options.getBatchOptions()};
+						Worker worker{statement, batch, stats, workerErrors[workerIndex], stopping};
+
+						body(worker, workerIndex, workerCount);
+
+						batch.close();
+
+						if (stopping)
+							transaction.rollback();
+						else
+							transaction.commit();
+					}
+					catch (...)
+					{
+						stopping = true;
+
+						std::lock_guard mutexGuard{failureMutex};
+
+						if (!failure)
+							failure = std::current_exception();
+					}
+
+					stats.elapsed = std::chrono::steady_clock::now() - start;
+				});
+		}
+	}
+	catch (...)
+	{
+		stopping = true;
+
+		for (auto& thread : threads)
+			thread.join();
+
+		throw;
+	}
+
+	for (auto& thread : threads)
+		thread.join();
+
+	if (failure)
+		std::rethrow_exception(failure);
+
+	for (unsigned workerIndex = 0u; workerIndex < workerCount; ++workerIndex)
+	{
+		const auto& stats = result.workers[workerIndex];
+		result.rows += stats.rows;
+		result.failedRows += stats.failedRows;
+
+		auto& errors = workerErrors[workerIndex];
+		result.errors.insert(
+			result.errors.end(), std::make_move_iterator(errors.begin()), std::make_move_iterator(errors.end()));
+	}
+
+	std::sort(result.errors.begin(), result.errors.end(),
+		[](const ParallelLoaderError& a, const ParallelLoaderError& b) { return a.index < b.index; });
+
+	return result;
+}
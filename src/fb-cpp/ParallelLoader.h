@@ -0,0 +1,343 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_PARALLEL_LOADER_H
+#define FBCPP_PARALLEL_LOADER_H
+
+#include "Attachment.h"
+#include "AttachmentPool.h"
+#include "Batch.h"
+#include "Statement.h"
+#include "StructBinding.h"
+#include "Transaction.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <vector>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// Represents options used when creating a ParallelLoader object.
+	///
+	class ParallelLoaderOptions final
+	{
+	public:
+		///
+		/// Returns the number of worker threads, each with its own attachment and transaction.
+		///
+		unsigned getWorkerCount() const
+		{
+			return workerCount;
+		}
+
+		///
+		/// Sets the number of worker threads.
+		///
+		ParallelLoaderOptions& setWorkerCount(unsigned value)
+		{
+			workerCount = value;
+			return *this;
+		}
+
+		///
+		/// Returns the number of rows each worker sends per batch execution.
+		///
+		unsigned getBatchSize() const
+		{
+			return batchSize;
+		}
+
+		///
+		/// Sets the number of rows each worker sends per batch execution.
+		///
+		ParallelLoaderOptions& setBatchSize(unsigned value)
+		{
+			batchSize = value;
+			return *this;
+		}
+
+		///
+		/// Returns the options of the batch created by each worker.
+		///
+		const BatchOptions& getBatchOptions() const
+		{
+			return batchOptions;
+		}
+
+		///
+		/// Sets the options of the batch created by each worker.
+		///
+		ParallelLoaderOptions& setBatchOptions(const BatchOptions& value)
+		{
+			batchOptions = value;
+			return *this;
+		}
+
+		///
+		/// Returns the options of the transaction started by each worker.
+		///
+		const TransactionOptions& getTransactionOptions() const
+		{
+			return transactionOptions;
+		}
+
+		///
+		/// Sets the options of the transaction started by each worker.
+		///
+		ParallelLoaderOptions& setTransactionOptions(const TransactionOptions& value)
+		{
+			transactionOptions = value;
+			return *this;
+		}
+
+	private:
+		unsigned workerCount = 4;
+		unsigned batchSize = 1000;
+		BatchOptions batchOptions = BatchOptions().setMultiError(true);
+		TransactionOptions transactionOptions;
+	};
+
+	///
+	/// Throughput numbers of one ParallelLoader worker.
+	///
+	struct ParallelLoaderWorkerStats final
+	{
+		///
+		/// Number of rows sent by the worker.
+		///
+		std::uint64_t rows = 0;
+
+		///
+		/// Number of rows reported as failed by the server.
+		///
+		std::uint64_t failedRows = 0;
+
+		///
+		/// Number of batch executions.
+		///
+		unsigned batches = 0;
+
+		///
+		/// Wall-clock time from attaching to committing.
+		///
+		std::chrono::nanoseconds elapsed{};
+
+		///
+		/// Returns the number of rows sent per second.
+		///
+		double getRowsPerSecond() const noexcept
+		{
+			const auto seconds = std::chrono::duration<double>(elapsed).count();
+			return seconds > 0 ? static_cast<double>(rows) / seconds : 0.0;
+		}
+	};
+
+	///
+	/// Error reported by the server for one input row of a ParallelLoader.
+	///
+	struct ParallelLoaderError final
+	{
+		///
+		/// Zero-based index of the row in the input.
+		///
+		std::uint64_t index;
+
+		///
+		/// Detailed status vector, in `IStatus::getErrors()` format. May be empty when the batch
+		/// ran out of detailed error slots.
+		///
+		std::vector<std::intptr_t> status;
+	};
+
+	///
+	/// Aggregated outcome of a ParallelLoader run.
+	///
+	struct ParallelLoaderResult final
+	{
+		///
+		/// Total number of rows sent.
+		///
+		std::uint64_t rows = 0;
+
+		///
+		/// Total number of rows reported as failed.
+		///
+		std::uint64_t failedRows = 0;
+
+		///
+		/// Per-row errors of all workers, ordered by input row index.
+		///
+		std::vector<ParallelLoaderError> errors;
+
+		///
+		/// Per-worker statistics, indexed by worker number.
+		///
+		std::vector<ParallelLoaderWorkerStats> workers;
+	};
+
+	///
+	/// @brief Loads rows through several attachments in parallel, each worker running its own Batch.
+	///
+	/// Each worker thread leases an attachment from an AttachmentPool, starts its own transaction,
+	/// prepares the SQL text and executes batches of `getBatchSize()` rows. Workers commit their
+	/// transactions independently when their share of the input is done. If a worker throws, the
+	/// other workers stop and roll back what they have not committed yet, and the exception is
+	/// rethrown by `load()`.
+	///
+	class ParallelLoader final
+	{
+	public:
+		///
+		/// Function filling the parameters of the worker statement with the next input row.
+		/// Returns false when the input is exhausted. Calls are serialized by the loader.
+		///
+		using RowSource = std::function<bool(Statement& statement)>;
+
+	private:
+		class Worker final
+		{
+		public:
+			Worker(Statement& statement, Batch& batch, ParallelLoaderWorkerStats& stats,
+				std::vector<ParallelLoaderError>& errors, const std::atomic_bool& stopping) noexcept
+				: statement{statement},
+				  batch{batch},
+				  stats{stats},
+				  errors{errors},
+				  stopping{stopping}
+			{
+			}
+
+		public:
+			Statement& getStatement() noexcept
+			{
+				return statement;
+			}
+
+			Batch& getBatch() noexcept
+			{
+				return batch;
+			}
+
+			bool isStopping() const noexcept
+			{
+				return stopping.load(std::memory_order_relaxed);
+			}
+
+			void enqueue(std::uint64_t firstIndex, std::size_t count)
+			{
+				for (std::size_t i = 0; i < count; ++i)
+					rowIndices.push_back(firstIndex + i);
+			}
+
+			void flush();
+
+		private:
+			Statement& statement;
+			Batch& batch;
+			ParallelLoaderWorkerStats& stats;
+			std::vector<ParallelLoaderError>& errors;
+			const std::atomic_bool& stopping;
+			std::vector<std::uint64_t> rowIndices;
+		};
+
+		using WorkerBody = std::function<void(Worker& worker, unsigned workerIndex, unsigned workerCount)>;
+
+	public:
+		///
+		/// Creates a loader executing `sql` through attachments leased from `pool`.
+		///
+		explicit ParallelLoader(AttachmentPool& pool, std::string uri, AttachmentOptions attachmentOptions,
+			std::string sql, const ParallelLoaderOptions& options = {});
+
+		ParallelLoader(const ParallelLoader&) = delete;
+		ParallelLoader& operator=(const ParallelLoader&) = delete;
+
+	public:
+		///
+		/// Loads rows pulled from `source` until it returns false.
+		///
+		ParallelLoaderResult load(const RowSource& source);
+
+		///
+		/// Loads a span of aggregate or tuple-like records, splitting it in one contiguous part
+		/// per worker. Each batch is encoded with `Batch::addRange()`.
+		///
+		template <typename T>
+			requires(Aggregate<T> || TupleLike<T>)
+		ParallelLoaderResult load(std::span<const T> rows)
+		{
+			const std::size_t batchSize = options.getBatchSize();
+
+			return run(
+				[rows, batchSize](Worker& worker, unsigned workerIndex, unsigned workerCount)
+				{
+					const auto begin = rows.size() * workerIndex / workerCount;
+					const auto end = rows.size() * (workerIndex + 1) / workerCount;
+
+					for (auto pos = begin; pos < end && !worker.isStopping(); pos += batchSize)
+					{
+						const auto count = std::min(batchSize, end - pos);
+
+						worker.getBatch().addRange(rows.subspan(pos, count));
+						worker.enqueue(pos, count);
+						worker.flush();
+					}
+				});
+		}
+
+		///
+		/// Convenience overload of `load()` for mutable spans.
+		///
+		template <typename T>
+			requires(Aggregate<T> || TupleLike<T>)
+		ParallelLoaderResult load(std::span<T> rows)
+		{
+			return load(std::span<const T>{rows});
+		}
+
+	private:
+		ParallelLoaderResult run(const WorkerBody& body);
+
+	private:
+		AttachmentPool& pool;
+		std::string uri;
+		AttachmentOptions attachmentOptions;
+		std::string sql;
+		ParallelLoaderOptions options;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_PARALLEL_LOADER_H
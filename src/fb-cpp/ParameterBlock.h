@@ -0,0 +1,136 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_PARAMETER_BLOCK_H
+#define FBCPP_PARAMETER_BLOCK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// Kind of a ParameterBlock, which must match the object it is passed to.
+	///
+	enum class ParameterBlockType
+	{
+		///
+		/// Database parameter block, used by Attachment.
+		///
+		DPB,
+
+		///
+		/// Transaction parameter block, used by Transaction.
+		///
+		TPB,
+
+		///
+		/// Blob parameter block, used by Blob and Batch blobs.
+		///
+		BPB,
+
+		///
+		/// Batch parameter block, used by Batch.
+		///
+		BATCH
+	};
+
+	///
+	/// Immutable, already encoded parameter block, as returned by the `compile()` method of the options classes.
+	/// Compiling options once and passing the block to the constructors avoids the `IXpbBuilder` work of every
+	/// object creation. Copies share the same bytes, so a ParameterBlock may be kept in a static and used from
+	/// several threads.
+	///
+	class ParameterBlock final
+	{
+	public:
+		///
+		/// Constructs a ParameterBlock of the specified type holding the already encoded bytes.
+		///
+		explicit ParameterBlock(ParameterBlockType type, std::vector<std::uint8_t> bytes)
+			: type{type},
+			  bytes{std::make_shared<const std::vector<std::uint8_t>>(std::move(bytes))}
+		{
+		}
+
+	public:
+		///
+		/// Returns the type of the block.
+		///
+		ParameterBlockType getType() const noexcept
+		{
+			return type;
+		}
+
+		///
+		/// Returns the encoded bytes.
+		///
+		std::span<const std::uint8_t> getBytes() const noexcept
+		{
+			return *bytes;
+		}
+
+		///
+		/// Returns a pointer to the encoded bytes.
+		///
+		const std::uint8_t* getData() const noexcept
+		{
+			return bytes->data();
+		}
+
+		///
+		/// Returns the number of encoded bytes.
+		///
+		unsigned getLength() const noexcept
+		{
+			return static_cast<unsigned>(bytes->size());
+		}
+
+		///
+		/// Throws std::invalid_argument when the block is not of the expected type.
+		///
+		void checkType(ParameterBlockType expected) const
+		{
+			if (type != expected)
+				throw std::invalid_argument{"ParameterBlock type does not match its use"};
+		}
+
+	private:
+		ParameterBlockType type;
+		std::shared_ptr<const std::vector<std::uint8_t>> bytes;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_PARAMETER_BLOCK_H
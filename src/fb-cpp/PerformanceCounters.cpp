@@ -0,0 +1,340 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "PerformanceCounters.h"
+#include "Attachment.h"
+#include "Client.h"
+#include "Exception.h"
+#include <cstddef>
+#include <span>
+#include <vector>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+namespace
+{
+	constexpr std::size_t INITIAL_INFO_BUFFER_SIZE = 1024u;
+	constexpr std::size_t MAX_INFO_BUFFER_SIZE = 16u * 1024u * 1024u;
+
+	std::uint64_t readInteger(std::span<const std::uint8_t> data) noexcept
+	{
+		std::uint64_t result = 0u;
+
+		for (std::size_t i = 0u; i < data.size() && i < sizeof(result); ++i)
+			result |= static_cast<std::uint64_t>(data[i]) << (8u * i);
+
+		return result;
+	}
+
+	// Calls `consumer(item, value)` for each item of an info response. Returns false when the response was
+	// truncated, so the caller can retry with a bigger buffer.
+	template <typename F>
+	bool parseInfo(const char* caller, std::span<const std::uint8_t> buffer, F&& consumer)
+	{
+		auto ptr = buffer.data();
+		const auto end = ptr + buffer.size();
+
+		while (ptr < end)
+		{
+			const auto item = *ptr++;
+
+			if (item == isc_info_end)
+				return true;
+
+			if (item == isc_info_truncated)
+				return false;
+
+			if (item == isc_info_error)
+				throw FbCppException(std::string{caller} + " error response");
+
+			if (ptr + 2 > end)
+				throw FbCppException(std::string{caller} + " malformed response");
+
+			const auto itemLength = static_cast<std::uint16_t>(ptr[0] | (ptr[1] << 8));
+			ptr += 2;
+
+			if (ptr + itemLength > end)
+				throw FbCppException(std::string{caller} + " invalid length");
+
+			consumer(item, std::span{ptr, itemLength});
+			ptr += itemLength;
+		}
+
+		return false;
+	}
+
+	// Repeats `getInfo(buffer)` with bigger buffers until `parse(buffer)` accepts the response.
+	template <typename GetInfo, typename Parse>
+	void queryInfo(const char* caller, GetInfo&& getInfo, Parse&& parse)
+	{
+		std::vector<std::uint8_t> buffer(INITIAL_INFO_BUFFER_SIZE);
+
+		while (true)
+		{
+			getInfo(buffer);
+
+			if (parse(std::span<const std::uint8_t>{buffer}))
+				return;
+
+			if (buffer.size() >= MAX_INFO_BUFFER_SIZE)
+				throw FbCppException(std::string{caller} + " truncated response");
+
+			buffer.assign(buffer.size() * 2u, 0u);
+		}
+	}
+
+	std::uint64_t TableCounters::*getTableCounter(std::uint8_t item) noexcept
+	{
+		switch (item)
+		{
+			case isc_info_read_seq_count:
+				return &TableCounters::sequentialReads;
+
+			case isc_info_read_idx_count:
+				return &TableCounters::indexedReads;
+
+			case isc_info_insert_count:
+				return &TableCounters::inserts;
+
+			case isc_info_update_count:
+				return &TableCounters::updates;
+
+			case isc_info_delete_count:
+				return &TableCounters::deletes;
+
+			case isc_info_backout_count:
+				return &TableCounters::backouts;
+
+			case isc_info_purge_count:
+				return &TableCounters::purges;
+
+			case isc_info_expunge_count:
+				return &TableCounters::expunges;
+
+			default:
+				return nullptr;
+		}
+	}
+
+	std::uint64_t subtract(std::uint64_t later, std::uint64_t earlier) noexcept
+	{
+		return later > earlier ? later - earlier : 0u;
+	}
+}  // namespace
+
+
+PerformanceCounters fbcpp::operator-(const PerformanceCounters& later, const PerformanceCounters& earlier)
+{
+	PerformanceCounters result;
+	result.pageReads = subtract(later.pageReads, earlier.pageReads);
+	result.pageWrites = subtract(later.pageWrites, earlier.pageWrites);
+	result.pageFetches = subtract(later.pageFetches, earlier.pageFetches);
+	result.pageMarks = subtract(later.pageMarks, earlier.pageMarks);
+	result.currentMemory = later.currentMemory;
+	result.maxMemory = later.maxMemory;
+
+	for (const auto& [relationId, counters] : later.tables)
+	{
+		const auto previous = earlier.tables.find(relationId);
+		const auto base = previous == earlier.tables.end() ? TableCounters{} : previous->second;
+
+		const TableCounters delta{
+			.sequentialReads = subtract(counters.sequentialReads, base.sequentialReads),
+			.indexedReads = subtract(counters.indexedReads, base.indexedReads),
+			.inserts = subtract(counters.inserts, base.inserts),
+			.updates = subtract(counters.updates, base.updates),
+			.deletes = subtract(counters.deletes, base.deletes),
+			.backouts = subtract(counters.backouts, base.backouts),
+			.purges = subtract(counters.purges, base.purges),
+			.expunges = subtract(counters.expunges, base.expunges),
+		};
+
+		if (delta != TableCounters{})
+			result.tables.emplace(relationId, delta);
+	}
+
+	return result;
+}
+
+
+PerformanceSnapshot::PerformanceSnapshot(Attachment& attachment)
+	: attachment{attachment},
+	  start{attachment.getPerformanceCounters()}
+{
+}
+
+PerformanceCounters PerformanceSnapshot::getDelta()
+{
+	return attachment.getPerformanceCounters() - start;
+}
+
+void PerformanceSnapshot::reset()
+{
+	start = attachment.getPerformanceCounters();
+}
+
+
+ExecutionStats impl::queryExecutionStats(Client& client, fb::IStatement* statement)
+{
+	static constexpr std::uint8_t ITEMS[] = {isc_info_sql_records};
+	static constexpr auto CALLER = "Statement::getExecutionStats";
+
+	StatusWrapper statusWrapper{client};
+	ExecutionStats stats;
+
+	queryInfo(
+		CALLER,
+		[&](std::vector<std::uint8_t>& buffer)
+		{
+			statement->getInfo(&statusWrapper, sizeof(ITEMS), ITEMS, static_cast<unsigned>(buffer.size()),
+				buffer.data());
+		},
+		[&](std::span<const std::uint8_t> buffer)
+		{
+			return parseInfo(CALLER, buffer,
+				[&](std::uint8_t item, std::span<const std::uint8_t> value)
+				{
+					if (item != isc_info_sql_records)
+						return;
+
+					// The record counts are nested items, with their own terminator.
+					parseInfo(CALLER, value,
+						[&](std::uint8_t countItem, std::span<const std::uint8_t> count)
+						{
+							switch (countItem)
+							{
+								case isc_info_req_select_count:
+									stats.selectedRecords = readInteger(count);
+									break;
+
+								case isc_info_req_insert_count:
+									stats.insertedRecords = readInteger(count);
+									break;
+
+								case isc_info_req_update_count:
+									stats.updatedRecords = readInteger(count);
+									break;
+
+								case isc_info_req_delete_count:
+									stats.deletedRecords = readInteger(count);
+									break;
+
+								default:
+									break;
+							}
+						});
+				});
+		});
+
+	return stats;
+}
+
+PerformanceCounters impl::queryPerformanceCounters(Client& client, fb::IAttachment* attachment)
+{
+	static constexpr std::uint8_t ITEMS[] = {
+		isc_info_reads,
+		isc_info_writes,
+		isc_info_fetches,
+		isc_info_marks,
+		isc_info_current_memory,
+		isc_info_max_memory,
+		isc_info_read_seq_count,
+		isc_info_read_idx_count,
+		isc_info_insert_count,
+		isc_info_update_count,
+		isc_info_delete_count,
+		isc_info_backout_count,
+		isc_info_purge_count,
+		isc_info_expunge_count,
+	};
+	static constexpr auto CALLER = "Attachment::getPerformanceCounters";
+	// Per-table entries: a 2-byte relation ID followed by a 4-byte count.
+	static constexpr std::size_t TABLE_ENTRY_SIZE = 6u;
+
+	StatusWrapper statusWrapper{client};
+	PerformanceCounters counters;
+
+	queryInfo(
+		CALLER,
+		[&](std::vector<std::uint8_t>& buffer)
+		{
+			attachment->getInfo(&statusWrapper, sizeof(ITEMS), ITEMS, static_cast<unsigned>(buffer.size()),
+				buffer.data());
+		},
+		[&](std::span<const std::uint8_t> buffer)
+		{
+			counters = {};
+
+			return parseInfo(CALLER, buffer,
+				[&](std::uint8_t item, std::span<const std::uint8_t> value)
+				{
+					switch (item)
+					{
+						case isc_info_reads:
+							counters.pageReads = readInteger(value);
+							return;
+
+						case isc_info_writes:
+							counters.pageWrites = readInteger(value);
+							return;
+
+						case isc_info_fetches:
+							counters.pageFetches = readInteger(value);
+							return;
+
+						case isc_info_marks:
+							counters.pageMarks = readInteger(value);
+							return;
+
+						case isc_info_current_memory:
+							counters.currentMemory = readInteger(value);
+							return;
+
+						case isc_info_max_memory:
+							counters.maxMemory = readInteger(value);
+							return;
+
+						default:
+							break;
+					}
+
+					const auto member = getTableCounter(item);
+
+					if (!member)
+						return;
+
+					for (std::size_t pos = 0u; pos + TABLE_ENTRY_SIZE <= value.size(); pos += TABLE_ENTRY_SIZE)
+					{
+						const auto relationId = static_cast<unsigned>(readInteger(value.subspan(pos, 2u)));
+						counters.tables[relationId].*member = readInteger(value.subspan(pos + 2u, 4u));
+					}
+				});
+		});
+
+	return counters;
+}
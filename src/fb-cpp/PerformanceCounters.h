@@ -0,0 +1,229 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_PERFORMANCE_COUNTERS_H
+#define FBCPP_PERFORMANCE_COUNTERS_H
+
+#include "fb-api.h"
+#include <cstdint>
+#include <map>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	class Attachment;
+	class Client;
+
+	///
+	/// Record counts of the last execution of a Statement, as reported by `isc_info_sql_records`.
+	///
+	struct ExecutionStats final
+	{
+		///
+		/// Number of records fetched so far by a SELECT.
+		///
+		std::uint64_t selectedRecords = 0u;
+
+		///
+		/// Number of records inserted.
+		///
+		std::uint64_t insertedRecords = 0u;
+
+		///
+		/// Number of records updated.
+		///
+		std::uint64_t updatedRecords = 0u;
+
+		///
+		/// Number of records deleted.
+		///
+		std::uint64_t deletedRecords = 0u;
+	};
+
+	///
+	/// Record-level counters of one table, as reported by the per-table attachment info items.
+	///
+	struct TableCounters final
+	{
+		///
+		/// Records read by natural (sequential) scans.
+		///
+		std::uint64_t sequentialReads = 0u;
+
+		///
+		/// Records read through indexes.
+		///
+		std::uint64_t indexedReads = 0u;
+
+		///
+		/// Records inserted.
+		///
+		std::uint64_t inserts = 0u;
+
+		///
+		/// Records updated.
+		///
+		std::uint64_t updates = 0u;
+
+		///
+		/// Records deleted.
+		///
+		std::uint64_t deletes = 0u;
+
+		///
+		/// Record versions backed out.
+		///
+		std::uint64_t backouts = 0u;
+
+		///
+		/// Old record versions purged.
+		///
+		std::uint64_t purges = 0u;
+
+		///
+		/// Deleted records expunged.
+		///
+		std::uint64_t expunges = 0u;
+
+		///
+		/// Compares all counters.
+		///
+		bool operator==(const TableCounters&) const noexcept = default;
+	};
+
+	///
+	/// Snapshot of the I/O, memory and per-table counters of an Attachment since it was connected.
+	///
+	/// Counters are cumulative; subtract two snapshots (or use PerformanceSnapshot) to get the work done in
+	/// between.
+	///
+	struct PerformanceCounters final
+	{
+		///
+		/// Pages read from disk (`isc_info_reads`).
+		///
+		std::uint64_t pageReads = 0u;
+
+		///
+		/// Pages written to disk (`isc_info_writes`).
+		///
+		std::uint64_t pageWrites = 0u;
+
+		///
+		/// Pages fetched from the page cache (`isc_info_fetches`).
+		///
+		std::uint64_t pageFetches = 0u;
+
+		///
+		/// Pages marked as modified in the page cache (`isc_info_marks`).
+		///
+		std::uint64_t pageMarks = 0u;
+
+		///
+		/// Memory currently in use by the server (`isc_info_current_memory`). Not cumulative: a delta keeps
+		/// the later value.
+		///
+		std::uint64_t currentMemory = 0u;
+
+		///
+		/// Peak memory used by the server (`isc_info_max_memory`). Not cumulative: a delta keeps the later
+		/// value.
+		///
+		std::uint64_t maxMemory = 0u;
+
+		///
+		/// Per-table counters keyed by relation ID (`RDB$RELATIONS.RDB$RELATION_ID`). Only tables touched by
+		/// the attachment are present.
+		///
+		std::map<unsigned, TableCounters> tables;
+	};
+
+	///
+	/// Returns the work done between two snapshots of the same attachment: cumulative counters of `later`
+	/// minus those of `earlier`. Tables whose counters did not change are omitted.
+	///
+	PerformanceCounters operator-(const PerformanceCounters& later, const PerformanceCounters& earlier);
+
+	///
+	/// Captures the counters of an Attachment on construction and reports the work done since then.
+	///
+	/// Typical usage:
+	/// ```
+	/// PerformanceSnapshot snapshot{attachment};
+	/// statement.execute(transaction);
+	/// assert(snapshot.getDelta().pageReads <= 10);
+	/// ```
+	///
+	class PerformanceSnapshot final
+	{
+	public:
+		///
+		/// Captures the current counters of `attachment`, which must outlive the snapshot.
+		///
+		explicit PerformanceSnapshot(Attachment& attachment);
+
+	public:
+		///
+		/// Returns the counters captured on construction or on the last `reset()`.
+		///
+		const PerformanceCounters& getStart() const noexcept
+		{
+			return start;
+		}
+
+		///
+		/// Returns the work done since the start counters were captured.
+		///
+		PerformanceCounters getDelta();
+
+		///
+		/// Captures the current counters as the new start.
+		///
+		void reset();
+
+	private:
+		Attachment& attachment;
+		PerformanceCounters start;
+	};
+
+	namespace impl
+	{
+		///
+		/// Queries `isc_info_sql_records` of a statement handle.
+		///
+		ExecutionStats queryExecutionStats(Client& client, fb::IStatement* statement);
+
+		///
+		/// Queries the I/O, memory and per-table counters of an attachment handle.
+		///
+		PerformanceCounters queryPerformanceCounters(Client& client, fb::IAttachment* attachment);
+	}  // namespace impl
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_PERFORMANCE_COUNTERS_H
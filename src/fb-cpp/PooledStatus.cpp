@@ -0,0 +1,109 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "PooledStatus.h"
+#include <array>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+namespace
+{
+	// Set when the calling thread's pool was destroyed, so statuses disposed later in the thread exit are freed
+	// directly instead of touching the destroyed pool.
+	thread_local bool poolDestroyed = false;
+
+	struct StatusPool final
+	{
+		~StatusPool()
+		{
+			poolDestroyed = true;
+
+			for (std::size_t i = 0; i < count; ++i)
+				delete items[i];
+		}
+
+		std::array<PooledStatus*, PooledStatus::MAX_POOLED> items{};
+		std::size_t count = 0;
+	};
+
+	StatusPool& getPool()
+	{
+		thread_local StatusPool pool;
+		return pool;
+	}
+}  // namespace
+
+
+PooledStatus* PooledStatus::acquire()
+{
+	if (!poolDestroyed)
+	{
+		auto& pool = getPool();
+
+		if (pool.count != 0)
+			return pool.items[--pool.count];
+	}
+
+	return new PooledStatus{};
+}
+
+void PooledStatus::dispose() noexcept
+{
+	init();
+
+	if (!poolDestroyed)
+	{
+		auto& pool = getPool();
+
+		if (pool.count < pool.items.size())
+		{
+			pool.items[pool.count++] = this;
+			return;
+		}
+	}
+
+	delete this;
+}
+
+fb::IStatus* PooledStatus::clone() const noexcept
+{
+	PooledStatus* copy;
+
+	// Like the cloop dispatchers, report a failed clone with a null result instead of letting bad_alloc escape.
+	try
+	{
+		copy = acquire();
+	}
+	catch (...)
+	{
+		return nullptr;
+	}
+
+	copy->setErrors(getErrors());
+	copy->setWarnings(getWarnings());
+	return copy;
+}
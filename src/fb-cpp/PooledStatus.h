@@ -0,0 +1,157 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_POOLED_STATUS_H
+#define FBCPP_POOLED_STATUS_H
+
+#include "fb-api.h"
+#include "Exception.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp::impl
+{
+	///
+	/// @brief IStatus implemented in-library and recycled through a per-thread pool.
+	///
+	/// Objects are obtained with `acquire()`. Disposing one resets it and returns it to the pool of the calling
+	/// thread, so creating temporary statuses does not allocate once the pool is warm. Pooled objects are freed
+	/// when their thread exits; they never call into the Firebird client library.
+	///
+	class PooledStatus final : public fb::IStatusImpl<PooledStatus, StatusWrapper>
+	{
+	public:
+		///
+		/// Maximum number of idle objects kept per thread.
+		///
+		static constexpr std::size_t MAX_POOLED = 16u;
+
+	public:
+		///
+		/// Returns an empty status from the calling thread's pool, allocating one if the pool is empty.
+		///
+		static PooledStatus* acquire();
+
+	public:
+		PooledStatus()
+		{
+			errors.reserve(RESERVED_ITEMS, RESERVED_STRINGS);
+			warnings.reserve(RESERVED_ITEMS, RESERVED_STRINGS);
+		}
+
+		PooledStatus(const PooledStatus&) = delete;
+		PooledStatus& operator=(const PooledStatus&) = delete;
+
+	public:
+		void dispose() noexcept override;
+
+		void init() noexcept override
+		{
+			errors.clear();
+			warnings.clear();
+		}
+
+		unsigned getState() const noexcept override
+		{
+			return (errors.hasData() ? IStatus::STATE_ERRORS : 0u) |
+				(warnings.hasData() ? IStatus::STATE_WARNINGS : 0u);
+		}
+
+		void setErrors2(unsigned length, const std::intptr_t* value) noexcept override
+		{
+			assignNoThrow(errors, value, length);
+		}
+
+		void setWarnings2(unsigned length, const std::intptr_t* value) noexcept override
+		{
+			assignNoThrow(warnings, value, length);
+		}
+
+		void setErrors(const std::intptr_t* value) noexcept override
+		{
+			assignNoThrow(errors, value);
+		}
+
+		void setWarnings(const std::intptr_t* value) noexcept override
+		{
+			assignNoThrow(warnings, value);
+		}
+
+		const std::intptr_t* getErrors() const noexcept override
+		{
+			return errors.empty() ? cleanStatus() : errors.getItems().data();
+		}
+
+		const std::intptr_t* getWarnings() const noexcept override
+		{
+			return warnings.empty() ? cleanStatus() : warnings.getItems().data();
+		}
+
+		///
+		/// Returns a copy from the pool, or nullptr if a new object cannot be allocated.
+		///
+		IStatus* clone() const noexcept override;
+
+	private:
+		static constexpr std::size_t RESERVED_ITEMS = 20u;
+		static constexpr std::size_t RESERVED_STRINGS = 256u;
+
+	private:
+		static const std::intptr_t* cleanStatus() noexcept
+		{
+			static const std::intptr_t clean[3] = {isc_arg_gds, 0, isc_arg_end};
+			return clean;
+		}
+
+		// Vectors that do not fit the reserved storage are copied with allocations; if these fail, the vector is
+		// replaced by an out of memory error, which fits the reserved storage.
+		static void assignNoThrow(StatusVector& target, const std::intptr_t* value,
+			unsigned length = std::numeric_limits<unsigned>::max()) noexcept
+		{
+			try
+			{
+				target.assign(value, length);
+			}
+			catch (...)
+			{
+				static constexpr std::intptr_t outOfMemory[] = {isc_arg_gds, isc_virmemexh, isc_arg_end};
+				target.clear();
+				target.assign(outOfMemory);
+			}
+		}
+
+	private:
+		StatusVector errors;
+		StatusVector warnings;
+	};
+}  // namespace fbcpp::impl
+
+
+#endif  // FBCPP_POOLED_STATUS_H
@@ -0,0 +1,157 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "PrefetchCursor.h"
+#include "Statement.h"
+#include <cassert>
+#include <stdexcept>
+#include <utility>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+PrefetchCursor::PrefetchCursor(Statement& statement, unsigned windowSize, unsigned windowCount)
+	: statement{statement},
+	  windowSize{windowSize},
+	  windowCount{windowCount}
+{
+	assert(statement.isValid());
+	assert(statement.getResultSetHandle());
+
+	if (windowSize == 0)
+		throw std::invalid_argument{"PrefetchCursor windowSize must be greater than zero"};
+
+	if (windowCount == 0)
+		throw std::invalid_argument{"PrefetchCursor windowCount must be greater than zero"};
+
+	freeWindows.reserve(windowCount);
+
+	producer = std::thread{&PrefetchCursor::produce, this};
+}
+
+RowSet* PrefetchCursor::next()
+{
+	std::unique_lock mutexGuard{mutex};
+
+	if (current)
+	{
+		freeWindows.push_back(std::move(current));
+		condition.notify_all();
+	}
+
+	condition.wait(mutexGuard, [this] { return !filledWindows.empty() || finished; });
+
+	if (!filledWindows.empty())
+	{
+		current = std::move(filledWindows.front());
+		filledWindows.pop_front();
+		return current.get();
+	}
+
+	if (error)
+		std::rethrow_exception(std::exchange(error, nullptr));
+
+	return nullptr;
+}
+
+void PrefetchCursor::close()
+{
+	{  // scope
+		std::lock_guard mutexGuard{mutex};
+		stopping = true;
+		finished = true;
+	}
+
+	condition.notify_all();
+
+	if (producer.joinable())
+		producer.join();
+
+	std::lock_guard mutexGuard{mutex};
+	current.reset();
+	filledWindows.clear();
+	freeWindows.clear();
+	error = nullptr;
+}
+
+void PrefetchCursor::produce()
+{
+	while (true)
+	{
+		std::unique_ptr<RowSet> window;
+
+		{  // scope
+			std::unique_lock mutexGuard{mutex};
+
+			condition.wait(
+				mutexGuard, [this] { return stopping || !freeWindows.empty() || createdWindows < windowCount; });
+
+			if (stopping)
+				return;
+
+			if (!freeWindows.empty())
+			{
+				window = std::move(freeWindows.back());
+				freeWindows.pop_back();
+			}
+			else
+				++createdWindows;
+		}
+
+		try
+		{
+			if (window)
+				window->refill(statement);
+			else
+				window = std::make_unique<RowSet>(statement, windowSize);
+		}
+		catch (...)
+		{
+			std::lock_guard mutexGuard{mutex};
+			error = std::current_exception();
+			finished = true;
+			condition.notify_all();
+			return;
+		}
+
+		const bool eof = window->isEof();
+
+		{  // scope
+			std::lock_guard mutexGuard{mutex};
+
+			if (window->getCount() != 0)
+				filledWindows.push_back(std::move(window));
+
+			if (eof)
+				finished = true;
+		}
+
+		condition.notify_all();
+
+		if (eof)
+			return;
+	}
+}
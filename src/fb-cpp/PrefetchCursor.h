@@ -0,0 +1,128 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_PREFETCH_CURSOR_H
+#define FBCPP_PREFETCH_CURSOR_H
+
+#include "RowSet.h"
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	class Statement;
+
+	///
+	/// @brief Reads a result set ahead of the consumer on a background thread.
+	///
+	/// A producer thread keeps fetching RowSet windows of `windowSize` rows from the statement
+	/// while the caller processes previously fetched windows, so network round trips overlap
+	/// with row processing. At most `windowCount` windows exist at once (including the one
+	/// being consumed): two gives double buffering, three triple buffering.
+	///
+	/// As with RowSet, fetching starts after the row already fetched by `Statement::execute()`.
+	/// The statement must not be used by the caller while the cursor exists.
+	///
+	class PrefetchCursor final
+	{
+	public:
+		///
+		/// @brief Starts prefetching from the current result set of `statement`.
+		/// @param statement The statement with an open result set.
+		/// @param windowSize Maximum number of rows per window.
+		/// @param windowCount Maximum number of windows alive at once.
+		///
+		explicit PrefetchCursor(Statement& statement, unsigned windowSize, unsigned windowCount = 2);
+
+		///
+		/// @brief Stops the producer thread, waiting for an in-flight fetch to complete.
+		///
+		~PrefetchCursor() noexcept
+		{
+			try
+			{
+				close();
+			}
+			catch (...)
+			{
+				// swallow
+			}
+		}
+
+		PrefetchCursor(const PrefetchCursor&) = delete;
+		PrefetchCursor& operator=(const PrefetchCursor&) = delete;
+
+		PrefetchCursor(PrefetchCursor&&) = delete;
+		PrefetchCursor& operator=(PrefetchCursor&&) = delete;
+
+	public:
+		///
+		/// @brief Waits for the next filled window and returns it.
+		///
+		/// The returned window stays valid until the next call to `next()` or `close()`,
+		/// which hands it back to the producer for reuse.
+		///
+		/// @return The next window, or nullptr when the result set is exhausted.
+		/// @throws Any exception raised by the producer while fetching, after the windows
+		/// fetched before the failure were returned.
+		///
+		RowSet* next();
+
+		///
+		/// @brief Stops prefetching. Further calls to `next()` return nullptr.
+		///
+		void close();
+
+	private:
+		void produce();
+
+	private:
+		Statement& statement;
+		unsigned windowSize;
+		unsigned windowCount;
+		unsigned createdWindows = 0;
+		std::unique_ptr<RowSet> current;
+		std::deque<std::unique_ptr<RowSet>> filledWindows;
+		std::vector<std::unique_ptr<RowSet>> freeWindows;
+		std::exception_ptr error;
+		std::mutex mutex;
+		std::condition_variable condition;
+		std::thread producer;
+		bool finished = false;
+		bool stopping = false;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_PREFETCH_CURSOR_H
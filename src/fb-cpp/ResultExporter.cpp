@@ -0,0 +1,662 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "ResultExporter.h"
+#include "Attachment.h"
+#include "Blob.h"
+#include "CalendarConverter.h"
+#include "Client.h"
+#include "Exception.h"
+#include "NumericConverter.h"
+#include "RowSet.h"
+#include "Statement.h"
+#include "Transaction.h"
+#include <cassert>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+namespace
+{
+	constexpr unsigned CS_BINARY = 1u;
+	constexpr int BLOB_SUB_TYPE_TEXT = 1;
+	constexpr std::string_view BINARY_MAGIC = "FBCPPEXP";
+	constexpr std::uint16_t BINARY_VERSION = 1u;
+
+	using Buffer = std::vector<char>;
+
+	template <typename T>
+	T read(const std::byte* data) noexcept
+	{
+		T value;
+		std::memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	void append(Buffer& out, std::string_view value)
+	{
+		out.insert(out.end(), value.begin(), value.end());
+	}
+
+	template <typename T>
+	void appendRaw(Buffer& out, T value)
+	{
+		const auto bytes = reinterpret_cast<const char*>(&value);
+		out.insert(out.end(), bytes, bytes + sizeof(value));
+	}
+
+	void appendHex(Buffer& out, std::span<const std::byte> data)
+	{
+		constexpr std::string_view digits = "0123456789ABCDEF";
+
+		for (const auto byte : data)
+		{
+			const auto value = static_cast<unsigned>(byte);
+			out.push_back(digits[value >> 4]);
+			out.push_back(digits[value & 0xFu]);
+		}
+	}
+
+
+	///
+	/// Hands filled buffers to the writer, directly or through a writer thread with double buffering.
+	///
+	class OutputBuffer final
+	{
+	public:
+		OutputBuffer(const ResultExporter::Writer& writer, std::size_t bufferSize, bool useThread)
+			: writer{writer},
+			  bufferSize{bufferSize}
+		{
+			current.reserve(bufferSize);
+
+			if (useThread)
+				thread = std::thread{&OutputBuffer::writeLoop, this};
+		}
+
+		~OutputBuffer() noexcept
+		{
+			stop();
+		}
+
+		OutputBuffer(const OutputBuffer&) = delete;
+		OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+	public:
+		Buffer& get() noexcept
+		{
+			return current;
+		}
+
+		void flushIfFull()
+		{
+			if (current.size() >= bufferSize)
+				flush();
+		}
+
+		void finish()
+		{
+			if (!current.empty())
+				flush();
+
+			if (thread.joinable())
+			{
+				{  // scope
+					std::unique_lock mutexGuard{mutex};
+					condition.wait(mutexGuard, [this] { return !pending.has_value() || error; });
+				}
+
+				stop();
+
+				if (error)
+					std::rethrow_exception(error);
+			}
+		}
+
+	private:
+		void flush()
+		{
+			if (!thread.joinable())
+			{
+				writer(std::as_bytes(std::span{current}));
+				current.clear();
+				return;
+			}
+
+			std::unique_lock mutexGuard{mutex};
+			condition.wait(mutexGuard, [this] { return !pending.has_value() || error; });
+
+			if (error)
+				std::rethrow_exception(error);
+
+			pending = std::move(current);
+			current = std::move(spare);
+			current.clear();
+			current.reserve(bufferSize);
+
+			condition.notify_all();
+		}
+
+		void stop() noexcept
+		{
+			if (!thread.joinable())
+				return;
+
+			{  // scope
+				std::lock_guard mutexGuard{mutex};
+				stopping = true;
+			}
+
+			condition.notify_all();
+			thread.join();
+		}
+
+		void writeLoop()
+		{
+			std::unique_lock mutexGuard{mutex};
+
+			while (true)
+			{
+				condition.wait(mutexGuard, [this] { return pending.has_value() || stopping; });
+
+				if (!pending.has_value())
+					return;
+
+				auto data = std::move(pending.value());
+
+				mutexGuard.unlock();
+
+				std::exception_ptr writeError;
+
+				try
+				{
+					writer(std::as_bytes(std::span{data}));
+				}
+				catch (...)
+				{
+					writeError = std::current_exception();
+				}
+
+				mutexGuard.lock();
+
+				pending.reset();
+				spare = std::move(data);
+				condition.notify_all();
+
+				if (writeError)
+				{
+					error = writeError;
+					return;
+				}
+			}
+		}
+
+	private:
+		const ResultExporter::Writer& writer;
+		std::size_t bufferSize;
+		Buffer current;
+		Buffer spare;
+		std::optional<Buffer> pending;
+		std::exception_ptr error;
+		std::mutex mutex;
+		std::condition_variable condition;
+		bool stopping = false;
+		std::thread thread;
+	};
+
+
+	///
+	/// Formats rows straight from their raw messages into the output buffer.
+	///
+	class RowFormatter final
+	{
+	public:
+		RowFormatter(Statement& statement, Transaction& transaction, const ResultExportOptions& options)
+			: attachment{statement.getAttachment()},
+			  transaction{transaction},
+			  options{options},
+			  descriptors{statement.getOutputDescriptorSet()},
+			  statusWrapper{statement.getAttachment().getClient()},
+			  numericConverter{statement.getAttachment().getClient()},
+			  calendarConverter{statement.getAttachment().getClient()}
+		{
+		}
+
+	public:
+		void writeHeader(Buffer& out)
+		{
+			const auto& columns = descriptors->getDescriptors();
+
+			if (options.getFormat() == ExportFormat::BINARY)
+			{
+				append(out, BINARY_MAGIC);
+				appendRaw(out, BINARY_VERSION);
+				appendRaw(out, static_cast<std::uint16_t>(columns.size()));
+
+				for (const auto& column : columns)
+				{
+					const auto& name = column.alias.empty() ? column.name : column.alias;
+
+					appendRaw(out, static_cast<std::uint16_t>(column.adjustedType));
+					appendRaw(out, static_cast<std::int16_t>(column.scale));
+					appendRaw(out, static_cast<std::uint32_t>(column.length));
+					appendRaw(out, static_cast<std::uint16_t>(name.size()));
+					append(out, name);
+				}
+
+				return;
+			}
+
+			if (!options.getHeader())
+				return;
+
+			for (std::size_t i = 0; i < columns.size(); ++i)
+			{
+				if (i != 0)
+					out.push_back(getDelimiter());
+
+				appendText(out, columns[i].alias.empty() ? columns[i].name : columns[i].alias);
+			}
+
+			out.push_back('\n');
+		}
+
+		void writeRow(Buffer& out, const std::byte* message)
+		{
+			const auto isBinary = options.getFormat() == ExportFormat::BINARY;
+
+			for (std::size_t i = 0; i < descriptors->size(); ++i)
+			{
+				if (!isBinary && i != 0)
+					out.push_back(getDelimiter());
+
+				const auto& layout = descriptors->getLayout(i);
+				const auto isNull = layout.adjustedType == DescriptorAdjustedType::NULL_TYPE ||
+					read<std::int16_t>(&message[layout.nullOffset]) != FB_FALSE;
+
+				if (isBinary)
+					writeBinaryValue(out, i, isNull ? nullptr : &message[layout.offset]);
+				else if (isNull)
+				{
+					if (options.getFormat() == ExportFormat::TSV)
+						append(out, "\\N");
+				}
+				else
+					writeTextValue(out, i, &message[layout.offset]);
+			}
+
+			if (!isBinary)
+				out.push_back('\n');
+		}
+
+	private:
+		char getDelimiter() const noexcept
+		{
+			return options.getFormat() == ExportFormat::TSV ? '\t' : options.getDelimiter();
+		}
+
+		void appendText(Buffer& out, std::string_view text)
+		{
+			if (options.getFormat() == ExportFormat::TSV)
+			{
+				for (const auto c : text)
+				{
+					switch (c)
+					{
+						case '\\':
+							append(out, "\\\\");
+							break;
+
+						case '\t':
+							append(out, "\\t");
+							break;
+
+						case '\n':
+							append(out, "\\n");
+							break;
+
+						case '\r':
+							append(out, "\\r");
+							break;
+
+						default:
+							out.push_back(c);
+							break;
+					}
+				}
+
+				return;
+			}
+
+			const auto delimiter = options.getDelimiter();
+			const auto needsQuotes = text.empty() ||
+				text.find_first_of(std::string_view{"\"\r\n"}) != std::string_view::npos ||
+				text.find(delimiter) != std::string_view::npos;
+
+			if (!needsQuotes)
+			{
+				append(out, text);
+				return;
+			}
+
+			out.push_back('"');
+
+			for (const auto c : text)
+			{
+				if (c == '"')
+					out.push_back('"');
+
+				out.push_back(c);
+			}
+
+			out.push_back('"');
+		}
+
+		std::span<const std::byte> readBlob(const std::byte* data)
+		{
+			BlobId blobId;
+			blobId.id = read<ISC_QUAD>(data);
+
+			Blob blob{attachment, transaction, blobId};
+			blobBuffer.resize(blob.getLength());
+			const auto length = blob.read(blobBuffer);
+			blob.close();
+
+			return {blobBuffer.data(), length};
+		}
+
+		void writeTextValue(Buffer& out, std::size_t column, const std::byte* data)
+		{
+			const auto& layout = descriptors->getLayout(column);
+
+			switch (layout.adjustedType)
+			{
+				case DescriptorAdjustedType::BOOLEAN:
+					append(out, read<FB_BOOLEAN>(data) != FB_FALSE ? "true" : "false");
+					break;
+
+				case DescriptorAdjustedType::INT16:
+					scratch.clear();
+					numericConverter.appendNumberString(scratch, ScaledInt16{read<std::int16_t>(data), layout.scale});
+					append(out, scratch);
+					break;
+
+				case DescriptorAdjustedType::INT32:
+					scratch.clear();
+					numericConverter.appendNumberString(scratch, ScaledInt32{read<std::int32_t>(data), layout.scale});
+					append(out, scratch);
+					break;
+
+				case DescriptorAdjustedType::INT64:
+					scratch.clear();
+					numericConverter.appendNumberString(scratch, ScaledInt64{read<std::int64_t>(data), layout.scale});
+					append(out, scratch);
+					break;
+
+				case DescriptorAdjustedType::INT128:
+					scratch.clear();
+					numericConverter.appendOpaqueInt128String(
+						scratch, &statusWrapper, read<OpaqueInt128>(data), layout.scale);
+					append(out, scratch);
+					break;
+
+				case DescriptorAdjustedType::FLOAT:
+					scratch.clear();
+					numericConverter.appendNumberString(scratch, read<float>(data));
+					append(out, scratch);
+					break;
+
+				case DescriptorAdjustedType::DOUBLE:
+					scratch.clear();
+					numericConverter.appendNumberString(scratch, read<double>(data));
+					append(out, scratch);
+					break;
+
+				case DescriptorAdjustedType::DECFLOAT16:
+					scratch.clear();
+					numericConverter.appendOpaqueDecFloat16String(
+						scratch, &statusWrapper, read<OpaqueDecFloat16>(data));
+					append(out, scratch);
+					break;
+
+				case DescriptorAdjustedType::DECFLOAT34:
+					scratch.clear();
+					numericConverter.appendOpaqueDecFloat34String(
+						scratch, &statusWrapper, read<OpaqueDecFloat34>(data));
+					append(out, scratch);
+					break;
+
+				case DescriptorAdjustedType::DATE:
+					scratch.clear();
+					calendarConverter.appendOpaqueDateString(scratch, read<OpaqueDate>(data));
+					append(out, scratch);
+					break;
+
+				case DescriptorAdjustedType::TIME:
+					scratch.clear();
+					calendarConverter.appendOpaqueTimeString(scratch, read<OpaqueTime>(data));
+					append(out, scratch);
+					break;
+
+				case DescriptorAdjustedType::TIMESTAMP:
+					scratch.clear();
+					calendarConverter.appendOpaqueTimestampString(scratch, read<OpaqueTimestamp>(data));
+					append(out, scratch);
+					break;
+
+				// The EX layouts start with the plain one and only add the offset, which the zone name implies.
+				case DescriptorAdjustedType::TIME_TZ:
+				case DescriptorAdjustedType::TIME_TZ_EX:
+					scratch.clear();
+					calendarConverter.appendOpaqueTimeTzString(scratch, &statusWrapper, read<OpaqueTimeTz>(data));
+					appendText(out, scratch);
+					break;
+
+				case DescriptorAdjustedType::TIMESTAMP_TZ:
+				case DescriptorAdjustedType::TIMESTAMP_TZ_EX:
+					scratch.clear();
+					calendarConverter.appendOpaqueTimestampTzString(
+						scratch, &statusWrapper, read<OpaqueTimestampTz>(data));
+					appendText(out, scratch);
+					break;
+
+				case DescriptorAdjustedType::STRING:
+				{
+					const auto length = read<std::uint16_t>(data);
+					const auto chars = data + sizeof(std::uint16_t);
+
+					if (descriptors->getDescriptors()[column].charSetId == CS_BINARY)
+						appendHex(out, {chars, length});
+					else
+						appendText(out, {reinterpret_cast<const char*>(chars), length});
+					break;
+				}
+
+				case DescriptorAdjustedType::BLOB:
+				{
+					const auto content = readBlob(data);
+
+					if (descriptors->getDescriptors()[column].subType == BLOB_SUB_TYPE_TEXT)
+						appendText(out, {reinterpret_cast<const char*>(content.data()), content.size()});
+					else
+						appendHex(out, content);
+					break;
+				}
+
+				case DescriptorAdjustedType::NULL_TYPE:
+					break;
+			}
+		}
+
+		void writeBinaryValue(Buffer& out, std::size_t column, const std::byte* data)
+		{
+			if (!data)
+			{
+				appendRaw(out, std::int32_t{-1});
+				return;
+			}
+
+			const auto& layout = descriptors->getLayout(column);
+			std::span<const std::byte> value;
+
+			switch (layout.adjustedType)
+			{
+				case DescriptorAdjustedType::STRING:
+					value = {data + sizeof(std::uint16_t), read<std::uint16_t>(data)};
+					break;
+
+				case DescriptorAdjustedType::BLOB:
+					value = readBlob(data);
+					break;
+
+				default:
+					value = {data, layout.length};
+					break;
+			}
+
+			if (value.size() > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()))
+				throw FbCppException("Value too large for the binary export format");
+
+			appendRaw(out, static_cast<std::int32_t>(value.size()));
+			const auto bytes = reinterpret_cast<const char*>(value.data());
+			out.insert(out.end(), bytes, bytes + value.size());
+		}
+
+	private:
+		Attachment& attachment;
+		Transaction& transaction;
+		const ResultExportOptions& options;
+		DescriptorSetPtr descriptors;
+		StatusWrapper statusWrapper;
+		NumericConverter numericConverter;
+		CalendarConverter calendarConverter;
+		std::string scratch;
+		std::vector<std::byte> blobBuffer;
+	};
+}  // namespace
+
+
+ResultExporter::ResultExporter(Statement& statement, Transaction& transaction, const ResultExportOptions& options)
+	: statement{statement},
+	  transaction{transaction},
+	  options{options}
+{
+	assert(statement.isValid());
+	assert(statement.getResultSetHandle());
+
+	if (options.getWindowSize() == 0)
+		throw std::invalid_argument{"ResultExporter windowSize must be greater than zero"};
+
+	if (options.getBufferSize() == 0)
+		throw std::invalid_argument{"ResultExporter bufferSize must be greater than zero"};
+
+	if (options.getFormat() == ExportFormat::CSV &&
+		(options.getDelimiter() == '"' || options.getDelimiter() == '\n' || options.getDelimiter() == '\r'))
+	{
+		throw std::invalid_argument{"ResultExporter delimiter cannot be a quote or a line break"};
+	}
+}
+
+std::uint64_t ResultExporter::exportTo(const Writer& writer)
+{
+	OutputBuffer output{writer, options.getBufferSize(), options.getWriterThread()};
+	RowFormatter formatter{statement, transaction, options};
+	std::uint64_t rowCount = 0u;
+
+	formatter.writeHeader(output.get());
+
+	if (options.getIncludeCurrentRow())
+	{
+		formatter.writeRow(output.get(), statement.getOutputMessage().data());
+		output.flushIfFull();
+		++rowCount;
+	}
+
+	RowSet rowSet{statement, options.getWindowSize()};
+
+	while (true)
+	{
+		for (unsigned i = 0; i < rowSet.getCount(); ++i)
+		{
+			formatter.writeRow(output.get(), rowSet.getRawRow(i).data());
+			output.flushIfFull();
+		}
+
+		rowCount += rowSet.getCount();
+
+		if (rowSet.isEof())
+			break;
+
+		rowSet.refill(statement);
+	}
+
+	output.finish();
+
+	return rowCount;
+}
+
+std::uint64_t ResultExporter::exportTo(std::ostream& stream)
+{
+	return exportTo(
+		[&stream](std::span<const std::byte> data)
+		{
+			if (!stream.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size())))
+				throw FbCppException("Cannot write the exported rows to the stream");
+		});
+}
+
+std::uint64_t ResultExporter::exportTo(const std::filesystem::path& path)
+{
+	std::ofstream out;
+	out.rdbuf()->pubsetbuf(nullptr, 0);
+	out.open(path, std::ios::binary | std::ios::trunc);
+
+	if (!out)
+		throw FbCppException("Cannot open file '" + path.string() + "' for writing");
+
+	const auto rowCount = exportTo(out);
+
+	out.close();
+
+	if (!out)
+		throw FbCppException("Cannot write file '" + path.string() + "'");
+
+	return rowCount;
+}
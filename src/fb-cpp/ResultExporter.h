@@ -0,0 +1,270 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef FBCPP_RESULT_EXPORTER_H
+#define FBCPP_RESULT_EXPORTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <ostream>
+#include <span>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	class Statement;
+	class Transaction;
+
+	///
+	/// Output format of a ResultExporter.
+	///
+	enum class ExportFormat
+	{
+		///
+		/// Comma (or `ResultExportOptions::getDelimiter()`) separated values. Fields containing the delimiter,
+		/// quotes or line breaks are quoted, empty strings are written as `""` and NULLs as empty fields.
+		///
+		CSV,
+
+		///
+		/// Tab separated values. Tabs, line breaks and backslashes are escaped with a backslash and NULLs are
+		/// written as `\N`, as in PostgreSQL's COPY text format.
+		///
+		TSV,
+
+		///
+		/// Compact length-prefixed binary format, in host byte order. It starts with the 8 bytes `FBCPPEXP`, a
+		/// `uint16` version (1) and a `uint16` column count, followed by each column's `uint16`
+		/// DescriptorAdjustedType, `int16` scale, `uint32` length and `uint16`-prefixed name. Each row then
+		/// holds, for each column, an `int32` length (-1 for NULL) followed by the value: the raw message
+		/// representation for fixed-width types, and the bytes for strings and blobs.
+		///
+		BINARY,
+	};
+
+	///
+	/// Represents options used by ResultExporter.
+	///
+	class ResultExportOptions final
+	{
+	public:
+		///
+		/// Returns the output format.
+		///
+		ExportFormat getFormat() const
+		{
+			return format;
+		}
+
+		///
+		/// Sets the output format.
+		///
+		ResultExportOptions& setFormat(ExportFormat value)
+		{
+			format = value;
+			return *this;
+		}
+
+		///
+		/// Returns the CSV field delimiter.
+		///
+		char getDelimiter() const
+		{
+			return delimiter;
+		}
+
+		///
+		/// Sets the CSV field delimiter.
+		///
+		ResultExportOptions& setDelimiter(char value)
+		{
+			delimiter = value;
+			return *this;
+		}
+
+		///
+		/// Returns whether CSV and TSV outputs start with a line of column names.
+		///
+		bool getHeader() const
+		{
+			return header;
+		}
+
+		///
+		/// Sets whether CSV and TSV outputs start with a line of column names.
+		///
+		ResultExportOptions& setHeader(bool value)
+		{
+			header = value;
+			return *this;
+		}
+
+		///
+		/// Returns whether the row already fetched by `Statement::execute()` is exported first.
+		///
+		bool getIncludeCurrentRow() const
+		{
+			return includeCurrentRow;
+		}
+
+		///
+		/// Sets whether the row already fetched by `Statement::execute()` is exported first.
+		/// Usually set to the value returned by `execute()`.
+		///
+		ResultExportOptions& setIncludeCurrentRow(bool value)
+		{
+			includeCurrentRow = value;
+			return *this;
+		}
+
+		///
+		/// Returns the number of rows fetched from the cursor at once.
+		///
+		unsigned getWindowSize() const
+		{
+			return windowSize;
+		}
+
+		///
+		/// Sets the number of rows fetched from the cursor at once.
+		///
+		ResultExportOptions& setWindowSize(unsigned value)
+		{
+			windowSize = value;
+			return *this;
+		}
+
+		///
+		/// Returns the size of the output buffer handed to the writer.
+		///
+		std::size_t getBufferSize() const
+		{
+			return bufferSize;
+		}
+
+		///
+		/// Sets the size of the output buffer handed to the writer.
+		///
+		ResultExportOptions& setBufferSize(std::size_t value)
+		{
+			bufferSize = value;
+			return *this;
+		}
+
+		///
+		/// Returns whether the writer is called by a separate thread.
+		///
+		bool getWriterThread() const
+		{
+			return writerThread;
+		}
+
+		///
+		/// Sets whether the writer is called by a separate thread, so fetching and formatting the next buffer
+		/// overlaps with writing the previous one.
+		///
+		ResultExportOptions& setWriterThread(bool value)
+		{
+			writerThread = value;
+			return *this;
+		}
+
+	private:
+		ExportFormat format = ExportFormat::CSV;
+		char delimiter = ',';
+		bool header = true;
+		bool includeCurrentRow = false;
+		unsigned windowSize = 1024u;
+		std::size_t bufferSize = 4u * 1024u * 1024u;
+		bool writerThread = false;
+	};
+
+	///
+	/// @brief Exports the current result set of a Statement as CSV, TSV or a binary format.
+	///
+	/// The cursor is read in RowSet windows and each value is formatted straight from the raw message into a
+	/// large reused output buffer, which is handed to the writer when full. Numbers are formatted with
+	/// `std::to_chars`, dates and times in ISO format (`YYYY-MM-DD HH:MM:SS.ffff`) and values with a time zone
+	/// are followed by the zone name. Text blobs are exported as text; non-text blobs and OCTETS strings are
+	/// hex-encoded in the text formats.
+	///
+	/// The statement must not be used by the caller while it is exported.
+	///
+	class ResultExporter final
+	{
+	public:
+		///
+		/// Function receiving each filled output buffer.
+		///
+		using Writer = std::function<void(std::span<const std::byte> data)>;
+
+	public:
+		///
+		/// Prepares the export of the current result set of `statement`, executed in `transaction`, which is
+		/// also used to read blobs.
+		///
+		explicit ResultExporter(
+			Statement& statement, Transaction& transaction, const ResultExportOptions& options = {});
+
+		ResultExporter(const ResultExporter&) = delete;
+		ResultExporter& operator=(const ResultExporter&) = delete;
+
+	public:
+		///
+		/// Exports the remaining rows to the writer.
+		///
+		/// @return The number of rows exported.
+		///
+		std::uint64_t exportTo(const Writer& writer);
+
+		///
+		/// Exports the remaining rows to the stream.
+		///
+		/// @return The number of rows exported.
+		///
+		std::uint64_t exportTo(std::ostream& stream);
+
+		///
+		/// Exports the remaining rows to a file, replacing it.
+		///
+		/// @return The number of rows exported.
+		///
+		std::uint64_t exportTo(const std::filesystem::path& path);
+
+	private:
+		Statement& statement;
+		Transaction& transaction;
+		ResultExportOptions options;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_RESULT_EXPORTER_H
@@ -28,12 +28,16 @@
 #include "config.h"
 #include "fb-api.h"
 #include "types.h"
+#include "Arena.h"
 #include "Blob.h"
+#include "BindingPlan.h"
+#include "NativeNumeric.h"
 #include "NumericConverter.h"
 #include "CalendarConverter.h"
 #include "Descriptor.h"
 #include "Exception.h"
 #include "StructBinding.h"
+#include "VariantPlan.h"
 #include "VariantTypeTraits.h"
 #include <cassert>
 #include <cstddef>
@@ -42,6 +46,7 @@
 #include <span>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #if FB_CPP_USE_BOOST_MULTIPRECISION != 0
@@ -62,23 +67,52 @@ namespace fbcpp
 	/// descriptors to interpret the raw bytes. It is produced by RowSet for any
 	/// fetched row.
 	///
+	/// Accessors are const and never modify the message. A Row that borrows the
+	/// helpers of its owner shares them with the owner's other rows; a Row built
+	/// without them creates its own on first use, so such rows can be read from
+	/// different threads at once.
+	///
 	class Row final
 	{
 	public:
 		///
 		/// @brief Constructs a Row view over the given message buffer.
 		///
+		/// Conversion helpers are built from `client` on first use.
+		///
 		/// @param client Client used to build conversion helpers.
 		/// @param descriptors Column descriptors.
 		/// @param message Span over the raw row data.
 		///
-		Row(Client& client, const std::vector<Descriptor>& descriptors, std::span<const std::byte> message)
+		Row(Client& client, const DescriptorSet& descriptors, std::span<const std::byte> message)
+			: client{&client},
+			  descriptors{&descriptors},
+			  message{message}
+		{
+		}
+
+		///
+		/// @brief Constructs a Row view over the given message buffer that borrows
+		/// the conversion helpers of its owner (a Statement or RowSet).
+		///
+		/// The borrowed objects must outlive the Row.
+		///
+		/// @param client Client of the owner.
+		/// @param descriptors Column descriptors.
+		/// @param message Span over the raw row data.
+		/// @param statusWrapper Status wrapper of the owner.
+		/// @param numericConverter Numeric converter of the owner.
+		/// @param calendarConverter Calendar converter of the owner.
+		///
+		Row(Client& client, const DescriptorSet& descriptors, std::span<const std::byte> message,
+			impl::StatusWrapper& statusWrapper, impl::NumericConverter& numericConverter,
+			impl::CalendarConverter& calendarConverter) noexcept
 			: client{&client},
 			  descriptors{&descriptors},
 			  message{message},
-			  statusWrapper{client},
-			  numericConverter{client},
-			  calendarConverter{client}
+			  borrowedStatusWrapper{&statusWrapper},
+			  borrowedNumericConverter{&numericConverter},
+			  borrowedCalendarConverter{&calendarConverter}
 		{
 		}
 
@@ -90,7 +124,7 @@ namespace fbcpp
 		///
 		/// @brief Reports whether the row has a null at the given column.
 		///
-		bool isNull(unsigned index)
+		bool isNull(unsigned index) const
 		{
 			const auto& descriptor = getDescriptor(index);
 			return *reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE;
@@ -99,7 +133,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a boolean column.
 		///
-		std::optional<bool> getBool(unsigned index)
+		std::optional<bool> getBool(unsigned index) const
 		{
 			const auto& descriptor = getDescriptor(index);
 
@@ -119,7 +153,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a 16-bit signed integer column.
 		///
-		std::optional<std::int16_t> getInt16(unsigned index)
+		std::optional<std::int16_t> getInt16(unsigned index) const
 		{
 			std::optional<int> scale{0};
 			return getNumber<std::int16_t>(index, scale, "std::int16_t");
@@ -128,7 +162,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a scaled 16-bit signed integer column.
 		///
-		std::optional<ScaledInt16> getScaledInt16(unsigned index)
+		std::optional<ScaledInt16> getScaledInt16(unsigned index) const
 		{
 			std::optional<int> scale;
 			const auto value = getNumber<std::int16_t>(index, scale, "ScaledInt16");
@@ -138,7 +172,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a 32-bit signed integer column.
 		///
-		std::optional<std::int32_t> getInt32(unsigned index)
+		std::optional<std::int32_t> getInt32(unsigned index) const
 		{
 			std::optional<int> scale{0};
 			return getNumber<std::int32_t>(index, scale, "std::int32_t");
@@ -147,7 +181,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a scaled 32-bit signed integer column.
 		///
-		std::optional<ScaledInt32> getScaledInt32(unsigned index)
+		std::optional<ScaledInt32> getScaledInt32(unsigned index) const
 		{
 			std::optional<int> scale;
 			const auto value = getNumber<std::int32_t>(index, scale, "ScaledInt32");
@@ -157,7 +191,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a 64-bit signed integer column.
 		///
-		std::optional<std::int64_t> getInt64(unsigned index)
+		std::optional<std::int64_t> getInt64(unsigned index) const
 		{
 			std::optional<int> scale{0};
 			return getNumber<std::int64_t>(index, scale, "std::int64_t");
@@ -166,7 +200,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a scaled 64-bit signed integer column.
 		///
-		std::optional<ScaledInt64> getScaledInt64(unsigned index)
+		std::optional<ScaledInt64> getScaledInt64(unsigned index) const
 		{
 			std::optional<int> scale;
 			const auto value = getNumber<std::int64_t>(index, scale, "ScaledInt64");
@@ -176,7 +210,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a Firebird scaled 128-bit integer column.
 		///
-		std::optional<ScaledOpaqueInt128> getScaledOpaqueInt128(unsigned index)
+		std::optional<ScaledOpaqueInt128> getScaledOpaqueInt128(unsigned index) const
 		{
 			const auto& descriptor = getDescriptor(index);
 
@@ -199,7 +233,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a Boost 128-bit integer column.
 		///
-		std::optional<BoostInt128> getBoostInt128(unsigned index)
+		std::optional<BoostInt128> getBoostInt128(unsigned index) const
 		{
 			std::optional<int> scale{0};
 			const auto value = getNumber<BoostInt128>(index, scale, "BoostInt128");
@@ -209,7 +243,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a scaled Boost 128-bit integer column.
 		///
-		std::optional<ScaledBoostInt128> getScaledBoostInt128(unsigned index)
+		std::optional<ScaledBoostInt128> getScaledBoostInt128(unsigned index) const
 		{
 			std::optional<int> scale;
 			const auto value = getNumber<BoostInt128>(index, scale, "ScaledBoostInt128");
@@ -220,7 +254,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a single precision floating-point column.
 		///
-		std::optional<float> getFloat(unsigned index)
+		std::optional<float> getFloat(unsigned index) const
 		{
 			std::optional<int> scale{0};
 			return getNumber<float>(index, scale, "float");
@@ -229,7 +263,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a double precision floating-point column.
 		///
-		std::optional<double> getDouble(unsigned index)
+		std::optional<double> getDouble(unsigned index) const
 		{
 			std::optional<int> scale{0};
 			return getNumber<double>(index, scale, "double");
@@ -238,7 +272,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a Firebird 16-digit decimal floating-point column.
 		///
-		std::optional<OpaqueDecFloat16> getOpaqueDecFloat16(unsigned index)
+		std::optional<OpaqueDecFloat16> getOpaqueDecFloat16(unsigned index) const
 		{
 			const auto& descriptor = getDescriptor(index);
 
@@ -259,7 +293,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a Boost-based 16-digit decimal floating-point column.
 		///
-		std::optional<BoostDecFloat16> getBoostDecFloat16(unsigned index)
+		std::optional<BoostDecFloat16> getBoostDecFloat16(unsigned index) const
 		{
 			std::optional<int> scale{0};
 			return getNumber<BoostDecFloat16>(index, scale, "BoostDecFloat16");
@@ -269,7 +303,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a Firebird 34-digit decimal floating-point column.
 		///
-		std::optional<OpaqueDecFloat34> getOpaqueDecFloat34(unsigned index)
+		std::optional<OpaqueDecFloat34> getOpaqueDecFloat34(unsigned index) const
 		{
 			const auto& descriptor = getDescriptor(index);
 
@@ -290,7 +324,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a Boost-based 34-digit decimal floating-point column.
 		///
-		std::optional<BoostDecFloat34> getBoostDecFloat34(unsigned index)
+		std::optional<BoostDecFloat34> getBoostDecFloat34(unsigned index) const
 		{
 			std::optional<int> scale{0};
 			return getNumber<BoostDecFloat34>(index, scale, "BoostDecFloat34");
@@ -300,7 +334,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a date column.
 		///
-		std::optional<Date> getDate(unsigned index)
+		std::optional<Date> getDate(unsigned index) const
 		{
 			const auto& descriptor = getDescriptor(index);
 
@@ -310,7 +344,7 @@ namespace fbcpp
 			switch (descriptor.adjustedType)
 			{
 				case DescriptorAdjustedType::DATE:
-					return calendarConverter.opaqueDateToDate(
+					return getCalendarConverter().opaqueDateToDate(
 						*reinterpret_cast<const OpaqueDate*>(&message[descriptor.offset]));
 
 				default:
@@ -321,7 +355,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a raw date column in Firebird's representation.
 		///
-		std::optional<OpaqueDate> getOpaqueDate(unsigned index)
+		std::optional<OpaqueDate> getOpaqueDate(unsigned index) const
 		{
 			const auto& descriptor = getDescriptor(index);
 
@@ -341,7 +375,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a time-of-day column without timezone.
 		///
-		std::optional<Time> getTime(unsigned index)
+		std::optional<Time> getTime(unsigned index) const
 		{
 			const auto& descriptor = getDescriptor(index);
 
@@ -351,7 +385,7 @@ namespace fbcpp
 			switch (descriptor.adjustedType)
 			{
 				case DescriptorAdjustedType::TIME:
-					return calendarConverter.opaqueTimeToTime(
+					return getCalendarConverter().opaqueTimeToTime(
 						*reinterpret_cast<const OpaqueTime*>(&message[descriptor.offset]));
 
 				default:
@@ -362,7 +396,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a raw time-of-day column in Firebird's representation.
 		///
-		std::optional<OpaqueTime> getOpaqueTime(unsigned index)
+		std::optional<OpaqueTime> getOpaqueTime(unsigned index) const
 		{
 			const auto& descriptor = getDescriptor(index);
 
@@ -382,7 +416,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a timestamp column without timezone.
 		///
-		std::optional<Timestamp> getTimestamp(unsigned index)
+		std::optional<Timestamp> getTimestamp(unsigned index) const
 		{
 			const auto& descriptor = getDescriptor(index);
 
@@ -392,7 +426,7 @@ namespace fbcpp
 			switch (descriptor.adjustedType)
 			{
 				case DescriptorAdjustedType::TIMESTAMP:
-					return calendarConverter.opaqueTimestampToTimestamp(
+					return getCalendarConverter().opaqueTimestampToTimestamp(
 						*reinterpret_cast<const OpaqueTimestamp*>(&message[descriptor.offset]));
 
 				default:
@@ -403,7 +437,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a raw timestamp column in Firebird's representation.
 		///
-		std::optional<OpaqueTimestamp> getOpaqueTimestamp(unsigned index)
+		std::optional<OpaqueTimestamp> getOpaqueTimestamp(unsigned index) const
 		{
 			const auto& descriptor = getDescriptor(index);
 
@@ -423,7 +457,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a time-of-day column with timezone.
 		///
-		std::optional<TimeTz> getTimeTz(unsigned index)
+		std::optional<TimeTz> getTimeTz(unsigned index) const
 		{
 			const auto& descriptor = getDescriptor(index);
 
@@ -433,8 +467,8 @@ namespace fbcpp
 			switch (descriptor.adjustedType)
 			{
 				case DescriptorAdjustedType::TIME_TZ:
-					return calendarConverter.opaqueTimeTzToTimeTz(
-						&statusWrapper, *reinterpret_cast<const OpaqueTimeTz*>(&message[descriptor.offset]));
+					return getCalendarConverter().opaqueTimeTzToTimeTz(
+						&getStatusWrapper(), *reinterpret_cast<const OpaqueTimeTz*>(&message[descriptor.offset]));
 
 				default:
 					throwInvalidType("TimeTz", descriptor.adjustedType);
@@ -444,7 +478,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a raw time-of-day column with timezone in Firebird's representation.
 		///
-		std::optional<OpaqueTimeTz> getOpaqueTimeTz(unsigned index)
+		std::optional<OpaqueTimeTz> getOpaqueTimeTz(unsigned index) const
 		{
 			const auto& descriptor = getDescriptor(index);
 
@@ -464,7 +498,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a timestamp-with-time-zone column.
 		///
-		std::optional<TimestampTz> getTimestampTz(unsigned index)
+		std::optional<TimestampTz> getTimestampTz(unsigned index) const
 		{
 			const auto& descriptor = getDescriptor(index);
 
@@ -474,8 +508,8 @@ namespace fbcpp
 			switch (descriptor.adjustedType)
 			{
 				case DescriptorAdjustedType::TIMESTAMP_TZ:
-					return calendarConverter.opaqueTimestampTzToTimestampTz(
-						&statusWrapper, *reinterpret_cast<const OpaqueTimestampTz*>(&message[descriptor.offset]));
+					return getCalendarConverter().opaqueTimestampTzToTimestampTz(
+						&getStatusWrapper(), *reinterpret_cast<const OpaqueTimestampTz*>(&message[descriptor.offset]));
 
 				default:
 					throwInvalidType("TimestampTz", descriptor.adjustedType);
@@ -485,7 +519,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a raw timestamp-with-time-zone column in Firebird's representation.
 		///
-		std::optional<OpaqueTimestampTz> getOpaqueTimestampTz(unsigned index)
+		std::optional<OpaqueTimestampTz> getOpaqueTimestampTz(unsigned index) const
 		{
 			const auto& descriptor = getDescriptor(index);
 
@@ -505,7 +539,7 @@ namespace fbcpp
 		///
 		/// @brief Reads a blob identifier column.
 		///
-		std::optional<BlobId> getBlobId(unsigned index)
+		std::optional<BlobId> getBlobId(unsigned index) const
 		{
 			const auto& descriptor = getDescriptor(index);
 
@@ -527,75 +561,79 @@ namespace fbcpp
 		}
 
 		///
-		/// @brief Reads a textual column, applying number-to-string conversions when needed.
+		/// @brief Reads a VARCHAR or CHAR column without copying it.
+		/// @return A view into the message buffer, valid until the row is refetched or destroyed.
 		///
-		std::optional<std::string> getString(unsigned index)
+		std::optional<std::string_view> getStringView(unsigned index) const
 		{
-			const auto& descriptor = getDescriptor(index);
+			const auto data = getStringData(index, "std::string_view");
 
-			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
+			if (!data)
 				return std::nullopt;
 
-			const auto data = &message[descriptor.offset];
-
-			switch (descriptor.adjustedType)
-			{
-				case DescriptorAdjustedType::BOOLEAN:
-					return (message[descriptor.offset] != std::byte{0}) ? std::string{"true"} : std::string{"false"};
-
-				case DescriptorAdjustedType::INT16:
-					return numericConverter.numberToString(
-						ScaledInt16{*reinterpret_cast<const std::int16_t*>(data), descriptor.scale});
-
-				case DescriptorAdjustedType::INT32:
-					return numericConverter.numberToString(
-						ScaledInt32{*reinterpret_cast<const std::int32_t*>(data), descriptor.scale});
-
-				case DescriptorAdjustedType::INT64:
-					return numericConverter.numberToString(
-						ScaledInt64{*reinterpret_cast<const std::int64_t*>(data), descriptor.scale});
+			return std::string_view{reinterpret_cast<const char*>(data + sizeof(std::uint16_t)),
+				*reinterpret_cast<const std::uint16_t*>(data)};
+		}
 
-				case DescriptorAdjustedType::INT128:
-					return numericConverter.opaqueInt128ToString(
-						&statusWrapper, *reinterpret_cast<const OpaqueInt128*>(data), descriptor.scale);
+		///
+		/// @brief Reads the raw bytes of a VARCHAR or CHAR column (e.g. CHARACTER SET OCTETS) without copying them.
+		/// @return A view into the message buffer, valid until the row is refetched or destroyed.
+		///
+		std::optional<std::span<const std::byte>> getBytes(unsigned index) const
+		{
+			const auto data = getStringData(index, "std::span<const std::byte>");
 
-				case DescriptorAdjustedType::FLOAT:
-					return numericConverter.numberToString(*reinterpret_cast<const float*>(data));
+			if (!data)
+				return std::nullopt;
 
-				case DescriptorAdjustedType::DOUBLE:
-					return numericConverter.numberToString(*reinterpret_cast<const double*>(data));
+			return std::span<const std::byte>{
+				data + sizeof(std::uint16_t), *reinterpret_cast<const std::uint16_t*>(data)};
+		}
 
-				case DescriptorAdjustedType::DATE:
-					return calendarConverter.opaqueDateToString(*reinterpret_cast<const OpaqueDate*>(data));
+		///
+		/// @brief Reads a textual column, applying number-to-string conversions when needed.
+		///
+		std::optional<std::string> getString(unsigned index) const
+		{
+			const auto& descriptor = getDescriptor(index);
 
-				case DescriptorAdjustedType::TIME:
-					return calendarConverter.opaqueTimeToString(*reinterpret_cast<const OpaqueTime*>(data));
+			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
+				return std::nullopt;
 
-				case DescriptorAdjustedType::TIMESTAMP:
-					return calendarConverter.opaqueTimestampToString(*reinterpret_cast<const OpaqueTimestamp*>(data));
+			std::string result;
+			appendString(descriptor, result);
+			return result;
+		}
 
-				case DescriptorAdjustedType::TIME_TZ:
-					return calendarConverter.opaqueTimeTzToString(
-						&statusWrapper, *reinterpret_cast<const OpaqueTimeTz*>(data));
+		///
+		/// @brief Reads a textual column like `getString()`, without allocating a `std::string`.
+		/// @return A view into the message buffer for textual columns, or otherwise into `arena`, valid until the
+		/// row is refetched or the arena is reset.
+		///
+		std::optional<std::string_view> getString(unsigned index, Arena& arena) const
+		{
+			const auto& descriptor = getDescriptor(index);
 
-				case DescriptorAdjustedType::TIMESTAMP_TZ:
-					return calendarConverter.opaqueTimestampTzToString(
-						&statusWrapper, *reinterpret_cast<const OpaqueTimestampTz*>(data));
+			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
+				return std::nullopt;
 
-				case DescriptorAdjustedType::DECFLOAT16:
-					return numericConverter.opaqueDecFloat16ToString(
-						&statusWrapper, *reinterpret_cast<const OpaqueDecFloat16*>(data));
+			const auto data = &message[descriptor.offset];
 
-				case DescriptorAdjustedType::DECFLOAT34:
-					return numericConverter.opaqueDecFloat34ToString(
-						&statusWrapper, *reinterpret_cast<const OpaqueDecFloat34*>(data));
+			switch (descriptor.adjustedType)
+			{
+				case DescriptorAdjustedType::BOOLEAN:
+					return (*data != std::byte{0}) ? std::string_view{"true"} : std::string_view{"false"};
 
 				case DescriptorAdjustedType::STRING:
-					return std::string{reinterpret_cast<const char*>(data + sizeof(std::uint16_t)),
+					return std::string_view{reinterpret_cast<const char*>(data + sizeof(std::uint16_t)),
 						*reinterpret_cast<const std::uint16_t*>(data)};
 
 				default:
-					throwInvalidType("std::string", descriptor.adjustedType);
+				{
+					auto& scratch = arena.getScratch();
+					appendString(descriptor, scratch);
+					return arena.store(scratch);
+				}
 			}
 		}
 
@@ -607,13 +645,32 @@ namespace fbcpp
 		/// @brief Retrieves a column using the most appropriate typed accessor specialization.
 		///
 		template <typename T>
-		T get(unsigned index);
+		T get(unsigned index) const;
+
+		///
+		/// @brief Retrieves a column by its alias or field name (case-insensitive).
+		/// @throws std::out_of_range if no column has that name.
+		///
+		template <typename T>
+		T get(const DescriptorName& name) const
+		{
+			return get<T>(getIndex(name));
+		}
+
+		///
+		/// @brief Returns the index of the column with the given alias or field name (case-insensitive).
+		/// @throws std::out_of_range if no column has that name.
+		///
+		unsigned getIndex(const DescriptorName& name) const
+		{
+			return descriptors->getIndex(name);
+		}
 
 		///
 		/// @brief Retrieves all output columns into a user-defined aggregate struct.
 		///
 		template <Aggregate T>
-		T get()
+		T get() const
 		{
 			using namespace impl::reflection;
 
@@ -632,7 +689,7 @@ namespace fbcpp
 		/// @brief Retrieves all output columns into a tuple-like type.
 		///
 		template <TupleLike T>
-		T get()
+		T get() const
 		{
 			using namespace impl::reflection;
 
@@ -647,11 +704,24 @@ namespace fbcpp
 			return getTuple<T>(std::make_index_sequence<N>{});
 		}
 
+		///
+		/// @brief Retrieves all output columns using a precomputed binding plan.
+		/// @throws FbCppException if the plan was built for a different descriptor set.
+		///
+		template <typename T>
+		T get(const BindingPlan<T>& plan) const
+		{
+			if (plan.getDescriptorSet().get() != descriptors)
+				throw FbCppException("BindingPlan was built for a different descriptor set");
+
+			return plan.read(*this, message.data());
+		}
+
 		///
 		/// @brief Retrieves a column value as a user-defined variant type.
 		///
 		template <VariantLike V>
-		V get(unsigned index)
+		V get(unsigned index) const
 		{
 			using namespace impl::reflection;
 
@@ -677,235 +747,223 @@ namespace fbcpp
 			return getVariantValue<V>(index, descriptor);
 		}
 
-	private:
-		const Descriptor& getDescriptor(unsigned index)
+		///
+		/// @brief Retrieves a column value as a user-defined variant type using a precomputed variant plan.
+		/// @throws FbCppException if the plan was built for a different descriptor set.
+		///
+		template <VariantLike V>
+		V get(const VariantPlan<V>& plan, unsigned index) const
 		{
-			if (index >= descriptors->size())
-				throw std::out_of_range("index out of range");
+			if (plan.getDescriptorSet().get() != descriptors)
+				throw FbCppException("VariantPlan was built for a different descriptor set");
 
-			return (*descriptors)[index];
+			return plan.read(*this, message.data(), index);
 		}
 
-		template <typename T, std::size_t... Is>
-		T getStruct(std::index_sequence<Is...>)
+	private:
+		impl::StatusWrapper& getStatusWrapper() const
 		{
-			using namespace impl::reflection;
+			if (borrowedStatusWrapper)
+				return *borrowedStatusWrapper;
 
-			return T{getStructField<FieldType<T, Is>>(static_cast<unsigned>(Is))...};
+			if (!ownedStatusWrapper)
+				ownedStatusWrapper.emplace(*client);
+
+			return *ownedStatusWrapper;
 		}
 
-		template <typename F>
-		auto getStructField(unsigned index)
+		impl::NumericConverter& getNumericConverter() const
 		{
-			using namespace impl::reflection;
+			if (borrowedNumericConverter)
+				return *borrowedNumericConverter;
 
-			if constexpr (isOptionalV<F>)
-				return get<F>(index);
-			else if constexpr (isVariantV<F>)
-				return get<F>(index);
-			else
-			{
-				auto opt = get<std::optional<F>>(index);
+			if (!ownedNumericConverter)
+				ownedNumericConverter.emplace(*client);
 
-				if (!opt.has_value())
-				{
-					throw FbCppException(
-						"Null value encountered for non-optional field at index " + std::to_string(index));
-				}
+			return *ownedNumericConverter;
+		}
 
-				return std::move(opt.value());
-			}
+		impl::CalendarConverter& getCalendarConverter() const
+		{
+			if (borrowedCalendarConverter)
+				return *borrowedCalendarConverter;
+
+			if (!ownedCalendarConverter)
+				ownedCalendarConverter.emplace(*client);
+
+			return *ownedCalendarConverter;
 		}
 
-		template <typename T, std::size_t... Is>
-		T getTuple(std::index_sequence<Is...>)
+		const DescriptorLayout& getDescriptor(unsigned index) const
 		{
-			using namespace impl::reflection;
+			if (index >= descriptors->size())
+				throw std::out_of_range("index out of range");
 
-			return T{getStructField<std::tuple_element_t<Is, T>>(static_cast<unsigned>(Is))...};
+			return descriptors->getLayout(index);
 		}
 
-		template <typename V>
-		V getVariantValue(unsigned index, const Descriptor& descriptor)
+		void appendString(const DescriptorLayout& descriptor, std::string& result) const
 		{
-			using namespace impl::reflection;
+			const auto data = &message[descriptor.offset];
 
 			switch (descriptor.adjustedType)
 			{
 				case DescriptorAdjustedType::BOOLEAN:
-					if constexpr (variantContainsV<bool, V>)
-						return V{get<std::optional<bool>>(index).value()};
+					result += (*data != std::byte{0}) ? "true" : "false";
 					break;
 
 				case DescriptorAdjustedType::INT16:
-					if (descriptor.scale != 0)
-					{
-						if constexpr (variantContainsV<ScaledInt16, V>)
-							return V{get<std::optional<ScaledInt16>>(index).value()};
-						if constexpr (variantContainsV<ScaledInt32, V>)
-							return V{get<std::optional<ScaledInt32>>(index).value()};
-						if constexpr (variantContainsV<ScaledInt64, V>)
-							return V{get<std::optional<ScaledInt64>>(index).value()};
-#if FB_CPP_USE_BOOST_MULTIPRECISION != 0
-						if constexpr (variantContainsV<ScaledBoostInt128, V>)
-							return V{get<std::optional<ScaledBoostInt128>>(index).value()};
-#endif
-					}
-					if constexpr (variantContainsV<std::int16_t, V>)
-						return V{get<std::optional<std::int16_t>>(index).value()};
+					getNumericConverter().appendNumberString(
+						result, ScaledInt16{*reinterpret_cast<const std::int16_t*>(data), descriptor.scale});
 					break;
 
 				case DescriptorAdjustedType::INT32:
-					if (descriptor.scale != 0)
-					{
-						if constexpr (variantContainsV<ScaledInt32, V>)
-							return V{get<std::optional<ScaledInt32>>(index).value()};
-						if constexpr (variantContainsV<ScaledInt64, V>)
-							return V{get<std::optional<ScaledInt64>>(index).value()};
-#if FB_CPP_USE_BOOST_MULTIPRECISION != 0
-						if constexpr (variantContainsV<ScaledBoostInt128, V>)
-							return V{get<std::optional<ScaledBoostInt128>>(index).value()};
-#endif
-					}
-					if constexpr (variantContainsV<std::int32_t, V>)
-						return V{get<std::optional<std::int32_t>>(index).value()};
+					getNumericConverter().appendNumberString(
+						result, ScaledInt32{*reinterpret_cast<const std::int32_t*>(data), descriptor.scale});
 					break;
 
 				case DescriptorAdjustedType::INT64:
-					if (descriptor.scale != 0)
-					{
-						if constexpr (variantContainsV<ScaledInt64, V>)
-							return V{get<std::optional<ScaledInt64>>(index).value()};
-#if FB_CPP_USE_BOOST_MULTIPRECISION != 0
-						if constexpr (variantContainsV<ScaledBoostInt128, V>)
-							return V{get<std::optional<ScaledBoostInt128>>(index).value()};
-#endif
-					}
-					if constexpr (variantContainsV<std::int64_t, V>)
-						return V{get<std::optional<std::int64_t>>(index).value()};
+					getNumericConverter().appendNumberString(
+						result, ScaledInt64{*reinterpret_cast<const std::int64_t*>(data), descriptor.scale});
 					break;
 
-#if FB_CPP_USE_BOOST_MULTIPRECISION != 0
 				case DescriptorAdjustedType::INT128:
-					if constexpr (variantContainsV<ScaledOpaqueInt128, V>)
-						return V{get<std::optional<ScaledOpaqueInt128>>(index).value()};
-					else if (descriptor.scale != 0)
-					{
-						if constexpr (variantContainsV<ScaledBoostInt128, V>)
-							return V{get<std::optional<ScaledBoostInt128>>(index).value()};
-					}
-					else if constexpr (variantContainsV<BoostInt128, V>)
-						return V{get<std::optional<BoostInt128>>(index).value()};
+					getNumericConverter().appendOpaqueInt128String(
+						result, &getStatusWrapper(), *reinterpret_cast<const OpaqueInt128*>(data), descriptor.scale);
 					break;
-#endif
 
 				case DescriptorAdjustedType::FLOAT:
-					if constexpr (variantContainsV<float, V>)
-						return V{get<std::optional<float>>(index).value()};
+					getNumericConverter().appendNumberString(result, *reinterpret_cast<const float*>(data));
 					break;
 
 				case DescriptorAdjustedType::DOUBLE:
-					if constexpr (variantContainsV<double, V>)
-						return V{get<std::optional<double>>(index).value()};
-					break;
-
-#if FB_CPP_USE_BOOST_MULTIPRECISION != 0
-				case DescriptorAdjustedType::DECFLOAT16:
-					if constexpr (variantContainsV<OpaqueDecFloat16, V>)
-						return V{get<std::optional<OpaqueDecFloat16>>(index).value()};
-					else if constexpr (variantContainsV<BoostDecFloat16, V>)
-						return V{get<std::optional<BoostDecFloat16>>(index).value()};
-					break;
-
-				case DescriptorAdjustedType::DECFLOAT34:
-					if constexpr (variantContainsV<OpaqueDecFloat34, V>)
-						return V{get<std::optional<OpaqueDecFloat34>>(index).value()};
-					else if constexpr (variantContainsV<BoostDecFloat34, V>)
-						return V{get<std::optional<BoostDecFloat34>>(index).value()};
-					break;
-#endif
-
-				case DescriptorAdjustedType::STRING:
-					if constexpr (variantContainsV<std::string, V>)
-						return V{get<std::optional<std::string>>(index).value()};
+					getNumericConverter().appendNumberString(result, *reinterpret_cast<const double*>(data));
 					break;
 
 				case DescriptorAdjustedType::DATE:
-					if constexpr (variantContainsV<OpaqueDate, V>)
-						return V{get<std::optional<OpaqueDate>>(index).value()};
-					else if constexpr (variantContainsV<Date, V>)
-						return V{get<std::optional<Date>>(index).value()};
+					getCalendarConverter().appendOpaqueDateString(result, *reinterpret_cast<const OpaqueDate*>(data));
 					break;
 
 				case DescriptorAdjustedType::TIME:
-					if constexpr (variantContainsV<OpaqueTime, V>)
-						return V{get<std::optional<OpaqueTime>>(index).value()};
-					else if constexpr (variantContainsV<Time, V>)
-						return V{get<std::optional<Time>>(index).value()};
+					getCalendarConverter().appendOpaqueTimeString(result, *reinterpret_cast<const OpaqueTime*>(data));
 					break;
 
 				case DescriptorAdjustedType::TIMESTAMP:
-					if constexpr (variantContainsV<OpaqueTimestamp, V>)
-						return V{get<std::optional<OpaqueTimestamp>>(index).value()};
-					else if constexpr (variantContainsV<Timestamp, V>)
-						return V{get<std::optional<Timestamp>>(index).value()};
+					getCalendarConverter().appendOpaqueTimestampString(
+						result, *reinterpret_cast<const OpaqueTimestamp*>(data));
 					break;
 
 				case DescriptorAdjustedType::TIME_TZ:
-					if constexpr (variantContainsV<OpaqueTimeTz, V>)
-						return V{get<std::optional<OpaqueTimeTz>>(index).value()};
-					else if constexpr (variantContainsV<TimeTz, V>)
-						return V{get<std::optional<TimeTz>>(index).value()};
+					getCalendarConverter().appendOpaqueTimeTzString(
+						result, &getStatusWrapper(), *reinterpret_cast<const OpaqueTimeTz*>(data));
 					break;
 
 				case DescriptorAdjustedType::TIMESTAMP_TZ:
-					if constexpr (variantContainsV<OpaqueTimestampTz, V>)
-						return V{get<std::optional<OpaqueTimestampTz>>(index).value()};
-					else if constexpr (variantContainsV<TimestampTz, V>)
-						return V{get<std::optional<TimestampTz>>(index).value()};
+					getCalendarConverter().appendOpaqueTimestampTzString(
+						result, &getStatusWrapper(), *reinterpret_cast<const OpaqueTimestampTz*>(data));
 					break;
 
-				case DescriptorAdjustedType::BLOB:
-					if constexpr (variantContainsV<BlobId, V>)
-						return V{get<std::optional<BlobId>>(index).value()};
+				case DescriptorAdjustedType::DECFLOAT16:
+					getNumericConverter().appendOpaqueDecFloat16String(
+						result, &getStatusWrapper(), *reinterpret_cast<const OpaqueDecFloat16*>(data));
 					break;
 
-				default:
+				case DescriptorAdjustedType::DECFLOAT34:
+					getNumericConverter().appendOpaqueDecFloat34String(
+						result, &getStatusWrapper(), *reinterpret_cast<const OpaqueDecFloat34*>(data));
+					break;
+
+				case DescriptorAdjustedType::STRING:
+					result.append(reinterpret_cast<const char*>(data + sizeof(std::uint16_t)),
+						*reinterpret_cast<const std::uint16_t*>(data));
 					break;
+
+				default:
+					throwInvalidType("std::string", descriptor.adjustedType);
 			}
+		}
+
+		const std::byte* getStringData(unsigned index, const char* typeName) const
+		{
+			const auto& descriptor = getDescriptor(index);
 
-			return tryVariantAlternatives<V, 0>(index, descriptor);
+			if (descriptor.adjustedType != DescriptorAdjustedType::STRING)
+				throwInvalidType(typeName, descriptor.adjustedType);
+
+			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
+				return nullptr;
+
+			return &message[descriptor.offset];
 		}
 
-		template <typename V, std::size_t I = 0>
-		V tryVariantAlternatives(unsigned index, [[maybe_unused]] const Descriptor& descriptor)
+		template <typename T, std::size_t... Is>
+		T getStruct(std::index_sequence<Is...>) const
 		{
 			using namespace impl::reflection;
 
-			if constexpr (I >= std::variant_size_v<V>)
-			{
-				throw FbCppException(
-					"Cannot convert SQL type to any variant alternative at index " + std::to_string(index));
-			}
+			return T{getStructField<FieldType<T, Is>>(static_cast<unsigned>(Is))...};
+		}
+
+		template <typename F>
+		auto getStructField(unsigned index) const
+		{
+			using namespace impl::reflection;
+
+			if constexpr (isOptionalV<F>)
+				return get<F>(index);
+			else if constexpr (isVariantV<F>)
+				return get<F>(index);
 			else
 			{
-				using Alt = std::variant_alternative_t<I, V>;
+				auto opt = get<std::optional<F>>(index);
 
-				if constexpr (std::is_same_v<Alt, std::monostate>)
-					return tryVariantAlternatives<V, I + 1>(index, descriptor);
-				else if constexpr (isOpaqueTypeV<Alt>)
-					return tryVariantAlternatives<V, I + 1>(index, descriptor);
-				else
+				if (!opt.has_value())
 				{
-					auto opt = get<std::optional<Alt>>(index);
-					return V{std::move(opt.value())};
+					throw FbCppException(
+						"Null value encountered for non-optional field at index " + std::to_string(index));
 				}
+
+				return std::move(opt.value());
 			}
 		}
 
+		template <typename T, std::size_t... Is>
+		T getTuple(std::index_sequence<Is...>) const
+		{
+			using namespace impl::reflection;
+
+			return T{getStructField<std::tuple_element_t<Is, T>>(static_cast<unsigned>(Is))...};
+		}
+
+		template <typename V>
+		V getVariantValue(unsigned index, const DescriptorLayout& descriptor) const
+		{
+			const auto alternative = impl::resolveVariantAlternative<V>(descriptor);
+
+			if (alternative == std::variant_npos)
+				impl::throwNoVariantAlternative(index);
+
+			return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+			{
+				static constexpr V (*getters[])(const Row&, unsigned) = {&Row::getVariantAlternative<V, Is>...};
+				return getters[alternative](*this, index);
+			}(std::make_index_sequence<std::variant_size_v<V>>{});
+		}
+
+		template <typename V, std::size_t I>
+		static V getVariantAlternative(const Row& row, unsigned index)
+		{
+			using Alt = std::variant_alternative_t<I, V>;
+
+			if constexpr (std::is_same_v<Alt, std::monostate>)
+				return V{std::in_place_index<I>};
+			else
+				return V{std::in_place_index<I>, row.get<std::optional<Alt>>(index).value()};
+		}
+
 		// FIXME: floating to integral
 		template <typename T>
-		std::optional<T> getNumber(unsigned index, std::optional<int>& scale, const char* typeName)
+		std::optional<T> getNumber(unsigned index, std::optional<int>& scale, const char* typeName) const
 		{
 			const auto& descriptor = getDescriptor(index);
 
@@ -919,25 +977,41 @@ namespace fbcpp
 			std::optional<BoostDecFloat34> boostDecFloat34;
 #endif
 
+#if FB_CPP_USE_NATIVE_NUMERIC != 0
+			if constexpr (std::is_arithmetic_v<T>)
+			{
+				switch (descriptor.adjustedType)
+				{
+					case DescriptorAdjustedType::INT128:
+					case DescriptorAdjustedType::DECFLOAT16:
+					case DescriptorAdjustedType::DECFLOAT34:
+						return getNativeNumber<T>(descriptor, data, scale, typeName);
+
+					default:
+						break;
+				}
+			}
+#endif
+
 			// FIXME: Use IUtil
 			switch (descriptor.adjustedType)
 			{
 #if FB_CPP_USE_BOOST_MULTIPRECISION != 0
 				case DescriptorAdjustedType::INT128:
 					boostInt128.emplace(
-						numericConverter.opaqueInt128ToBoostInt128(*reinterpret_cast<const OpaqueInt128*>(data)));
+						getNumericConverter().opaqueInt128ToBoostInt128(*reinterpret_cast<const OpaqueInt128*>(data)));
 					data = reinterpret_cast<const std::byte*>(&boostInt128.value());
 					break;
 
 				case DescriptorAdjustedType::DECFLOAT16:
-					boostDecFloat16.emplace(numericConverter.opaqueDecFloat16ToBoostDecFloat16(
-						&statusWrapper, *reinterpret_cast<const OpaqueDecFloat16*>(data)));
+					boostDecFloat16.emplace(getNumericConverter().opaqueDecFloat16ToBoostDecFloat16(
+						&getStatusWrapper(), *reinterpret_cast<const OpaqueDecFloat16*>(data)));
 					data = reinterpret_cast<const std::byte*>(&boostDecFloat16.value());
 					break;
 
 				case DescriptorAdjustedType::DECFLOAT34:
-					boostDecFloat34.emplace(numericConverter.opaqueDecFloat34ToBoostDecFloat34(
-						&statusWrapper, *reinterpret_cast<const OpaqueDecFloat34*>(data)));
+					boostDecFloat34.emplace(getNumericConverter().opaqueDecFloat34ToBoostDecFloat34(
+						&getStatusWrapper(), *reinterpret_cast<const OpaqueDecFloat34*>(data)));
 					data = reinterpret_cast<const std::byte*>(&boostDecFloat34.value());
 					break;
 #endif
@@ -949,6 +1023,51 @@ namespace fbcpp
 			return convertNumber<T>(descriptor, data, scale, typeName);
 		}
 
+#if FB_CPP_USE_NATIVE_NUMERIC != 0
+		// Converts INT128 and DECFLOAT columns to built-in arithmetic types without fbclient or Boost.
+		template <typename T>
+		T getNativeNumber(const DescriptorLayout& descriptor, const std::byte* data, std::optional<int>& scale,
+			const char* typeName) const
+		{
+			const bool isInt128 = descriptor.adjustedType == DescriptorAdjustedType::INT128;
+			const bool isDecFloat16 = descriptor.adjustedType == DescriptorAdjustedType::DECFLOAT16;
+
+			if (!scale.has_value())
+			{
+				if (!isInt128)
+					throwInvalidType(typeName, descriptor.adjustedType);
+
+				scale = descriptor.scale;
+			}
+
+			if constexpr (std::is_floating_point_v<T>)
+			{
+				if (isInt128)
+				{
+					return static_cast<T>(
+						impl::int128ToDouble(*reinterpret_cast<const OpaqueInt128*>(data), descriptor.scale));
+				}
+
+				return static_cast<T>(isDecFloat16
+						? impl::decFloat16ToDouble(*reinterpret_cast<const OpaqueDecFloat16*>(data))
+						: impl::decFloat34ToDouble(*reinterpret_cast<const OpaqueDecFloat34*>(data)));
+			}
+			else
+			{
+				const auto toScale = scale.value();
+				const auto int64Value = isInt128
+					? impl::int128ToInt64(*reinterpret_cast<const OpaqueInt128*>(data), descriptor.scale, toScale)
+					: isDecFloat16 ? impl::decFloat16ToInt64(*reinterpret_cast<const OpaqueDecFloat16*>(data), toScale)
+								   : impl::decFloat34ToInt64(*reinterpret_cast<const OpaqueDecFloat34*>(data), toScale);
+
+				if (!int64Value.has_value())
+					getNumericConverter().throwNumericOutOfRange();
+
+				return getNumericConverter().numberToNumber<T>(ScaledInt64{int64Value.value(), toScale}, toScale);
+			}
+		}
+#endif
+
 		[[noreturn]] static void throwInvalidType(const char* actualType, DescriptorAdjustedType descriptorType)
 		{
 			throw FbCppException("Invalid type: actual type " + std::string(actualType) + ", descriptor type " +
@@ -956,8 +1075,8 @@ namespace fbcpp
 		}
 
 		template <typename T>
-		T convertNumber(
-			const Descriptor& descriptor, const std::byte* data, std::optional<int>& toScale, const char* toTypeName)
+		T convertNumber(const DescriptorLayout& descriptor, const std::byte* data, std::optional<int>& toScale,
+			const char* toTypeName) const
 		{
 			if (!toScale.has_value())
 			{
@@ -979,37 +1098,37 @@ namespace fbcpp
 			switch (descriptor.adjustedType)
 			{
 				case DescriptorAdjustedType::INT16:
-					return numericConverter.numberToNumber<T>(
+					return getNumericConverter().numberToNumber<T>(
 						ScaledInt16{*reinterpret_cast<const std::int16_t*>(data), descriptor.scale}, toScale.value());
 
 				case DescriptorAdjustedType::INT32:
-					return numericConverter.numberToNumber<T>(
+					return getNumericConverter().numberToNumber<T>(
 						ScaledInt32{*reinterpret_cast<const std::int32_t*>(data), descriptor.scale}, toScale.value());
 
 				case DescriptorAdjustedType::INT64:
-					return numericConverter.numberToNumber<T>(
+					return getNumericConverter().numberToNumber<T>(
 						ScaledInt64{*reinterpret_cast<const std::int64_t*>(data), descriptor.scale}, toScale.value());
 
 #if FB_CPP_USE_BOOST_MULTIPRECISION != 0
 				case DescriptorAdjustedType::INT128:
-					return numericConverter.numberToNumber<T>(
+					return getNumericConverter().numberToNumber<T>(
 						ScaledBoostInt128{*reinterpret_cast<const BoostInt128*>(data), descriptor.scale},
 						toScale.value());
 
 				case DescriptorAdjustedType::DECFLOAT16:
-					return numericConverter.numberToNumber<T>(
+					return getNumericConverter().numberToNumber<T>(
 						*reinterpret_cast<const BoostDecFloat16*>(data), toScale.value());
 
 				case DescriptorAdjustedType::DECFLOAT34:
-					return numericConverter.numberToNumber<T>(
+					return getNumericConverter().numberToNumber<T>(
 						*reinterpret_cast<const BoostDecFloat34*>(data), toScale.value());
 #endif
 
 				case DescriptorAdjustedType::FLOAT:
-					return numericConverter.numberToNumber<T>(*reinterpret_cast<const float*>(data), toScale.value());
+					return getNumericConverter().numberToNumber<T>(*reinterpret_cast<const float*>(data), toScale.value());
 
 				case DescriptorAdjustedType::DOUBLE:
-					return numericConverter.numberToNumber<T>(*reinterpret_cast<const double*>(data), toScale.value());
+					return getNumericConverter().numberToNumber<T>(*reinterpret_cast<const double*>(data), toScale.value());
 
 				default:
 					throwInvalidType(toTypeName, descriptor.adjustedType);
@@ -1018,11 +1137,14 @@ namespace fbcpp
 
 	private:
 		Client* client;
-		const std::vector<Descriptor>* descriptors;
+		const DescriptorSet* descriptors;
 		std::span<const std::byte> message;
-		impl::StatusWrapper statusWrapper;
-		impl::NumericConverter numericConverter;
-		impl::CalendarConverter calendarConverter;
+		impl::StatusWrapper* borrowedStatusWrapper = nullptr;
+		impl::NumericConverter* borrowedNumericConverter = nullptr;
+		impl::CalendarConverter* borrowedCalendarConverter = nullptr;
+		mutable std::optional<impl::StatusWrapper> ownedStatusWrapper;
+		mutable std::optional<impl::NumericConverter> ownedNumericConverter;
+		mutable std::optional<impl::CalendarConverter> ownedCalendarConverter;
 	};
 
 	///
@@ -1031,179 +1153,185 @@ namespace fbcpp
 	///
 
 	template <>
-	inline std::optional<bool> Row::get<std::optional<bool>>(unsigned index)
+	inline std::optional<bool> Row::get<std::optional<bool>>(unsigned index) const
 	{
 		return getBool(index);
 	}
 
 	template <>
-	inline std::optional<BlobId> Row::get<std::optional<BlobId>>(unsigned index)
+	inline std::optional<BlobId> Row::get<std::optional<BlobId>>(unsigned index) const
 	{
 		return getBlobId(index);
 	}
 
 	template <>
-	inline std::optional<std::int16_t> Row::get<std::optional<std::int16_t>>(unsigned index)
+	inline std::optional<std::int16_t> Row::get<std::optional<std::int16_t>>(unsigned index) const
 	{
 		return getInt16(index);
 	}
 
 	template <>
-	inline std::optional<ScaledInt16> Row::get<std::optional<ScaledInt16>>(unsigned index)
+	inline std::optional<ScaledInt16> Row::get<std::optional<ScaledInt16>>(unsigned index) const
 	{
 		return getScaledInt16(index);
 	}
 
 	template <>
-	inline std::optional<std::int32_t> Row::get<std::optional<std::int32_t>>(unsigned index)
+	inline std::optional<std::int32_t> Row::get<std::optional<std::int32_t>>(unsigned index) const
 	{
 		return getInt32(index);
 	}
 
 	template <>
-	inline std::optional<ScaledInt32> Row::get<std::optional<ScaledInt32>>(unsigned index)
+	inline std::optional<ScaledInt32> Row::get<std::optional<ScaledInt32>>(unsigned index) const
 	{
 		return getScaledInt32(index);
 	}
 
 	template <>
-	inline std::optional<std::int64_t> Row::get<std::optional<std::int64_t>>(unsigned index)
+	inline std::optional<std::int64_t> Row::get<std::optional<std::int64_t>>(unsigned index) const
 	{
 		return getInt64(index);
 	}
 
 	template <>
-	inline std::optional<ScaledInt64> Row::get<std::optional<ScaledInt64>>(unsigned index)
+	inline std::optional<ScaledInt64> Row::get<std::optional<ScaledInt64>>(unsigned index) const
 	{
 		return getScaledInt64(index);
 	}
 
 	template <>
-	inline std::optional<ScaledOpaqueInt128> Row::get<std::optional<ScaledOpaqueInt128>>(unsigned index)
+	inline std::optional<ScaledOpaqueInt128> Row::get<std::optional<ScaledOpaqueInt128>>(unsigned index) const
 	{
 		return getScaledOpaqueInt128(index);
 	}
 
 #if FB_CPP_USE_BOOST_MULTIPRECISION != 0
 	template <>
-	inline std::optional<BoostInt128> Row::get<std::optional<BoostInt128>>(unsigned index)
+	inline std::optional<BoostInt128> Row::get<std::optional<BoostInt128>>(unsigned index) const
 	{
 		return getBoostInt128(index);
 	}
 
 	template <>
-	inline std::optional<ScaledBoostInt128> Row::get<std::optional<ScaledBoostInt128>>(unsigned index)
+	inline std::optional<ScaledBoostInt128> Row::get<std::optional<ScaledBoostInt128>>(unsigned index) const
 	{
 		return getScaledBoostInt128(index);
 	}
 #endif
 
 	template <>
-	inline std::optional<float> Row::get<std::optional<float>>(unsigned index)
+	inline std::optional<float> Row::get<std::optional<float>>(unsigned index) const
 	{
 		return getFloat(index);
 	}
 
 	template <>
-	inline std::optional<double> Row::get<std::optional<double>>(unsigned index)
+	inline std::optional<double> Row::get<std::optional<double>>(unsigned index) const
 	{
 		return getDouble(index);
 	}
 
 	template <>
-	inline std::optional<OpaqueDecFloat16> Row::get<std::optional<OpaqueDecFloat16>>(unsigned index)
+	inline std::optional<OpaqueDecFloat16> Row::get<std::optional<OpaqueDecFloat16>>(unsigned index) const
 	{
 		return getOpaqueDecFloat16(index);
 	}
 
 #if FB_CPP_USE_BOOST_MULTIPRECISION != 0
 	template <>
-	inline std::optional<BoostDecFloat16> Row::get<std::optional<BoostDecFloat16>>(unsigned index)
+	inline std::optional<BoostDecFloat16> Row::get<std::optional<BoostDecFloat16>>(unsigned index) const
 	{
 		return getBoostDecFloat16(index);
 	}
 #endif
 
 	template <>
-	inline std::optional<OpaqueDecFloat34> Row::get<std::optional<OpaqueDecFloat34>>(unsigned index)
+	inline std::optional<OpaqueDecFloat34> Row::get<std::optional<OpaqueDecFloat34>>(unsigned index) const
 	{
 		return getOpaqueDecFloat34(index);
 	}
 
 #if FB_CPP_USE_BOOST_MULTIPRECISION != 0
 	template <>
-	inline std::optional<BoostDecFloat34> Row::get<std::optional<BoostDecFloat34>>(unsigned index)
+	inline std::optional<BoostDecFloat34> Row::get<std::optional<BoostDecFloat34>>(unsigned index) const
 	{
 		return getBoostDecFloat34(index);
 	}
 #endif
 
 	template <>
-	inline std::optional<Date> Row::get<std::optional<Date>>(unsigned index)
+	inline std::optional<Date> Row::get<std::optional<Date>>(unsigned index) const
 	{
 		return getDate(index);
 	}
 
 	template <>
-	inline std::optional<OpaqueDate> Row::get<std::optional<OpaqueDate>>(unsigned index)
+	inline std::optional<OpaqueDate> Row::get<std::optional<OpaqueDate>>(unsigned index) const
 	{
 		return getOpaqueDate(index);
 	}
 
 	template <>
-	inline std::optional<Time> Row::get<std::optional<Time>>(unsigned index)
+	inline std::optional<Time> Row::get<std::optional<Time>>(unsigned index) const
 	{
 		return getTime(index);
 	}
 
 	template <>
-	inline std::optional<OpaqueTime> Row::get<std::optional<OpaqueTime>>(unsigned index)
+	inline std::optional<OpaqueTime> Row::get<std::optional<OpaqueTime>>(unsigned index) const
 	{
 		return getOpaqueTime(index);
 	}
 
 	template <>
-	inline std::optional<OpaqueTimestamp> Row::get<std::optional<OpaqueTimestamp>>(unsigned index)
+	inline std::optional<OpaqueTimestamp> Row::get<std::optional<OpaqueTimestamp>>(unsigned index) const
 	{
 		return getOpaqueTimestamp(index);
 	}
 
 	template <>
-	inline std::optional<Timestamp> Row::get<std::optional<Timestamp>>(unsigned index)
+	inline std::optional<Timestamp> Row::get<std::optional<Timestamp>>(unsigned index) const
 	{
 		return getTimestamp(index);
 	}
 
 	template <>
-	inline std::optional<TimeTz> Row::get<std::optional<TimeTz>>(unsigned index)
+	inline std::optional<TimeTz> Row::get<std::optional<TimeTz>>(unsigned index) const
 	{
 		return getTimeTz(index);
 	}
 
 	template <>
-	inline std::optional<OpaqueTimeTz> Row::get<std::optional<OpaqueTimeTz>>(unsigned index)
+	inline std::optional<OpaqueTimeTz> Row::get<std::optional<OpaqueTimeTz>>(unsigned index) const
 	{
 		return getOpaqueTimeTz(index);
 	}
 
 	template <>
-	inline std::optional<TimestampTz> Row::get<std::optional<TimestampTz>>(unsigned index)
+	inline std::optional<TimestampTz> Row::get<std::optional<TimestampTz>>(unsigned index) const
 	{
 		return getTimestampTz(index);
 	}
 
 	template <>
-	inline std::optional<OpaqueTimestampTz> Row::get<std::optional<OpaqueTimestampTz>>(unsigned index)
+	inline std::optional<OpaqueTimestampTz> Row::get<std::optional<OpaqueTimestampTz>>(unsigned index) const
 	{
 		return getOpaqueTimestampTz(index);
 	}
 
 	template <>
-	inline std::optional<std::string> Row::get<std::optional<std::string>>(unsigned index)
+	inline std::optional<std::string> Row::get<std::optional<std::string>>(unsigned index) const
 	{
 		return getString(index);
 	}
 
+	template <>
+	inline std::optional<std::string_view> Row::get<std::optional<std::string_view>>(unsigned index) const
+	{
+		return getStringView(index);
+	}
+
 	///
 	/// @}
 	///
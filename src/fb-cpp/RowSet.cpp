@@ -25,6 +25,9 @@
 #include "RowSet.h"
 #include "Client.h"
 #include "Statement.h"
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
 
 using namespace fbcpp;
 using namespace fbcpp::impl;
@@ -32,6 +35,7 @@ using namespace fbcpp::impl;
 
 RowSet::RowSet(Statement& statement, unsigned maxRows)
 	: client{&statement.getAttachment().getClient()},
+	  maxRows{maxRows},
 	  statusWrapper{statement.getAttachment().getClient()},
 	  numericConverter{statement.getAttachment().getClient()},
 	  calendarConverter{statement.getAttachment().getClient()}
@@ -39,24 +43,305 @@ RowSet::RowSet(Statement& statement, unsigned maxRows)
 	assert(statement.isValid());
 	assert(statement.getResultSetHandle());
 
-	descriptors = statement.getOutputDescriptors();
+	init(statement);
+	fetch(statement);
+}
+
+RowSet::RowSet(Statement& statement, unsigned maxRows, unsigned position)
+	: client{&statement.getAttachment().getClient()},
+	  maxRows{maxRows},
+	  statusWrapper{statement.getAttachment().getClient()},
+	  numericConverter{statement.getAttachment().getClient()},
+	  calendarConverter{statement.getAttachment().getClient()}
+{
+	assert(statement.isValid());
+	assert(statement.getResultSetHandle());
+
+	init(statement);
+	fetch(statement, position);
+}
+
+RowSet::RowSet(
+	Statement& statement, unsigned maxRows, Transaction& transaction, const BlobPrefetchOptions& options)
+	: client{&statement.getAttachment().getClient()},
+	  maxRows{maxRows},
+	  statusWrapper{statement.getAttachment().getClient()},
+	  numericConverter{statement.getAttachment().getClient()},
+	  calendarConverter{statement.getAttachment().getClient()}
+{
+	assert(statement.isValid());
+	assert(statement.getResultSetHandle());
+
+	if (options.getMaxBlobSize() == 0)
+		throw std::invalid_argument{"BlobPrefetchOptions maxBlobSize must be greater than zero"};
+
+	init(statement);
+
+	blobs = std::make_unique<PrefetchedBlobs>();
+	blobs->attachment = &statement.getAttachment();
+	blobs->transaction = &transaction;
+	blobs->maxBlobSize = options.getMaxBlobSize();
+
+	const auto& layouts = descriptors->getLayouts();
+
+	if (options.getColumns().empty())
+	{
+		for (unsigned column = 0; column < layouts.size(); ++column)
+		{
+			if (layouts[column].adjustedType == DescriptorAdjustedType::BLOB)
+				blobs->columns.push_back(column);
+		}
+	}
+	else
+	{
+		for (const auto column : options.getColumns())
+		{
+			if (column >= layouts.size())
+				throw std::out_of_range("index out of range");
+
+			if (layouts[column].adjustedType != DescriptorAdjustedType::BLOB)
+				throw std::invalid_argument{"BlobPrefetchOptions columns must be BLOB columns"};
+
+			blobs->columns.push_back(column);
+		}
+	}
+
+	fetch(statement);
+}
+
+RowSet::RowSet(Statement& statement, unsigned maxRows, CurrentRowTag)
+	: client{&statement.getAttachment().getClient()},
+	  maxRows{maxRows},
+	  statusWrapper{statement.getAttachment().getClient()},
+	  numericConverter{statement.getAttachment().getClient()},
+	  calendarConverter{statement.getAttachment().getClient()}
+{
+	assert(statement.isValid());
+	assert(statement.getResultSetHandle());
+
+	init(statement);
+	fetch(statement, std::nullopt, true);
+}
+
+RowSet RowSet::fromCurrentRow(Statement& statement, unsigned maxRows)
+{
+	return RowSet{statement, maxRows, CurrentRowTag{}};
+}
 
-	auto outMetadata = statement.getOutputMetadata();
-	messageLength = outMetadata->getMessageLength(&statusWrapper);
+void RowSet::init(Statement& statement)
+{
+	descriptors = statement.getOutputDescriptorSet();
+	messageFormat = statement.getOutputMessageFormat();
 
+	// Rows of a bound message struct are spaced as an array of the struct.
+	if (messageFormat)
+		messageLength = messageFormat->size;
+	else
+	{
+		auto outMetadata = statement.getOutputMetadata();
+		messageLength = outMetadata->getMessageLength(&statusWrapper);
+	}
+}
+
+bool RowSet::refill(Statement& statement)
+{
+	assert(statement.isValid());
+	assert(statement.getResultSetHandle());
+
+	// The cursor is exhausted: drop the rows without calling fetchNext() past the end again.
+	if (eof)
+	{
+		count = 0;
+		buffer.clear();
+
+		if (arena)
+			arena->reset();
+
+		if (blobs)
+		{
+			blobs->slots.clear();
+			blobs->data.clear();
+		}
+
+		return false;
+	}
+
+	fetch(statement);
+
+	return count != 0;
+}
+
+bool RowSet::refillAt(Statement& statement, unsigned position)
+{
+	assert(statement.isValid());
+	assert(statement.getResultSetHandle());
+
+	fetch(statement, position);
+
+	return count != 0;
+}
+
+RowSetSlice RowSet::slice(unsigned begin, unsigned end) const
+{
+	if (begin > end || end > count)
+		throw std::out_of_range("RowSet slice out of range");
+
+	return RowSetSlice{*client, descriptors, buffer.data() + static_cast<std::size_t>(begin) * messageLength,
+		messageLength, begin, end - begin};
+}
+
+AsyncOperation<RowSet> RowSet::fetchAsync(AsyncExecutor& executor, Statement& statement, unsigned maxRows)
+{
+	return executor.run(&statement.getAttachment(), [&statement, maxRows] { return RowSet{statement, maxRows}; });
+}
+
+AsyncOperation<bool> RowSet::refillAsync(AsyncExecutor& executor, Statement& statement)
+{
+	return executor.run(&statement.getAttachment(), [this, &statement] { return refill(statement); });
+}
+
+void RowSet::fetch(Statement& statement, std::optional<unsigned> position, bool currentRow)
+{
+	// Shrinking in a previous window keeps the capacity, so this does not reallocate.
 	buffer.resize(static_cast<std::size_t>(maxRows) * messageLength);
 
 	auto resultSet = statement.getResultSetHandle();
 	auto* dest = buffer.data();
 
-	for (unsigned i = 0; i < maxRows; ++i)
+	count = 0;
+	eof = false;
+
+	if (arena)
+		arena->reset();
+
+	if (currentRow && maxRows != 0)
 	{
-		if (resultSet->fetchNext(&statusWrapper, dest) != fb::IStatus::RESULT_OK)
-			break;
+		const auto& message = statement.getOutputMessage();
+		assert(message.size() >= messageLength);
 
+		std::copy_n(message.begin(), messageLength, dest);
 		dest += messageLength;
 		++count;
 	}
 
+	OperationScope scope{statement.getObserver().get(), OperationType::ROW_SET_FETCH, statement.getSql()};
+	const auto timed = statement.getSlowQueryLog() != nullptr;
+	const auto start = timed ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+
+	try
+	{
+		for (unsigned i = count; i < maxRows; ++i)
+		{
+			MetricsScope metrics{client->getMetricsRegistry(), MetricsCall::FETCH};
+			const auto status = i == 0 && position.has_value()
+				? resultSet->fetchAbsolute(&statusWrapper, static_cast<int>(position.value()), dest)
+				: resultSet->fetchNext(&statusWrapper, dest);
+
+			if (status != fb::IStatus::RESULT_OK)
+			{
+				eof = true;
+				break;
+			}
+
+			dest += messageLength;
+			++count;
+		}
+	}
+	catch (...)
+	{
+		buffer.resize(static_cast<std::size_t>(dest - buffer.data()));
+		scope.fail();
+		throw;
+	}
+
 	buffer.resize(static_cast<std::size_t>(dest - buffer.data()));
+	scope.finish(count, buffer.size());
+
+	if (timed) [[unlikely]]
+		statement.addExternalFetch(std::chrono::steady_clock::now() - start, count, eof);
+
+	if (blobs)
+		prefetchBlobs();
+}
+
+void RowSet::prefetchBlobs()
+{
+	auto& prefetched = *blobs;
+	using State = PrefetchedBlobs::State;
+
+	prefetched.slots.clear();
+	prefetched.data.clear();
+
+	// Read one byte past the threshold to tell the blobs that fit from the ones that do not.
+	prefetched.readBuffer.resize(static_cast<std::size_t>(prefetched.maxBlobSize) + 1u);
+
+	for (unsigned index = 0; index < count; ++index)
+	{
+		const auto row = getRow(index);
+
+		for (const auto column : prefetched.columns)
+		{
+			const auto blobId = row.getBlobId(column);
+
+			if (!blobId)
+			{
+				prefetched.slots.push_back({.offset = 0, .length = 0, .state = State::NULL_BLOB});
+				continue;
+			}
+
+			Blob blob{*prefetched.attachment, *prefetched.transaction, blobId.value()};
+			const auto length = blob.read(std::span{prefetched.readBuffer});
+			blob.close();
+
+			if (length > prefetched.maxBlobSize)
+			{
+				prefetched.slots.push_back({.offset = 0, .length = 0, .state = State::TOO_LARGE});
+				continue;
+			}
+
+			const auto offset = prefetched.data.size();
+			prefetched.data.insert(
+				prefetched.data.end(), prefetched.readBuffer.begin(), prefetched.readBuffer.begin() + length);
+			prefetched.slots.push_back({.offset = offset, .length = length, .state = State::PREFETCHED});
+		}
+	}
+}
+
+const RowSet::PrefetchedBlobs::Slot* RowSet::findBlobSlot(unsigned index, unsigned column) const
+{
+	assert(index < count);
+
+	if (!blobs)
+		return nullptr;
+
+	const auto& columns = blobs->columns;
+	const auto position = std::find(columns.begin(), columns.end(), column);
+
+	if (position == columns.end())
+		return nullptr;
+
+	const auto slot =
+		static_cast<std::size_t>(index) * columns.size() + static_cast<std::size_t>(position - columns.begin());
+
+	// A window whose fetch or prefetch failed may have fewer slots than rows.
+	return slot < blobs->slots.size() ? &blobs->slots[slot] : nullptr;
+}
+
+bool RowSet::isBlobPrefetched(unsigned index, unsigned column) const
+{
+	const auto slot = findBlobSlot(index, column);
+	return slot && slot->state != PrefetchedBlobs::State::TOO_LARGE;
+}
+
+std::optional<std::span<const std::byte>> RowSet::getBlobBytes(unsigned index, unsigned column) const
+{
+	const auto slot = findBlobSlot(index, column);
+
+	if (!slot || slot->state == PrefetchedBlobs::State::TOO_LARGE)
+		throw FbCppException("Blob was not prefetched");
+
+	if (slot->state == PrefetchedBlobs::State::NULL_BLOB)
+		return std::nullopt;
+
+	return std::span<const std::byte>{blobs->data}.subspan(slot->offset, slot->length);
 }
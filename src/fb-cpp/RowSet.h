@@ -26,15 +26,23 @@
 #define FBCPP_ROWSET_H
 
 #include "fb-api.h"
+#include "Arena.h"
 #include "Row.h"
 #include "SmartPtrs.h"
 #include "NumericConverter.h"
 #include "CalendarConverter.h"
 #include "Descriptor.h"
 #include "Exception.h"
+#include "AsyncExecutor.h"
+#include "MessageStruct.h"
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <optional>
 #include <span>
+#include <string_view>
 #include <vector>
 
 
@@ -43,7 +51,55 @@
 ///
 namespace fbcpp
 {
+	class Attachment;
 	class Statement;
+	class Transaction;
+	class RowSetSlice;
+
+	///
+	/// Represents options used to prefetch the blob contents of a RowSet.
+	///
+	class BlobPrefetchOptions final
+	{
+	public:
+		///
+		/// Returns the indexes of the columns whose blobs are prefetched. Empty means all BLOB columns.
+		///
+		const std::vector<unsigned>& getColumns() const
+		{
+			return columns;
+		}
+
+		///
+		/// Sets the indexes of the columns whose blobs are prefetched. Empty means all BLOB columns.
+		///
+		BlobPrefetchOptions& setColumns(const std::vector<unsigned>& value)
+		{
+			columns = value;
+			return *this;
+		}
+
+		///
+		/// Returns the size in bytes above which a blob is left to be read with Blob.
+		///
+		unsigned getMaxBlobSize() const
+		{
+			return maxBlobSize;
+		}
+
+		///
+		/// Sets the size in bytes above which a blob is left to be read with Blob. Must not be zero.
+		///
+		BlobPrefetchOptions& setMaxBlobSize(unsigned value)
+		{
+			maxBlobSize = value;
+			return *this;
+		}
+
+	private:
+		std::vector<unsigned> columns;
+		unsigned maxBlobSize = 64u * 1024u;
+	};
 
 	///
 	/// @brief A disconnected buffer of rows fetched from a Statement's result set.
@@ -52,8 +108,74 @@ namespace fbcpp
 	/// construction the RowSet is independent of its source Statement and can
 	/// be used, moved, or destroyed freely.
 	///
+	/// The same RowSet can also page through a result set window by window
+	/// with `refill()`, which reuses the buffer and descriptors of the previous
+	/// window.
+	///
+	/// The rows returned by the non-const `getRow()` and by iteration share the
+	/// RowSet's status and converters, so they must be used by one thread at a
+	/// time. The buffer does not change until the next refill, so the const read
+	/// path (`getRow() const`, `slice()`) can be used from several threads at
+	/// once.
+	///
 	class RowSet final
 	{
+	public:
+		///
+		/// @brief Forward iterator over the rows of a RowSet, yielding Row views.
+		///
+		/// Iterating a const RowSet yields the rows of `getRow() const`.
+		///
+		template <typename Owner>
+		class BasicIterator final
+		{
+		public:
+			// Rows are returned by value, so only the C++20 concept is forward; the legacy category is input.
+			using iterator_concept = std::forward_iterator_tag;
+			using iterator_category = std::input_iterator_tag;
+			using value_type = Row;
+			using reference = Row;
+			using difference_type = std::ptrdiff_t;
+
+			BasicIterator() noexcept = default;
+
+			BasicIterator(Owner& rowSet, unsigned index) noexcept
+				: rowSet{&rowSet},
+				  index{index}
+			{
+			}
+
+		public:
+			Row operator*() const
+			{
+				return rowSet->getRow(index);
+			}
+
+			BasicIterator& operator++() noexcept
+			{
+				++index;
+				return *this;
+			}
+
+			BasicIterator operator++(int) noexcept
+			{
+				auto old = *this;
+				++index;
+				return old;
+			}
+
+			bool operator==(const BasicIterator& o) const noexcept
+			{
+				return rowSet == o.rowSet && index == o.index;
+			}
+
+		private:
+			Owner* rowSet = nullptr;
+			unsigned index = 0;
+		};
+
+		using Iterator = BasicIterator<RowSet>;
+		using ConstIterator = BasicIterator<const RowSet>;
 
 	public:
 		///
@@ -69,17 +191,69 @@ namespace fbcpp
 		///
 		explicit RowSet(Statement& statement, unsigned maxRows);
 
+		///
+		/// @brief Fetches up to `maxRows` rows of a scrollable cursor, starting
+		/// at the absolute (1-based) `position`.
+		///
+		/// The first row is fetched with `IResultSet::fetchAbsolute()` and the
+		/// others with `IResultSet::fetchNext()`.
+		///
+		/// @param statement The statement with an open scrollable result set.
+		/// @param maxRows Maximum number of rows to fetch.
+		/// @param position Absolute position of the first row.
+		///
+		explicit RowSet(Statement& statement, unsigned maxRows, unsigned position);
+
+		///
+		/// @brief Fetches up to `maxRows` rows like `RowSet(Statement&, unsigned)`, then reads the contents of
+		/// their blobs up to `options.getMaxBlobSize()` into a buffer of the RowSet.
+		///
+		/// Every refill prefetches the blobs of its window, which are then read with `getBlobBytes()` and
+		/// `getBlobString()`. This is eager loading, not overlapped I/O: each blob is opened, read and closed in
+		/// turn on the calling thread, only skipping the length request done by `Blob::getLength()`. The round
+		/// trips are saved by preparing the statement with `StatementOptions::setMaxInlineBlobSize()`, which lets
+		/// a Firebird 5.0.3+ server send small blobs with the rows so the client library serves these reads.
+		///
+		/// The RowSet keeps a reference to `transaction` for the refills: the transaction must stay valid for as
+		/// long as the RowSet is refilled, and in any case outlive the RowSet.
+		///
+		/// @param statement The statement with an open result set.
+		/// @param maxRows Maximum number of rows to fetch.
+		/// @param transaction The transaction the statement was executed in.
+		/// @param options The columns to prefetch and the size threshold.
+		/// @throws std::out_of_range if a column index is out of range.
+		/// @throws std::invalid_argument if a column is not a BLOB or the size threshold is zero.
+		///
+		explicit RowSet(
+			Statement& statement, unsigned maxRows, Transaction& transaction, const BlobPrefetchOptions& options);
+
+		///
+		/// @brief Fetches up to `maxRows` rows from the current result set of
+		/// `statement`, starting with the row already fetched by
+		/// `Statement::execute()`.
+		///
+		/// The statement must have an open result set positioned on a row, that
+		/// is, `execute()` returned true and nothing was fetched afterwards.
+		///
+		static RowSet fromCurrentRow(Statement& statement, unsigned maxRows);
+
 		RowSet(RowSet&& o) noexcept
 			: client{o.client},
 			  count{o.count},
+			  maxRows{o.maxRows},
 			  messageLength{o.messageLength},
+			  messageFormat{o.messageFormat},
+			  eof{o.eof},
 			  buffer{std::move(o.buffer)},
 			  descriptors{std::move(o.descriptors)},
 			  statusWrapper{std::move(o.statusWrapper)},
 			  numericConverter{std::move(o.numericConverter)},
-			  calendarConverter{std::move(o.calendarConverter)}
+			  calendarConverter{std::move(o.calendarConverter)},
+			  arena{std::move(o.arena)},
+			  blobs{std::move(o.blobs)}
 		{
 			o.count = 0;
+			o.maxRows = 0;
 			o.messageLength = 0;
 		}
 
@@ -89,13 +263,19 @@ namespace fbcpp
 			{
 				client = o.client;
 				count = o.count;
+				maxRows = o.maxRows;
 				messageLength = o.messageLength;
+				messageFormat = o.messageFormat;
+				eof = o.eof;
 				buffer = std::move(o.buffer);
 				descriptors = std::move(o.descriptors);
 				statusWrapper = std::move(o.statusWrapper);
 				numericConverter = std::move(o.numericConverter);
 				calendarConverter = std::move(o.calendarConverter);
+				arena = std::move(o.arena);
+				blobs = std::move(o.blobs);
 				o.count = 0;
+				o.maxRows = 0;
 				o.messageLength = 0;
 			}
 
@@ -106,6 +286,66 @@ namespace fbcpp
 		RowSet& operator=(const RowSet&) = delete;
 
 	public:
+		///
+		/// @brief Replaces the current rows with up to `getMaxRows()` next rows
+		/// of the current result set of `statement`.
+		///
+		/// The buffer allocation and the descriptors of the previous window are
+		/// reused, so paging through a large result set runs with constant memory.
+		/// The statement must be the one (or have the same output format as the
+		/// one) used to construct this RowSet. Once isEof() is true, the rows are
+		/// cleared and nothing is fetched.
+		///
+		/// @return Whether at least one row was fetched.
+		///
+		bool refill(Statement& statement);
+
+		///
+		/// @brief Replaces the rows with the next window of a scrollable cursor,
+		/// starting at the absolute (1-based) `position`.
+		///
+		/// The buffer allocation and the descriptors of the previous window are
+		/// reused.
+		///
+		/// @return Whether at least one row was fetched.
+		///
+		bool refillAt(Statement& statement, unsigned position);
+
+		///
+		/// @brief Returns an awaitable that constructs a RowSet on an I/O thread of the executor.
+		///
+		/// Calls on the statement's Attachment are serialized. The statement must remain valid until
+		/// the operation completes.
+		///
+		static AsyncOperation<RowSet> fetchAsync(AsyncExecutor& executor, Statement& statement, unsigned maxRows);
+
+		///
+		/// @brief Returns an awaitable that calls refill() on an I/O thread of the executor.
+		///
+		/// This RowSet and the statement must remain valid until the operation completes.
+		///
+		AsyncOperation<bool> refillAsync(AsyncExecutor& executor, Statement& statement);
+
+		///
+		/// @brief Returns whether the end of the cursor was reached by the last
+		/// fetch window.
+		///
+		/// When the last window ends exactly at the end of the cursor, this
+		/// becomes true only after the next (empty) refill.
+		///
+		bool isEof() const noexcept
+		{
+			return eof;
+		}
+
+		///
+		/// @brief Returns the maximum number of rows of each fetch window.
+		///
+		unsigned getMaxRows() const noexcept
+		{
+			return maxRows;
+		}
+
 		///
 		/// @brief Returns the number of rows actually fetched.
 		///
@@ -129,7 +369,63 @@ namespace fbcpp
 		Row getRow(unsigned index)
 		{
 			assert(index < count);
-			return Row{*client, descriptors, getRawRow(index)};
+			return Row{*client, *descriptors, getRawRow(index), statusWrapper, numericConverter, calendarConverter};
+		}
+
+		///
+		/// @brief Returns a Row view of the row at `index` with its own conversion
+		/// helpers, so the rows of a const RowSet can be read from several threads.
+		/// @param index Zero-based row index (must be < getCount()).
+		///
+		Row getRow(unsigned index) const
+		{
+			assert(index < count);
+			return Row{*client, *descriptors, getRawRow(index)};
+		}
+
+		///
+		/// @brief Returns a view of the rows in `[begin, end)` with its own status
+		/// and converters.
+		///
+		/// Each slice can be processed by a different thread, for example one
+		/// slice per task of a thread pool or per element of a range given to
+		/// `std::for_each(std::execution::par, ...)`. The slices are valid until the
+		/// RowSet is refilled, moved or destroyed.
+		///
+		/// @throws std::out_of_range if `begin > end` or `end > getCount()`.
+		///
+		RowSetSlice slice(unsigned begin, unsigned end) const;
+
+		///
+		/// @brief Returns an iterator to the first row, for range-for loops.
+		///
+		Iterator begin() noexcept
+		{
+			return Iterator{*this, 0};
+		}
+
+		///
+		/// @brief Returns an iterator past the last row.
+		///
+		Iterator end() noexcept
+		{
+			return Iterator{*this, count};
+		}
+
+		///
+		/// @brief Returns a const iterator to the first row, for range-for loops over a const object.
+		///
+		ConstIterator begin() const noexcept
+		{
+			return ConstIterator{*this, 0};
+		}
+
+		///
+		/// @brief Returns a const iterator past the last row.
+		///
+		ConstIterator end() const noexcept
+		{
+			return ConstIterator{*this, count};
 		}
 
 		///
@@ -143,6 +439,79 @@ namespace fbcpp
 			return {data, messageLength};
 		}
 
+		///
+		/// @brief Returns the rows as an array of the message struct `T` bound with
+		/// `Statement::bindOutputMessage<T>()` before the RowSet was constructed.
+		///
+		/// The rows are not copied. Any refill invalidates the span.
+		///
+		/// @throws FbCppException if the rows were not fetched as `T`.
+		///
+		template <MessageStruct T>
+		std::span<const T> getMessages() const
+		{
+			if (messageFormat != &impl::getMessageFormat<T>())
+				throw FbCppException("RowSet rows were not fetched as this message struct");
+
+			return {reinterpret_cast<const T*>(buffer.data()), count};
+		}
+
+		///
+		/// @brief Returns the column descriptors of the rows.
+		///
+		const std::vector<Descriptor>& getDescriptors() const noexcept
+		{
+			return descriptors->getDescriptors();
+		}
+
+		///
+		/// @brief Returns the shared descriptor set of the rows.
+		///
+		const DescriptorSetPtr& getDescriptorSet() const noexcept
+		{
+			return descriptors;
+		}
+
+		///
+		/// @brief Returns whether the blob of `column` in the row at `index` can be read with `getBlobBytes()`,
+		/// that is, the column is prefetched and the blob is NULL or not larger than the size threshold.
+		///
+		bool isBlobPrefetched(unsigned index, unsigned column) const;
+
+		///
+		/// @brief Returns the prefetched contents of the blob of `column` in the row at `index`.
+		/// @return A view into the RowSet, valid until the next refill, or nullopt if the blob is NULL.
+		/// @throws FbCppException if the blob was not prefetched (see `isBlobPrefetched()`).
+		///
+		std::optional<std::span<const std::byte>> getBlobBytes(unsigned index, unsigned column) const;
+
+		///
+		/// @brief Returns the prefetched contents of a text blob like `getBlobBytes()`.
+		///
+		std::optional<std::string_view> getBlobString(unsigned index, unsigned column) const
+		{
+			const auto bytes = getBlobBytes(index, column);
+
+			if (!bytes)
+				return std::nullopt;
+
+			return std::string_view{reinterpret_cast<const char*>(bytes->data()), bytes->size()};
+		}
+
+		///
+		/// @brief Returns the arena of the window, created on first use.
+		///
+		/// The arena is reset by every refill, so the views returned by `Row::getString(unsigned, Arena&)` with
+		/// it are valid as long as the rows themselves.
+		///
+		Arena& getArena()
+		{
+			if (!arena)
+				arena = std::make_unique<Arena>();
+
+			return *arena;
+		}
+
 		///
 		/// @brief Returns the entire contiguous buffer containing all fetched rows.
 		///
@@ -151,12 +520,253 @@ namespace fbcpp
 			return buffer;
 		}
 
+	private:
+		struct CurrentRowTag final
+		{
+		};
+
+		explicit RowSet(Statement& statement, unsigned maxRows, CurrentRowTag);
+
+		struct PrefetchedBlobs final
+		{
+			enum class State : std::uint8_t
+			{
+				NULL_BLOB,
+				PREFETCHED,
+				TOO_LARGE
+			};
+
+			struct Slot final
+			{
+				std::size_t offset;
+				std::size_t length;
+				State state;
+			};
+
+			Attachment* attachment;
+			Transaction* transaction;
+			unsigned maxBlobSize;
+			std::vector<unsigned> columns;
+			std::vector<Slot> slots;
+			std::vector<std::byte> data;
+			std::vector<std::byte> readBuffer;
+		};
+
+	private:
+		void init(Statement& statement);
+		void fetch(Statement& statement, std::optional<unsigned> position = std::nullopt, bool currentRow = false);
+		void prefetchBlobs();
+		const PrefetchedBlobs::Slot* findBlobSlot(unsigned index, unsigned column) const;
+
 	private:
 		Client* client;
 		unsigned count = 0;
+		unsigned maxRows = 0;
 		unsigned messageLength = 0;
+		const impl::MessageFormat* messageFormat = nullptr;
+		bool eof = false;
 		std::vector<std::byte> buffer;
-		std::vector<Descriptor> descriptors;
+		DescriptorSetPtr descriptors;
+		impl::StatusWrapper statusWrapper;
+		impl::NumericConverter numericConverter;
+		impl::CalendarConverter calendarConverter;
+		std::unique_ptr<Arena> arena;
+		std::unique_ptr<PrefetchedBlobs> blobs;
+	};
+
+	///
+	/// @brief A contiguous range of the rows of a RowSet, returned by `RowSet::slice()`.
+	///
+	/// A slice owns its status and converters, so different slices of the same
+	/// RowSet can be read concurrently. A slice must be used by one thread at a
+	/// time.
+	///
+	class RowSetSlice final
+	{
+	public:
+		///
+		/// @brief Forward iterator over the rows of a RowSetSlice, yielding Row views.
+		///
+		/// Iterating a const RowSetSlice yields the rows of `getRow() const`.
+		///
+		template <typename Owner>
+		class BasicIterator final
+		{
+		public:
+			// Rows are returned by value, so only the C++20 concept is forward; the legacy category is input.
+			using iterator_concept = std::forward_iterator_tag;
+			using iterator_category = std::input_iterator_tag;
+			using value_type = Row;
+			using reference = Row;
+			using difference_type = std::ptrdiff_t;
+
+			BasicIterator() noexcept = default;
+
+			BasicIterator(Owner& slice, unsigned index) noexcept
+				: slice{&slice},
+				  index{index}
+			{
+			}
+
+		public:
+			Row operator*() const
+			{
+				return slice->getRow(index);
+			}
+
+			BasicIterator& operator++() noexcept
+			{
+				++index;
+				return *this;
+			}
+
+			BasicIterator operator++(int) noexcept
+			{
+				auto old = *this;
+				++index;
+				return old;
+			}
+
+			bool operator==(const BasicIterator& o) const noexcept
+			{
+				return slice == o.slice && index == o.index;
+			}
+
+		private:
+			Owner* slice = nullptr;
+			unsigned index = 0;
+		};
+
+		using Iterator = BasicIterator<RowSetSlice>;
+		using ConstIterator = BasicIterator<const RowSetSlice>;
+
+	public:
+		///
+		/// @brief Constructs a slice of `count` rows of `messageLength` bytes
+		/// starting at `data`, which is row `offset` of its RowSet.
+		///
+		explicit RowSetSlice(Client& client, DescriptorSetPtr descriptors, const std::byte* data,
+			unsigned messageLength, unsigned offset, unsigned count)
+			: client{&client},
+			  descriptors{std::move(descriptors)},
+			  data{data},
+			  messageLength{messageLength},
+			  offset{offset},
+			  count{count},
+			  statusWrapper{client},
+			  numericConverter{client},
+			  calendarConverter{client}
+		{
+		}
+
+		RowSetSlice(RowSetSlice&& o) noexcept = default;
+		RowSetSlice& operator=(RowSetSlice&& o) noexcept = default;
+
+		RowSetSlice(const RowSetSlice&) = delete;
+		RowSetSlice& operator=(const RowSetSlice&) = delete;
+
+	public:
+		///
+		/// @brief Returns the index, in the RowSet, of the first row of the slice.
+		///
+		unsigned getOffset() const noexcept
+		{
+			return offset;
+		}
+
+		///
+		/// @brief Returns the number of rows of the slice.
+		///
+		unsigned getCount() const noexcept
+		{
+			return count;
+		}
+
+		///
+		/// @brief Returns whether the slice has no rows.
+		///
+		bool isEmpty() const noexcept
+		{
+			return count == 0;
+		}
+
+		///
+		/// @brief Returns a Row view for typed access to the row at `index` of the slice.
+		/// @param index Zero-based row index within the slice (must be < getCount()).
+		///
+		Row getRow(unsigned index)
+		{
+			assert(index < count);
+			return Row{*client, *descriptors, getRawRow(index), statusWrapper, numericConverter, calendarConverter};
+		}
+
+		///
+		/// @brief Returns a Row view of the row at `index` of the slice with its own conversion helpers.
+		/// @param index Zero-based row index within the slice (must be < getCount()).
+		///
+		Row getRow(unsigned index) const
+		{
+			assert(index < count);
+			return Row{*client, *descriptors, getRawRow(index)};
+		}
+
+		///
+		/// @brief Returns an iterator to the first row, for range-for loops.
+		///
+		Iterator begin() noexcept
+		{
+			return Iterator{*this, 0};
+		}
+
+		///
+		/// @brief Returns an iterator past the last row.
+		///
+		Iterator end() noexcept
+		{
+			return Iterator{*this, count};
+		}
+
+		///
+		/// @brief Returns a const iterator to the first row, for range-for loops over a const object.
+		///
+		ConstIterator begin() const noexcept
+		{
+			return ConstIterator{*this, 0};
+		}
+
+		///
+		/// @brief Returns a const iterator past the last row.
+		///
+		ConstIterator end() const noexcept
+		{
+			return ConstIterator{*this, count};
+		}
+
+		///
+		/// @brief Returns a span over the raw data of the row at `index` of the slice.
+		/// @param index Zero-based row index within the slice (must be < getCount()).
+		///
+		std::span<const std::byte> getRawRow(unsigned index) const
+		{
+			assert(index < count);
+			return {data + static_cast<std::size_t>(index) * messageLength, messageLength};
+		}
+
+		///
+		/// @brief Returns the shared descriptor set of the rows.
+		///
+		const DescriptorSetPtr& getDescriptorSet() const noexcept
+		{
+			return descriptors;
+		}
+
+	private:
+		Client* client;
+		DescriptorSetPtr descriptors;
+		const std::byte* data;
+		unsigned messageLength;
+		unsigned offset;
+		unsigned count;
 		impl::StatusWrapper statusWrapper;
 		impl::NumericConverter numericConverter;
 		impl::CalendarConverter calendarConverter;
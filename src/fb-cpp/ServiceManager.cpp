@@ -25,6 +25,7 @@
 #include "ServiceManager.h"
 #include "Client.h"
 #include "Exception.h"
+#include <algorithm>
 #include <cassert>
 
 using namespace fbcpp;
@@ -96,9 +97,11 @@ void ServiceManager::startAction(const std::vector<std::uint8_t>& spb)
 	handle->start(&statusWrapper, static_cast<unsigned>(spb.size()), spb.data());
 }
 
-void ServiceManager::waitForCompletion(const VerboseOutput& verboseOutput, bool requestStdin)
+void ServiceManager::waitForCompletion(const VerboseOutput& verboseOutput, bool requestStdin,
+	const DataSink& dataSink, const DataSource& dataSource)
 {
 	assert(isValid());
+	assert(!(dataSink && verboseOutput));
 
 	StatusWrapper statusWrapper{*client};
 	auto receiveBuilder =
@@ -111,66 +114,107 @@ void ServiceManager::waitForCompletion(const VerboseOutput& verboseOutput, bool
 	const auto receiveLength = receiveBuilder->getBufferLength(&statusWrapper);
 	const auto* receiveBuffer = receiveBuilder->getBuffer(&statusWrapper);
 
-	std::vector<std::uint8_t> buffer(16u * 1024u);
+	// Data streams use a larger buffer, so each round trip carries more of the stream.
+	std::vector<std::uint8_t> buffer((dataSink ? 64u : 16u) * 1024u);
+	std::vector<std::byte> inputBuffer;
 	std::string pendingLine;
 	unsigned stdinRequest = 0;
 
+	// The send block is reused between polls; the response is always terminated, so the buffer is not cleared.
+	auto sendBuilder =
+		fbUnique(client->getUtil()->getXpbBuilder(&statusWrapper, fb::IXpbBuilder::SPB_SEND, nullptr, 0));
+
 	for (bool running = true; running;)
 	{
-		auto sendBuilder =
-			fbUnique(client->getUtil()->getXpbBuilder(&statusWrapper, fb::IXpbBuilder::SPB_SEND, nullptr, 0));
+		sendBuilder->clear(&statusWrapper);
 
 		if (stdinRequest)
-			throw FbCppException("Service requested stdin input");
+		{
+			if (!dataSource)
+				throw FbCppException("Service requested stdin input");
+
+			// The length of a send item is limited to 16 bits. An empty item tells the end of the stream.
+			inputBuffer.resize(std::min(stdinRequest, 32u * 1024u));
+			const auto inputLength = std::min(dataSource(inputBuffer), inputBuffer.size());
+
+			sendBuilder->insertBytes(
+				&statusWrapper, isc_info_svc_line, inputBuffer.data(), static_cast<unsigned>(inputLength));
+		}
 
-		std::fill(buffer.begin(), buffer.end(), 0);
 		handle->query(&statusWrapper, sendBuilder->getBufferLength(&statusWrapper),
 			sendBuilder->getBuffer(&statusWrapper), receiveLength, receiveBuffer, static_cast<unsigned>(buffer.size()),
 			buffer.data());
 
-		auto responseBuilder = fbUnique(client->getUtil()->getXpbBuilder(
-			&statusWrapper, fb::IXpbBuilder::SPB_RESPONSE, buffer.data(), static_cast<unsigned>(buffer.size())));
-
 		stdinRequest = 0;
 		int outputLength = 0;
 		bool notReady = false;
 
-		for (responseBuilder->rewind(&statusWrapper); running && !responseBuilder->isEof(&statusWrapper);
-			responseBuilder->moveNext(&statusWrapper))
-		{
-			switch (responseBuilder->getTag(&statusWrapper))
-			{
-				case isc_info_svc_line:
-				{
-					const auto* line = responseBuilder->getString(&statusWrapper);
-					const auto length = static_cast<int>(responseBuilder->getLength(&statusWrapper));
-					if (verboseOutput && length > 0)
-						verboseOutput(std::string_view{line, static_cast<size_t>(length)});
-					outputLength = length;
-					break;
-				}
-
-				case isc_info_svc_to_eof:
-				{
-					const auto* bytes = reinterpret_cast<const char*>(responseBuilder->getBytes(&statusWrapper));
-					const auto length = static_cast<int>(responseBuilder->getLength(&statusWrapper));
-					emitVerboseChunk(pendingLine, std::string_view{bytes, static_cast<size_t>(length)}, verboseOutput);
-					outputLength = length;
-					break;
-				}
+		// IXpbBuilder copies the block it parses and cannot be reloaded, so the response is read in place.
+		const auto* ptr = buffer.data();
+		const auto* const end = ptr + buffer.size();
 
-				case isc_info_svc_stdin:
-					stdinRequest = static_cast<unsigned>(responseBuilder->getInt(&statusWrapper));
-					break;
+		while (running && ptr < end)
+		{
+			const auto item = *ptr++;
 
+			switch (item)
+			{
 				case isc_info_end:
 					running = false;
-					break;
+					continue;
 
 				case isc_info_truncated:
 				case isc_info_data_not_ready:
 				case isc_info_svc_timeout:
 					notReady = true;
+					continue;
+
+				case isc_info_svc_stdin:
+					if (ptr + 4 > end)
+						throw FbCppException("ServiceManager::waitForCompletion malformed response");
+
+					stdinRequest = static_cast<unsigned>(ptr[0]) | (static_cast<unsigned>(ptr[1]) << 8) |
+						(static_cast<unsigned>(ptr[2]) << 16) | (static_cast<unsigned>(ptr[3]) << 24);
+					ptr += 4;
+					continue;
+
+				default:
+					break;
+			}
+
+			if (ptr + 2 > end)
+				throw FbCppException("ServiceManager::waitForCompletion malformed response");
+
+			const auto length = static_cast<int>(ptr[0] | (ptr[1] << 8));
+			ptr += 2;
+
+			if (ptr + length > end)
+				throw FbCppException("ServiceManager::waitForCompletion invalid length");
+
+			const auto* const bytes = reinterpret_cast<const char*>(ptr);
+			ptr += length;
+
+			switch (item)
+			{
+				case isc_info_svc_line:
+					if (verboseOutput && length > 0)
+						verboseOutput(std::string_view{bytes, static_cast<size_t>(length)});
+					outputLength = length;
+					break;
+
+				case isc_info_svc_to_eof:
+					if (dataSink)
+					{
+						if (length > 0)
+							dataSink(std::as_bytes(std::span{bytes, static_cast<size_t>(length)}));
+					}
+					else
+					{
+						emitVerboseChunk(
+							pendingLine, std::string_view{bytes, static_cast<size_t>(length)}, verboseOutput);
+					}
+
+					outputLength = length;
 					break;
 
 				default:
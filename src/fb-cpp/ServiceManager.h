@@ -28,10 +28,12 @@
 #include "Exception.h"
 #include "fb-api.h"
 #include "SmartPtrs.h"
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <limits>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -181,6 +183,17 @@ namespace fbcpp
 		///
 		using VerboseOutput = std::function<void(std::string_view line)>;
 
+		///
+		/// Function receiving the next chunk of a service data stream, such as a backup written to `stdout`.
+		///
+		using DataSink = std::function<void(std::span<const std::byte> chunk)>;
+
+		///
+		/// Function filling the buffer with the next bytes of a service data stream, such as a backup read from
+		/// `stdin`. Returns the number of bytes written to the buffer, or zero at the end of the stream.
+		///
+		using DataSource = std::function<std::size_t(std::span<std::byte> buffer)>;
+
 		///
 		/// Attaches to the service manager specified by the given options.
 		///
@@ -290,7 +303,8 @@ namespace fbcpp
 		}
 
 		void startAction(const std::vector<std::uint8_t>& spb);
-		void waitForCompletion(const VerboseOutput& verboseOutput = {}, bool requestStdin = false);
+		void waitForCompletion(const VerboseOutput& verboseOutput = {}, bool requestStdin = false,
+			const DataSink& dataSink = {}, const DataSource& dataSource = {});
 
 	private:
 		void detachHandle();
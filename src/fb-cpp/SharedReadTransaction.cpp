@@ -0,0 +1,105 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "SharedReadTransaction.h"
+#include <algorithm>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+void SharedReadLease::invalidate() noexcept
+{
+	if (owner && generation)
+		owner->invalidate(generation.get());
+}
+
+
+SharedReadTransaction::SharedReadTransaction(Attachment& attachment, const SharedReadTransactionOptions& options)
+	: attachment{&attachment},
+	  options{options},
+	  tpb{options.getTransactionOptions().compile(attachment.getClient())}
+{
+	assert(attachment.isValid());
+}
+
+std::uint64_t SharedReadTransaction::getStartedCount()
+{
+	std::lock_guard mutexGuard{mutex};
+	return startedCount;
+}
+
+SharedReadLease SharedReadTransaction::acquire()
+{
+	std::shared_ptr<SharedReadLease::Generation> expired;
+	std::unique_lock mutexGuard{mutex};
+
+	if (current && std::chrono::steady_clock::now() - current->startedAt >= options.getMaxAge())
+		expired = std::move(current);
+
+	if (!current)
+	{
+		current = std::make_shared<SharedReadLease::Generation>(std::make_unique<Transaction>(*attachment, tpb));
+		++startedCount;
+	}
+
+	SharedReadLease lease{*this, current};
+
+	// Commit the replaced transaction, if no lease holds it anymore, outside the lock.
+	mutexGuard.unlock();
+	expired.reset();
+
+	return lease;
+}
+
+void SharedReadTransaction::renew() noexcept
+{
+	std::shared_ptr<SharedReadLease::Generation> dropped;
+
+	{  // scope
+		std::lock_guard mutexGuard{mutex};
+		dropped = std::move(current);
+	}
+}
+
+bool SharedReadTransaction::isBroken(const DatabaseException& exception) const noexcept
+{
+	const auto& codes = options.getBrokenErrorCodes();
+
+	return std::any_of(
+		codes.begin(), codes.end(), [&](std::intptr_t code) { return exception.hasErrorCode(code); });
+}
+
+void SharedReadTransaction::invalidate(const SharedReadLease::Generation* generation) noexcept
+{
+	std::shared_ptr<SharedReadLease::Generation> dropped;
+
+	{  // scope
+		std::lock_guard mutexGuard{mutex};
+
+		if (current.get() == generation)
+			dropped = std::move(current);
+	}
+}
@@ -0,0 +1,334 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_SHARED_READ_TRANSACTION_H
+#define FBCPP_SHARED_READ_TRANSACTION_H
+
+#include "Attachment.h"
+#include "Exception.h"
+#include "ParameterBlock.h"
+#include "Transaction.h"
+#include <cassert>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	class SharedReadTransaction;
+
+	///
+	/// Represents options used when creating a SharedReadTransaction object.
+	///
+	class SharedReadTransactionOptions final
+	{
+	public:
+		///
+		/// Returns the options of the shared transactions.
+		///
+		const TransactionOptions& getTransactionOptions() const
+		{
+			return transactionOptions;
+		}
+
+		///
+		/// Sets the options of the shared transactions.
+		/// They should describe a `READ_COMMITTED` + `READ_ONLY` transaction, which does not hold back garbage
+		/// collection however long it lives and sees the data committed by other transactions.
+		///
+		SharedReadTransactionOptions& setTransactionOptions(const TransactionOptions& value)
+		{
+			transactionOptions = value;
+			return *this;
+		}
+
+		///
+		/// Returns the age after which the shared transaction is replaced by a new one.
+		///
+		std::chrono::steady_clock::duration getMaxAge() const
+		{
+			return maxAge;
+		}
+
+		///
+		/// Sets the age after which the shared transaction is replaced by a new one.
+		///
+		SharedReadTransactionOptions& setMaxAge(std::chrono::steady_clock::duration value)
+		{
+			maxAge = value;
+			return *this;
+		}
+
+		///
+		/// Returns the ISC error codes that mean the shared transaction is no longer usable.
+		///
+		const std::vector<std::intptr_t>& getBrokenErrorCodes() const
+		{
+			return brokenErrorCodes;
+		}
+
+		///
+		/// Sets the ISC error codes that mean the shared transaction is no longer usable.
+		///
+		SharedReadTransactionOptions& setBrokenErrorCodes(std::vector<std::intptr_t> value)
+		{
+			brokenErrorCodes = std::move(value);
+			return *this;
+		}
+
+	private:
+		TransactionOptions transactionOptions =
+			TransactionOptions().setIsolationLevel(TransactionIsolationLevel::READ_COMMITTED).setAccessMode(
+				TransactionAccessMode::READ_ONLY);
+		std::chrono::steady_clock::duration maxAge = std::chrono::minutes{10};
+		std::vector<std::intptr_t> brokenErrorCodes{isc_bad_trans_handle};
+	};
+
+	///
+	/// RAII handle to the transaction of a SharedReadTransaction.
+	/// The transaction stays alive while the lease exists, even when the SharedReadTransaction already replaced it
+	/// by a new one. The SharedReadTransaction must outlive all of its leases.
+	///
+	class SharedReadLease final
+	{
+	private:
+		struct Generation;
+
+	public:
+		///
+		/// Constructs an empty lease.
+		///
+		SharedReadLease() noexcept = default;
+
+		SharedReadLease(SharedReadLease&&) noexcept = default;
+		SharedReadLease& operator=(SharedReadLease&&) noexcept = default;
+
+		SharedReadLease(const SharedReadLease&) = delete;
+		SharedReadLease& operator=(const SharedReadLease&) = delete;
+
+	public:
+		///
+		/// Returns whether the lease holds a transaction.
+		///
+		bool isValid() const noexcept
+		{
+			return generation != nullptr;
+		}
+
+		///
+		/// Returns the leased Transaction.
+		///
+		Transaction& get() noexcept
+		{
+			assert(isValid());
+			return *generation->transaction;
+		}
+
+		///
+		/// Returns the leased Transaction.
+		///
+		Transaction& operator*() noexcept
+		{
+			return get();
+		}
+
+		///
+		/// Returns the leased Transaction.
+		///
+		Transaction* operator->() noexcept
+		{
+			return &get();
+		}
+
+		///
+		/// Makes the SharedReadTransaction start a new transaction on the next acquire(), when this lease still
+		/// refers to the current one. Use it after an error that left the transaction unusable.
+		///
+		void invalidate() noexcept;
+
+		///
+		/// Releases the transaction, making the lease empty.
+		///
+		void release() noexcept
+		{
+			generation.reset();
+			owner = nullptr;
+		}
+
+	private:
+		struct Generation final
+		{
+			explicit Generation(std::unique_ptr<Transaction> transaction) noexcept
+				: transaction{std::move(transaction)},
+				  startedAt{std::chrono::steady_clock::now()}
+			{
+			}
+
+			Generation(const Generation&) = delete;
+			Generation& operator=(const Generation&) = delete;
+
+			~Generation() noexcept
+			{
+				try
+				{
+					if (transaction->isValid())
+						transaction->commit();
+				}
+				catch (...)
+				{
+					// swallow
+				}
+			}
+
+			std::unique_ptr<Transaction> transaction;
+			std::chrono::steady_clock::time_point startedAt;
+		};
+
+		SharedReadLease(SharedReadTransaction& owner, std::shared_ptr<Generation> generation) noexcept
+			: owner{&owner},
+			  generation{std::move(generation)}
+		{
+		}
+
+	private:
+		SharedReadTransaction* owner = nullptr;
+		std::shared_ptr<Generation> generation;
+
+		friend class SharedReadTransaction;
+	};
+
+	///
+	/// @brief Long-lived read transaction of one Attachment, shared by concurrent read-only statement executions.
+	///
+	/// The transaction is started on the first acquire() with the TPB compiled from the options, and handed out to
+	/// any number of threads through SharedReadLease objects, so read requests do not pay for a start/commit round
+	/// trip pair. When it is older than `getMaxAge()` or a lease invalidates it, the next acquire() starts a new
+	/// transaction; the old one is committed when its last lease is released. The SharedReadTransaction itself is
+	/// thread-safe and must be destroyed before its Attachment.
+	///
+	class SharedReadTransaction final
+	{
+	public:
+		///
+		/// Constructs a SharedReadTransaction for the specified Attachment. No transaction is started yet.
+		///
+		explicit SharedReadTransaction(Attachment& attachment, const SharedReadTransactionOptions& options = {});
+
+		SharedReadTransaction(SharedReadTransaction&&) = delete;
+		SharedReadTransaction& operator=(SharedReadTransaction&&) = delete;
+		SharedReadTransaction(const SharedReadTransaction&) = delete;
+		SharedReadTransaction& operator=(const SharedReadTransaction&) = delete;
+
+	public:
+		///
+		/// Returns the Attachment used by this SharedReadTransaction.
+		///
+		Attachment& getAttachment() noexcept
+		{
+			return *attachment;
+		}
+
+		///
+		/// Returns the options used to create this SharedReadTransaction.
+		///
+		const SharedReadTransactionOptions& getOptions() const noexcept
+		{
+			return options;
+		}
+
+		///
+		/// Returns the number of transactions started so far.
+		///
+		std::uint64_t getStartedCount();
+
+		///
+		/// Leases the current transaction, starting a new one when there is none or it is too old.
+		///
+		SharedReadLease acquire();
+
+		///
+		/// Drops the current transaction, so the next acquire() starts a new one.
+		/// Transactions still leased are committed when their last lease is released.
+		///
+		void renew() noexcept;
+
+		///
+		/// Returns whether the exception means the shared transaction is no longer usable.
+		///
+		bool isBroken(const DatabaseException& exception) const noexcept;
+
+		///
+		/// Runs the callable with the leased transaction and returns what it returns.
+		/// When it fails with one of the broken error codes, the transaction is invalidated and the callable is
+		/// invoked once more with a new transaction, so it must only read data.
+		///
+		template <typename F>
+			requires std::invocable<F&, Transaction&>
+		std::invoke_result_t<F&, Transaction&> run(F&& callable)
+		{
+			for (unsigned attempt = 1u;; ++attempt)
+			{
+				auto lease = acquire();
+
+				try
+				{
+					return callable(lease.get());
+				}
+				catch (const DatabaseException& e)
+				{
+					if (attempt > 1u || !isBroken(e))
+						throw;
+
+					lease.invalidate();
+				}
+			}
+		}
+
+	private:
+		void invalidate(const SharedReadLease::Generation* generation) noexcept;
+
+	private:
+		Attachment* attachment;
+		SharedReadTransactionOptions options;
+		ParameterBlock tpb;
+		std::mutex mutex;
+		std::shared_ptr<SharedReadLease::Generation> current;
+		std::uint64_t startedCount = 0u;
+
+		friend class SharedReadLease;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_SHARED_READ_TRANSACTION_H
@@ -0,0 +1,96 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "SlowQueryLog.h"
+#include <utility>
+
+using namespace fbcpp;
+
+
+SlowQueryLog::SlowQueryLog(const SlowQueryLogOptions& options)
+	: options{options}
+{
+	ring.reserve(options.getSink() ? 0u : options.getCapacity());
+}
+
+void SlowQueryLog::record(SlowQueryEntry entry)
+{
+	if (const auto& sink = options.getSink())
+	{
+		{  // scope
+			std::lock_guard mutexGuard{mutex};
+			++recordedCount;
+		}
+
+		sink(entry);
+		return;
+	}
+
+	std::lock_guard mutexGuard{mutex};
+
+	++recordedCount;
+
+	if (options.getCapacity() == 0u)
+		return;
+
+	if (ring.size() < options.getCapacity())
+		ring.push_back(std::move(entry));
+	else
+		ring[next] = std::move(entry);
+
+	next = (next + 1u) % options.getCapacity();
+}
+
+std::vector<SlowQueryEntry> SlowQueryLog::getEntries() const
+{
+	std::lock_guard mutexGuard{mutex};
+
+	std::vector<SlowQueryEntry> entries;
+	entries.reserve(ring.size());
+
+	// Once the ring is full, `next` is the oldest entry.
+	const auto start = ring.size() < options.getCapacity() ? 0u : next;
+
+	for (std::size_t i = 0u; i < ring.size(); ++i)
+		entries.push_back(ring[(start + i) % ring.size()]);
+
+	return entries;
+}
+
+std::uint64_t SlowQueryLog::getRecordedCount() const
+{
+	std::lock_guard mutexGuard{mutex};
+	return recordedCount;
+}
+
+void SlowQueryLog::clear()
+{
+	std::lock_guard mutexGuard{mutex};
+
+	ring.clear();
+	next = 0u;
+	recordedCount = 0u;
+}
@@ -0,0 +1,289 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_SLOW_QUERY_LOG_H
+#define FBCPP_SLOW_QUERY_LOG_H
+
+#include "Descriptor.h"
+#include "PerformanceCounters.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// Statement execution recorded by a SlowQueryLog.
+	///
+	struct SlowQueryEntry final
+	{
+		///
+		/// SQL text of the statement.
+		///
+		std::string sql;
+
+		///
+		/// Detailed plan of the statement, or empty when plans are not captured or the server produced none.
+		///
+		std::string plan;
+
+		///
+		/// Types of the input parameters.
+		///
+		std::vector<DescriptorOriginalType> parameterTypes;
+
+		///
+		/// Time spent preparing the statement. Only the first execution after the prepare accounts it.
+		///
+		std::chrono::nanoseconds prepareTime{};
+
+		///
+		/// Time spent executing the statement, including the fetch of the first row of a cursor.
+		///
+		std::chrono::nanoseconds executeTime{};
+
+		///
+		/// Time spent fetching the remaining rows, by the Statement or by RowSet windows over it.
+		///
+		std::chrono::nanoseconds fetchTime{};
+
+		///
+		/// Sum of the prepare, execute and fetch times, compared with the threshold.
+		///
+		std::chrono::nanoseconds totalTime{};
+
+		///
+		/// Number of rows fetched, the first one included.
+		///
+		std::uint64_t fetchedRows = 0u;
+
+		///
+		/// Record counts of the execution, when captured.
+		///
+		std::optional<ExecutionStats> stats;
+
+		///
+		/// Wall-clock time at which the execution was recorded.
+		///
+		std::chrono::system_clock::time_point recordedAt;
+	};
+
+	///
+	/// Represents options used when creating a SlowQueryLog object.
+	///
+	class SlowQueryLogOptions final
+	{
+	public:
+		///
+		/// Function receiving each recorded entry instead of the in-memory ring.
+		/// It may be called concurrently from the threads using the statements.
+		///
+		using Sink = std::function<void(const SlowQueryEntry&)>;
+
+	public:
+		///
+		/// Returns the minimum total time of the executions recorded.
+		///
+		std::chrono::nanoseconds getThreshold() const
+		{
+			return threshold;
+		}
+
+		///
+		/// Sets the minimum total time of the executions recorded.
+		///
+		SlowQueryLogOptions& setThreshold(std::chrono::nanoseconds value)
+		{
+			threshold = value;
+			return *this;
+		}
+
+		///
+		/// Returns the maximum number of entries kept in memory; older entries are overwritten.
+		///
+		std::size_t getCapacity() const
+		{
+			return capacity;
+		}
+
+		///
+		/// Sets the maximum number of entries kept in memory; older entries are overwritten.
+		///
+		SlowQueryLogOptions& setCapacity(std::size_t value)
+		{
+			capacity = value;
+			return *this;
+		}
+
+		///
+		/// Returns whether the detailed plan is captured. It is fetched only for slow statements and then
+		/// cached by the Statement.
+		///
+		bool getCapturePlan() const
+		{
+			return capturePlan;
+		}
+
+		///
+		/// Sets whether the detailed plan is captured.
+		///
+		SlowQueryLogOptions& setCapturePlan(bool value)
+		{
+			capturePlan = value;
+			return *this;
+		}
+
+		///
+		/// Returns whether the execution stats (`Statement::getExecutionStats()`) are captured.
+		///
+		bool getCaptureStats() const
+		{
+			return captureStats;
+		}
+
+		///
+		/// Sets whether the execution stats (`Statement::getExecutionStats()`) are captured.
+		///
+		SlowQueryLogOptions& setCaptureStats(bool value)
+		{
+			captureStats = value;
+			return *this;
+		}
+
+		///
+		/// Returns the function receiving the entries, if any.
+		///
+		const Sink& getSink() const
+		{
+			return sink;
+		}
+
+		///
+		/// Sets a function receiving the entries instead of the in-memory ring.
+		///
+		SlowQueryLogOptions& setSink(Sink value)
+		{
+			sink = std::move(value);
+			return *this;
+		}
+
+	private:
+		std::chrono::nanoseconds threshold = std::chrono::milliseconds{500};
+		std::size_t capacity = 128u;
+		bool capturePlan = true;
+		bool captureStats = true;
+		Sink sink;
+	};
+
+	///
+	/// @brief Records the statement executions slower than a threshold.
+	///
+	/// A SlowQueryLog is registered with `Attachment::setSlowQueryLog()` and captured by the statements
+	/// prepared afterwards, which then time their prepare, execute and fetches. An execution ends when its
+	/// forward-only cursor reaches the end, when a non-cursor statement completes, when the statement is
+	/// executed again or when it is freed. If its total time reaches the threshold, an entry with the SQL,
+	/// plan, parameter types, timings and execution stats is stored in a bounded ring or passed to the sink.
+	///
+	/// Plans are only fetched for slow executions, so fast statements pay for a few clock reads only.
+	/// All methods are thread-safe.
+	///
+	class SlowQueryLog final
+	{
+	public:
+		///
+		/// Creates a log with the given options.
+		///
+		explicit SlowQueryLog(const SlowQueryLogOptions& options = {});
+
+		SlowQueryLog(const SlowQueryLog&) = delete;
+		SlowQueryLog& operator=(const SlowQueryLog&) = delete;
+
+	public:
+		///
+		/// Returns the options this log was created with.
+		///
+		const SlowQueryLogOptions& getOptions() const noexcept
+		{
+			return options;
+		}
+
+		///
+		/// Stores `entry` in the ring, or passes it to the sink.
+		///
+		void record(SlowQueryEntry entry);
+
+		///
+		/// Returns the entries in the ring, oldest first.
+		///
+		std::vector<SlowQueryEntry> getEntries() const;
+
+		///
+		/// Returns the number of entries recorded since creation or the last `clear()`, overwritten
+		/// entries and those passed to the sink included.
+		///
+		std::uint64_t getRecordedCount() const;
+
+		///
+		/// Removes all entries from the ring and resets the recorded count.
+		///
+		void clear();
+
+	private:
+		const SlowQueryLogOptions options;
+		mutable std::mutex mutex;
+		std::vector<SlowQueryEntry> ring;
+		std::size_t next = 0u;
+		std::uint64_t recordedCount = 0u;
+	};
+
+	namespace impl
+	{
+		///
+		/// Per-statement timing state of the current execution, kept by Statement for its SlowQueryLog.
+		///
+		struct SlowQueryState final
+		{
+			std::chrono::nanoseconds prepareTime{};
+			std::chrono::nanoseconds executeTime{};
+			std::chrono::nanoseconds fetchTime{};
+			std::uint64_t fetchedRows = 0u;
+			bool active = false;
+			std::optional<std::string> plan;
+		};
+	}  // namespace impl
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_SLOW_QUERY_LOG_H
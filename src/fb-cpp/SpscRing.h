@@ -0,0 +1,115 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_SPSC_RING_H
+#define FBCPP_SPSC_RING_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp::impl
+{
+	///
+	/// @brief Bounded lock-free queue for exactly one producer thread and one consumer thread.
+	///
+	/// The storage is allocated once by the constructor; pushing and popping never allocate nor block.
+	///
+	template <typename T>
+		requires std::is_trivially_copyable_v<T>
+	class SpscRing final
+	{
+	public:
+		///
+		/// Creates a ring able to hold at least `minCapacity` elements (rounded up to a power of two).
+		///
+		explicit SpscRing(std::size_t minCapacity)
+			: mask{std::bit_ceil(minCapacity < 2u ? 2u : minCapacity) - 1u},
+			  items{std::make_unique<T[]>(mask + 1u)}
+		{
+		}
+
+		SpscRing(const SpscRing&) = delete;
+		SpscRing& operator=(const SpscRing&) = delete;
+
+	public:
+		///
+		/// Returns the number of elements the ring can hold.
+		///
+		std::size_t getCapacity() const noexcept
+		{
+			return mask + 1u;
+		}
+
+		///
+		/// Appends an element. Returns false, without blocking, if the ring is full.
+		/// Must only be called by the producer thread.
+		///
+		bool tryPush(const T& value) noexcept
+		{
+			const auto currentTail = tail.load(std::memory_order_relaxed);
+
+			if (currentTail - head.load(std::memory_order_acquire) > mask)
+				return false;
+
+			items[currentTail & mask] = value;
+			tail.store(currentTail + 1u, std::memory_order_release);
+			return true;
+		}
+
+		///
+		/// Removes the oldest element into `value`. Returns false if the ring is empty.
+		/// Must only be called by the consumer thread.
+		///
+		bool tryPop(T& value) noexcept
+		{
+			const auto currentHead = head.load(std::memory_order_relaxed);
+
+			if (currentHead == tail.load(std::memory_order_acquire))
+				return false;
+
+			value = items[currentHead & mask];
+			head.store(currentHead + 1u, std::memory_order_release);
+			return true;
+		}
+
+	private:
+		static constexpr std::size_t CACHE_LINE_SIZE = 64u;
+
+		const std::size_t mask;
+		std::unique_ptr<T[]> items;
+		alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> head{0u};
+		alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> tail{0u};
+	};
+}  // namespace fbcpp::impl
+
+
+#endif  // FBCPP_SPSC_RING_H
@@ -26,11 +26,117 @@
 #include "Transaction.h"
 #include "Attachment.h"
 #include "Client.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
 
 using namespace fbcpp;
 using namespace fbcpp::impl;
 
 
+static void checkMessageSize(const char* name, std::size_t expected, std::size_t actual)
+{
+	if (actual != expected)
+	{
+		throw std::invalid_argument{std::string{"Statement "} + name + " message size " + std::to_string(actual) +
+			" does not match the metadata length " + std::to_string(expected)};
+	}
+}
+
+static bool isParameterNameStart(char c)
+{
+	return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+}
+
+static bool isParameterNamePart(char c)
+{
+	return isParameterNameStart(c) || (c >= '0' && c <= '9') || c == '_' || c == '$';
+}
+
+// Replaces `:name` parameters by `?` and records the positions of each name, skipping string literals
+// (including Q-strings), quoted identifiers and comments.
+static std::string parseNamedParameters(
+	std::string_view sql, DescriptorNameMap<std::vector<unsigned>>& parameterIndexes)
+{
+	std::string result;
+	result.reserve(sql.size());
+
+	unsigned position = 0u;
+	std::size_t i = 0u;
+
+	const auto copyUntil = [&](std::size_t end)
+	{
+		end = std::min(end, sql.size());
+		result.append(sql.substr(i, end - i));
+		i = end;
+	};
+
+	while (i < sql.size())
+	{
+		const char c = sql[i];
+		const char next = i + 1u < sql.size() ? sql[i + 1u] : '\0';
+
+		if (c == '\'' || c == '"')
+		{
+			const auto end = sql.find(c, i + 1u);
+			copyUntil(end == std::string_view::npos ? end : end + 1u);
+		}
+		else if (c == '-' && next == '-')
+		{
+			const auto end = sql.find('\n', i + 2u);
+			copyUntil(end == std::string_view::npos ? end : end + 1u);
+		}
+		else if (c == '/' && next == '*')
+		{
+			const auto end = sql.find("*/", i + 2u);
+			copyUntil(end == std::string_view::npos ? end : end + 2u);
+		}
+		else if ((c == 'q' || c == 'Q') && next == '\'' && i + 2u < sql.size() &&
+			(i == 0u || !isParameterNamePart(sql[i - 1u])))
+		{
+			const char open = sql[i + 2u];
+			const char close = open == '(' ? ')' : open == '{' ? '}' : open == '[' ? ']' : open == '<' ? '>' : open;
+
+			auto end = i + 3u;
+
+			while (end + 1u < sql.size() && !(sql[end] == close && sql[end + 1u] == '\''))
+				++end;
+
+			copyUntil(end + 2u);
+		}
+		else if (c == '?')
+		{
+			++position;
+			copyUntil(i + 1u);
+		}
+		else if (c == ':' && isParameterNameStart(next))
+		{
+			auto end = i + 1u;
+
+			while (end < sql.size() && isParameterNamePart(sql[end]))
+				++end;
+
+			parameterIndexes[std::string{sql.substr(i + 1u, end - i - 1u)}].push_back(position++);
+			result += '?';
+			i = end;
+		}
+		else if (isParameterNamePart(c))
+		{
+			auto end = i + 1u;
+
+			while (end < sql.size() && isParameterNamePart(sql[end]))
+				++end;
+
+			copyUntil(end);
+		}
+		else
+			copyUntil(i + 1u);
+	}
+
+	return result;
+}
+
+
 Statement::Statement(
 	Attachment& attachment, Transaction& transaction, std::string_view sql, const StatementOptions& options)
 	: attachment{&attachment},
@@ -41,6 +147,18 @@ Statement::Statement(
 	assert(attachment.isValid());
 	assert(transaction.isValid());
 
+	this->sql = sql;
+	observer = attachment.getObserver();
+	slowQueryLog = attachment.getSlowQueryLog();
+
+	std::string namedSql;
+
+	if (options.getNamedParameters())
+	{
+		namedSql = parseNamedParameters(sql, parameterIndexes);
+		sql = namedSql;
+	}
+
 	unsigned flags = fb::IStatement::PREPARE_PREFETCH_METADATA;
 
 	if (options.getPrefetchLegacyPlan())
@@ -49,8 +167,28 @@ Statement::Statement(
 	if (options.getPrefetchPlan())
 		flags |= fb::IStatement::PREPARE_PREFETCH_DETAILED_PLAN;
 
-	statementHandle.reset(attachment.getHandle()->prepare(&statusWrapper, transaction.getHandle().get(),
-		static_cast<unsigned>(sql.length()), sql.data(), options.getDialect(), flags));
+	{  // scope
+		OperationScope scope{observer.get(), OperationType::PREPARE, this->sql};
+		const auto slowQueryStart =
+			slowQueryLog ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+
+		try
+		{
+			MetricsScope metrics{attachment.getClient().getMetricsRegistry(), MetricsCall::PREPARE};
+			statementHandle.reset(attachment.getHandle()->prepare(&statusWrapper, transaction.getHandle().get(),
+				static_cast<unsigned>(sql.length()), sql.data(), options.getDialect(), flags));
+		}
+		catch (...)
+		{
+			scope.fail();
+			throw;
+		}
+
+		scope.finish();
+
+		if (slowQueryLog) [[unlikely]]
+			slowQuery.prepareTime = std::chrono::steady_clock::now() - slowQueryStart;
+	}
 
 	if (options.getCursorName().has_value())
 		statementHandle->setCursorName(&statusWrapper, options.getCursorName()->c_str());
@@ -58,6 +196,18 @@ Statement::Statement(
 	if (options.getCursorType() == CursorType::SCROLLABLE)
 		cursorFlags = fb::IStatement::CURSOR_TYPE_SCROLLABLE;
 
+	if (const auto maxInlineBlobSize = options.getMaxInlineBlobSize())
+	{
+		try
+		{
+			statementHandle->setMaxInlineBlobSize(&statusWrapper, maxInlineBlobSize.value());
+		}
+		catch (const DatabaseException&)
+		{
+			// Client libraries older than 5.0.3 do not have the method.
+		}
+	}
+
 	type = static_cast<StatementType>(statementHandle->getType(&statusWrapper));
 
 	switch (type)
@@ -84,11 +234,16 @@ Statement::Statement(
 			break;
 	}
 
-	const auto processMetadata = [&](FbRef<fb::IMessageMetadata>& metadata, std::vector<Descriptor>& descriptors,
+	const auto processMetadata = [&](FbRef<fb::IMessageMetadata>& metadata, DescriptorSetPtr& descriptorSet,
 									 std::vector<std::byte>& message)
 	{
+		std::vector<Descriptor> descriptors;
+
 		if (!metadata)
+		{
+			descriptorSet = std::make_shared<const DescriptorSet>(std::move(descriptors));
 			return;
+		}
 
 		message.resize(metadata->getMessageLength(&statusWrapper));
 
@@ -170,6 +325,8 @@ Statement::Statement(
 				*reinterpret_cast<std::int16_t*>(&message[descriptor.nullOffset]) = FB_TRUE;
 			}
 		}
+
+		descriptorSet = std::make_shared<const DescriptorSet>(std::move(descriptors));
 	};
 
 	inMetadata.reset(statementHandle->getInputMetadata(&statusWrapper));
@@ -178,13 +335,17 @@ Statement::Statement(
 	outMetadata.reset(statementHandle->getOutputMetadata(&statusWrapper));
 	processMetadata(outMetadata, outDescriptors, outMessage);
 
-	outRow = std::make_unique<Row>(attachment.getClient(), outDescriptors, std::span{outMessage});
+	outRow = std::make_unique<Row>(attachment.getClient(), *outDescriptors, std::span{outMessage}, statusWrapper,
+		numericConverter, calendarConverter);
 }
 
 void Statement::free()
 {
 	assert(isValid());
 
+	if (slowQuery.active) [[unlikely]]
+		finishSlowQuery();
+
 	if (resultSetHandle)
 	{
 		resultSetHandle->close(&statusWrapper);
@@ -209,7 +370,195 @@ std::string Statement::getPlan()
 	return statementHandle->getPlan(&statusWrapper, true);
 }
 
+ExecutionStats Statement::getExecutionStats()
+{
+	assert(isValid());
+
+	return queryExecutionStats(attachment->getClient(), statementHandle.get());
+}
+
+void Statement::bindMessageFormat(bool input, const impl::MessageFormat& format)
+{
+	assert(isValid());
+
+	const auto name = input ? "input" : "output";
+
+	if (resultSetHandle)
+		throw FbCppException(std::string{"Cannot bind the "} + name + " message while a cursor is open");
+
+	auto& metadata = input ? inMetadata : outMetadata;
+	auto& descriptorSet = input ? inDescriptors : outDescriptors;
+	auto& message = input ? inMessage : outMessage;
+	const auto count = static_cast<unsigned>(descriptorSet->size());
+
+	if (!metadata || count != format.fields.size())
+	{
+		throw FbCppException(std::string{"Message struct has "} + std::to_string(format.fields.size()) +
+			" columns but the " + name + " message has " + std::to_string(count));
+	}
+
+	FbRef<fb::IMetadataBuilder> builder;
+	builder.reset(metadata->getBuilder(&statusWrapper));
+
+	auto descriptors = descriptorSet->getDescriptors();
+
+	for (unsigned index = 0u; index < count; ++index)
+	{
+		const auto& field = format.fields[index];
+		auto& descriptor = descriptors[index];
+
+		// setType keeps the previous length, so the length is always set.
+		builder->setType(&statusWrapper, index, field.type);
+		builder->setLength(&statusWrapper, index, field.length);
+
+		if (!field.keepScale)
+		{
+			builder->setScale(&statusWrapper, index, 0);
+			descriptor.scale = 0;
+		}
+
+		descriptor.adjustedType = static_cast<DescriptorAdjustedType>(field.type);
+		descriptor.length = field.length;
+		descriptor.offset = field.offset;
+		descriptor.nullOffset = field.nullOffset;
+	}
+
+	// IMetadataBuilder cannot place fields, so the layout it computes must be the one of the struct.
+	FbRef<fb::IMessageMetadata> newMetadata;
+	newMetadata.reset(builder->getMetadata(&statusWrapper));
+
+	for (unsigned index = 0u; index < count; ++index)
+	{
+		const auto& field = format.fields[index];
+
+		if (newMetadata->getOffset(&statusWrapper, index) != field.offset ||
+			newMetadata->getNullOffset(&statusWrapper, index) != field.nullOffset)
+		{
+			throw FbCppException("Message struct column " + std::to_string(index) +
+				" does not match the offsets of the " + name + " message");
+		}
+	}
+
+	if (newMetadata->getAlignedLength(&statusWrapper) != format.size)
+	{
+		throw FbCppException(std::string{"Message struct size "} + std::to_string(format.size) +
+			" does not match the aligned length of the " + name + " message");
+	}
+
+	metadata = std::move(newMetadata);
+	descriptorSet = std::make_shared<const DescriptorSet>(std::move(descriptors));
+
+	message.assign(format.size, std::byte{0});
+
+	for (const auto& field : format.fields)
+		*reinterpret_cast<std::int16_t*>(&message[field.nullOffset]) = FB_TRUE;
+
+	if (input)
+		inMessageFormat = &format;
+	else
+	{
+		outMessageFormat = &format;
+		outRow = std::make_unique<Row>(attachment->getClient(), *outDescriptors, std::span{outMessage}, statusWrapper,
+			numericConverter, calendarConverter);
+	}
+}
+
+void Statement::checkMessageFormat(
+	const char* name, const impl::MessageFormat* bound, const impl::MessageFormat& format)
+{
+	if (bound != &format)
+		throw FbCppException(std::string{"The "} + name + " message is not bound to this message struct");
+}
+
+void Statement::addExternalFetch(std::chrono::nanoseconds duration, std::uint64_t rows, bool eof) noexcept
+{
+	if (!slowQuery.active)
+		return;
+
+	slowQuery.fetchTime += duration;
+	slowQuery.fetchedRows += rows;
+
+	if (eof && cursorFlags == 0)
+		finishSlowQuery();
+}
+
+void Statement::finishSlowQuery() noexcept
+{
+	assert(slowQueryLog);
+
+	slowQuery.active = false;
+
+	const auto totalTime = slowQuery.prepareTime + slowQuery.executeTime + slowQuery.fetchTime;
+	const auto& options = slowQueryLog->getOptions();
+
+	try
+	{
+		if (totalTime >= options.getThreshold())
+		{
+			SlowQueryEntry entry{
+				.sql = sql,
+				.plan = {},
+				.parameterTypes = {},
+				.prepareTime = slowQuery.prepareTime,
+				.executeTime = slowQuery.executeTime,
+				.fetchTime = slowQuery.fetchTime,
+				.totalTime = totalTime,
+				.fetchedRows = slowQuery.fetchedRows,
+				.stats = std::nullopt,
+				.recordedAt = std::chrono::system_clock::now(),
+			};
+
+			for (const auto& layout : inDescriptors->getLayouts())
+				entry.parameterTypes.push_back(layout.originalType);
+
+			// Plans are only needed for slow executions, and do not change while the statement is prepared.
+			if (options.getCapturePlan())
+			{
+				if (!slowQuery.plan.has_value())
+					slowQuery.plan = statementHandle->getPlan(&statusWrapper, true);
+
+				entry.plan = slowQuery.plan.value();
+			}
+
+			if (options.getCaptureStats())
+				entry.stats = getExecutionStats();
+
+			slowQueryLog->record(std::move(entry));
+		}
+	}
+	catch (...)
+	{
+		// swallow
+	}
+
+	// Only the first execution after the prepare accounts its time.
+	slowQuery.prepareTime = {};
+	slowQuery.executeTime = {};
+	slowQuery.fetchTime = {};
+	slowQuery.fetchedRows = 0u;
+}
+
 bool Statement::execute(Transaction& transaction)
+{
+	return executeMessages(transaction, inMessage.data(), outMessage.data());
+}
+
+bool Statement::execute(Transaction& transaction, std::span<const std::byte> inMsg)
+{
+	checkMessageSize("input", inMessage.size(), inMsg.size());
+
+	return executeMessages(transaction, inMsg.data(), outMessage.data());
+}
+
+bool Statement::execute(Transaction& transaction, std::span<const std::byte> inMsg, std::span<std::byte> outMsg)
+{
+	checkMessageSize("input", inMessage.size(), inMsg.size());
+	checkMessageSize("output", outMessage.size(), outMsg.size());
+
+	return executeMessages(transaction, inMsg.data(), outMsg.data());
+}
+
+bool Statement::executeMessages(Transaction& transaction, const std::byte* inData, std::byte* outData)
 {
 	assert(isValid());
 	assert(transaction.isValid());
@@ -220,70 +569,155 @@ bool Statement::execute(Transaction& transaction)
 		resultSetHandle.reset();
 	}
 
-	const auto outMessageData = outMessage.data();
+	if (arena)
+		arena->reset();
 
-	if (outMessageData)
+	if (outData)
 	{
-		for (const auto& descriptor : outDescriptors)
-			*reinterpret_cast<std::int16_t*>(&outMessageData[descriptor.nullOffset]) = FB_TRUE;
+		for (const auto& descriptor : outDescriptors->getLayouts())
+			*reinterpret_cast<std::int16_t*>(&outData[descriptor.nullOffset]) = FB_TRUE;
 	}
 
-	switch (type)
+	const auto inBuffer = const_cast<std::byte*>(inData);
+
+	if (slowQuery.active) [[unlikely]]
+		finishSlowQuery();
+
+	OperationScope scope{observer.get(), OperationType::EXECUTE, sql};
+	const auto slowQueryStart =
+		slowQueryLog ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+	bool result;
+
+	try
 	{
-		case StatementType::SELECT:
-		case StatementType::SELECT_FOR_UPDATE:
-			resultSetHandle.reset(statementHandle->openCursor(&statusWrapper, transaction.getHandle().get(),
-				inMetadata.get(), inMessage.data(), outMetadata.get(), cursorFlags));
-			return resultSetHandle->fetchNext(&statusWrapper, outMessageData) == fb::IStatus::RESULT_OK;
+		switch (type)
+		{
+			case StatementType::SELECT:
+			case StatementType::SELECT_FOR_UPDATE:
+			{
+				{  // scope
+					MetricsScope metrics{attachment->getClient().getMetricsRegistry(), MetricsCall::OPEN_CURSOR};
+					resultSetHandle.reset(statementHandle->openCursor(&statusWrapper, transaction.getHandle().get(),
+						inMetadata.get(), inBuffer, outMetadata.get(), cursorFlags));
+				}
+
+				MetricsScope metrics{attachment->getClient().getMetricsRegistry(), MetricsCall::FETCH};
+				result = resultSetHandle->fetchNext(&statusWrapper, outData) == fb::IStatus::RESULT_OK;
+				scope.finish(result ? 1u : 0u);
+				break;
+			}
 
-		default:
-			statementHandle->execute(&statusWrapper, transaction.getHandle().get(), inMetadata.get(), inMessage.data(),
-				outMetadata.get(), outMessageData);
-			return true;
+			default:
+			{
+				MetricsScope metrics{attachment->getClient().getMetricsRegistry(), MetricsCall::EXECUTE};
+				statementHandle->execute(&statusWrapper, transaction.getHandle().get(), inMetadata.get(), inBuffer,
+					outMetadata.get(), outData);
+				result = true;
+				scope.finish();
+				break;
+			}
+		}
+	}
+	catch (...)
+	{
+		scope.fail();
+		throw;
+	}
+
+	if (slowQueryLog) [[unlikely]]
+	{
+		slowQuery.executeTime = std::chrono::steady_clock::now() - slowQueryStart;
+		slowQuery.fetchedRows = resultSetHandle && result ? 1u : 0u;
+		slowQuery.active = true;
+
+		// Without a cursor left to fetch, the execution is complete.
+		if (!resultSetHandle || (!result && cursorFlags == 0))
+			finishSlowQuery();
 	}
+
+	return result;
 }
 
-bool Statement::fetchNext()
+template <typename F>
+bool Statement::fetchObserved(F&& fetch)
 {
 	assert(isValid());
 
-	return resultSetHandle && resultSetHandle->fetchNext(&statusWrapper, outMessage.data()) == fb::IStatus::RESULT_OK;
+	if (!resultSetHandle)
+		return false;
+
+	if (arena)
+		arena->reset();
+
+	OperationScope scope{observer.get(), OperationType::FETCH, sql};
+	const auto slowQueryStart =
+		slowQuery.active ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+
+	try
+	{
+		const bool fetched = [&]
+		{
+			MetricsScope metrics{attachment->getClient().getMetricsRegistry(), MetricsCall::FETCH};
+			return fetch() == fb::IStatus::RESULT_OK;
+		}();
+		scope.finish(fetched ? 1u : 0u);
+
+		if (slowQuery.active) [[unlikely]]
+			addExternalFetch(std::chrono::steady_clock::now() - slowQueryStart, fetched ? 1u : 0u, !fetched);
+
+		return fetched;
+	}
+	catch (...)
+	{
+		scope.fail();
+		throw;
+	}
 }
 
-bool Statement::fetchPrior()
+bool Statement::fetchNext()
 {
-	assert(isValid());
+	return fetchObserved([this] { return resultSetHandle->fetchNext(&statusWrapper, outMessage.data()); });
+}
 
-	return resultSetHandle && resultSetHandle->fetchPrior(&statusWrapper, outMessage.data()) == fb::IStatus::RESULT_OK;
+AsyncOperation<bool> Statement::executeAsync(AsyncExecutor& executor, Transaction& transaction)
+{
+	return executor.run(attachment, [this, &transaction] { return execute(transaction); });
 }
 
-bool Statement::fetchFirst()
+AsyncOperation<bool> Statement::fetchNextAsync(AsyncExecutor& executor)
 {
-	assert(isValid());
+	return executor.run(attachment, [this] { return fetchNext(); });
+}
+
+bool Statement::fetchNextInto(std::span<std::byte> outMsg)
+{
+	checkMessageSize("output", outMessage.size(), outMsg.size());
 
-	return resultSetHandle && resultSetHandle->fetchFirst(&statusWrapper, outMessage.data()) == fb::IStatus::RESULT_OK;
+	return fetchObserved([&] { return resultSetHandle->fetchNext(&statusWrapper, outMsg.data()); });
 }
 
-bool Statement::fetchLast()
+bool Statement::fetchPrior()
 {
-	assert(isValid());
+	return fetchObserved([this] { return resultSetHandle->fetchPrior(&statusWrapper, outMessage.data()); });
+}
 
-	return resultSetHandle && resultSetHandle->fetchLast(&statusWrapper, outMessage.data()) == fb::IStatus::RESULT_OK;
+bool Statement::fetchFirst()
+{
+	return fetchObserved([this] { return resultSetHandle->fetchFirst(&statusWrapper, outMessage.data()); });
 }
 
-bool Statement::fetchAbsolute(unsigned position)
+bool Statement::fetchLast()
 {
-	assert(isValid());
+	return fetchObserved([this] { return resultSetHandle->fetchLast(&statusWrapper, outMessage.data()); });
+}
 
-	return resultSetHandle &&
-		resultSetHandle->fetchAbsolute(&statusWrapper, static_cast<int>(position), outMessage.data()) ==
-		fb::IStatus::RESULT_OK;
+bool Statement::fetchAbsolute(unsigned position)
+{
+	return fetchObserved(
+		[&] { return resultSetHandle->fetchAbsolute(&statusWrapper, static_cast<int>(position), outMessage.data()); });
 }
 
 bool Statement::fetchRelative(int offset)
 {
-	assert(isValid());
-
-	return resultSetHandle &&
-		resultSetHandle->fetchRelative(&statusWrapper, offset, outMessage.data()) == fb::IStatus::RESULT_OK;
+	return fetchObserved([&] { return resultSetHandle->fetchRelative(&statusWrapper, offset, outMessage.data()); });
 }
@@ -28,27 +28,36 @@
 #include "config.h"
 #include "fb-api.h"
 #include "types.h"
+#include "Arena.h"
 #include "Blob.h"
 #include "Attachment.h"
 #include "Client.h"
 #include "Row.h"
+#include "BindingPlan.h"
 #include "NumericConverter.h"
 #include "CalendarConverter.h"
 #include "Descriptor.h"
+#include "Observer.h"
+#include "SlowQueryLog.h"
 #include "SmartPtrs.h"
 #include "Exception.h"
+#include "AsyncExecutor.h"
+#include "MessageStruct.h"
 #include "StructBinding.h"
+#include "VariantPlan.h"
 #include "VariantTypeTraits.h"
 #include <charconv>
-#include <cerrno>
+#include <chrono>
 #include <cstdlib>
 #include <limits>
 #include <memory>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 #include <cassert>
 #include <cmath>
@@ -88,6 +97,12 @@ namespace fbcpp
 	///
 	class StatementOptions final
 	{
+	public:
+		///
+		/// @brief Compares all options field by field.
+		///
+		bool operator==(const StatementOptions& o) const = default;
+
 	public:
 		///
 		/// @brief Reports whether the legacy textual plan should be prefetched during prepare.
@@ -184,10 +199,61 @@ namespace fbcpp
 			return *this;
 		}
 
+		///
+		/// @brief Reports whether `:name` parameters are parsed from the SQL text.
+		///
+		bool getNamedParameters() const
+		{
+			return namedParameters;
+		}
+
+		///
+		/// @brief Enables or disables parsing of `:name` parameters in the SQL text.
+		///
+		/// When enabled, each `:name` outside string literals, quoted identifiers and comments is
+		/// replaced by `?` before preparing, and the parameter positions are indexed by name for
+		/// `Statement::getParameterIndexes()` and the name-based `set()` overloads. Positional `?`
+		/// parameters may be mixed with named ones. Keep it disabled for PSQL code (e.g. EXECUTE BLOCK)
+		/// that references variables with `:variable`.
+		///
+		/// @param value `true` to parse named parameters.
+		/// @return Reference to this instance for fluent configuration.
+		///
+		StatementOptions& setNamedParameters(bool value)
+		{
+			namedParameters = value;
+			return *this;
+		}
+
+		///
+		/// @brief Returns the maximum size of the blobs sent inline with the rows, if set.
+		///
+		const std::optional<unsigned>& getMaxInlineBlobSize() const
+		{
+			return maxInlineBlobSize;
+		}
+
+		///
+		/// @brief Sets the maximum size of the blobs the server sends inline with the rows of the result set.
+		///
+		/// Reading an inline blob (open, read and close) is served by the client library without any round
+		/// trip. Requires Firebird 5.0.3 or later on both sides; the option is ignored otherwise.
+		///
+		/// @param value Maximum blob size in bytes, zero to disable inline blobs.
+		/// @return Reference to this instance for fluent configuration.
+		///
+		StatementOptions& setMaxInlineBlobSize(unsigned value)
+		{
+			maxInlineBlobSize = value;
+			return *this;
+		}
+
 	private:
 		bool prefetchLegacyPlan = false;
 		bool prefetchPlan = false;
+		bool namedParameters = false;
 		std::optional<std::string> cursorName;
+		std::optional<unsigned> maxInlineBlobSize;
 		CursorType cursorType = CursorType::FORWARD_ONLY;
 		unsigned dialect = SQL_DIALECT_CURRENT;
 	};
@@ -258,6 +324,9 @@ namespace fbcpp
 	///
 	/// Prepares, executes, and fetches SQL statements against a Firebird attachment.
 	///
+	/// A Statement owns its parameter and row buffers, so it must be used by one thread at a time. Different
+	/// statements of the same Attachment may be used concurrently by different threads.
+	///
 	class Statement final
 	{
 	public:
@@ -282,14 +351,24 @@ namespace fbcpp
 			  statementHandle{std::move(o.statementHandle)},
 			  resultSetHandle{std::move(o.resultSetHandle)},
 			  inMetadata{std::move(o.inMetadata)},
-			  inDescriptors{std::move(o.inDescriptors)},
+			  inDescriptors{std::exchange(o.inDescriptors, DescriptorSet::getEmpty())},
 			  inMessage{std::move(o.inMessage)},
 			  outMetadata{std::move(o.outMetadata)},
-			  outDescriptors{std::move(o.outDescriptors)},
+			  outDescriptors{std::exchange(o.outDescriptors, DescriptorSet::getEmpty())},
 			  outMessage{std::move(o.outMessage)},
-			  outRow{std::make_unique<Row>(attachment->getClient(), outDescriptors, std::span{outMessage})},
+			  inMessageFormat{o.inMessageFormat},
+			  outMessageFormat{o.outMessageFormat},
+			  outRow{o.outRow ? std::make_unique<Row>(attachment->getClient(), *outDescriptors, std::span{outMessage},
+									statusWrapper, numericConverter, calendarConverter)
+							  : nullptr},
+			  arena{std::move(o.arena)},
 			  type{o.type},
-			  cursorFlags{o.cursorFlags}
+			  cursorFlags{o.cursorFlags},
+			  parameterIndexes{std::move(o.parameterIndexes)},
+			  sql{std::move(o.sql)},
+			  observer{std::move(o.observer)},
+			  slowQueryLog{std::move(o.slowQueryLog)},
+			  slowQuery{std::move(o.slowQuery)}
 		{
 			o.outRow.reset();
 		}
@@ -311,14 +390,24 @@ namespace fbcpp
 				statementHandle = std::move(o.statementHandle);
 				resultSetHandle = std::move(o.resultSetHandle);
 				inMetadata = std::move(o.inMetadata);
-				inDescriptors = std::move(o.inDescriptors);
+				inDescriptors = std::exchange(o.inDescriptors, DescriptorSet::getEmpty());
 				inMessage = std::move(o.inMessage);
 				outMetadata = std::move(o.outMetadata);
-				outDescriptors = std::move(o.outDescriptors);
+				outDescriptors = std::exchange(o.outDescriptors, DescriptorSet::getEmpty());
 				outMessage = std::move(o.outMessage);
-				outRow = std::make_unique<Row>(attachment->getClient(), outDescriptors, std::span{outMessage});
+				inMessageFormat = o.inMessageFormat;
+				outMessageFormat = o.outMessageFormat;
+				outRow = o.outRow ? std::make_unique<Row>(attachment->getClient(), *outDescriptors,
+										std::span{outMessage}, statusWrapper, numericConverter, calendarConverter)
+								  : nullptr;
+				arena = std::move(o.arena);
 				type = o.type;
 				cursorFlags = o.cursorFlags;
+				parameterIndexes = std::move(o.parameterIndexes);
+				sql = std::move(o.sql);
+				observer = std::move(o.observer);
+				slowQueryLog = std::move(o.slowQueryLog);
+				slowQuery = std::move(o.slowQuery);
 
 				o.outRow.reset();
 			}
@@ -362,6 +451,17 @@ namespace fbcpp
 			return *attachment;
 		}
 
+		///
+		/// Returns the type of the cursors opened by this Statement.
+		///
+		CursorType getCursorType() const noexcept
+		{
+			if ((cursorFlags & fb::IStatement::CURSOR_TYPE_SCROLLABLE) != 0)
+				return CursorType::SCROLLABLE;
+
+			return CursorType::FORWARD_ONLY;
+		}
+
 		///
 		/// Returns whether the Statement object is valid.
 		///
@@ -420,6 +520,53 @@ namespace fbcpp
 			return outMessage;
 		}
 
+		///
+		/// @brief Returns the SQL text given to the constructor.
+		///
+		const std::string& getSql() const noexcept
+		{
+			return sql;
+		}
+
+		///
+		/// @brief Returns the observer captured from the attachment when the statement was prepared, if any.
+		///
+		const std::shared_ptr<OperationObserver>& getObserver() const noexcept
+		{
+			return observer;
+		}
+
+		///
+		/// @brief Returns the slow-query log captured from the attachment when the statement was prepared,
+		/// if any.
+		///
+		const std::shared_ptr<SlowQueryLog>& getSlowQueryLog() const noexcept
+		{
+			return slowQueryLog;
+		}
+
+		///
+		/// @brief Accounts rows of the current cursor fetched outside of the Statement, such as by RowSet,
+		/// in the current execution of the slow-query log.
+		///
+		/// Does nothing without a slow-query log. `eof` ends the execution of a forward-only cursor.
+		///
+		void addExternalFetch(std::chrono::nanoseconds duration, std::uint64_t rows, bool eof) noexcept;
+
+		///
+		/// @brief Returns the arena of the statement, created on first use.
+		///
+		/// The arena is reset by every execute and fetch, so the views returned by `getString(unsigned, Arena&)`
+		/// with it are valid until the next one.
+		///
+		Arena& getArena()
+		{
+			if (!arena)
+				arena = std::make_unique<Arena>();
+
+			return *arena;
+		}
+
 		///
 		/// @brief Returns the type classification reported by the server.
 		///
@@ -443,13 +590,29 @@ namespace fbcpp
 		///
 		const std::vector<Descriptor>& getInputDescriptors() noexcept
 		{
-			return inDescriptors;
+			return inDescriptors->getDescriptors();
 		}
 
 		///
 		/// @brief Provides cached descriptors for each output column.
 		///
 		const std::vector<Descriptor>& getOutputDescriptors() noexcept
+		{
+			return outDescriptors->getDescriptors();
+		}
+
+		///
+		/// @brief Provides the shared, immutable descriptor set of the input parameters.
+		///
+		const DescriptorSetPtr& getInputDescriptorSet() noexcept
+		{
+			return inDescriptors;
+		}
+
+		///
+		/// @brief Provides the shared, immutable descriptor set of the output columns.
+		///
+		const DescriptorSetPtr& getOutputDescriptorSet() noexcept
 		{
 			return outDescriptors;
 		}
@@ -458,6 +621,85 @@ namespace fbcpp
 		/// @}
 		///
 
+		///
+		/// @name Message structs
+		/// @{
+		///
+
+		///
+		/// @brief Lays out the input message as the message struct `T`, so parameters can be written directly
+		/// through `getInputMessageAs<T>()` and `Batch::add(std::span<const T>)`.
+		///
+		/// Each parameter is coerced to the type of its struct field; the server converts the values. The
+		/// resulting offsets must match the ones of `T`. Descriptors, plans and batches obtained before the
+		/// call refer to the previous layout.
+		///
+		/// @throws FbCppException if a cursor is open, the struct has a different number of columns, or its
+		/// layout does not match the one of the message.
+		///
+		template <MessageStruct T>
+		void bindInputMessage()
+		{
+			bindMessageFormat(true, impl::getMessageFormat<T>());
+		}
+
+		///
+		/// @brief Lays out the output message as the message struct `T`, so rows can be read directly through
+		/// `getOutputMessageAs<T>()` and `RowSet::getMessages<T>()`.
+		///
+		/// Each column is coerced to the type of its struct field; the server converts the values. The
+		/// resulting offsets must match the ones of `T`. Descriptors, plans and row sets obtained before the
+		/// call refer to the previous layout.
+		///
+		/// @throws FbCppException if a cursor is open, the struct has a different number of columns, or its
+		/// layout does not match the one of the message.
+		///
+		template <MessageStruct T>
+		void bindOutputMessage()
+		{
+			bindMessageFormat(false, impl::getMessageFormat<T>());
+		}
+
+		///
+		/// @brief Returns the input message as the message struct `T` given to `bindInputMessage()`.
+		///
+		template <MessageStruct T>
+		T& getInputMessageAs()
+		{
+			checkMessageFormat("input", inMessageFormat, impl::getMessageFormat<T>());
+			return *reinterpret_cast<T*>(inMessage.data());
+		}
+
+		///
+		/// @brief Returns the output message as the message struct `T` given to `bindOutputMessage()`.
+		///
+		template <MessageStruct T>
+		const T& getOutputMessageAs()
+		{
+			checkMessageFormat("output", outMessageFormat, impl::getMessageFormat<T>());
+			return *reinterpret_cast<const T*>(outMessage.data());
+		}
+
+		///
+		/// @brief Returns the layout bound by `bindInputMessage()`, or `nullptr`.
+		///
+		const impl::MessageFormat* getInputMessageFormat() const noexcept
+		{
+			return inMessageFormat;
+		}
+
+		///
+		/// @brief Returns the layout bound by `bindOutputMessage()`, or `nullptr`.
+		///
+		const impl::MessageFormat* getOutputMessageFormat() const noexcept
+		{
+			return outMessageFormat;
+		}
+
+		///
+		/// @}
+		///
+
 		///
 		/// @brief Releases the prepared handle and any associated result set.
 		///
@@ -473,6 +715,14 @@ namespace fbcpp
 		///
 		std::string getPlan();
 
+		///
+		/// @brief Returns the records selected, inserted, updated and deleted by the last execution.
+		///
+		/// For a SELECT, the selected count grows as rows are fetched. Page I/O is only reported for the
+		/// whole attachment; see `Attachment::getPerformanceCounters()` and PerformanceSnapshot.
+		///
+		ExecutionStats getExecutionStats();
+
 		///
 		/// @brief Executes a prepared statement using the supplied transaction.
 		/// @param transaction Transaction that will own the execution context.
@@ -480,6 +730,25 @@ namespace fbcpp
 		///
 		bool execute(Transaction& transaction);
 
+		///
+		/// @brief Executes a prepared statement reading the parameters from a caller-owned message.
+		/// @param transaction Transaction that will own the execution context.
+		/// @param inMsg Input message laid out as described by `getInputMetadata()`, used in place
+		/// of the internal input message. Its size must equal the input message length.
+		/// @return `true` when execution yields a record, which is stored in the internal output message.
+		///
+		bool execute(Transaction& transaction, std::span<const std::byte> inMsg);
+
+		///
+		/// @brief Executes a prepared statement using caller-owned input and output messages.
+		/// @param transaction Transaction that will own the execution context.
+		/// @param inMsg Input message laid out as described by `getInputMetadata()`.
+		/// @param outMsg Buffer laid out as described by `getOutputMetadata()` that receives the first
+		/// record or the returned values. The internal output message and the row accessors are not updated.
+		/// @return `true` when execution yields a record.
+		///
+		bool execute(Transaction& transaction, std::span<const std::byte> inMsg, std::span<std::byte> outMsg);
+
 		///
 		/// @name Cursor movement
 		/// @{
@@ -489,6 +758,13 @@ namespace fbcpp
 		///
 		bool fetchNext();
 
+		///
+		/// @brief Fetches the next row in the current result set into a caller-owned buffer.
+		/// @param outMsg Buffer laid out as described by `getOutputMetadata()`. Its size must equal
+		/// the output message length. The internal output message and the row accessors are not updated.
+		///
+		bool fetchNextInto(std::span<std::byte> outMsg);
+
 		///
 		/// @brief Fetches the previous row in the current result set.
 		///
@@ -518,6 +794,27 @@ namespace fbcpp
 		/// @}
 		///
 
+		///
+		/// @name Asynchronous execution
+		/// @{
+
+		///
+		/// @brief Returns an awaitable that executes the statement on an I/O thread of the executor.
+		///
+		/// Calls on the same Attachment are serialized. The statement and the transaction must remain
+		/// valid until the operation completes.
+		///
+		AsyncOperation<bool> executeAsync(AsyncExecutor& executor, Transaction& transaction);
+
+		///
+		/// @brief Returns an awaitable that fetches the next row on an I/O thread of the executor.
+		///
+		AsyncOperation<bool> fetchNextAsync(AsyncExecutor& executor);
+
+		///
+		/// @}
+		///
+
 		///
 		/// @name Parameter writing
 		/// @{
@@ -531,7 +828,7 @@ namespace fbcpp
 
 			const auto message = inMessage.data();
 
-			for (const auto& descriptor : inDescriptors)
+			for (const auto& descriptor : inDescriptors->getLayouts())
 				*reinterpret_cast<std::int16_t*>(&message[descriptor.nullOffset]) = FB_TRUE;
 		}
 
@@ -549,6 +846,40 @@ namespace fbcpp
 			*reinterpret_cast<std::int16_t*>(&message[descriptor.nullOffset]) = FB_TRUE;
 		}
 
+		///
+		/// @brief Returns the positions of a `:name` parameter parsed with `StatementOptions::setNamedParameters()`.
+		/// The lookup is case-insensitive.
+		/// @throws std::out_of_range if the SQL has no parameter with that name.
+		///
+		const std::vector<unsigned>& getParameterIndexes(const DescriptorName& name) const
+		{
+			if (const auto it = parameterIndexes.find(name); it != parameterIndexes.end())
+				return it->second;
+
+			throw std::out_of_range("unknown parameter name: " + std::string{name.getName()});
+		}
+
+		///
+		/// @brief Marks all the occurrences of a named parameter as null.
+		///
+		void setNull(const DescriptorName& name)
+		{
+			for (const auto index : getParameterIndexes(name))
+				setNull(index);
+		}
+
+		///
+		/// @brief Binds a value to all the occurrences of a named parameter.
+		/// @param name Parameter name, without the leading colon.
+		/// @param value Value accepted by the index-based `set()` overloads.
+		///
+		template <typename T>
+		void set(const DescriptorName& name, const T& value)
+		{
+			for (const auto index : getParameterIndexes(name))
+				set(index, value);
+		}
+
 		///
 		/// @brief Binds a boolean parameter value or null.
 		/// @param index Zero-based parameter index.
@@ -1183,33 +1514,9 @@ namespace fbcpp
 				case DescriptorAdjustedType::INT32:
 				case DescriptorAdjustedType::INT64:
 				{
-					std::string strValue(value);
-					int scale = 0;
+					auto scaledValue = numericConverter.stringToScaledInt64(value);
 
-					if (const auto dotPos = strValue.find_last_of('.'); dotPos != std::string_view::npos)
-					{
-						for (auto pos = dotPos + 1; pos < strValue.size(); ++pos)
-						{
-							const char c = value[pos];
-
-							if (c < '0' || c > '9')
-								break;
-
-							--scale;
-						}
-
-						strValue.erase(dotPos, 1);
-					}
-
-					static_assert(sizeof(long long) == sizeof(std::int64_t));
-					std::int64_t intValue;
-					const auto convResult =
-						std::from_chars(strValue.data(), strValue.data() + strValue.size(), intValue);
-					if (convResult.ec != std::errc{} || convResult.ptr != strValue.data() + strValue.size())
-						numericConverter.throwConversionErrorFromString(strValue);
-					auto scaledValue = ScaledInt64{intValue, scale};
-
-					if (scale != descriptor.scale)
+					if (scaledValue.scale != descriptor.scale)
 					{
 						scaledValue.value =
 							numericConverter.numberToNumber<std::int64_t>(scaledValue, descriptor.scale);
@@ -1221,33 +1528,14 @@ namespace fbcpp
 				}
 
 				case DescriptorAdjustedType::INT128:
-				{
-					std::string strValue(value);
-					client.getInt128Util(&statusWrapper)
-						->fromString(
-							&statusWrapper, descriptor.scale, strValue.c_str(), reinterpret_cast<OpaqueInt128*>(data));
+					*reinterpret_cast<OpaqueInt128*>(data) =
+						numericConverter.stringToOpaqueInt128(&statusWrapper, value, descriptor.scale);
 					break;
-				}
 
 				case DescriptorAdjustedType::FLOAT:
 				case DescriptorAdjustedType::DOUBLE:
-				{
-					double doubleValue;
-#if defined(__APPLE__)
-					errno = 0;
-					std::string valueString{value};
-					char* parseEnd = nullptr;
-					doubleValue = std::strtod(valueString.c_str(), &parseEnd);
-					if (parseEnd != valueString.c_str() + valueString.size() || errno == ERANGE)
-						numericConverter.throwConversionErrorFromString(std::move(valueString));
-#else
-					const auto convResult = std::from_chars(value.data(), value.data() + value.size(), doubleValue);
-					if (convResult.ec != std::errc{} || convResult.ptr != value.data() + value.size())
-						numericConverter.throwConversionErrorFromString(std::string{value});
-#endif
-					setDouble(index, doubleValue);
+					setDouble(index, numericConverter.stringToDouble(value));
 					return;
-				}
 
 				case DescriptorAdjustedType::DATE:
 					*reinterpret_cast<OpaqueDate*>(data) = calendarConverter.stringToOpaqueDate(value);
@@ -1271,23 +1559,15 @@ namespace fbcpp
 						calendarConverter.stringToOpaqueTimestampTz(&statusWrapper, value);
 					break;
 
-#if FB_CPP_USE_BOOST_MULTIPRECISION != 0
 				case DescriptorAdjustedType::DECFLOAT16:
-				{
-					std::string strValue{value};
-					client.getDecFloat16Util(&statusWrapper)
-						->fromString(&statusWrapper, strValue.c_str(), reinterpret_cast<OpaqueDecFloat16*>(data));
+					*reinterpret_cast<OpaqueDecFloat16*>(data) =
+						numericConverter.stringToOpaqueDecFloat16(&statusWrapper, value);
 					break;
-				}
 
 				case DescriptorAdjustedType::DECFLOAT34:
-				{
-					std::string strValue{value};
-					client.getDecFloat34Util(&statusWrapper)
-						->fromString(&statusWrapper, strValue.c_str(), reinterpret_cast<OpaqueDecFloat34*>(data));
+					*reinterpret_cast<OpaqueDecFloat34*>(data) =
+						numericConverter.stringToOpaqueDecFloat34(&statusWrapper, value);
 					break;
-				}
-#endif
 
 				case DescriptorAdjustedType::STRING:
 					if (value.length() > descriptor.length)
@@ -1875,6 +2155,37 @@ namespace fbcpp
 			return outRow->getString(index);
 		}
 
+		///
+		/// @brief Reads a textual column without allocating a `std::string`, formatting other types into `arena`.
+		/// @return A view into the output message or into `arena`, valid until the next fetch or execute when
+		/// `arena` is the one returned by `getArena()`.
+		///
+		std::optional<std::string_view> getString(unsigned index, Arena& arena)
+		{
+			assert(isValid());
+			return outRow->getString(index, arena);
+		}
+
+		///
+		/// @brief Reads a VARCHAR or CHAR column without copying it.
+		/// @return A view into the output message, valid until the next fetch or execute.
+		///
+		std::optional<std::string_view> getStringView(unsigned index)
+		{
+			assert(isValid());
+			return outRow->getStringView(index);
+		}
+
+		///
+		/// @brief Reads the raw bytes of a VARCHAR or CHAR column (e.g. CHARACTER SET OCTETS) without copying them.
+		/// @return A view into the output message, valid until the next fetch or execute.
+		///
+		std::optional<std::span<const std::byte>> getBytes(unsigned index)
+		{
+			assert(isValid());
+			return outRow->getBytes(index);
+		}
+
 		///
 		/// @}
 		///
@@ -1889,6 +2200,25 @@ namespace fbcpp
 			return outRow->get<T>(index);
 		}
 
+		///
+		/// @brief Retrieves a column by its alias or field name (case-insensitive).
+		/// @throws std::out_of_range if no column has that name.
+		///
+		template <typename T>
+		T get(const DescriptorName& name)
+		{
+			return get<T>(getIndex(name));
+		}
+
+		///
+		/// @brief Returns the index of the output column with the given alias or field name (case-insensitive).
+		/// @throws std::out_of_range if no column has that name.
+		///
+		unsigned getIndex(const DescriptorName& name) const
+		{
+			return outDescriptors->getIndex(name);
+		}
+
 		///
 		/// @brief Retrieves all output columns into a user-defined aggregate struct.
 		/// @tparam T An aggregate type whose fields match the output column count and types.
@@ -1916,10 +2246,10 @@ namespace fbcpp
 
 			constexpr std::size_t N = fieldCountV<T>;
 
-			if (N != inDescriptors.size())
+			if (N != inDescriptors->size())
 			{
 				throw FbCppException("Struct field count (" + std::to_string(N) +
-					") does not match input parameter count (" + std::to_string(inDescriptors.size()) + ")");
+					") does not match input parameter count (" + std::to_string(inDescriptors->size()) + ")");
 			}
 
 			setStruct(value, std::make_index_sequence<N>{});
@@ -1950,15 +2280,45 @@ namespace fbcpp
 		{
 			constexpr std::size_t N = std::tuple_size_v<T>;
 
-			if (N != inDescriptors.size())
+			if (N != inDescriptors->size())
 			{
 				throw FbCppException("Tuple element count (" + std::to_string(N) +
-					") does not match input parameter count (" + std::to_string(inDescriptors.size()) + ")");
+					") does not match input parameter count (" + std::to_string(inDescriptors->size()) + ")");
 			}
 
 			setTuple(value, std::make_index_sequence<N>{});
 		}
 
+		///
+		/// @brief Retrieves all output columns using a precomputed binding plan.
+		/// @param plan Plan built from getOutputDescriptorSet().
+		/// @throws FbCppException if the plan was built for a different descriptor set.
+		/// @throws FbCppException if a NULL value is encountered for a non-optional field.
+		///
+		template <typename T>
+		T get(const BindingPlan<T>& plan)
+		{
+			assert(isValid());
+			return outRow->get(plan);
+		}
+
+		///
+		/// @brief Sets all input parameters using a precomputed binding plan.
+		/// @param plan Plan built from getInputDescriptorSet().
+		/// @param value The struct or tuple containing parameter values.
+		/// @throws FbCppException if the plan was built for a different descriptor set.
+		///
+		template <typename T>
+		void set(const BindingPlan<T>& plan, const T& value)
+		{
+			assert(isValid());
+
+			if (plan.getDescriptorSet() != inDescriptors)
+				throw FbCppException("BindingPlan was built for a different descriptor set");
+
+			plan.write(*this, inMessage.data(), value);
+		}
+
 		///
 		/// @brief Retrieves a column value as a user-defined variant type.
 		/// @tparam V A std::variant type with possible C++ types. Use std::monostate for NULL.
@@ -1974,6 +2334,37 @@ namespace fbcpp
 			return outRow->get<V>(index);
 		}
 
+		///
+		/// @brief Retrieves a column value as a user-defined variant type using a precomputed variant plan.
+		/// @param plan Plan built from getOutputDescriptorSet().
+		/// @param index Zero-based column index.
+		/// @throws FbCppException if the plan was built for a different descriptor set.
+		///
+		template <VariantLike V>
+		V get(const VariantPlan<V>& plan, unsigned index)
+		{
+			assert(isValid());
+			return outRow->get(plan, index);
+		}
+
+		///
+		/// @brief Sets a parameter from a variant value using a precomputed variant plan.
+		/// @param plan Plan built from getInputDescriptorSet().
+		/// @param index Zero-based parameter index.
+		/// @param value The variant containing the value.
+		/// @throws FbCppException if the plan was built for a different descriptor set.
+		///
+		template <VariantLike V>
+		void set(const VariantPlan<V>& plan, unsigned index, const V& value)
+		{
+			assert(isValid());
+
+			if (plan.getDescriptorSet() != inDescriptors)
+				throw FbCppException("VariantPlan was built for a different descriptor set");
+
+			plan.write(*this, index, value);
+		}
+
 		///
 		/// @brief Sets a parameter from a variant value.
 		/// @tparam V A std::variant type.
@@ -2004,15 +2395,27 @@ namespace fbcpp
 		}
 
 	private:
+		bool executeMessages(Transaction& transaction, const std::byte* inData, std::byte* outData);
+
+		template <typename F>
+		bool fetchObserved(F&& fetch);
+
+		void finishSlowQuery() noexcept;
+
+		void bindMessageFormat(bool input, const impl::MessageFormat& format);
+
+		static void checkMessageFormat(
+			const char* name, const impl::MessageFormat* bound, const impl::MessageFormat& format);
+
 		///
 		/// @brief Validates and returns the descriptor for the given input parameter index.
 		///
-		const Descriptor& getInDescriptor(unsigned index)
+		const DescriptorLayout& getInDescriptor(unsigned index)
 		{
-			if (index >= inDescriptors.size())
+			if (index >= inDescriptors->size())
 				throw std::out_of_range("index out of range");
 
-			return inDescriptors[index];
+			return inDescriptors->getLayout(index);
 		}
 
 		///
@@ -2050,7 +2453,7 @@ namespace fbcpp
 			const auto descriptorData = &message[descriptor.offset];
 			std::optional<int> descriptorScale{descriptor.scale};
 
-			Descriptor valueDescriptor;
+			DescriptorLayout valueDescriptor;
 			valueDescriptor.adjustedType = valueType;
 			valueDescriptor.scale = scale;
 
@@ -2082,6 +2485,22 @@ namespace fbcpp
 						numericConverter.boostInt128ToOpaqueInt128(boostInt128);
 					break;
 				}
+#elif FB_CPP_USE_NATIVE_NUMERIC != 0
+				case DescriptorAdjustedType::INT128:
+				{
+					std::optional<OpaqueInt128> opaqueInt128;
+
+					if constexpr (std::is_integral_v<T>)
+						opaqueInt128 = impl::int64ToInt128(ScaledInt64{value, scale}, descriptor.scale);
+					else
+						opaqueInt128 = impl::doubleToInt128(static_cast<double>(value), descriptor.scale);
+
+					if (!opaqueInt128.has_value())
+						numericConverter.throwNumericOutOfRange();
+
+					*reinterpret_cast<OpaqueInt128*>(descriptorData) = opaqueInt128.value();
+					break;
+				}
 #endif
 
 				case DescriptorAdjustedType::FLOAT:
@@ -2112,6 +2531,30 @@ namespace fbcpp
 						numericConverter.boostDecFloat34ToOpaqueDecFloat34(&statusWrapper, boostDecFloat34);
 					break;
 				}
+#elif FB_CPP_USE_NATIVE_NUMERIC != 0
+				case DescriptorAdjustedType::DECFLOAT16:
+				case DescriptorAdjustedType::DECFLOAT34:
+				{
+					std::string valueString;
+
+					if constexpr (std::is_integral_v<T>)
+						valueString = numericConverter.numberToString(ScaledInt64{value, scale});
+					else
+						valueString = numericConverter.numberToString(value);
+
+					if (descriptor.adjustedType == DescriptorAdjustedType::DECFLOAT16)
+					{
+						*reinterpret_cast<OpaqueDecFloat16*>(descriptorData) =
+							numericConverter.stringToOpaqueDecFloat16(&statusWrapper, valueString);
+					}
+					else
+					{
+						*reinterpret_cast<OpaqueDecFloat34*>(descriptorData) =
+							numericConverter.stringToOpaqueDecFloat34(&statusWrapper, valueString);
+					}
+
+					break;
+				}
 #endif
 
 				default:
@@ -2129,7 +2572,7 @@ namespace fbcpp
 
 		template <typename T>
 		T convertNumber(
-			const Descriptor& descriptor, const std::byte* data, std::optional<int>& toScale, const char* toTypeName)
+			const DescriptorLayout& descriptor, const std::byte* data, std::optional<int>& toScale, const char* toTypeName)
 		{
 			if (!toScale.has_value())
 			{
@@ -2199,14 +2642,22 @@ namespace fbcpp
 		FbRef<fb::IStatement> statementHandle;
 		FbRef<fb::IResultSet> resultSetHandle;
 		FbRef<fb::IMessageMetadata> inMetadata;
-		std::vector<Descriptor> inDescriptors;
+		DescriptorSetPtr inDescriptors = DescriptorSet::getEmpty();
 		std::vector<std::byte> inMessage;
 		FbRef<fb::IMessageMetadata> outMetadata;
-		std::vector<Descriptor> outDescriptors;
+		DescriptorSetPtr outDescriptors = DescriptorSet::getEmpty();
 		std::vector<std::byte> outMessage;
+		const impl::MessageFormat* inMessageFormat = nullptr;
+		const impl::MessageFormat* outMessageFormat = nullptr;
 		std::unique_ptr<Row> outRow;
+		std::unique_ptr<Arena> arena;
 		StatementType type;
 		unsigned cursorFlags = 0;
+		impl::DescriptorNameMap<std::vector<unsigned>> parameterIndexes;
+		std::string sql;
+		std::shared_ptr<OperationObserver> observer;
+		std::shared_ptr<SlowQueryLog> slowQueryLog;
+		impl::SlowQueryState slowQuery;
 	};
 
 	///
@@ -2388,6 +2839,12 @@ namespace fbcpp
 		return getString(index);
 	}
 
+	template <>
+	inline std::optional<std::string_view> Statement::get<std::optional<std::string_view>>(unsigned index)
+	{
+		return getStringView(index);
+	}
+
 	///
 	/// @}
 	///
@@ -0,0 +1,123 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "StatementCache.h"
+#include "Attachment.h"
+#include "Transaction.h"
+#include <cassert>
+#include <stdexcept>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+std::size_t StatementCache::KeyHash::operator()(const Key& key) const noexcept
+{
+	const auto& options = *key.options;
+
+	auto hash = std::hash<std::string_view>{}(key.sql);
+
+	const auto combine = [&hash](std::size_t value)
+	{ hash ^= value + 0x9e3779b97f4a7c15u + (hash << 6) + (hash >> 2); };
+
+	combine(options.getDialect());
+	combine(static_cast<std::size_t>(options.getCursorType()));
+	combine((options.getPrefetchPlan() ? 1u : 0u) | (options.getPrefetchLegacyPlan() ? 2u : 0u) |
+		(options.getNamedParameters() ? 4u : 0u));
+
+	if (const auto& cursorName = options.getCursorName())
+		combine(std::hash<std::string>{}(*cursorName));
+
+	return hash;
+}
+
+
+StatementCache::StatementCache(Attachment& attachment, std::size_t capacity)
+	: attachment{&attachment},
+	  capacity{capacity}
+{
+	assert(attachment.isValid());
+
+	if (capacity == 0u)
+		throw std::invalid_argument{"StatementCache capacity must be greater than zero"};
+
+	index.reserve(capacity);
+}
+
+Statement& StatementCache::prepare(Transaction& transaction, std::string_view sql, const StatementOptions& options)
+{
+	if (const auto it = index.find(Key{sql, &options}); it != index.end())
+	{
+		const auto entry = it->second;
+
+		if (entry->statement.isValid())
+		{
+			++hitCount;
+			entries.splice(entries.begin(), entries, entry);
+			entry->statement.clearParameters();
+			return entry->statement;
+		}
+
+		// The statement was freed by the user; prepare it again.
+		index.erase(it);
+		entries.erase(entry);
+	}
+
+	++missCount;
+
+	Statement statement{*attachment, transaction, sql, options};
+
+	if (entries.size() >= capacity)
+	{
+		const auto& last = entries.back();
+		index.erase(Key{last.sql, &last.options});
+		entries.pop_back();
+	}
+
+	auto& entry = entries.emplace_front(sql, options, std::move(statement));
+	index.emplace(Key{entry.sql, &entry.options}, entries.begin());
+
+	return entry.statement;
+}
+
+bool StatementCache::erase(std::string_view sql, const StatementOptions& options)
+{
+	const auto it = index.find(Key{sql, &options});
+
+	if (it == index.end())
+		return false;
+
+	const auto entry = it->second;
+	index.erase(it);
+	entries.erase(entry);
+
+	return true;
+}
+
+void StatementCache::clear() noexcept
+{
+	index.clear();
+	entries.clear();
+}
@@ -0,0 +1,167 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_STATEMENT_CACHE_H
+#define FBCPP_STATEMENT_CACHE_H
+
+#include "Statement.h"
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	class Attachment;
+	class Transaction;
+
+	///
+	/// LRU cache of prepared Statement objects of one Attachment, keyed by SQL text plus StatementOptions.
+	/// A cache hit returns the already prepared Statement, with its descriptors and message buffers ready and its
+	/// parameters reset to NULL, avoiding the server round-trip and the metadata processing of a new prepare.
+	/// The StatementCache is not thread-safe and must be destroyed before its Attachment.
+	///
+	class StatementCache final
+	{
+	public:
+		///
+		/// Constructs an empty StatementCache for the specified Attachment, holding up to `capacity` statements.
+		///
+		explicit StatementCache(Attachment& attachment, std::size_t capacity = 64u);
+
+		StatementCache(StatementCache&&) = delete;
+		StatementCache& operator=(StatementCache&&) = delete;
+		StatementCache(const StatementCache&) = delete;
+		StatementCache& operator=(const StatementCache&) = delete;
+
+	public:
+		///
+		/// Returns the Attachment used by this StatementCache.
+		///
+		Attachment& getAttachment() noexcept
+		{
+			return *attachment;
+		}
+
+		///
+		/// Returns the maximum number of cached statements.
+		///
+		std::size_t getCapacity() const noexcept
+		{
+			return capacity;
+		}
+
+		///
+		/// Returns the number of cached statements.
+		///
+		std::size_t getSize() const noexcept
+		{
+			return entries.size();
+		}
+
+		///
+		/// Returns the number of prepare() calls served from the cache.
+		///
+		std::size_t getHitCount() const noexcept
+		{
+			return hitCount;
+		}
+
+		///
+		/// Returns the number of prepare() calls that had to prepare a new statement.
+		///
+		std::size_t getMissCount() const noexcept
+		{
+			return missCount;
+		}
+
+		///
+		/// Returns a prepared Statement for the SQL text and options, preparing it (using the specified
+		/// transaction) on cache miss. On cache hit, input parameters are reset to NULL.
+		/// The returned reference is valid until the statement is evicted, which happens when `capacity` other
+		/// distinct statements are prepared through the cache, or until clear() or erase() is called.
+		///
+		Statement& prepare(Transaction& transaction, std::string_view sql, const StatementOptions& options = {});
+
+		///
+		/// Removes (and frees) the cached statement for the SQL text and options, if present.
+		/// Returns whether a statement was removed.
+		///
+		bool erase(std::string_view sql, const StatementOptions& options = {});
+
+		///
+		/// Removes (and frees) all cached statements.
+		///
+		void clear() noexcept;
+
+	private:
+		struct Key final
+		{
+			std::string_view sql;
+			const StatementOptions* options;
+
+			bool operator==(const Key& o) const
+			{
+				return sql == o.sql && *options == *o.options;
+			}
+		};
+
+		struct KeyHash final
+		{
+			std::size_t operator()(const Key& key) const noexcept;
+		};
+
+		struct Entry final
+		{
+			Entry(std::string_view sql, const StatementOptions& options, Statement&& statement)
+				: sql{sql},
+				  options{options},
+				  statement{std::move(statement)}
+			{
+			}
+
+			std::string sql;
+			StatementOptions options;
+			Statement statement;
+		};
+
+	private:
+		Attachment* attachment;
+		std::size_t capacity;
+		std::size_t hitCount = 0u;
+		std::size_t missCount = 0u;
+		std::list<Entry> entries;  // most recently used first
+		std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_STATEMENT_CACHE_H
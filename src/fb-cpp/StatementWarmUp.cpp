@@ -0,0 +1,168 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "StatementWarmUp.h"
+#include "Attachment.h"
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+namespace
+{
+	std::string describeError(const std::exception_ptr& error)
+	{
+		try
+		{
+			std::rethrow_exception(error);
+		}
+		catch (const std::exception& e)
+		{
+			return e.what();
+		}
+		catch (...)
+		{
+			return "unknown error";
+		}
+	}
+}  // namespace
+
+
+WarmUpReport StatementWarmUp::run(std::span<StatementCache* const> caches,
+	std::span<const WarmUpStatement> statements, const StatementWarmUpOptions& options)
+{
+	if (options.getThreadCount() == 0u)
+		throw std::invalid_argument{"StatementWarmUp threadCount must be greater than zero"};
+
+	for (const auto* cache : caches)
+	{
+		if (!cache)
+			throw std::invalid_argument{"StatementWarmUp caches must not be null"};
+
+		if (cache->getCapacity() < statements.size())
+			throw std::invalid_argument{"StatementWarmUp statements do not fit in the cache capacity"};
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+
+	WarmUpReport report;
+	report.results.resize(caches.size() * statements.size());
+
+	for (std::size_t cacheIndex = 0u; cacheIndex < caches.size(); ++cacheIndex)
+	{
+		for (std::size_t statementIndex = 0u; statementIndex < statements.size(); ++statementIndex)
+		{
+			auto& result = report.results[cacheIndex * statements.size() + statementIndex];
+			result.cacheIndex = cacheIndex;
+			result.statementIndex = statementIndex;
+		}
+	}
+
+	// Records the error of every prepare of a cache that could not be prepared at all.
+	const auto failCache = [&](std::size_t cacheIndex, std::size_t from, const std::exception_ptr& error)
+	{
+		for (auto statementIndex = from; statementIndex < statements.size(); ++statementIndex)
+		{
+			auto& result = report.results[cacheIndex * statements.size() + statementIndex];
+
+			if (!result.error)
+				result.error = error;
+		}
+	};
+
+	std::atomic<std::size_t> nextCache = 0u;
+
+	const auto fill = [&]
+	{
+		for (auto cacheIndex = nextCache++; cacheIndex < caches.size(); cacheIndex = nextCache++)
+		{
+			auto& cache = *caches[cacheIndex];
+			std::size_t statementIndex = 0u;
+
+			try
+			{
+				Transaction transaction{cache.getAttachment(), options.getTransactionOptions()};
+
+				for (; statementIndex < statements.size(); ++statementIndex)
+				{
+					const auto& statement = statements[statementIndex];
+					auto& result = report.results[cacheIndex * statements.size() + statementIndex];
+					const auto prepareStart = std::chrono::steady_clock::now();
+
+					try
+					{
+						cache.prepare(transaction, statement.sql, statement.options);
+					}
+					catch (...)
+					{
+						result.error = std::current_exception();
+					}
+
+					result.prepareTime = std::chrono::steady_clock::now() - prepareStart;
+				}
+
+				transaction.commit();
+			}
+			catch (...)
+			{
+				// The transaction could not be started or committed.
+				failCache(cacheIndex, statementIndex, std::current_exception());
+			}
+		}
+	};
+
+	const auto threadCount = static_cast<unsigned>(std::min<std::size_t>(options.getThreadCount(), caches.size()));
+
+	if (threadCount <= 1u)
+		fill();
+	else
+	{
+		std::vector<std::thread> threads;
+		threads.reserve(threadCount);
+
+		for (unsigned i = 0u; i < threadCount; ++i)
+			threads.emplace_back(fill);
+
+		for (auto& thread : threads)
+			thread.join();
+	}
+
+	for (auto& result : report.results)
+	{
+		if (result.error)
+		{
+			result.errorMessage = describeError(result.error);
+			++report.failedCount;
+		}
+	}
+
+	report.elapsed = std::chrono::steady_clock::now() - start;
+
+	return report;
+}
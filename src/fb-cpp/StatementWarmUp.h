@@ -0,0 +1,193 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_STATEMENT_WARM_UP_H
+#define FBCPP_STATEMENT_WARM_UP_H
+
+#include "Statement.h"
+#include "StatementCache.h"
+#include "Transaction.h"
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <span>
+#include <string>
+#include <vector>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// SQL text and options of one statement to be prepared by StatementWarmUp.
+	///
+	struct WarmUpStatement final
+	{
+		///
+		/// SQL text of the statement.
+		///
+		std::string sql;
+
+		///
+		/// Options used to prepare the statement, which are also part of the StatementCache key.
+		///
+		StatementOptions options;
+	};
+
+	///
+	/// Represents options used when running a StatementWarmUp.
+	///
+	class StatementWarmUpOptions final
+	{
+	public:
+		///
+		/// Returns the maximum number of threads preparing statements concurrently.
+		///
+		unsigned getThreadCount() const
+		{
+			return threadCount;
+		}
+
+		///
+		/// Sets the maximum number of threads preparing statements concurrently.
+		/// Each StatementCache is filled by a single thread, so more threads than caches are never started.
+		///
+		StatementWarmUpOptions& setThreadCount(unsigned value)
+		{
+			threadCount = value;
+			return *this;
+		}
+
+		///
+		/// Returns the options of the transaction started by each thread for every cache it fills.
+		///
+		const TransactionOptions& getTransactionOptions() const
+		{
+			return transactionOptions;
+		}
+
+		///
+		/// Sets the options of the transaction started by each thread for every cache it fills.
+		///
+		StatementWarmUpOptions& setTransactionOptions(const TransactionOptions& value)
+		{
+			transactionOptions = value;
+			return *this;
+		}
+
+	private:
+		unsigned threadCount = 4;
+		TransactionOptions transactionOptions =
+			TransactionOptions().setIsolationLevel(TransactionIsolationLevel::READ_COMMITTED).setAccessMode(
+				TransactionAccessMode::READ_ONLY);
+	};
+
+	///
+	/// Outcome of preparing one statement in one StatementCache.
+	///
+	struct WarmUpResult final
+	{
+		///
+		/// Zero-based index of the cache in the span passed to `StatementWarmUp::run()`.
+		///
+		std::size_t cacheIndex = 0u;
+
+		///
+		/// Zero-based index of the statement in the span passed to `StatementWarmUp::run()`.
+		///
+		std::size_t statementIndex = 0u;
+
+		///
+		/// Wall-clock time spent in the prepare, or until it failed.
+		///
+		std::chrono::nanoseconds prepareTime{};
+
+		///
+		/// Exception thrown by the prepare, or null when it succeeded.
+		///
+		std::exception_ptr error;
+
+		///
+		/// Message of the exception thrown by the prepare, or empty when it succeeded.
+		///
+		std::string errorMessage;
+	};
+
+	///
+	/// Aggregated outcome of a StatementWarmUp run.
+	///
+	struct WarmUpReport final
+	{
+		///
+		/// Per-statement results, ordered by cache index and then by statement index.
+		///
+		std::vector<WarmUpResult> results;
+
+		///
+		/// Number of prepares that failed.
+		///
+		std::size_t failedCount = 0u;
+
+		///
+		/// Wall-clock time of the whole run.
+		///
+		std::chrono::nanoseconds elapsed{};
+
+		///
+		/// Returns whether all prepares succeeded.
+		///
+		bool isSuccess() const noexcept
+		{
+			return failedCount == 0u;
+		}
+	};
+
+	///
+	/// @brief Fills several StatementCache objects concurrently, typically one per pooled attachment.
+	///
+	/// Prepared statements belong to the attachment that prepared them, so every statement is prepared in every
+	/// cache; the parallelism is across caches (and thus attachments), each one filled by a single thread as
+	/// StatementCache is not thread-safe. A failed prepare is reported in the WarmUpReport and does not stop the
+	/// remaining ones. The caches must not be used by other threads during the run and must be able to hold all
+	/// the statements.
+	///
+	class StatementWarmUp final
+	{
+	public:
+		StatementWarmUp() = delete;
+
+	public:
+		///
+		/// Prepares all `statements` in all `caches` and returns the per-statement results.
+		///
+		static WarmUpReport run(std::span<StatementCache* const> caches, std::span<const WarmUpStatement> statements,
+			const StatementWarmUpOptions& options = {});
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_STATEMENT_WARM_UP_H
@@ -0,0 +1,71 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TimeZoneCache.h"
+#include <mutex>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+std::optional<TimeZoneName> TimeZoneCache::findName(ISC_USHORT id) const
+{
+	std::shared_lock lock{mutex};
+
+	if (const auto it = namesById.find(id); it != namesById.end())
+		return it->second;
+
+	return std::nullopt;
+}
+
+std::optional<ISC_USHORT> TimeZoneCache::findId(std::string_view name) const
+{
+	std::shared_lock lock{mutex};
+
+	if (const auto it = idsByName.find(name); it != idsByName.end())
+		return it->second;
+
+	return std::nullopt;
+}
+
+TimeZoneName TimeZoneCache::intern(ISC_USHORT id, std::string_view name)
+{
+	std::unique_lock lock{mutex};
+
+	const auto [it, inserted] = namesById.try_emplace(id, name);
+
+	if (inserted && idsByName.size() < MAX_NAMES)
+		idsByName.try_emplace(std::string{name}, id);
+
+	return it->second;
+}
+
+void TimeZoneCache::addId(std::string_view name, ISC_USHORT id)
+{
+	std::unique_lock lock{mutex};
+
+	if (idsByName.size() < MAX_NAMES)
+		idsByName.try_emplace(std::string{name}, id);
+}
@@ -0,0 +1,109 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_TIME_ZONE_CACHE_H
+#define FBCPP_TIME_ZONE_CACHE_H
+
+#include "fb-api.h"
+#include "types.h"
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp::impl
+{
+	///
+	/// @brief Thread-safe cache of the Firebird time zone IDs and their names, owned by a Client.
+	///
+	/// Names decoded from values are interned, so decoding TIME/TIMESTAMP WITH TIME ZONE values neither
+	/// allocates nor calls the client library after the first value of each zone. Names used to encode values
+	/// are mapped to their IDs, so encoding skips the zone lookup for known names.
+	///
+	class TimeZoneCache final
+	{
+	public:
+		///
+		/// Maximum number of names mapped to IDs.
+		/// Firebird knows a few hundred regions plus the offsets, but names given by the application (with
+		/// different spellings of the same zone) are only cached up to this limit.
+		///
+		static constexpr std::size_t MAX_NAMES = 4096u;
+
+	public:
+		TimeZoneCache() = default;
+
+		TimeZoneCache(const TimeZoneCache&) = delete;
+		TimeZoneCache& operator=(const TimeZoneCache&) = delete;
+
+	public:
+		///
+		/// Returns the interned name of the specified time zone ID, if already known.
+		///
+		std::optional<TimeZoneName> findName(ISC_USHORT id) const;
+
+		///
+		/// Returns the ID of the specified time zone name, if already known.
+		///
+		std::optional<ISC_USHORT> findId(std::string_view name) const;
+
+		///
+		/// Interns the name decoded by Firebird for the specified ID and returns the interned name.
+		/// If the ID is already known, the existing name is returned.
+		///
+		TimeZoneName intern(ISC_USHORT id, std::string_view name);
+
+		///
+		/// Records the ID Firebird resolved for a name given by the application.
+		///
+		void addId(std::string_view name, ISC_USHORT id);
+
+	private:
+		struct NameHash final
+		{
+			using is_transparent = void;
+
+			std::size_t operator()(std::string_view value) const noexcept
+			{
+				return std::hash<std::string_view>{}(value);
+			}
+		};
+
+	private:
+		mutable std::shared_mutex mutex;
+		std::unordered_map<ISC_USHORT, TimeZoneName> namesById;
+		std::unordered_map<std::string, ISC_USHORT, NameHash, std::equal_to<>> idsByName;
+	};
+}  // namespace fbcpp::impl
+
+
+#endif  // FBCPP_TIME_ZONE_CACHE_H
@@ -0,0 +1,426 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TraceManager.h"
+#include "Client.h"
+#include <charconv>
+#include <memory>
+#include <string>
+#include <utility>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+namespace
+{
+	std::string_view trim(std::string_view text) noexcept
+	{
+		const auto start = text.find_first_not_of(" \t\r");
+
+		if (start == std::string_view::npos)
+			return {};
+
+		const auto end = text.find_last_not_of(" \t\r");
+		return text.substr(start, end - start + 1u);
+	}
+
+	// Parses the leading digits of the text, advancing it past them.
+	template <typename T>
+	std::optional<T> parseNumber(std::string_view& text) noexcept
+	{
+		T value{};
+		const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+
+		if (error != std::errc{})
+			return std::nullopt;
+
+		text.remove_prefix(static_cast<std::size_t>(end - text.data()));
+		return value;
+	}
+
+	// Parses the number that follows the marker in the text.
+	template <typename T>
+	std::optional<T> parseAfter(std::string_view text, std::string_view marker) noexcept
+	{
+		const auto pos = text.find(marker);
+
+		if (pos == std::string_view::npos)
+			return std::nullopt;
+
+		text.remove_prefix(pos + marker.size());
+		return parseNumber<T>(text);
+	}
+
+	bool isRuler(std::string_view line, char c) noexcept
+	{
+		line = trim(line);
+		return !line.empty() && line.find_first_not_of(c) == std::string_view::npos;
+	}
+
+	// Event headers look like `2025-01-15T10:20:30.1230 (1234:0x7f00c8e1b0c0) EXECUTE_STATEMENT_FINISH`.
+	bool isEventHeader(std::string_view line) noexcept
+	{
+		return line.size() > 20u && line[4] == '-' && line[7] == '-' && line[10] == 'T' && line[13] == ':' &&
+			line.find(" (") != std::string_view::npos;
+	}
+
+	// Parses the counters line, such as `      0 ms, 2 read(s), 4 fetch(es), 1 mark(s)`.
+	bool parseCounters(std::string_view line, TraceEvent& event)
+	{
+		line = trim(line);
+		TraceEvent parsed;
+		bool hasElapsed = false;
+
+		while (!line.empty())
+		{
+			const auto separator = line.find(',');
+			auto item = trim(line.substr(0u, separator));
+			line = separator == std::string_view::npos ? std::string_view{} : line.substr(separator + 1u);
+
+			const auto value = parseNumber<std::uint64_t>(item);
+
+			if (!value)
+				return false;
+
+			item = trim(item);
+
+			if (item == "ms")
+			{
+				parsed.elapsed = std::chrono::milliseconds{static_cast<std::chrono::milliseconds::rep>(*value)};
+				hasElapsed = true;
+			}
+			else if (item.starts_with("read"))
+				parsed.reads = value;
+			else if (item.starts_with("write"))
+				parsed.writes = value;
+			else if (item.starts_with("fetch"))
+				parsed.fetches = value;
+			else if (item.starts_with("mark"))
+				parsed.marks = value;
+			else
+				return false;
+		}
+
+		if (!hasElapsed)
+			return false;
+
+		event.elapsed = parsed.elapsed;
+		event.reads = parsed.reads;
+		event.writes = parsed.writes;
+		event.fetches = parsed.fetches;
+		event.marks = parsed.marks;
+
+		return true;
+	}
+
+	// Groups the trace output lines into events and parses their well known items.
+	class TraceEventParser final
+	{
+	private:
+		enum class Section
+		{
+			NONE,
+			STATEMENT,
+			SQL,
+			PLAN
+		};
+
+	public:
+		explicit TraceEventParser(const TraceEventOutput& eventOutput)
+			: eventOutput{eventOutput}
+		{
+		}
+
+		void parse(std::string_view line)
+		{
+			if (!line.empty() && line.back() == '\n')
+				line.remove_suffix(1u);
+
+			if (isEventHeader(line))
+			{
+				finish();
+				startEvent(line);
+				return;
+			}
+
+			if (!event)
+				return;
+
+			event->text += '\n';
+			event->text += line;
+
+			parseItem(line);
+		}
+
+		void finish()
+		{
+			if (!event)
+				return;
+
+			while (!event->text.empty() && (event->text.back() == '\n' || event->text.back() == '\r'))
+				event->text.pop_back();
+
+			const auto completed = std::move(event);
+			event.reset();
+
+			if (eventOutput)
+				eventOutput(*completed);
+		}
+
+	private:
+		void startEvent(std::string_view line)
+		{
+			event = std::make_unique<TraceEvent>();
+			event->text = line;
+			section = Section::NONE;
+
+			const auto space = line.find(' ');
+			event->timestamp = line.substr(0u, space);
+
+			auto rest = line.substr(space + 1u);
+
+			if (rest.starts_with('('))
+			{
+				rest.remove_prefix(1u);
+
+				if (const auto processId = parseNumber<std::uint64_t>(rest))
+					event->processId = *processId;
+
+				if (const auto close = rest.find(')'); close != std::string_view::npos)
+					rest.remove_prefix(close + 1u);
+			}
+
+			event->eventType = trim(rest);
+		}
+
+		void parseItem(std::string_view line)
+		{
+			switch (section)
+			{
+				case Section::STATEMENT:
+					section = isRuler(line, '-') ? Section::SQL : Section::NONE;
+					return;
+
+				case Section::SQL:
+					if (isRuler(line, '^') || trim(line).empty())
+						section = Section::NONE;
+					else
+					{
+						if (!event->sql.empty())
+							event->sql += '\n';
+
+						event->sql += line;
+					}
+					return;
+
+				case Section::PLAN:
+					if (trim(line).empty())
+						section = Section::NONE;
+					else
+					{
+						event->plan += '\n';
+						event->plan += line;
+					}
+					return;
+
+				case Section::NONE:
+					break;
+			}
+
+			const auto item = trim(line);
+
+			if (item.starts_with("Statement ") && item.ends_with(':'))
+			{
+				event->statementId = parseAfter<std::int64_t>(item, "Statement ");
+				section = Section::STATEMENT;
+			}
+			else if (item.starts_with("PLAN ") || item.starts_with("Select Expression"))
+			{
+				event->plan = item;
+				section = Section::PLAN;
+			}
+			else if (const auto pos = item.find(" (ATT_"); pos != std::string_view::npos)
+			{
+				event->database = trim(item.substr(0u, pos));
+				event->attachmentId = parseAfter<std::int64_t>(item, "(ATT_");
+
+				// The user follows the attachment id, optionally with the role: `(ATT_5, SYSDBA:NONE, ...)`.
+				if (auto user = item.substr(pos); user.find(", ") != std::string_view::npos)
+				{
+					user.remove_prefix(user.find(", ") + 2u);
+					event->user = trim(user.substr(0u, user.find_first_of(":,)")));
+				}
+			}
+			else if (item.starts_with("(TRA_"))
+				event->transactionId = parseAfter<std::int64_t>(item, "(TRA_");
+			else if (item.ends_with(" records fetched"))
+			{
+				auto count = item;
+				event->recordsFetched = parseNumber<std::uint64_t>(count);
+			}
+			else if (!item.empty() && item.front() >= '0' && item.front() <= '9')
+				parseCounters(item, *event);
+		}
+
+	private:
+		const TraceEventOutput& eventOutput;
+		std::unique_ptr<TraceEvent> event;
+		Section section = Section::NONE;
+	};
+}  // namespace
+
+
+void TraceManager::start(const TraceSessionOptions& options, const TraceEventOutput& eventOutput)
+{
+	StatusWrapper statusWrapper{getClient()};
+	auto builder =
+		fbUnique(getClient().getUtil()->getXpbBuilder(&statusWrapper, fb::IXpbBuilder::SPB_START, nullptr, 0));
+	builder->insertTag(&statusWrapper, isc_action_svc_trace_start);
+
+	if (const auto& name = options.getName())
+		builder->insertString(&statusWrapper, isc_spb_trc_name, name->c_str());
+
+	builder->insertString(&statusWrapper, isc_spb_trc_cfg, options.getConfig().c_str());
+
+	const auto buffer = builder->getBuffer(&statusWrapper);
+	const auto length = builder->getBufferLength(&statusWrapper);
+	startAction(std::vector<std::uint8_t>(buffer, buffer + length));
+
+	TraceEventParser parser{eventOutput};
+	bool sessionStarted = false;
+
+	waitForCompletion(
+		[&](std::string_view line)
+		{
+			if (const auto& verboseOutput = options.getVerboseOutput())
+				verboseOutput(line);
+
+			// The first line tells the session id: `Trace session ID 5 started`.
+			if (!sessionStarted && line.starts_with("Trace session ID "))
+			{
+				sessionStarted = true;
+
+				if (const auto sessionId = parseAfter<std::uint64_t>(line, "Trace session ID "))
+				{
+					if (const auto& sessionIdOutput = options.getSessionIdOutput())
+						sessionIdOutput(*sessionId);
+				}
+
+				return;
+			}
+
+			parser.parse(line);
+		});
+
+	parser.finish();
+}
+
+void TraceManager::stop(std::uint64_t sessionId)
+{
+	const auto lines = runSessionAction(isc_action_svc_trace_stop, sessionId);
+
+	for (const auto& line : lines)
+	{
+		if (line.find("stopped") != std::string::npos)
+			return;
+	}
+
+	if (lines.empty())
+		throw FbCppException("Trace session " + std::to_string(sessionId) + " could not be stopped");
+
+	throw FbCppException(std::string{trim(lines.front())});
+}
+
+std::vector<TraceSessionInfo> TraceManager::list()
+{
+	std::vector<TraceSessionInfo> sessions;
+
+	// Sessions are listed as `Session ID: N` followed by indented `key: value` lines.
+	for (const auto& line : runSessionAction(isc_action_svc_trace_list, std::nullopt))
+	{
+		const auto item = trim(line);
+
+		if (item.starts_with("Session ID:"))
+		{
+			auto& session = sessions.emplace_back();
+			session.id = parseAfter<std::uint64_t>(item, "Session ID: ").value_or(0u);
+			continue;
+		}
+
+		const auto colon = item.find(':');
+
+		if (sessions.empty() || colon == std::string_view::npos)
+			continue;
+
+		auto& session = sessions.back();
+		const auto key = trim(item.substr(0u, colon));
+		const auto value = trim(item.substr(colon + 1u));
+
+		if (key == "name")
+			session.name = value;
+		else if (key == "user")
+			session.user = value;
+		else if (key == "date")
+			session.date = value;
+		else if (key == "flags")
+		{
+			for (auto flags = value; !flags.empty();)
+			{
+				const auto comma = flags.find(',');
+				session.flags.emplace_back(trim(flags.substr(0u, comma)));
+				flags = comma == std::string_view::npos ? std::string_view{} : flags.substr(comma + 1u);
+			}
+		}
+	}
+
+	return sessions;
+}
+
+std::vector<std::string> TraceManager::runSessionAction(
+	unsigned char action, std::optional<std::uint64_t> sessionId)
+{
+	StatusWrapper statusWrapper{getClient()};
+	auto builder =
+		fbUnique(getClient().getUtil()->getXpbBuilder(&statusWrapper, fb::IXpbBuilder::SPB_START, nullptr, 0));
+	builder->insertTag(&statusWrapper, action);
+
+	if (sessionId)
+		addSpbInt(builder.get(), &statusWrapper, isc_spb_trc_id, *sessionId, "Trace session id");
+
+	const auto buffer = builder->getBuffer(&statusWrapper);
+	const auto length = builder->getBufferLength(&statusWrapper);
+	startAction(std::vector<std::uint8_t>(buffer, buffer + length));
+
+	std::vector<std::string> lines;
+	waitForCompletion(
+		[&](std::string_view line)
+		{
+			if (!trim(line).empty())
+				lines.emplace_back(line);
+		});
+
+	return lines;
+}
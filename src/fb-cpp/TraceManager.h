@@ -0,0 +1,306 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_TRACE_MANAGER_H
+#define FBCPP_TRACE_MANAGER_H
+
+#include "ServiceManager.h"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// Trace event parsed from the text written by the Firebird trace plugin.
+	/// Items not present in the event text are left empty.
+	///
+	struct TraceEvent final
+	{
+		///
+		/// Timestamp of the event, as written by the server.
+		///
+		std::string timestamp;
+
+		///
+		/// Server process id.
+		///
+		std::uint64_t processId = 0u;
+
+		///
+		/// Name of the event, such as `EXECUTE_STATEMENT_FINISH`, possibly prefixed by `FAILED` or
+		/// `UNAUTHORIZED`.
+		///
+		std::string eventType;
+
+		///
+		/// Database path of the attachment.
+		///
+		std::string database;
+
+		///
+		/// Attachment id.
+		///
+		std::optional<std::int64_t> attachmentId;
+
+		///
+		/// User name of the attachment.
+		///
+		std::string user;
+
+		///
+		/// Transaction id.
+		///
+		std::optional<std::int64_t> transactionId;
+
+		///
+		/// Statement id.
+		///
+		std::optional<std::int64_t> statementId;
+
+		///
+		/// Statement SQL text.
+		///
+		std::string sql;
+
+		///
+		/// Statement plan, legacy or explained.
+		///
+		std::string plan;
+
+		///
+		/// Number of records fetched by the statement.
+		///
+		std::optional<std::uint64_t> recordsFetched;
+
+		///
+		/// Elapsed time of the operation.
+		///
+		std::optional<std::chrono::milliseconds> elapsed;
+
+		///
+		/// Page reads.
+		///
+		std::optional<std::uint64_t> reads;
+
+		///
+		/// Page writes.
+		///
+		std::optional<std::uint64_t> writes;
+
+		///
+		/// Page fetches.
+		///
+		std::optional<std::uint64_t> fetches;
+
+		///
+		/// Page marks.
+		///
+		std::optional<std::uint64_t> marks;
+
+		///
+		/// Full text of the event, header line included.
+		///
+		std::string text;
+	};
+
+	///
+	/// Function invoked for every trace event, as soon as it is complete.
+	///
+	using TraceEventOutput = std::function<void(const TraceEvent& event)>;
+
+	///
+	/// Function invoked with the id of a trace session once the server has started it.
+	///
+	using TraceSessionIdOutput = std::function<void(std::uint64_t sessionId)>;
+
+	///
+	/// Represents options used to start a trace session through the service manager.
+	///
+	class TraceSessionOptions final
+	{
+	public:
+		///
+		/// Returns the trace session name.
+		///
+		const std::optional<std::string>& getName() const
+		{
+			return name;
+		}
+
+		///
+		/// Sets the trace session name.
+		///
+		TraceSessionOptions& setName(const std::string& value)
+		{
+			name = value;
+			return *this;
+		}
+
+		///
+		/// Returns the trace configuration text, in the format of `fbtrace.conf`.
+		///
+		const std::string& getConfig() const
+		{
+			return config;
+		}
+
+		///
+		/// Sets the trace configuration text, in the format of `fbtrace.conf`.
+		///
+		TraceSessionOptions& setConfig(const std::string& value)
+		{
+			config = value;
+			return *this;
+		}
+
+		///
+		/// Returns the function invoked with the id of the started session.
+		///
+		const TraceSessionIdOutput& getSessionIdOutput() const
+		{
+			return sessionIdOutput;
+		}
+
+		///
+		/// Sets the function invoked with the id of the started session, which is needed to stop it from another
+		/// TraceManager.
+		///
+		TraceSessionOptions& setSessionIdOutput(const TraceSessionIdOutput& value)
+		{
+			sessionIdOutput = value;
+			return *this;
+		}
+
+		///
+		/// Returns the function invoked for every raw line of the trace output.
+		///
+		const ServiceManager::VerboseOutput& getVerboseOutput() const
+		{
+			return verboseOutput;
+		}
+
+		///
+		/// Sets the function invoked for every raw line of the trace output.
+		///
+		TraceSessionOptions& setVerboseOutput(const ServiceManager::VerboseOutput& value)
+		{
+			verboseOutput = value;
+			return *this;
+		}
+
+	private:
+		std::optional<std::string> name;
+		std::string config;
+		TraceSessionIdOutput sessionIdOutput;
+		ServiceManager::VerboseOutput verboseOutput;
+	};
+
+	///
+	/// Trace session reported by TraceManager::list().
+	///
+	struct TraceSessionInfo final
+	{
+		///
+		/// Session id.
+		///
+		std::uint64_t id = 0u;
+
+		///
+		/// Session name.
+		///
+		std::string name;
+
+		///
+		/// User that started the session.
+		///
+		std::string user;
+
+		///
+		/// Start date of the session, as written by the server.
+		///
+		std::string date;
+
+		///
+		/// Session flags, such as `active`, `suspend`, `admin`, `trace` and `log full`.
+		///
+		std::vector<std::string> flags;
+
+		///
+		/// Returns whether the session is active.
+		///
+		bool isActive() const noexcept
+		{
+			for (const auto& flag : flags)
+			{
+				if (flag == "active")
+					return true;
+			}
+
+			return false;
+		}
+	};
+
+	///
+	/// Represents a connection to the Firebird service manager that manages trace sessions.
+	///
+	class TraceManager final : public ServiceManager
+	{
+	public:
+		using ServiceManager::ServiceManager;
+
+	public:
+		///
+		/// Starts a trace session and delivers its events until the session is stopped, what is done through
+		/// another TraceManager with the id given to the session id output.
+		///
+		void start(const TraceSessionOptions& options, const TraceEventOutput& eventOutput);
+
+		///
+		/// Stops the trace session with the given id.
+		/// Throws FbCppException if the server could not stop it.
+		///
+		void stop(std::uint64_t sessionId);
+
+		///
+		/// Returns the trace sessions visible to the service user.
+		///
+		std::vector<TraceSessionInfo> list();
+
+	private:
+		std::vector<std::string> runSessionAction(unsigned char action, std::optional<std::uint64_t> sessionId);
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_TRACE_MANAGER_H
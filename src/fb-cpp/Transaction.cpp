@@ -132,8 +132,22 @@ static FbUniquePtr<fb::IXpbBuilder> buildTpb(
 }
 
 
+ParameterBlock TransactionOptions::compile(Client& client) const
+{
+	StatusWrapper statusWrapper{client};
+
+	const auto tpbBuilder = buildTpb(client.getMaster(), statusWrapper, *this);
+	const auto tpbBuffer = tpbBuilder->getBuffer(&statusWrapper);
+	const auto tpbBufferLen = tpbBuilder->getBufferLength(&statusWrapper);
+
+	return ParameterBlock{ParameterBlockType::TPB, {tpbBuffer, tpbBuffer + tpbBufferLen}};
+}
+
+
 Transaction::Transaction(Attachment& attachment, const TransactionOptions& options)
-	: client{attachment.getClient()}
+	: client{attachment.getClient()},
+	  attachment{&attachment},
+	  observer{attachment.getObserver()}
 {
 	assert(attachment.isValid());
 
@@ -145,11 +159,29 @@ Transaction::Transaction(Attachment& attachment, const TransactionOptions& optio
 	const auto tpbBuffer = tpbBuilder->getBuffer(&statusWrapper);
 	const auto tpbBufferLen = tpbBuilder->getBufferLength(&statusWrapper);
 
+	MetricsScope metrics{client.getMetricsRegistry(), MetricsCall::START_TRANSACTION};
 	handle.reset(attachment.getHandle()->startTransaction(&statusWrapper, tpbBufferLen, tpbBuffer));
 }
 
+Transaction::Transaction(Attachment& attachment, const ParameterBlock& tpb)
+	: client{attachment.getClient()},
+	  attachment{&attachment},
+	  observer{attachment.getObserver()}
+{
+	assert(attachment.isValid());
+
+	tpb.checkType(ParameterBlockType::TPB);
+
+	StatusWrapper statusWrapper{client};
+
+	MetricsScope metrics{client.getMetricsRegistry(), MetricsCall::START_TRANSACTION};
+	handle.reset(attachment.getHandle()->startTransaction(&statusWrapper, tpb.getLength(), tpb.getData()));
+}
+
 Transaction::Transaction(Attachment& attachment, std::string_view setTransactionCmd)
-	: client{attachment.getClient()}
+	: client{attachment.getClient()},
+	  attachment{&attachment},
+	  observer{attachment.getObserver()}
 {
 	assert(attachment.isValid());
 
@@ -161,11 +193,19 @@ Transaction::Transaction(Attachment& attachment, std::string_view setTransaction
 }
 
 Transaction::Transaction(std::span<std::reference_wrapper<Attachment>> attachments, const TransactionOptions& options)
+	: Transaction{attachments, options.compile(attachments[0].get().getClient())}
+{
+}
+
+Transaction::Transaction(std::span<std::reference_wrapper<Attachment>> attachments, const ParameterBlock& tpb)
 	: client{attachments[0].get().getClient()},
-	  isMultiDatabase{true}
+	  isMultiDatabase{true},
+	  observer{attachments[0].get().getObserver()}
 {
 	assert(!attachments.empty());
 
+	tpb.checkType(ParameterBlockType::TPB);
+
 	// Validate all attachments use the same Client
 	for (const auto& attachment : attachments)
 	{
@@ -179,18 +219,15 @@ Transaction::Transaction(std::span<std::reference_wrapper<Attachment>> attachmen
 
 	StatusWrapper statusWrapper{client};
 
-	auto tpbBuilder = buildTpb(master, statusWrapper, options);
-	const auto tpbBuffer = tpbBuilder->getBuffer(&statusWrapper);
-	const auto tpbBufferLen = tpbBuilder->getBufferLength(&statusWrapper);
-
 	auto dtcInterface = master->getDtc();
 	auto dtcStart = fbUnique(dtcInterface->startBuilder(&statusWrapper));
 
 	// Add each attachment with the same TPB
 	for (const auto& attachment : attachments)
-		dtcStart->addWithTpb(&statusWrapper, attachment.get().getHandle().get(), tpbBufferLen, tpbBuffer);
+		dtcStart->addWithTpb(&statusWrapper, attachment.get().getHandle().get(), tpb.getLength(), tpb.getData());
 
 	// Start the multi-database transaction, which disposes the IDtcStart instance
+	MetricsScope metrics{client.getMetricsRegistry(), MetricsCall::START_TRANSACTION};
 	handle.reset(dtcStart->start(&statusWrapper));
 	dtcStart.release();
 }
@@ -201,8 +238,20 @@ void Transaction::rollback()
 	assert(state == TransactionState::ACTIVE || state == TransactionState::PREPARED);
 
 	StatusWrapper statusWrapper{client};
+	OperationScope scope{observer.get(), OperationType::ROLLBACK};
 
-	handle->rollback(&statusWrapper);
+	try
+	{
+		MetricsScope metrics{client.getMetricsRegistry(), MetricsCall::ROLLBACK};
+		handle->rollback(&statusWrapper);
+	}
+	catch (...)
+	{
+		scope.fail();
+		throw;
+	}
+
+	scope.finish();
 	handle.reset();
 	state = TransactionState::ROLLED_BACK;
 }
@@ -213,8 +262,20 @@ void Transaction::commit()
 	assert(state == TransactionState::ACTIVE || state == TransactionState::PREPARED);
 
 	StatusWrapper statusWrapper{client};
+	OperationScope scope{observer.get(), OperationType::COMMIT};
 
-	handle->commit(&statusWrapper);
+	try
+	{
+		MetricsScope metrics{client.getMetricsRegistry(), MetricsCall::COMMIT};
+		handle->commit(&statusWrapper);
+	}
+	catch (...)
+	{
+		scope.fail();
+		throw;
+	}
+
+	scope.finish();
 	handle.reset();
 	state = TransactionState::COMMITTED;
 }
@@ -225,8 +286,20 @@ void Transaction::commitRetaining()
 	assert(state == TransactionState::ACTIVE);
 
 	StatusWrapper statusWrapper{client};
+	OperationScope scope{observer.get(), OperationType::COMMIT_RETAINING};
 
-	handle->commitRetaining(&statusWrapper);
+	try
+	{
+		MetricsScope metrics{client.getMetricsRegistry(), MetricsCall::COMMIT};
+		handle->commitRetaining(&statusWrapper);
+	}
+	catch (...)
+	{
+		scope.fail();
+		throw;
+	}
+
+	scope.finish();
 }
 
 void Transaction::rollbackRetaining()
@@ -235,8 +308,30 @@ void Transaction::rollbackRetaining()
 	assert(state == TransactionState::ACTIVE);
 
 	StatusWrapper statusWrapper{client};
+	OperationScope scope{observer.get(), OperationType::ROLLBACK_RETAINING};
+
+	try
+	{
+		MetricsScope metrics{client.getMetricsRegistry(), MetricsCall::ROLLBACK};
+		handle->rollbackRetaining(&statusWrapper);
+	}
+	catch (...)
+	{
+		scope.fail();
+		throw;
+	}
 
-	handle->rollbackRetaining(&statusWrapper);
+	scope.finish();
+}
+
+AsyncOperation<void> Transaction::commitAsync(AsyncExecutor& executor)
+{
+	return executor.run(attachment, [this] { commit(); });
+}
+
+AsyncOperation<void> Transaction::rollbackAsync(AsyncExecutor& executor)
+{
+	return executor.run(attachment, [this] { rollback(); });
 }
 
 void Transaction::prepare()
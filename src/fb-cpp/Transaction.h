@@ -27,6 +27,9 @@
 
 #include "fb-api.h"
 #include "SmartPtrs.h"
+#include "Observer.h"
+#include "AsyncExecutor.h"
+#include "ParameterBlock.h"
 #include <memory>
 #include <optional>
 #include <span>
@@ -43,6 +46,7 @@
 namespace fbcpp
 {
 	class Attachment;
+	class Client;
 
 	///
 	/// Transaction isolation level.
@@ -286,6 +290,12 @@ namespace fbcpp
 			return *this;
 		}
 
+		///
+		/// Encodes these options in a TPB that can be passed to the Transaction constructors, so that starting
+		/// transactions with the same options does not build the TPB again.
+		///
+		ParameterBlock compile(Client& client) const;
+
 	private:
 		std::vector<std::uint8_t> tpb;
 		std::optional<TransactionIsolationLevel> isolationLevel;
@@ -298,8 +308,6 @@ namespace fbcpp
 		bool autoCommit = false;
 	};
 
-	class Client;
-
 	///
 	/// Transaction state for tracking two-phase commit lifecycle.
 	///
@@ -362,6 +370,12 @@ namespace fbcpp
 		///
 		explicit Transaction(Attachment& attachment, std::string_view setTransactionCmd);
 
+		///
+		/// Constructs a Transaction object that starts a transaction in the specified
+		/// Attachment using a TPB returned by `TransactionOptions::compile()`.
+		///
+		explicit Transaction(Attachment& attachment, const ParameterBlock& tpb);
+
 		///
 		/// Constructs a Transaction object that starts a multi-database transaction
 		/// across the specified Attachments using the specified options.
@@ -374,15 +388,23 @@ namespace fbcpp
 		explicit Transaction(
 			std::span<std::reference_wrapper<Attachment>> attachments, const TransactionOptions& options = {});
 
+		///
+		/// Constructs a Transaction object that starts a multi-database transaction
+		/// across the specified Attachments using a TPB returned by `TransactionOptions::compile()`.
+		///
+		explicit Transaction(std::span<std::reference_wrapper<Attachment>> attachments, const ParameterBlock& tpb);
+
 		///
 		/// Move constructor.
 		/// A moved Transaction object becomes invalid.
 		///
 		Transaction(Transaction&& o) noexcept
 			: client{o.client},
+			  attachment{o.attachment},
 			  handle{std::move(o.handle)},
 			  state{o.state},
-			  isMultiDatabase{o.isMultiDatabase}
+			  isMultiDatabase{o.isMultiDatabase},
+			  observer{std::move(o.observer)}
 		{
 			o.state = TransactionState::ROLLED_BACK;
 		}
@@ -492,11 +514,26 @@ namespace fbcpp
 		///
 		void rollbackRetaining();
 
+		///
+		/// Returns an awaitable that commits the transaction on an I/O thread of the executor.
+		///
+		/// Calls on the same Attachment are serialized; multi-database transactions are not serialized
+		/// with any other call.
+		///
+		AsyncOperation<void> commitAsync(AsyncExecutor& executor);
+
+		///
+		/// Returns an awaitable that rolls back the transaction on an I/O thread of the executor.
+		///
+		AsyncOperation<void> rollbackAsync(AsyncExecutor& executor);
+
 	private:
 		Client& client;
+		Attachment* attachment = nullptr;
 		FbRef<fb::ITransaction> handle;
 		TransactionState state = TransactionState::ACTIVE;
 		const bool isMultiDatabase = false;
+		std::shared_ptr<OperationObserver> observer;
 	};
 }  // namespace fbcpp
 
@@ -0,0 +1,58 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TransactionRetry.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace fbcpp;
+
+
+bool RetryPolicy::isRetryable(const DatabaseException& exception) const noexcept
+{
+	return std::any_of(retryableErrorCodes.begin(), retryableErrorCodes.end(),
+		[&](std::intptr_t code) { return exception.hasErrorCode(code); });
+}
+
+std::chrono::microseconds RetryPolicy::getBackoff(unsigned attempt) const
+{
+	const auto initial = static_cast<double>(initialBackoff.count());
+	const auto limit = static_cast<double>(maxBackoff.count());
+	const auto exponent = static_cast<double>(attempt > 0u ? attempt - 1u : 0u);
+	const auto delay = std::min(limit, initial * std::pow(std::max(backoffMultiplier, 1.0), exponent));
+
+	const auto jitterFraction = std::clamp(jitter, 0.0, 1.0);
+	auto factor = 1.0;
+
+	if (jitterFraction > 0.0)
+	{
+		thread_local std::minstd_rand generator{std::random_device{}()};
+		std::uniform_real_distribution<double> distribution{0.0, jitterFraction};
+		factor -= distribution(generator);
+	}
+
+	return std::chrono::microseconds{static_cast<std::int64_t>(delay * factor)};
+}
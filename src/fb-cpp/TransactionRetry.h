@@ -0,0 +1,249 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_TRANSACTION_RETRY_H
+#define FBCPP_TRANSACTION_RETRY_H
+
+#include "fb-api.h"
+#include "Attachment.h"
+#include "Exception.h"
+#include "Observer.h"
+#include "Transaction.h"
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// Represents the retry policy used by runInTransaction().
+	///
+	/// The delay before attempt `n + 1` is `initialBackoff * backoffMultiplier^(n - 1)`, limited to `maxBackoff`,
+	/// and then reduced by a random amount of up to `jitter` times itself, so concurrent conflicting transactions
+	/// do not retry in lockstep.
+	///
+	class RetryPolicy final
+	{
+	public:
+		///
+		/// Returns the maximum number of attempts, including the first one.
+		///
+		unsigned getMaxAttempts() const
+		{
+			return maxAttempts;
+		}
+
+		///
+		/// Sets the maximum number of attempts, including the first one.
+		///
+		RetryPolicy& setMaxAttempts(unsigned value)
+		{
+			maxAttempts = value;
+			return *this;
+		}
+
+		///
+		/// Returns the delay before the first retry.
+		///
+		std::chrono::microseconds getInitialBackoff() const
+		{
+			return initialBackoff;
+		}
+
+		///
+		/// Sets the delay before the first retry.
+		///
+		RetryPolicy& setInitialBackoff(std::chrono::microseconds value)
+		{
+			initialBackoff = value;
+			return *this;
+		}
+
+		///
+		/// Returns the upper limit of the delay between attempts.
+		///
+		std::chrono::microseconds getMaxBackoff() const
+		{
+			return maxBackoff;
+		}
+
+		///
+		/// Sets the upper limit of the delay between attempts.
+		///
+		RetryPolicy& setMaxBackoff(std::chrono::microseconds value)
+		{
+			maxBackoff = value;
+			return *this;
+		}
+
+		///
+		/// Returns the factor applied to the delay after each retry.
+		///
+		double getBackoffMultiplier() const
+		{
+			return backoffMultiplier;
+		}
+
+		///
+		/// Sets the factor applied to the delay after each retry.
+		///
+		RetryPolicy& setBackoffMultiplier(double value)
+		{
+			backoffMultiplier = value;
+			return *this;
+		}
+
+		///
+		/// Returns the fraction (from 0 to 1) of each delay that is randomized.
+		///
+		double getJitter() const
+		{
+			return jitter;
+		}
+
+		///
+		/// Sets the fraction (from 0 to 1) of each delay that is randomized.
+		///
+		RetryPolicy& setJitter(double value)
+		{
+			jitter = value;
+			return *this;
+		}
+
+		///
+		/// Returns the ISC error codes that make an attempt retryable.
+		///
+		const std::vector<std::intptr_t>& getRetryableErrorCodes() const
+		{
+			return retryableErrorCodes;
+		}
+
+		///
+		/// Sets the ISC error codes that make an attempt retryable.
+		///
+		RetryPolicy& setRetryableErrorCodes(std::vector<std::intptr_t> value)
+		{
+			retryableErrorCodes = std::move(value);
+			return *this;
+		}
+
+	public:
+		///
+		/// Returns whether the exception contains one of the retryable error codes.
+		///
+		bool isRetryable(const DatabaseException& exception) const noexcept;
+
+		///
+		/// Returns the jittered delay to wait after the specified failed attempt (starting at 1).
+		///
+		std::chrono::microseconds getBackoff(unsigned attempt) const;
+
+	private:
+		unsigned maxAttempts = 5u;
+		std::chrono::microseconds initialBackoff{std::chrono::milliseconds{10}};
+		std::chrono::microseconds maxBackoff{std::chrono::seconds{1}};
+		double backoffMultiplier = 2.0;
+		double jitter = 0.5;
+		std::vector<std::intptr_t> retryableErrorCodes{isc_update_conflict, isc_deadlock, isc_lock_conflict};
+	};
+
+	///
+	/// Runs the callable in a new transaction of the attachment and commits it, retrying the whole unit of work when
+	/// it fails with a retryable error (update conflicts and deadlocks by default).
+	///
+	/// The callable receives the `Transaction&` and may be invoked more than once, so it must not have effects
+	/// outside the transaction that cannot be repeated. Before each retry the transaction is rolled back and the
+	/// policy backoff is waited. Each retried attempt is reported to the attachment observer as
+	/// `OperationType::TRANSACTION_RETRY`, and the whole call as `OperationType::RUN_IN_TRANSACTION`.
+	///
+	/// Returns the value returned by the callable in the committed attempt. The exception of the last attempt is
+	/// rethrown when it is not retryable or the maximum number of attempts is reached.
+	///
+	template <typename F>
+		requires std::invocable<F&, Transaction&>
+	std::invoke_result_t<F&, Transaction&> runInTransaction(
+		Attachment& attachment, const TransactionOptions& options, F&& callable, const RetryPolicy& policy = {})
+	{
+		const auto observer = attachment.getObserver();
+		impl::OperationScope runScope{observer.get(), OperationType::RUN_IN_TRANSACTION};
+
+		for (std::uint32_t attempt = 1u;; ++attempt)
+		{
+			runScope.setAttempts(attempt);
+			impl::OperationScope attemptScope{observer.get(), OperationType::TRANSACTION_RETRY};
+			attemptScope.setAttempts(attempt);
+
+			try
+			{
+				Transaction transaction{attachment, options};
+
+				if constexpr (std::is_void_v<std::invoke_result_t<F&, Transaction&>>)
+				{
+					std::invoke(callable, transaction);
+					transaction.commit();
+					runScope.finish();
+					return;
+				}
+				else
+				{
+					decltype(auto) result = std::invoke(callable, transaction);
+					transaction.commit();
+					runScope.finish();
+					return result;
+				}
+			}
+			catch (const DatabaseException& exception)
+			{
+				if (attempt >= policy.getMaxAttempts() || !policy.isRetryable(exception))
+				{
+					runScope.fail();
+					throw;
+				}
+
+				attemptScope.fail();
+			}
+			catch (...)
+			{
+				runScope.fail();
+				throw;
+			}
+
+			std::this_thread::sleep_for(policy.getBackoff(attempt));
+		}
+	}
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_TRANSACTION_RETRY_H
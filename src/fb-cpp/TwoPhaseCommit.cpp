@@ -0,0 +1,455 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TwoPhaseCommit.h"
+#include "Client.h"
+#include "Exception.h"
+#include "Statement.h"
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+namespace
+{
+	// Runs function(index) for every index, all but the first one in new threads, and returns the exception
+	// thrown by each call.
+	template <typename F>
+	std::vector<std::exception_ptr> runParallel(std::size_t count, const F& function)
+	{
+		std::vector<std::exception_ptr> errors(count);
+
+		const auto runOne = [&](std::size_t index)
+		{
+			try
+			{
+				function(index);
+			}
+			catch (...)
+			{
+				errors[index] = std::current_exception();
+			}
+		};
+
+		std::vector<std::thread> threads;
+		threads.reserve(count);
+
+		for (std::size_t index = 1u; index < count; ++index)
+		{
+			try
+			{
+				threads.emplace_back(runOne, index);
+			}
+			catch (...)
+			{
+				// No more threads available: run it here.
+				runOne(index);
+			}
+		}
+
+		if (count != 0u)
+			runOne(0u);
+
+		for (auto& thread : threads)
+			thread.join();
+
+		return errors;
+	}
+
+	std::exception_ptr firstError(const std::vector<std::exception_ptr>& errors)
+	{
+		const auto it = std::find_if(errors.begin(), errors.end(), [](const auto& error) { return error != nullptr; });
+		return it == errors.end() ? nullptr : *it;
+	}
+
+	std::string generateGlobalId()
+	{
+		static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+		std::random_device device;
+		std::mt19937_64 engine{(static_cast<std::uint64_t>(device()) << 32) ^ device()};
+
+		std::string id;
+		id.reserve(32u);
+
+		for (unsigned part = 0u; part < 2u; ++part)
+		{
+			auto value = engine();
+
+			for (unsigned i = 0u; i < 16u; ++i, value >>= 4)
+				id += HEX_DIGITS[value & 0xFu];
+		}
+
+		return id;
+	}
+
+	void rollbackAll(std::span<const std::reference_wrapper<Transaction>> participants)
+	{
+		runParallel(participants.size(),
+			[&](std::size_t index)
+			{
+				auto& transaction = participants[index].get();
+
+				if (transaction.isValid() &&
+					(transaction.getState() == TransactionState::ACTIVE ||
+						transaction.getState() == TransactionState::PREPARED))
+				{
+					transaction.rollback();
+				}
+			});
+	}
+}  // namespace
+
+
+// Writes `data` to the file and flushes it to stable storage before returning.
+static void writeDurably(const std::filesystem::path& path, std::string_view data, bool truncate)
+{
+	bool written = true;
+
+#ifdef _WIN32
+	const auto file = CreateFileW(path.c_str(), truncate ? GENERIC_WRITE : FILE_APPEND_DATA, FILE_SHARE_READ, nullptr,
+		truncate ? CREATE_ALWAYS : OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (file == INVALID_HANDLE_VALUE)
+		throw FbCppException{"Cannot write decision log " + path.string()};
+
+	while (written && !data.empty())
+	{
+		DWORD count = 0;
+		written = WriteFile(file, data.data(), static_cast<DWORD>(data.size()), &count, nullptr) != 0;
+		data.remove_prefix(count);
+	}
+
+	written = written && FlushFileBuffers(file) != 0;
+	written = CloseHandle(file) != 0 && written;
+#else
+	const auto file = ::open(path.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC | (truncate ? O_TRUNC : O_APPEND), 0644);
+
+	if (file < 0)
+		throw FbCppException{"Cannot write decision log " + path.string()};
+
+	while (written && !data.empty())
+	{
+		const auto count = ::write(file, data.data(), data.size());
+
+		if (count < 0 && errno == EINTR)
+			continue;
+
+		written = count > 0;
+
+		if (written)
+			data.remove_prefix(static_cast<std::size_t>(count));
+	}
+
+	written = written && ::fsync(file) == 0;
+	written = ::close(file) == 0 && written;
+#endif
+
+	if (!written)
+		throw FbCppException{"Cannot write decision log " + path.string()};
+}
+
+// Replaces `target` with `source`, making the new directory entry durable.
+static void replaceDurably(const std::filesystem::path& source, const std::filesystem::path& target)
+{
+#ifdef _WIN32
+	if (!MoveFileExW(source.c_str(), target.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+		throw FbCppException{"Cannot replace decision log " + target.string()};
+#else
+	std::filesystem::rename(source, target);
+
+	auto directory = target.parent_path();
+
+	if (directory.empty())
+		directory = ".";
+
+	const auto file = ::open(directory.c_str(), O_RDONLY | O_CLOEXEC);
+	bool synced = file >= 0 && ::fsync(file) == 0;
+
+	if (file >= 0)
+		synced = ::close(file) == 0 && synced;
+
+	if (!synced)
+		throw FbCppException{"Cannot sync the directory of decision log " + target.string()};
+#endif
+}
+
+
+FileDecisionLog::FileDecisionLog(std::filesystem::path path)
+	: path{std::move(path)}
+{
+	std::ifstream in{this->path, std::ios::binary};
+
+	if (!in)
+	{
+		std::ofstream create{this->path, std::ios::binary | std::ios::app};
+
+		if (!create)
+			throw FbCppException{"Cannot create decision log " + this->path.string()};
+
+		return;
+	}
+
+	std::string line;
+
+	while (std::getline(in, line))
+	{
+		if (line.size() < 3u || line[1] != ' ')
+			continue;  // torn final record
+
+		auto globalId = line.substr(2u);
+
+		if (line[0] == 'C')
+			pending.insert(std::move(globalId));
+		else if (line[0] == 'D')
+			pending.erase(globalId);
+	}
+}
+
+void FileDecisionLog::logCommit(std::string_view globalId)
+{
+	std::lock_guard mutexGuard{mutex};
+
+	append('C', globalId);
+	pending.emplace(globalId);
+}
+
+void FileDecisionLog::logDone(std::string_view globalId)
+{
+	std::lock_guard mutexGuard{mutex};
+
+	append('D', globalId);
+	pending.erase(std::string{globalId});
+}
+
+bool FileDecisionLog::isCommitted(std::string_view globalId)
+{
+	std::lock_guard mutexGuard{mutex};
+	return pending.contains(std::string{globalId});
+}
+
+std::vector<std::string> FileDecisionLog::getPendingCommits()
+{
+	std::lock_guard mutexGuard{mutex};
+	return {pending.begin(), pending.end()};
+}
+
+void FileDecisionLog::compact()
+{
+	std::lock_guard mutexGuard{mutex};
+
+	auto tempPath = path;
+	tempPath += ".tmp";
+
+	std::string data;
+
+	for (const auto& globalId : pending)
+	{
+		data += "C ";
+		data += globalId;
+		data += '\n';
+	}
+
+	writeDurably(tempPath, data, true);
+	replaceDurably(tempPath, path);
+}
+
+void FileDecisionLog::append(char kind, std::string_view globalId)
+{
+	if (globalId.empty() || globalId.find_first_of(" \t\r\n") != std::string_view::npos)
+		throw std::invalid_argument{"Global transaction IDs must be non-empty and contain no whitespace"};
+
+	std::string record;
+	record.reserve(globalId.size() + 3u);
+	record += kind;
+	record += ' ';
+	record += globalId;
+	record += '\n';
+
+	writeDurably(path, record, false);
+}
+
+
+TwoPhaseCoordinator::TwoPhaseCoordinator(std::shared_ptr<TwoPhaseDecisionLog> log)
+	: log{std::move(log)}
+{
+	if (!this->log)
+		throw std::invalid_argument{"TwoPhaseCoordinator requires a decision log"};
+}
+
+TwoPhaseCommitResult TwoPhaseCoordinator::commit(std::span<const std::reference_wrapper<Transaction>> participants)
+{
+	return commit(participants, generateGlobalId());
+}
+
+TwoPhaseCommitResult TwoPhaseCoordinator::commit(
+	std::span<const std::reference_wrapper<Transaction>> participants, std::string globalId)
+{
+	if (participants.empty())
+		throw std::invalid_argument{"TwoPhaseCoordinator::commit requires at least one participant"};
+
+	for (const auto& participant : participants)
+	{
+		auto& transaction = participant.get();
+
+		if (!transaction.isValid() || transaction.getState() != TransactionState::ACTIVE)
+			throw std::invalid_argument{"TwoPhaseCoordinator participants must be active transactions"};
+	}
+
+	std::string message{MESSAGE_PREFIX};
+	message += globalId;
+
+	// Phase 1: prepare, aborting everything when any participant fails.
+	const auto prepareErrors =
+		runParallel(participants.size(), [&](std::size_t index) { participants[index].get().prepare(message); });
+
+	if (const auto error = firstError(prepareErrors))
+	{
+		rollbackAll(participants);
+		std::rethrow_exception(error);
+	}
+
+	try
+	{
+		log->logCommit(globalId);
+	}
+	catch (...)
+	{
+		rollbackAll(participants);
+		throw;
+	}
+
+	// Phase 2: the decision is durable, so failed commits are left for recovery.
+	TwoPhaseCommitResult result;
+	result.commitErrors =
+		runParallel(participants.size(), [&](std::size_t index) { participants[index].get().commit(); });
+
+	if (result.isComplete())
+	{
+		try
+		{
+			log->logDone(globalId);
+		}
+		catch (...)
+		{
+			// swallow
+		}
+	}
+
+	result.globalId = std::move(globalId);
+
+	return result;
+}
+
+TwoPhaseRecoveryResult TwoPhaseCoordinator::recover(Attachment& attachment)
+{
+	assert(attachment.isValid());
+
+	std::vector<std::pair<std::uint64_t, std::string>> limbo;
+
+	{  // scope
+		Transaction transaction{attachment,
+			TransactionOptions()
+				.setIsolationLevel(TransactionIsolationLevel::READ_COMMITTED)
+				.setAccessMode(TransactionAccessMode::READ_ONLY)};
+
+		// Limbo transactions have state 1.
+		Statement select{attachment, transaction,
+			"select rdb$transaction_id,"
+			"       cast(rdb$transaction_description as varchar(1024) character set octets)"
+			"  from rdb$transactions"
+			"  where rdb$transaction_state = 1"};
+
+		for (auto found = select.execute(transaction); found; found = select.fetchNext())
+		{
+			auto description = select.getString(1).value_or(std::string{});
+
+			if (description.starts_with(MESSAGE_PREFIX))
+			{
+				limbo.emplace_back(static_cast<std::uint64_t>(select.getInt64(0).value()),
+					description.substr(MESSAGE_PREFIX.size()));
+			}
+		}
+
+		transaction.commit();
+	}
+
+	TwoPhaseRecoveryResult result;
+	StatusWrapper statusWrapper{attachment.getClient()};
+
+	for (const auto& [transactionId, globalId] : limbo)
+	{
+		FbRef<fb::ITransaction> handle;
+
+		if (transactionId <= std::numeric_limits<std::uint32_t>::max())
+		{
+			const auto id = static_cast<std::uint32_t>(transactionId);
+			handle.reset(attachment.getHandle()->reconnectTransaction(
+				&statusWrapper, sizeof(id), reinterpret_cast<const std::uint8_t*>(&id)));
+		}
+		else
+		{
+			handle.reset(attachment.getHandle()->reconnectTransaction(
+				&statusWrapper, sizeof(transactionId), reinterpret_cast<const std::uint8_t*>(&transactionId)));
+		}
+
+		if (log->isCommitted(globalId))
+		{
+			handle->commit(&statusWrapper);
+			++result.committed;
+		}
+		else
+		{
+			handle->rollback(&statusWrapper);
+			++result.rolledBack;
+		}
+
+		handle.reset();
+	}
+
+	return result;
+}
@@ -0,0 +1,224 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_TWO_PHASE_COMMIT_H
+#define FBCPP_TWO_PHASE_COMMIT_H
+
+#include "Attachment.h"
+#include "Transaction.h"
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// Durable record of the commit decisions of a TwoPhaseCoordinator, used to resolve limbo transactions.
+	/// The coordinator follows the presumed-abort protocol: only commit decisions are logged, and a prepared
+	/// transaction whose global ID has no commit decision is rolled back by recovery.
+	/// Implementations must be thread-safe and must only return from `logCommit()` once the record is durable.
+	///
+	class TwoPhaseDecisionLog
+	{
+	public:
+		virtual ~TwoPhaseDecisionLog() = default;
+
+	public:
+		///
+		/// Records that the global transaction was decided to commit, after all its participants were prepared.
+		///
+		virtual void logCommit(std::string_view globalId) = 0;
+
+		///
+		/// Records that all participants of the global transaction were committed, so its decision may be
+		/// forgotten.
+		///
+		virtual void logDone(std::string_view globalId) = 0;
+
+		///
+		/// Returns whether a commit decision was logged for the global transaction.
+		///
+		virtual bool isCommitted(std::string_view globalId) = 0;
+	};
+
+	///
+	/// TwoPhaseDecisionLog appending one short line per record to a file.
+	/// Each record is synced to stable storage (`fsync()`, `FlushFileBuffers()`) before returning. Decisions of
+	/// completed global transactions are dropped from the file by compact(), which replaces it atomically.
+	///
+	class FileDecisionLog final : public TwoPhaseDecisionLog
+	{
+	public:
+		///
+		/// Opens (creating it when missing) the log file and loads the pending decisions.
+		///
+		explicit FileDecisionLog(std::filesystem::path path);
+
+		FileDecisionLog(const FileDecisionLog&) = delete;
+		FileDecisionLog& operator=(const FileDecisionLog&) = delete;
+
+	public:
+		void logCommit(std::string_view globalId) override;
+		void logDone(std::string_view globalId) override;
+		bool isCommitted(std::string_view globalId) override;
+
+		///
+		/// Returns the global IDs with a commit decision and no completion record.
+		///
+		std::vector<std::string> getPendingCommits();
+
+		///
+		/// Rewrites the file keeping only the pending commit decisions.
+		///
+		void compact();
+
+	private:
+		void append(char kind, std::string_view globalId);
+
+	private:
+		std::filesystem::path path;
+		std::mutex mutex;
+		std::unordered_set<std::string> pending;
+	};
+
+	///
+	/// Outcome of TwoPhaseCoordinator::commit().
+	///
+	struct TwoPhaseCommitResult final
+	{
+		///
+		/// Global ID of the transaction, also stored as the prepare message of every participant.
+		///
+		std::string globalId;
+
+		///
+		/// Errors of the participants whose commit failed, indexed like the participants and null for the ones
+		/// that committed. A participant that failed to commit is left in limbo and is committed by recovery.
+		///
+		std::vector<std::exception_ptr> commitErrors;
+
+		///
+		/// Returns whether all participants committed.
+		///
+		bool isComplete() const noexcept
+		{
+			for (const auto& error : commitErrors)
+			{
+				if (error)
+					return false;
+			}
+
+			return true;
+		}
+	};
+
+	///
+	/// Outcome of TwoPhaseCoordinator::recover().
+	///
+	struct TwoPhaseRecoveryResult final
+	{
+		///
+		/// Number of limbo transactions committed because their global transaction was decided to commit.
+		///
+		std::size_t committed = 0u;
+
+		///
+		/// Number of limbo transactions rolled back because no commit decision was logged.
+		///
+		std::size_t rolledBack = 0u;
+	};
+
+	///
+	/// @brief Two-phase commit coordinator for independently started transactions.
+	///
+	/// Unlike the multi-database Transaction constructor, participants may belong to different Client objects
+	/// and servers. commit() prepares all participants in parallel threads, logs the commit decision and then
+	/// commits them in parallel, so its latency is that of the slowest participant instead of the sum of all.
+	/// If a prepare fails, all participants are rolled back and the error is rethrown.
+	///
+	class TwoPhaseCoordinator final
+	{
+	public:
+		///
+		/// Prefix of the prepare message of the participants, followed by the global ID.
+		///
+		static constexpr std::string_view MESSAGE_PREFIX = "fb-cpp-2pc:";
+
+	public:
+		///
+		/// Constructs a coordinator logging its decisions to the specified log.
+		///
+		explicit TwoPhaseCoordinator(std::shared_ptr<TwoPhaseDecisionLog> log);
+
+		TwoPhaseCoordinator(const TwoPhaseCoordinator&) = delete;
+		TwoPhaseCoordinator& operator=(const TwoPhaseCoordinator&) = delete;
+
+	public:
+		///
+		/// Returns the decision log.
+		///
+		TwoPhaseDecisionLog& getLog() noexcept
+		{
+			return *log;
+		}
+
+		///
+		/// Commits the active participants as one global transaction with a generated global ID.
+		///
+		TwoPhaseCommitResult commit(std::span<const std::reference_wrapper<Transaction>> participants);
+
+		///
+		/// Commits the active participants as one global transaction with the specified global ID, which must be
+		/// unique among the transactions of this log.
+		///
+		TwoPhaseCommitResult commit(
+			std::span<const std::reference_wrapper<Transaction>> participants, std::string globalId);
+
+		///
+		/// Resolves the limbo transactions of the attachment prepared by a TwoPhaseCoordinator, committing the
+		/// ones with a logged commit decision and rolling back the others.
+		/// It must not run while a commit() involving the same database may be between its two phases.
+		///
+		TwoPhaseRecoveryResult recover(Attachment& attachment);
+
+	private:
+		std::shared_ptr<TwoPhaseDecisionLog> log;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_TWO_PHASE_COMMIT_H
@@ -0,0 +1,473 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_VARIANT_PLAN_H
+#define FBCPP_VARIANT_PLAN_H
+
+#include "config.h"
+#include "fb-api.h"
+#include "types.h"
+#include "BindingPlan.h"
+#include "Descriptor.h"
+#include "Exception.h"
+#include "StructBinding.h"
+#include "VariantTypeTraits.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+
+namespace fbcpp::impl
+{
+	///
+	/// Returns the index of `T` in the alternatives of `V`, or `std::variant_npos`.
+	///
+	template <typename T, typename V>
+	consteval std::size_t variantAlternativeIndex()
+	{
+		return []<std::size_t... Is>(std::index_sequence<Is...>)
+		{
+			std::size_t result = std::variant_npos;
+			((result =
+					 result == std::variant_npos && std::is_same_v<T, std::variant_alternative_t<Is, V>> ? Is : result),
+				...);
+			return result;
+		}(std::make_index_sequence<std::variant_size_v<V>>{});
+	}
+
+	///
+	/// Returns the index in `V` of the first of `Ts` that is an alternative of `V`, or `std::variant_npos`.
+	///
+	template <typename V, typename... Ts>
+	consteval std::size_t firstVariantAlternative()
+	{
+		std::size_t result = std::variant_npos;
+		((result = result == std::variant_npos ? variantAlternativeIndex<Ts, V>() : result), ...);
+		return result;
+	}
+
+	///
+	/// Returns the index of the first alternative of `V` usable for any column: neither std::monostate nor an
+	/// opaque type.
+	///
+	template <typename V>
+	consteval std::size_t fallbackVariantAlternative()
+	{
+		return []<std::size_t... Is>(std::index_sequence<Is...>)
+		{
+			std::size_t result = std::variant_npos;
+			((result = result == std::variant_npos &&
+						!std::is_same_v<std::variant_alternative_t<Is, V>, std::monostate> &&
+						!reflection::isOpaqueTypeV<std::variant_alternative_t<Is, V>>
+					? Is
+					: result),
+				...);
+			return result;
+		}(std::make_index_sequence<std::variant_size_v<V>>{});
+	}
+
+	///
+	/// Resolves the alternative of `V` that a non-NULL value of the described column is read as, or
+	/// `std::variant_npos` if none fits.
+	/// Exact representations are preferred (scaled types for scaled columns, opaque types over their
+	/// converted counterparts), then the first alternative that is neither std::monostate nor opaque.
+	///
+	template <typename V>
+	std::size_t resolveVariantAlternative(const DescriptorLayout& descriptor) noexcept
+	{
+		constexpr auto npos = std::variant_npos;
+		auto result = npos;
+
+		switch (descriptor.adjustedType)
+		{
+			case DescriptorAdjustedType::BOOLEAN:
+				result = firstVariantAlternative<V, bool>();
+				break;
+
+			case DescriptorAdjustedType::INT16:
+				if (descriptor.scale != 0)
+				{
+#if FB_CPP_USE_BOOST_MULTIPRECISION != 0
+					result = firstVariantAlternative<V, ScaledInt16, ScaledInt32, ScaledInt64, ScaledBoostInt128>();
+#else
+					result = firstVariantAlternative<V, ScaledInt16, ScaledInt32, ScaledInt64>();
+#endif
+				}
+
+				if (result == npos)
+					result = firstVariantAlternative<V, std::int16_t>();
+				break;
+
+			case DescriptorAdjustedType::INT32:
+				if (descriptor.scale != 0)
+				{
+#if FB_CPP_USE_BOOST_MULTIPRECISION != 0
+					result = firstVariantAlternative<V, ScaledInt32, ScaledInt64, ScaledBoostInt128>();
+#else
+					result = firstVariantAlternative<V, ScaledInt32, ScaledInt64>();
+#endif
+				}
+
+				if (result == npos)
+					result = firstVariantAlternative<V, std::int32_t>();
+				break;
+
+			case DescriptorAdjustedType::INT64:
+				if (descriptor.scale != 0)
+				{
+#if FB_CPP_USE_BOOST_MULTIPRECISION != 0
+					result = firstVariantAlternative<V, ScaledInt64, ScaledBoostInt128>();
+#else
+					result = firstVariantAlternative<V, ScaledInt64>();
+#endif
+				}
+
+				if (result == npos)
+					result = firstVariantAlternative<V, std::int64_t>();
+				break;
+
+#if FB_CPP_USE_BOOST_MULTIPRECISION != 0
+			case DescriptorAdjustedType::INT128:
+				result = firstVariantAlternative<V, ScaledOpaqueInt128>();
+
+				if (result == npos && descriptor.scale != 0)
+					result = firstVariantAlternative<V, ScaledBoostInt128>();
+				else if (result == npos)
+					result = firstVariantAlternative<V, BoostInt128>();
+				break;
+#endif
+
+			case DescriptorAdjustedType::FLOAT:
+				result = firstVariantAlternative<V, float>();
+				break;
+
+			case DescriptorAdjustedType::DOUBLE:
+				result = firstVariantAlternative<V, double>();
+				break;
+
+#if FB_CPP_USE_BOOST_MULTIPRECISION != 0
+			case DescriptorAdjustedType::DECFLOAT16:
+				result = firstVariantAlternative<V, OpaqueDecFloat16, BoostDecFloat16>();
+				break;
+
+			case DescriptorAdjustedType::DECFLOAT34:
+				result = firstVariantAlternative<V, OpaqueDecFloat34, BoostDecFloat34>();
+				break;
+#endif
+
+			case DescriptorAdjustedType::STRING:
+				result = firstVariantAlternative<V, std::string>();
+				break;
+
+			case DescriptorAdjustedType::DATE:
+				result = firstVariantAlternative<V, OpaqueDate, Date>();
+				break;
+
+			case DescriptorAdjustedType::TIME:
+				result = firstVariantAlternative<V, OpaqueTime, Time>();
+				break;
+
+			case DescriptorAdjustedType::TIMESTAMP:
+				result = firstVariantAlternative<V, OpaqueTimestamp, Timestamp>();
+				break;
+
+			case DescriptorAdjustedType::TIME_TZ:
+				result = firstVariantAlternative<V, OpaqueTimeTz, TimeTz>();
+				break;
+
+			case DescriptorAdjustedType::TIMESTAMP_TZ:
+				result = firstVariantAlternative<V, OpaqueTimestampTz, TimestampTz>();
+				break;
+
+			case DescriptorAdjustedType::BLOB:
+				result = firstVariantAlternative<V, BlobId>();
+				break;
+
+			default:
+				break;
+		}
+
+		return result == npos ? fallbackVariantAlternative<V>() : result;
+	}
+
+	[[noreturn]] inline void throwNoVariantAlternative(unsigned index)
+	{
+		throw FbCppException("Cannot convert SQL type to any variant alternative at index " + std::to_string(index));
+	}
+}  // namespace fbcpp::impl
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// @brief Precomputed variant alternative dispatch of a descriptor set.
+	///
+	/// Building a plan resolves, once per column, the alternative of `V` its values are read as and whether
+	/// that alternative matches the in-message representation of the column. Reading a cell is then one
+	/// indirect call to the decoder of that alternative: matching ones are copied from the message, all others
+	/// use the regular converting accessors of Row and Statement. Writing copies the alternatives that match
+	/// the column directly into the message. A plan is immutable and can be shared by any number of rows or
+	/// statements that use the same descriptor set.
+	///
+	template <VariantLike V>
+	class VariantPlan final
+	{
+	public:
+		///
+		/// Number of alternatives in `V`.
+		///
+		static constexpr std::size_t ALTERNATIVE_COUNT = std::variant_size_v<V>;
+
+	public:
+		///
+		/// @brief Creates the plan for the given descriptor set.
+		///
+		explicit VariantPlan(DescriptorSetPtr descriptorSet)
+			: descriptorSet{std::move(descriptorSet)}
+		{
+			static_assert(impl::reflection::variantAlternativesSupportedV<V>,
+				"Variant contains unsupported types. All variant alternatives must be types supported by fb-cpp "
+				"(e.g., std::int32_t, std::string, Date, ScaledOpaqueInt128, etc.). Check VariantTypeTraits.h for the "
+				"complete list of supported types.");
+
+			if (!this->descriptorSet)
+				throw std::invalid_argument{"descriptorSet must not be null"};
+
+			columns.resize(this->descriptorSet->size());
+
+			for (unsigned i = 0u; i < columns.size(); ++i)
+			{
+				initColumn(
+					columns[i], this->descriptorSet->getLayout(i), std::make_index_sequence<ALTERNATIVE_COUNT>{});
+			}
+		}
+
+	public:
+		///
+		/// @brief Returns the descriptor set this plan was built for.
+		///
+		const DescriptorSetPtr& getDescriptorSet() const noexcept
+		{
+			return descriptorSet;
+		}
+
+		///
+		/// @brief Returns the alternative index non-NULL values of the given column are read as, or
+		/// `std::variant_npos` if the column type fits no alternative.
+		///
+		std::size_t getAlternative(unsigned index) const
+		{
+			return getColumn(index).alternative;
+		}
+
+		///
+		/// @brief Reports whether values of the given column are read by copying them from the message.
+		///
+		bool isDirect(unsigned index) const
+		{
+			return getColumn(index).decoder >= ALTERNATIVE_COUNT && getColumn(index).decoder < NO_DECODER;
+		}
+
+		///
+		/// @brief Decodes a column of a message laid out by the plan descriptor set.
+		/// @param row Object used for columns that need conversion; must expose `get<std::optional<T>>(unsigned)`.
+		/// @param message Start of the message buffer.
+		/// @param index Zero-based column index.
+		/// @throws FbCppException if NULL but the variant lacks std::monostate.
+		/// @throws FbCppException if the column type cannot convert to any alternative.
+		///
+		template <typename R>
+		V read(R& row, const std::byte* message, unsigned index) const
+		{
+			const auto& column = getColumn(index);
+
+			if (*reinterpret_cast<const std::int16_t*>(&message[column.layout.nullOffset]) != FB_FALSE)
+			{
+				if constexpr (impl::reflection::variantContainsV<std::monostate, V>)
+					return V{std::monostate{}};
+				else
+				{
+					throw FbCppException(
+						"NULL value encountered but variant does not contain std::monostate at index " +
+						std::to_string(index));
+				}
+			}
+
+			return Decoders<R>::TABLE[column.decoder](row, message, column.layout, index);
+		}
+
+		///
+		/// @brief Encodes a value into a column of the input message of a statement laid out by the plan
+		/// descriptor set.
+		/// @param statement Object used for alternatives that need conversion; must expose `set(unsigned, T)`,
+		/// `setNull(unsigned)` and `getInputMessage()`.
+		/// @param index Zero-based parameter index.
+		/// @param value The variant containing the value; std::monostate sets NULL.
+		///
+		template <typename S>
+		void write(S& statement, unsigned index, const V& value) const
+		{
+			const auto& column = getColumn(index);
+			auto* const message = statement.getInputMessage().data();
+
+			std::visit(
+				[&](const auto& alternativeValue)
+				{
+					using T = std::decay_t<decltype(alternativeValue)>;
+
+					if constexpr (std::is_same_v<T, std::monostate>)
+						statement.setNull(index);
+					else
+					{
+						if constexpr (impl::DirectCodec<T>::supported)
+						{
+							if (column.encodable[value.index()] &&
+								impl::DirectCodec<T>::encode(
+									&message[column.layout.offset], column.layout, alternativeValue))
+							{
+								*reinterpret_cast<std::int16_t*>(&message[column.layout.nullOffset]) = FB_FALSE;
+								return;
+							}
+						}
+
+						statement.set(index, alternativeValue);
+					}
+				},
+				value);
+		}
+
+	private:
+		// Decoders 0 to N - 1 convert, N to 2N - 1 copy from the message, and 2N throws.
+		static constexpr std::size_t NO_DECODER = ALTERNATIVE_COUNT * 2u;
+
+		struct ColumnPlan final
+		{
+			DescriptorLayout layout{};
+			std::size_t alternative = std::variant_npos;
+			std::size_t decoder = NO_DECODER;
+			std::array<bool, ALTERNATIVE_COUNT> encodable{};
+		};
+
+		template <typename R>
+		using Decoder = V (*)(R& row, const std::byte* message, const DescriptorLayout& layout, unsigned index);
+
+		template <typename R>
+		struct Decoders final
+		{
+			template <std::size_t I>
+			static V convert(R& row, const std::byte*, const DescriptorLayout&, unsigned index)
+			{
+				using Alt = std::variant_alternative_t<I, V>;
+
+				if constexpr (std::is_same_v<Alt, std::monostate>)
+					return V{std::in_place_index<I>};
+				else
+					return V{std::in_place_index<I>, row.template get<std::optional<Alt>>(index).value()};
+			}
+
+			template <std::size_t I>
+			static V copy(R& row, const std::byte* message, const DescriptorLayout& layout, unsigned index)
+			{
+				using Alt = std::variant_alternative_t<I, V>;
+
+				if constexpr (impl::DirectCodec<Alt>::supported)
+					return V{std::in_place_index<I>, impl::DirectCodec<Alt>::decode(&message[layout.offset], layout)};
+				else
+					return convert<I>(row, message, layout, index);
+			}
+
+			static V fail(R&, const std::byte*, const DescriptorLayout&, unsigned index)
+			{
+				impl::throwNoVariantAlternative(index);
+			}
+
+			template <std::size_t... Is>
+			static constexpr std::array<Decoder<R>, NO_DECODER + 1u> makeTable(std::index_sequence<Is...>) noexcept
+			{
+				return {&convert<Is>..., &copy<Is>..., &fail};
+			}
+
+			static constexpr auto TABLE = makeTable(std::make_index_sequence<ALTERNATIVE_COUNT>{});
+		};
+
+		template <std::size_t... Is>
+		static void initColumn(ColumnPlan& column, const DescriptorLayout& layout, std::index_sequence<Is...>)
+		{
+			column.layout = layout;
+			column.alternative = impl::resolveVariantAlternative<V>(layout);
+			column.encodable = {isEncodable<Is>(layout)...};
+
+			if (column.alternative != std::variant_npos)
+			{
+				column.decoder = column.alternative;
+
+				// A direct decode must give exactly what the converting accessor would.
+				if (isAlternativeEncodable<Is...>(layout, column.alternative))
+					column.decoder += ALTERNATIVE_COUNT;
+			}
+		}
+
+		template <std::size_t I>
+		static bool isEncodable(const DescriptorLayout& layout) noexcept
+		{
+			using Alt = std::variant_alternative_t<I, V>;
+
+			if constexpr (impl::DirectCodec<Alt>::supported)
+				return impl::DirectCodec<Alt>::matches(layout);
+			else
+				return false;
+		}
+
+		template <std::size_t... Is>
+		static bool isAlternativeEncodable(const DescriptorLayout& layout, std::size_t alternative) noexcept
+		{
+			return ((Is == alternative && isEncodable<Is>(layout)) || ...);
+		}
+
+		const ColumnPlan& getColumn(unsigned index) const
+		{
+			if (index >= columns.size())
+				throw std::out_of_range("index out of range");
+
+			return columns[index];
+		}
+
+	private:
+		DescriptorSetPtr descriptorSet;
+		std::vector<ColumnPlan> columns;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_VARIANT_PLAN_H
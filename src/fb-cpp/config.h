@@ -31,6 +31,14 @@
 #endif
 #endif
 
+#if !defined(FB_CPP_USE_NATIVE_NUMERIC)
+#define FB_CPP_USE_NATIVE_NUMERIC 1
+#endif
+
+#if !defined(FB_CPP_ENABLE_METRICS)
+#define FB_CPP_ENABLE_METRICS 0
+#endif
+
 #if !defined(FB_CPP_USE_BOOST_DLL)
 #if __has_include(<boost/dll.hpp>)
 #define FB_CPP_USE_BOOST_DLL 1
@@ -26,15 +26,43 @@
 #define FBCPP_H
 
 #include "Client.h"
+#include "ParameterBlock.h"
+#include "Observer.h"
+#include "PerformanceCounters.h"
+#include "Metrics.h"
+#include "SlowQueryLog.h"
+#include "AsyncExecutor.h"
 #include "Attachment.h"
+#include "AttachmentPool.h"
 #include "Transaction.h"
+#include "TransactionRetry.h"
+#include "SharedReadTransaction.h"
+#include "TwoPhaseCommit.h"
 #include "Descriptor.h"
+#include "BindingPlan.h"
+#include "VariantPlan.h"
+#include "MessageStruct.h"
+#include "Arena.h"
 #include "Statement.h"
+#include "StatementCache.h"
+#include "StatementWarmUp.h"
 #include "RowSet.h"
+#include "PrefetchCursor.h"
+#include "PagedCursor.h"
+#include "ResultExporter.h"
+#include "ColumnarRowSet.h"
 #include "Batch.h"
+#include "BatchWriter.h"
+#include "BatchPipeline.h"
+#include "BulkImporter.h"
+#include "ParallelLoader.h"
+#include "FanOutQuery.h"
 #include "Blob.h"
+#include "BlobStream.h"
 #include "EventListener.h"
+#include "EventHub.h"
 #include "ServiceManager.h"
 #include "BackupManager.h"
+#include "TraceManager.h"
 
 #endif  // FBCPP_H
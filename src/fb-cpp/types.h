@@ -28,10 +28,13 @@
 #include "fb-api.h"
 #include "config.h"
 #include <chrono>
+#include <concepts>
 #include <cstdint>
 #include <format>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <string_view>
 
 #if FB_CPP_USE_BOOST_MULTIPRECISION != 0
 #include <boost/multiprecision/cpp_int.hpp>
@@ -155,6 +158,108 @@ namespace fbcpp
 		Time time{std::chrono::microseconds::zero()};
 	};
 
+	///
+	/// Time zone name shared between values.
+	/// Copying it never allocates: names decoded from Firebird values are interned per Client and every value of
+	/// the same zone refers to the same storage.
+	///
+	class TimeZoneName final
+	{
+	public:
+		///
+		/// Constructs an empty time zone name.
+		///
+		TimeZoneName() noexcept = default;
+
+		///
+		/// Constructs a time zone name holding a copy of the specified text.
+		///
+		TimeZoneName(std::string_view value)
+			: name{std::make_shared<const std::string>(value)}
+		{
+		}
+
+		///
+		/// Constructs a time zone name holding a copy of the specified text.
+		///
+		TimeZoneName(const char* value)
+			: TimeZoneName{std::string_view{value}}
+		{
+		}
+
+		///
+		/// Constructs a time zone name taking over the specified string.
+		///
+		TimeZoneName(std::string value)
+			: name{std::make_shared<const std::string>(std::move(value))}
+		{
+		}
+
+		///
+		/// Compares the names, short-circuiting when both share the same storage.
+		///
+		bool operator==(const TimeZoneName& o) const noexcept
+		{
+			return name == o.name || str() == o.str();
+		}
+
+		///
+		/// Compares the name with text.
+		///
+		template <typename T>
+			requires std::convertible_to<const T&, std::string_view>
+		bool operator==(const T& o) const noexcept
+		{
+			return str() == std::string_view{o};
+		}
+
+		///
+		/// Returns the name as a string view.
+		///
+		operator std::string_view() const noexcept
+		{
+			return str();
+		}
+
+	public:
+		///
+		/// Returns the name, which is empty for a default-constructed object.
+		/// The reference stays valid as long as this object (or a copy of it) exists.
+		///
+		const std::string& str() const noexcept
+		{
+			static const std::string empty;
+			return name ? *name : empty;
+		}
+
+		///
+		/// Returns the name as a null-terminated string.
+		///
+		const char* c_str() const noexcept
+		{
+			return str().c_str();
+		}
+
+		///
+		/// Returns whether the name is empty.
+		///
+		bool empty() const noexcept
+		{
+			return str().empty();
+		}
+
+	private:
+		std::shared_ptr<const std::string> name;
+	};
+
+	///
+	/// Stream insertion helper that writes the time zone name.
+	///
+	inline std::ostream& operator<<(std::ostream& os, const TimeZoneName& timeZoneName)
+	{
+		return os << timeZoneName.str();
+	}
+
 	///
 	/// Local time bound to a time zone.
 	///
@@ -173,7 +278,7 @@ namespace fbcpp
 		///
 		/// Time zone identifier.
 		///
-		std::string zone;
+		TimeZoneName zone;
 	};
 
 	///
@@ -191,7 +296,7 @@ namespace fbcpp
 		///
 		/// Time zone identifier.
 		///
-		std::string zone;
+		TimeZoneName zone;
 	};
 
 	///
@@ -0,0 +1,132 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "fb-cpp/Arena.h"
+#include "fb-cpp/RowSet.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+
+BOOST_AUTO_TEST_SUITE(ArenaSuite)
+
+BOOST_AUTO_TEST_CASE(blocksAreReusedAfterReset)
+{
+	Arena arena{64};
+
+	const auto first = arena.store("first");
+	BOOST_CHECK_EQUAL(first, "first");
+	BOOST_CHECK(arena.store("").empty());
+
+	const auto aligned = arena.allocate(8, 8);
+	BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(aligned) % 8u, 0u);
+
+	// Larger than a block: it gets a block of its own.
+	const std::string big(100, 'x');
+	BOOST_CHECK_EQUAL(arena.store(big), big);
+	BOOST_CHECK_EQUAL(arena.getUsed(), 5u + 8u + 100u);
+
+	const auto capacity = arena.getCapacity();
+	BOOST_CHECK(capacity >= 64u + 100u);
+
+	arena.reset();
+	BOOST_CHECK_EQUAL(arena.getUsed(), 0u);
+
+	for (int i = 0; i < 10; ++i)
+		BOOST_CHECK_EQUAL(arena.store("0123456789"), "0123456789");
+
+	BOOST_CHECK_EQUAL(arena.getCapacity(), capacity);
+
+	auto& scratch = arena.getScratch();
+	scratch += "scratch";
+	BOOST_CHECK(arena.getScratch().empty());
+}
+
+BOOST_AUTO_TEST_CASE(getStringFormatsIntoArena)
+{
+	const auto database = getTempFile("Arena-getStringFormatsIntoArena.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement ddl{attachment, transaction,
+		"create table t (id integer, amount numeric(18, 2), ratio double precision, day date, flag boolean, "
+		"name varchar(20))"};
+	ddl.execute(transaction);
+	transaction.commitRetaining();
+
+	Statement insert{
+		attachment, transaction, "insert into t values (1, -12.34, 0.5, date '2024-02-29', true, 'one')"};
+	insert.execute(transaction);
+
+	Statement insertNulls{attachment, transaction, "insert into t (id) values (2)"};
+	insertNulls.execute(transaction);
+
+	Statement select{attachment, transaction, "select id, amount, ratio, day, flag, name from t order by id"};
+	BOOST_REQUIRE(select.execute(transaction));
+
+	auto& arena = select.getArena();
+	std::string_view values[6];
+
+	for (unsigned i = 0; i < 6; ++i)
+	{
+		const auto value = select.getString(i, arena);
+		BOOST_REQUIRE(value.has_value());
+		BOOST_CHECK_EQUAL(value.value(), select.getString(i).value());
+		values[i] = value.value();
+	}
+
+	BOOST_CHECK_EQUAL(values[1], "-12.34");
+	BOOST_CHECK_EQUAL(values[3], "2024-02-29");
+	BOOST_CHECK_EQUAL(values[4], "true");
+	BOOST_CHECK_EQUAL(values[5], "one");
+	BOOST_CHECK(arena.getUsed() > 0u);
+
+	// The views of the previous row are released by the fetch.
+	BOOST_REQUIRE(select.fetchNext());
+	BOOST_CHECK_EQUAL(arena.getUsed(), 0u);
+	BOOST_CHECK_EQUAL(select.getString(0, arena).value(), "2");
+	BOOST_CHECK(!select.getString(1, arena).has_value());
+	BOOST_CHECK(!select.getString(5, arena).has_value());
+
+	BOOST_REQUIRE(select.execute(transaction));
+	RowSet rowSet{select, 10};
+	BOOST_REQUIRE_EQUAL(rowSet.getCount(), 1u);
+
+	auto& rowSetArena = rowSet.getArena();
+	const auto row = rowSet.getRow(0);
+	BOOST_CHECK_EQUAL(row.getString(0, rowSetArena).value(), "2");
+	BOOST_CHECK(rowSetArena.getUsed() > 0u);
+
+	BOOST_CHECK(!rowSet.refill(select));
+	BOOST_CHECK_EQUAL(rowSetArena.getUsed(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
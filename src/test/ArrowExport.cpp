@@ -0,0 +1,126 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if FB_CPP_TEST_ARROW
+
+#include "TestUtil.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include "fb-cpp-arrow/ArrowExport.h"
+#include <memory>
+#include <string>
+
+
+BOOST_AUTO_TEST_SUITE(ArrowExportSuite)
+
+BOOST_AUTO_TEST_CASE(streamsRecordBatches)
+{
+	const auto database = getTempFile("ArrowExport-streamsRecordBatches.fdb");
+
+	Attachment attachment{CLIENT, database,
+		AttachmentOptions().setCreateDatabase(true).setForcedWrites(false).setConnectionCharSet("UTF8")};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement ddl{attachment, transaction,
+		"create table arrow_test (id integer not null, amount numeric(10, 2), big numeric(38, 4), name varchar(20),"
+		" day date, moment timestamp with time zone, flag boolean, notes blob sub_type text)"};
+	ddl.execute(transaction);
+	transaction.commitRetaining();
+
+	Statement insert{attachment, transaction,
+		"insert into arrow_test values (1, 12.34, 123456789012345678901234.5678, 'one', date '1970-01-02',"
+		" timestamp '1970-01-01 00:00:01 America/Sao_Paulo', true, 'first note')"};
+	insert.execute(transaction);
+
+	Statement insertNulls{attachment, transaction, "insert into arrow_test (id) values (?)"};
+
+	for (int i = 2; i <= 3; ++i)
+	{
+		insertNulls.setInt32(0, i);
+		insertNulls.execute(transaction);
+	}
+
+	Statement select{attachment, transaction, "select * from arrow_test order by id"};
+	select.execute(transaction);
+
+	// execute() already fetched the first row, as with RowSet.
+	ArrowBatchReader reader{select, transaction, ArrowExportOptions().setBatchSize(1)};
+
+	const auto schema = reader.schema();
+	BOOST_REQUIRE_EQUAL(schema->num_fields(), 9);
+	BOOST_CHECK_EQUAL(schema->field(0)->name(), "ID");
+	BOOST_CHECK(schema->field(0)->type()->Equals(arrow::int32()));
+	BOOST_CHECK(!schema->field(0)->nullable());
+	BOOST_CHECK(schema->field(1)->type()->Equals(arrow::decimal128(18, 2)));
+	BOOST_CHECK(schema->field(2)->type()->Equals(arrow::decimal128(38, 4)));
+	BOOST_CHECK(schema->field(3)->type()->Equals(arrow::utf8()));
+	BOOST_CHECK(schema->field(4)->type()->Equals(arrow::date32()));
+	BOOST_CHECK(schema->field(5)->type()->Equals(arrow::timestamp(arrow::TimeUnit::MICRO, "UTC")));
+	BOOST_CHECK_EQUAL(schema->field(6)->name(), "MOMENT_TZ");
+	BOOST_CHECK(schema->field(7)->type()->Equals(arrow::boolean()));
+	BOOST_CHECK(schema->field(8)->type()->Equals(arrow::utf8()));
+
+	const auto second = reader.next();
+	BOOST_REQUIRE(second);
+	BOOST_CHECK_EQUAL(second->num_rows(), 1);
+	BOOST_CHECK_EQUAL(std::static_pointer_cast<arrow::Int32Array>(second->column(0))->Value(0), 2);
+
+	for (int i = 1; i < second->num_columns(); ++i)
+		BOOST_CHECK(second->column(i)->IsNull(0));
+
+	std::shared_ptr<arrow::RecordBatch> third;
+	BOOST_REQUIRE(reader.ReadNext(&third).ok());
+	BOOST_REQUIRE(third);
+	BOOST_CHECK_EQUAL(std::static_pointer_cast<arrow::Int32Array>(third->column(0))->Value(0), 3);
+
+	std::shared_ptr<arrow::RecordBatch> end;
+	BOOST_REQUIRE(reader.ReadNext(&end).ok());
+	BOOST_CHECK(!end);
+
+	Statement selectDescending{attachment, transaction, "select * from arrow_test order by id desc"};
+	selectDescending.execute(transaction);
+
+	const auto batch = toArrowRecordBatch(attachment, transaction, RowSet{selectDescending, 10});
+	BOOST_REQUIRE_EQUAL(batch->num_rows(), 2);
+	const auto first = batch->Slice(1);
+
+	BOOST_CHECK_EQUAL(std::static_pointer_cast<arrow::Int32Array>(first->column(0))->Value(0), 1);
+	BOOST_CHECK_EQUAL(std::static_pointer_cast<arrow::Decimal128Array>(first->column(1))->FormatValue(0), "12.34");
+	BOOST_CHECK_EQUAL(std::static_pointer_cast<arrow::Decimal128Array>(first->column(2))->FormatValue(0),
+		"123456789012345678901234.5678");
+	BOOST_CHECK_EQUAL(std::static_pointer_cast<arrow::StringArray>(first->column(3))->GetView(0), "one");
+	BOOST_CHECK_EQUAL(std::static_pointer_cast<arrow::Date32Array>(first->column(4))->Value(0), 1);
+	BOOST_CHECK_EQUAL(
+		std::static_pointer_cast<arrow::TimestampArray>(first->column(5))->Value(0), (3 * 3600 + 1) * 1000000ll);
+	BOOST_CHECK_EQUAL(
+		std::static_pointer_cast<arrow::StringArray>(first->column(6))->GetView(0), "America/Sao_Paulo");
+	BOOST_CHECK(std::static_pointer_cast<arrow::BooleanArray>(first->column(7))->Value(0));
+	BOOST_CHECK_EQUAL(std::static_pointer_cast<arrow::StringArray>(first->column(8))->GetView(0), "first note");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif  // FB_CPP_TEST_ARROW
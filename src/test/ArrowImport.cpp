@@ -0,0 +1,130 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#if FB_CPP_TEST_ARROW
+
+#include "TestUtil.h"
+#include "fb-cpp/Batch.h"
+#include "fb-cpp/RowSet.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include "fb-cpp-arrow/ArrowExport.h"
+#include "fb-cpp-arrow/ArrowImport.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+
+BOOST_AUTO_TEST_SUITE(ArrowImportSuite)
+
+BOOST_AUTO_TEST_CASE(roundTripsExportedBatches)
+{
+	const auto database = getTempFile("ArrowImport-roundTripsExportedBatches.fdb");
+
+	Attachment attachment{CLIENT, database,
+		AttachmentOptions().setCreateDatabase(true).setForcedWrites(false).setConnectionCharSet("UTF8")};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	for (const auto* sql : {
+			 "create table src (id integer not null, amount numeric(10, 2), name varchar(20), day date,"
+			 " moment timestamp, flag boolean, notes blob sub_type text)",
+			 "create table dst (id integer not null, amount numeric(10, 2), name varchar(20), day date,"
+			 " moment timestamp, flag boolean)",
+			 "create table dst_notes (id integer not null, notes blob sub_type text)",
+		 })
+	{
+		Statement ddl{attachment, transaction, sql};
+		ddl.execute(transaction);
+	}
+
+	transaction.commitRetaining();
+
+	Statement populate{attachment, transaction,
+		"insert into src select n, n * 1.25, 'name ' || n, dateadd(n day to date '1969-12-25'),"
+		" dateadd(n * 1000 millisecond to timestamp '1969-12-31 23:59:00'), mod(n, 2) = 0,"
+		" iif(mod(n, 3) = 0, null, 'note ' || n)"
+		" from (select row_number() over () n from rdb$types a cross join rdb$types b rows 5000)"};
+	populate.execute(transaction);
+
+	const auto exportRows = [&](const char* sql)
+	{
+		Statement select{attachment, transaction, sql};
+		select.execute(transaction);
+		return toArrowRecordBatch(attachment, transaction, RowSet{select, 10000});
+	};
+
+	const auto countMismatches = [&](const char* sql)
+	{
+		Statement count{attachment, transaction, sql};
+		count.execute(transaction);
+		return count.getInt32(0).value();
+	};
+
+	{  // scope
+		const auto recordBatch = exportRows("select id, amount, name, day, moment, flag from src order by id");
+
+		Statement insert{attachment, transaction, "insert into dst values (?, ?, ?, ?, ?, ?)"};
+		Batch batch{insert, transaction};
+		ArrowImporter importer{batch};
+
+		importer.add(*recordBatch);
+		BOOST_CHECK_EQUAL(importer.getRowCount(), static_cast<std::uint64_t>(recordBatch->num_rows()));
+
+		const auto report = importer.finish();
+		BOOST_CHECK_EQUAL(report.states.size(), static_cast<std::size_t>(recordBatch->num_rows()));
+		BOOST_CHECK(report.errors.empty());
+
+		BOOST_CHECK_EQUAL(countMismatches("select count(*) from src s full join dst d on d.id = s.id"
+										  " and d.amount = s.amount and d.name = s.name and d.day = s.day"
+										  " and d.moment = s.moment and d.flag = s.flag"
+										  " where s.id is null or d.id is null"),
+			0);
+	}
+
+	{  // scope
+		const auto recordBatch = exportRows("select id, notes from src order by id");
+
+		Statement insert{attachment, transaction, "insert into dst_notes values (?, ?)"};
+		Batch batch{insert, transaction, BatchOptions().setBlobPolicy(BlobPolicy::ID_ENGINE)};
+		ArrowImporter importer{batch};
+
+		importer.add(*recordBatch->Slice(0, 100));
+		importer.add(*recordBatch->Slice(100));
+		BOOST_CHECK(importer.finish().errors.empty());
+
+		BOOST_CHECK_EQUAL(countMismatches("select count(*) from src s full join dst_notes d on d.id = s.id"
+										  " and d.notes is not distinct from s.notes"
+										  " where s.id is null or d.id is null"),
+			0);
+
+		const auto wrongShape = exportRows("select id from src");
+		ArrowImporter other{batch};
+		BOOST_CHECK_THROW(other.add(*wrongShape), FbCppException);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif  // FB_CPP_TEST_ARROW
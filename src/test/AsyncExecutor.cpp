@@ -0,0 +1,237 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "fb-cpp/AsyncExecutor.h"
+#include "fb-cpp/Attachment.h"
+#include "fb-cpp/Blob.h"
+#include "fb-cpp/RowSet.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <future>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+BOOST_AUTO_TEST_SUITE(AsyncExecutorSuite)
+
+namespace
+{
+	// Minimal eager coroutine that reports its completion to a std::promise.
+	struct Detached final
+	{
+		struct promise_type final
+		{
+			Detached get_return_object() noexcept
+			{
+				return {};
+			}
+
+			std::suspend_never initial_suspend() noexcept
+			{
+				return {};
+			}
+
+			std::suspend_never final_suspend() noexcept
+			{
+				return {};
+			}
+
+			void return_void() noexcept
+			{
+			}
+
+			void unhandled_exception() noexcept
+			{
+				std::terminate();
+			}
+		};
+	};
+
+	Detached runOperations(AsyncExecutor& executor, std::promise<std::vector<std::string>>& done)
+	{
+		std::vector<std::string> log;
+
+		const auto value = co_await executor.run(nullptr, [] { return 42; });
+		log.push_back("value " + std::to_string(value));
+
+		try
+		{
+			co_await executor.run(nullptr, []() -> void { throw std::runtime_error{"failed"}; });
+		}
+		catch (const std::runtime_error& e)
+		{
+			log.push_back(std::string{"caught "} + e.what());
+		}
+
+		done.set_value(std::move(log));
+	}
+
+	Detached runQueries(AsyncExecutor& executor, Attachment& attachment, std::thread::id callerThread,
+		std::promise<std::vector<std::string>>& done)
+	{
+		std::vector<std::string> log;
+
+		{  // scope
+			Transaction transaction{attachment};
+			Statement insert{attachment, transaction, "insert into async_test (id, data) values (?, ?)"};
+
+			Blob writer{attachment, transaction};
+			const std::string text = "async blob";
+			co_await writer.writeAsync(executor, std::as_bytes(std::span{text.data(), text.size()}));
+			writer.close();
+
+			for (int i = 1; i <= 3; ++i)
+			{
+				insert.setInt32(0, i);
+				insert.setBlobId(1, writer.getId());
+				co_await insert.executeAsync(executor, transaction);
+			}
+
+			co_await transaction.commitAsync(executor);
+		}
+
+		Transaction transaction{attachment};
+		Statement select{attachment, transaction, "select id, data from async_test order by id"};
+
+		if (co_await select.executeAsync(executor, transaction))
+			log.push_back("first " + std::to_string(select.getInt32(0).value()));
+
+		Blob reader{attachment, transaction, select.getBlobId(1).value()};
+		std::vector<std::byte> buffer(64);
+		const auto read = co_await reader.readAsync(executor, buffer);
+		log.push_back("blob " + std::string{reinterpret_cast<const char*>(buffer.data()), read});
+		reader.close();
+
+		auto rowSet = co_await RowSet::fetchAsync(executor, select, 10);
+		log.push_back("rows " + std::to_string(rowSet.getCount()));
+		log.push_back("eof " + std::to_string(co_await select.fetchNextAsync(executor)));
+
+		co_await transaction.rollbackAsync(executor);
+
+		log.push_back(std::this_thread::get_id() == callerThread ? "caller thread" : "io thread");
+		done.set_value(std::move(log));
+	}
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(serializesWorkByKey)
+{
+	AsyncExecutor executor{AsyncExecutorOptions().setThreadCount(4)};
+	BOOST_CHECK_EQUAL(executor.getThreadCount(), 4u);
+
+	constexpr int count = 200;
+	const int keys[2]{};
+	std::atomic<int> running[2]{};
+	std::atomic<bool> overlapped = false;
+	std::vector<int> order[2];
+	std::atomic<int> finished = 0;
+	std::promise<void> allFinished;
+
+	for (int i = 0; i < count; ++i)
+	{
+		const auto k = i % 2;
+
+		executor.post(&keys[k],
+			[&, k, i]
+			{
+				if (running[k].fetch_add(1) != 0)
+					overlapped = true;
+
+				order[k].push_back(i);
+				std::this_thread::yield();
+				running[k].fetch_sub(1);
+
+				if (finished.fetch_add(1) + 1 == count)
+					allFinished.set_value();
+			});
+	}
+
+	allFinished.get_future().wait();
+
+	BOOST_CHECK(!overlapped);
+
+	for (int k = 0; k < 2; ++k)
+	{
+		BOOST_REQUIRE_EQUAL(order[k].size(), static_cast<std::size_t>(count / 2));
+
+		for (std::size_t i = 0; i < order[k].size(); ++i)
+			BOOST_CHECK_EQUAL(order[k][i], static_cast<int>(i * 2) + k);
+	}
+
+	std::atomic<int> resumes = 0;
+	std::optional<std::jthread> resumerThread;
+
+	AsyncExecutor resumingExecutor{AsyncExecutorOptions().setThreadCount(1).setResumer(
+		[&](std::coroutine_handle<> handle)
+		{
+			++resumes;
+			resumerThread.emplace([handle] { handle.resume(); });
+		})};
+
+	std::promise<std::vector<std::string>> done;
+	auto future = done.get_future();
+	runOperations(resumingExecutor, done);
+
+	const std::vector<std::string> expected{"value 42", "caught failed"};
+	const auto log = future.get();
+	BOOST_CHECK_EQUAL_COLLECTIONS(log.begin(), log.end(), expected.begin(), expected.end());
+	BOOST_CHECK_EQUAL(resumes.load(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(runsDatabaseCallsOnIoThreads)
+{
+	const auto database = getTempFile("AsyncExecutor-runsDatabaseCallsOnIoThreads.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction, "recreate table async_test (id integer, data blob)"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	std::vector<std::string> log;
+
+	{  // scope
+		AsyncExecutor executor{AsyncExecutorOptions().setThreadCount(2)};
+
+		std::promise<std::vector<std::string>> done;
+		auto future = done.get_future();
+		runQueries(executor, attachment, std::this_thread::get_id(), done);
+		log = future.get();
+	}
+
+	const std::vector<std::string> expected{"first 1", "blob async blob", "rows 2", "eof 0", "io thread"};
+	BOOST_CHECK_EQUAL_COLLECTIONS(log.begin(), log.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,182 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/AttachmentPool.h"
+#include "fb-cpp/Exception.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <chrono>
+#include <stdexcept>
+
+
+BOOST_AUTO_TEST_SUITE(AttachmentPoolSuite)
+
+BOOST_AUTO_TEST_CASE(invalidOptions)
+{
+	BOOST_CHECK_THROW(AttachmentPool(CLIENT, AttachmentPoolOptions().setMaxSize(0u)), std::invalid_argument);
+	BOOST_CHECK_THROW(
+		AttachmentPool(CLIENT, AttachmentPoolOptions().setMinSize(3u).setMaxSize(2u)), std::invalid_argument);
+
+	AttachmentPool pool{CLIENT};
+	BOOST_CHECK_THROW(pool.acquire("unused.fdb", AttachmentOptions().setCreateDatabase(true)), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(leaseIsReused)
+{
+	const auto database = getTempFile("AttachmentPool-leaseIsReused.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	AttachmentPool pool{CLIENT, AttachmentPoolOptions().setMaxSize(2u)};
+	fb::IAttachment* firstHandle;
+
+	{  // scope
+		auto lease = pool.acquire(database);
+		BOOST_REQUIRE(lease.isValid());
+		firstHandle = lease->getHandle().get();
+
+		Transaction transaction{*lease};
+		Statement select{*lease, transaction, "select 1 from rdb$database"};
+		BOOST_REQUIRE(select.execute(transaction));
+		BOOST_CHECK_EQUAL(*select.getInt32(0), 1);
+		transaction.commit();
+
+		BOOST_CHECK_EQUAL(pool.getLeasedCount(), 1u);
+		BOOST_CHECK_EQUAL(pool.getIdleCount(), 0u);
+	}
+
+	BOOST_CHECK_EQUAL(pool.getLeasedCount(), 0u);
+	BOOST_CHECK_EQUAL(pool.getIdleCount(), 1u);
+
+	auto lease1 = pool.acquire(database);
+	BOOST_CHECK_EQUAL(lease1->getHandle().get(), firstHandle);
+
+	// Different options map to a different key.
+	auto lease2 = pool.acquire(database, AttachmentOptions().setConnectionCharSet("UTF8"));
+	BOOST_CHECK_NE(lease2->getHandle().get(), firstHandle);
+	BOOST_CHECK_EQUAL(pool.getLeasedCount(), 2u);
+
+	// Discarded leases are disconnected instead of being returned.
+	lease2.discard();
+	BOOST_CHECK(!lease2.isValid());
+	BOOST_CHECK_EQUAL(pool.getLeasedCount(), 1u);
+	BOOST_CHECK_EQUAL(pool.getIdleCount(), 0u);
+
+	// Moving a lease does not return the attachment.
+	auto lease3 = std::move(lease1);
+	BOOST_CHECK(!lease1.isValid());
+	BOOST_CHECK_EQUAL(pool.getLeasedCount(), 1u);
+
+	lease3.release();
+	BOOST_CHECK_EQUAL(pool.getLeasedCount(), 0u);
+	BOOST_CHECK_EQUAL(pool.getIdleCount(), 1u);
+
+	pool.clear();
+	BOOST_CHECK_EQUAL(pool.getIdleCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(boundsAndEviction)
+{
+	const auto database = getTempFile("AttachmentPool-boundsAndEviction.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	AttachmentPool pool{CLIENT, AttachmentPoolOptions()
+									.setMinSize(1u)
+									.setMaxSize(2u)
+									.setIdleTimeout(std::chrono::milliseconds{0})
+									.setAcquireTimeout(std::chrono::milliseconds{50})};
+
+	pool.prewarm(database);
+	BOOST_CHECK_EQUAL(pool.getIdleCount(), 1u);
+
+	{  // scope
+		auto lease1 = pool.acquire(database);
+		auto lease2 = pool.acquire(database);
+		BOOST_CHECK_EQUAL(pool.getLeasedCount(), 2u);
+
+		BOOST_CHECK_THROW(pool.acquire(database), FbCppException);
+	}
+
+	BOOST_CHECK_EQUAL(pool.getIdleCount(), 2u);
+
+	// Everything is expired, but the minimum size is kept.
+	BOOST_CHECK_EQUAL(pool.evictIdle(), 1u);
+	BOOST_CHECK_EQUAL(pool.getIdleCount(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(brokenAttachmentIsNotHandedOut)
+{
+	const auto database = getTempFile("AttachmentPool-brokenAttachmentIsNotHandedOut.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	AttachmentPool pool{CLIENT};
+
+	{  // scope
+		auto lease = pool.acquire(database);
+
+		// An attachment disconnected by the user is not returned to the pool.
+		lease->disconnect();
+	}
+
+	BOOST_CHECK_EQUAL(pool.getIdleCount(), 0u);
+
+	std::int64_t pooledId;
+
+	{  // scope
+		auto lease = pool.acquire(database);
+		Transaction transaction{*lease};
+		Statement select{*lease, transaction, "select current_connection from rdb$database"};
+		BOOST_REQUIRE(select.execute(transaction));
+		pooledId = *select.getInt64(0);
+		transaction.commit();
+	}
+
+	BOOST_CHECK_EQUAL(pool.getIdleCount(), 1u);
+
+	{  // scope
+		// Kill the idle pooled attachment from another connection.
+		Transaction transaction{attachment};
+		Statement kill{attachment, transaction, "delete from mon$attachments where mon$attachment_id = ?"};
+		kill.setInt64(0, pooledId);
+		kill.execute(transaction);
+		transaction.commit();
+	}
+
+	// The liveness probe detects the dead attachment and a new one is created.
+	auto lease = pool.acquire(database);
+	Transaction transaction{*lease};
+	Statement select{*lease, transaction, "select current_connection from rdb$database"};
+	BOOST_REQUIRE(select.execute(transaction));
+	BOOST_CHECK_NE(*select.getInt64(0), pooledId);
+	transaction.commit();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -29,8 +29,13 @@
 #include "fb-cpp/Transaction.h"
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cstddef>
 #include <filesystem>
 #include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -250,6 +255,70 @@ BOOST_AUTO_TEST_CASE(restoreReplace)
 	cleanup.dropDatabase();
 }
 
+BOOST_AUTO_TEST_CASE(backupAndRestoreProgress)
+{
+	const auto sourceDatabasePath = getTempFile("BackupManager-backupAndRestoreProgress-source.fdb", false);
+	const auto restoredDatabasePath = getTempFile("BackupManager-backupAndRestoreProgress-restored.fdb", false);
+	const auto backupFile = getTempFile("BackupManager-backupAndRestoreProgress.fbk", false);
+	const auto sourceDatabaseUri = getTempFile("BackupManager-backupAndRestoreProgress-source.fdb");
+	const auto restoredDatabaseUri = getTempFile("BackupManager-backupAndRestoreProgress-restored.fdb");
+
+	{  // scope
+		Attachment attachment{CLIENT, sourceDatabaseUri, AttachmentOptions().setCreateDatabase(true)};
+		Transaction transaction{attachment};
+
+		Statement create{attachment, transaction, "create table progress_test(id integer not null primary key)"};
+		create.execute(transaction);
+		transaction.commitRetaining();
+
+		Statement insert{attachment, transaction,
+			"insert into progress_test(id) select rdb$relation_id from rdb$relations"};
+		insert.execute(transaction);
+		transaction.commit();
+	}
+
+	const auto isTableRecords = [](const BackupProgress& progress)
+	{ return progress.relation == "PROGRESS_TEST" && progress.records.has_value(); };
+
+	BackupManager manager{CLIENT, makeServiceManagerOptions()};
+
+	std::vector<BackupProgress> backupEvents;
+	std::vector<std::string> backupVerboseLines;
+	manager.backup(BackupOptions()
+			.setDatabase(sourceDatabasePath)
+			.setBackupFile(backupFile)
+			.setVerboseOutput([&](const std::string_view line) { backupVerboseLines.emplace_back(line); })
+			.setProgressOutput([&](const BackupProgress& progress) { backupEvents.push_back(progress); }));
+
+	BOOST_CHECK(!backupVerboseLines.empty());
+	BOOST_REQUIRE(!backupEvents.empty());
+	BOOST_CHECK(backupEvents.back().elapsed.count() > 0.0);
+	BOOST_CHECK(std::all_of(backupEvents.begin(), backupEvents.end(),
+		[](const BackupProgress& progress) { return !progress.phase.empty() && !progress.message.empty(); }));
+
+	const auto backupRecords = std::find_if(backupEvents.begin(), backupEvents.end(), isTableRecords);
+	BOOST_REQUIRE(backupRecords != backupEvents.end());
+	BOOST_CHECK(backupRecords->records.value() > 0u);
+	BOOST_CHECK(backupRecords->phaseElapsed <= backupRecords->elapsed);
+
+	std::vector<BackupProgress> restoreEvents;
+	manager.restore(RestoreOptions()
+			.setDatabase(restoredDatabasePath)
+			.setBackupFile(backupFile)
+			.setProgressOutput([&](const BackupProgress& progress) { restoreEvents.push_back(progress); }));
+
+	BOOST_REQUIRE(!restoreEvents.empty());
+	BOOST_CHECK(std::find_if(restoreEvents.begin(), restoreEvents.end(), isTableRecords) != restoreEvents.end());
+	BOOST_CHECK(std::any_of(restoreEvents.begin(), restoreEvents.end(),
+		[](const BackupProgress& progress) { return progress.pageWrites > 0u; }));
+
+	Attachment restored{CLIENT, restoredDatabaseUri};
+	FbDropDatabase restoredDrop{restored};
+
+	Attachment cleanup{CLIENT, sourceDatabaseUri};
+	cleanup.dropDatabase();
+}
+
 BOOST_AUTO_TEST_CASE(multiFileDatabaseAndBackupRoundTrip)
 {
 	const auto sourceDatabasePath = getTempFile("BackupManager-multiFile-source.fdb", false);
@@ -325,4 +394,78 @@ BOOST_AUTO_TEST_CASE(multiFileDatabaseAndBackupRoundTrip)
 	cleanup.dropDatabase();
 }
 
+BOOST_AUTO_TEST_CASE(streamingBackupAndRestore)
+{
+	const auto sourceDatabasePath = getTempFile("BackupManager-streaming-source.fdb", false);
+	const auto restoredDatabasePath = getTempFile("BackupManager-streaming-restored.fdb", false);
+	const auto sourceDatabaseUri = getTempFile("BackupManager-streaming-source.fdb");
+	const auto restoredDatabaseUri = getTempFile("BackupManager-streaming-restored.fdb");
+	const auto attachmentOptions = AttachmentOptions().setConnectionCharSet("UTF8");
+
+	{  // scope
+		Attachment attachment{
+			CLIENT, sourceDatabaseUri, AttachmentOptions().setCreateDatabase(true).setConnectionCharSet("UTF8")};
+
+		Transaction transaction{attachment};
+
+		Statement create{
+			attachment, transaction, "create table test(id integer not null primary key, name varchar(50))"};
+		create.execute(transaction);
+		transaction.commitRetaining();
+
+		Statement insert{attachment, transaction,
+			"insert into test(id, name) select row_number() over (), lpad('', 50, 'x')"
+			"  from rdb$types a cross join rdb$types b rows 5000"};
+		insert.execute(transaction);
+		transaction.commit();
+	}
+
+	BackupManager manager{CLIENT, makeServiceManagerOptions()};
+
+	std::vector<std::byte> stream;
+	unsigned chunks = 0u;
+
+	manager.backup(BackupOptions().setDatabase(sourceDatabasePath),
+		[&](std::span<const std::byte> chunk)
+		{
+			stream.insert(stream.end(), chunk.begin(), chunk.end());
+			++chunks;
+		});
+
+	BOOST_REQUIRE(!stream.empty());
+	BOOST_CHECK_GT(chunks, 1u);
+
+	std::size_t position = 0u;
+	std::vector<std::string> restoreVerboseLines;
+
+	manager.restore(RestoreOptions().setDatabase(restoredDatabasePath).setVerboseOutput(
+						[&](const std::string_view line) { restoreVerboseLines.emplace_back(line); }),
+		[&](std::span<std::byte> buffer)
+		{
+			const auto length = std::min(buffer.size(), stream.size() - position);
+			std::copy_n(stream.begin() + static_cast<std::ptrdiff_t>(position), length, buffer.begin());
+			position += length;
+			return length;
+		});
+
+	BOOST_CHECK_EQUAL(position, stream.size());
+	BOOST_CHECK(!restoreVerboseLines.empty());
+
+	Attachment restored{CLIENT, restoredDatabaseUri, attachmentOptions};
+	FbDropDatabase restoredDrop{restored};
+	Transaction transaction{restored};
+	Statement query{restored, transaction, "select count(*) from test"};
+	BOOST_REQUIRE(query.execute(transaction));
+	BOOST_CHECK_EQUAL(query.getInt64(0).value(), 5000);
+	transaction.commit();
+
+	const auto ignoreChunk = [](std::span<const std::byte>) {};
+	BOOST_CHECK_THROW(
+		manager.backup(BackupOptions().setDatabase(sourceDatabasePath).setBackupFile("x.fbk"), ignoreChunk),
+		std::invalid_argument);
+
+	Attachment cleanup{CLIENT, sourceDatabaseUri, attachmentOptions};
+	cleanup.dropDatabase();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
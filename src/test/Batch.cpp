@@ -25,8 +25,14 @@
 #include "TestUtil.h"
 #include "fb-cpp/Attachment.h"
 #include "fb-cpp/Batch.h"
+#include "fb-cpp/MessageStruct.h"
+#include "fb-cpp/RowSet.h"
 #include "fb-cpp/Statement.h"
 #include "fb-cpp/Transaction.h"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
 #include <span>
 #include <string>
 #include <vector>
@@ -399,6 +405,69 @@ BOOST_AUTO_TEST_CASE(blobWithIdEngine)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(blobFromFile)
+{
+	const auto database = getTempFile("Batch-blobFromFile.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction, "recreate table batch_test (id integer not null, data blob)"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	const std::filesystem::path sourcePath = getTempFile("Batch-blobFromFile.src", false);
+	std::string text(1024u * 1024u + 5u, '\0');
+
+	for (std::size_t i = 0; i < text.size(); ++i)
+		text[i] = static_cast<char>('A' + (i % 26));
+
+	{  // scope
+		std::ofstream source{sourcePath, std::ios::binary};
+		source.write(text.data(), static_cast<std::streamsize>(text.size()));
+	}
+
+	const auto streamOptions = BlobOptions().setType(BlobType::STREAM);
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement insert{attachment, transaction, "insert into batch_test (id, data) values (?, ?)"};
+
+		Batch batch{insert, transaction, BatchOptions().setBlobPolicy(BlobPolicy::ID_ENGINE).setRecordCounts(true)};
+
+		insert.setInt32(0, 1);
+		insert.setBlobId(1, batch.addBlobFromFile(sourcePath, streamOptions));
+		batch.addMessage();
+
+		auto completionState = batch.execute();
+		BOOST_CHECK_EQUAL(completionState.getSize(), 1u);
+		BOOST_CHECK_EQUAL(completionState.getState(0), 1);
+
+		transaction.commit();
+	}
+
+	std::filesystem::remove(sourcePath);
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement select{attachment, transaction, "select data from batch_test where id = 1"};
+		BOOST_CHECK(select.execute(transaction));
+
+		const auto receivedBlobId = select.getBlobId(0);
+		BOOST_REQUIRE(receivedBlobId.has_value());
+
+		Blob reader{attachment, transaction, receivedBlobId.value(), streamOptions};
+
+		std::vector<std::byte> buffer(text.size() + 1u);
+		const auto read = reader.read(buffer);
+		BOOST_CHECK_EQUAL(read, text.size());
+		BOOST_CHECK(std::string(reinterpret_cast<const char*>(buffer.data()), read) == text);
+	}
+}
+
 BOOST_AUTO_TEST_CASE(registerExistingBlob)
 {
 	const auto database = getTempFile("Batch-registerExistingBlob.fdb");
@@ -489,4 +558,163 @@ BOOST_AUTO_TEST_CASE(closeReleasesHandle)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(addRangeEncodesAllRecords)
+{
+	struct Record
+	{
+		std::int32_t id;
+		std::optional<std::string> name;
+		double amount;
+	};
+
+	const auto database = getTempFile("Batch-addRangeEncodesAllRecords.fdb");
+
+	Attachment attachment{CLIENT, database,
+		AttachmentOptions().setCreateDatabase(true).setForcedWrites(false).setConnectionCharSet("UTF8")};
+	FbDropDatabase attachmentDrop{attachment};
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction,
+			"recreate table batch_test (id integer not null, name varchar(50), amount numeric(10, 2))"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement insert{attachment, transaction, "insert into batch_test (id, name, amount) values (?, ?, ?)"};
+
+		Batch batch{insert, transaction, BatchOptions().setRecordCounts(true)};
+
+		std::vector<Record> records;
+
+		for (int i = 0; i < 100; ++i)
+			records.push_back({i, i % 10 == 0 ? std::nullopt : std::optional{"name" + std::to_string(i)}, i * 1.5});
+
+		batch.addRange(std::span{records});
+
+		auto completionState = batch.execute();
+		BOOST_CHECK_EQUAL(completionState.getSize(), 100u);
+		BOOST_CHECK(!completionState.findError(0).has_value());
+
+		transaction.commit();
+	}
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement select{attachment, transaction,
+			"select count(*), count(name), sum(id), sum(amount) from batch_test "
+			"where name is null or name = 'name' || id"};
+
+		BOOST_REQUIRE(select.execute(transaction));
+		BOOST_CHECK_EQUAL(select.getInt64(0).value(), 100);
+		BOOST_CHECK_EQUAL(select.getInt64(1).value(), 90);
+		BOOST_CHECK_EQUAL(select.getInt64(2).value(), 4950);
+		BOOST_CHECK_CLOSE(select.getDouble(3).value(), 7425.0, 0.001);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(messageStructsRoundTrip)
+{
+	struct Message
+	{
+		std::int32_t id;
+		std::int16_t idNull;
+		MessageVarChar<10> name;
+		std::int16_t nameNull;
+		double amount;
+		std::int16_t amountNull;
+	};
+
+	struct Other
+	{
+		std::int32_t id;
+		std::int16_t idNull;
+	};
+
+	static_assert(MessageStruct<Message>);
+
+	const auto database = getTempFile("Batch-messageStructsRoundTrip.fdb");
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction,
+			"recreate table message_test (id integer not null, name varchar(20), amount numeric(10, 2))"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement insert{attachment, transaction, "insert into message_test (id, name, amount) values (?, ?, ?)"};
+
+		BOOST_CHECK_THROW(insert.bindInputMessage<Other>(), FbCppException);
+		insert.bindInputMessage<Message>();
+		BOOST_CHECK(insert.getInputMessageFormat() == &impl::getMessageFormat<Message>());
+		BOOST_CHECK_EQUAL(insert.getInputMessage().size(), sizeof(Message));
+
+		std::vector<Message> messages(50);
+
+		for (int i = 0; i < 50; ++i)
+		{
+			auto& message = messages[i];
+			message.id = i;
+			message.idNull = 0;
+			message.name.set("name" + std::to_string(i));
+			message.nameNull = i % 10 == 0 ? -1 : 0;
+			message.amount = i * 1.5;
+			message.amountNull = 0;
+		}
+
+		{  // scope
+			Batch batch{insert, transaction};
+			BOOST_CHECK_THROW(batch.addMessages(std::span<const Other>{}), FbCppException);
+			batch.addMessages(std::span<const Message>{messages});
+			BOOST_CHECK_EQUAL(batch.execute().getSize(), 50u);
+		}
+
+		auto& single = insert.getInputMessageAs<Message>();
+		single = messages[1];
+		single.id = 50;
+		insert.execute(transaction);
+
+		transaction.commit();
+	}
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement select{attachment, transaction, "select id, name, amount from message_test order by id"};
+		select.bindOutputMessage<Message>();
+		BOOST_REQUIRE(select.execute(transaction));
+
+		const auto& first = select.getOutputMessageAs<Message>();
+		BOOST_CHECK_EQUAL(first.id, 0);
+		BOOST_CHECK(first.nameNull != 0);
+		BOOST_CHECK(select.isNull(1));
+		BOOST_CHECK_THROW(select.getOutputMessageAs<Other>(), FbCppException);
+		BOOST_CHECK_THROW(select.bindOutputMessage<Message>(), FbCppException);
+
+		RowSet rowSet{select, 100};
+		const auto rows = rowSet.getMessages<Message>();
+		BOOST_REQUIRE_EQUAL(rows.size(), 51u);
+		BOOST_CHECK_EQUAL(rowSet.getMessageLength(), sizeof(Message));
+
+		for (const auto& row : rows)
+		{
+			const auto source = row.id == 50 ? 1 : row.id;
+			BOOST_CHECK_EQUAL(row.nameNull != 0, source % 10 == 0);
+			BOOST_CHECK_CLOSE(row.amount, source * 1.5, 0.001);
+
+			if (row.nameNull == 0)
+				BOOST_CHECK_EQUAL(row.name.get(), "name" + std::to_string(source));
+		}
+
+		BOOST_CHECK_EQUAL(rowSet.getRow(50).getInt32(0).value(), 50);
+		BOOST_CHECK_THROW(rowSet.getMessages<Other>(), FbCppException);
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,116 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "fb-cpp/Attachment.h"
+#include "fb-cpp/BatchPipeline.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <future>
+#include <vector>
+
+
+BOOST_AUTO_TEST_SUITE(BatchPipelineSuite)
+
+BOOST_AUTO_TEST_CASE(executesSubmittedBuffersInOrder)
+{
+	const auto database = getTempFile("BatchPipeline-executesSubmittedBuffersInOrder.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction,
+			"recreate table batch_test (id integer not null primary key, "
+			"seq integer generated by default as identity)"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement insert{attachment, transaction, "insert into batch_test (id) values (?)"};
+
+		Batch batch{insert, transaction, BatchOptions().setMultiError(true).setRecordCounts(true)};
+		BatchPipeline pipeline{batch, 3};
+
+		std::vector<std::future<BatchCompletionState>> futures;
+
+		for (int buffer = 0; buffer < 10; ++buffer)
+		{
+			for (int i = 0; i < 100; ++i)
+			{
+				insert.setInt32(0, buffer * 100 + i);
+				pipeline.addMessage();
+			}
+
+			BOOST_CHECK_EQUAL(pipeline.getPendingMessages(), 100u);
+			futures.push_back(pipeline.submit());
+			BOOST_CHECK_EQUAL(pipeline.getPendingMessages(), 0u);
+		}
+
+		// A duplicate key fails only its own message.
+		insert.setInt32(0, 0);
+		pipeline.addMessage();
+		futures.push_back(pipeline.submit());
+
+		BOOST_CHECK_THROW(pipeline.submit(), FbCppException);
+
+		pipeline.drain();
+		BOOST_CHECK_EQUAL(pipeline.getQueuedBuffers(), 0u);
+
+		for (unsigned i = 0; i < 10; ++i)
+		{
+			auto state = futures[i].get();
+			BOOST_REQUIRE_EQUAL(state.getSize(), 100u);
+			BOOST_CHECK_EQUAL(state.getState(99), 1);
+			BOOST_CHECK(!state.findError(0).has_value());
+		}
+
+		auto failed = futures[10].get();
+		BOOST_REQUIRE_EQUAL(failed.getSize(), 1u);
+		BOOST_CHECK_EQUAL(failed.getState(0), BatchCompletionState::EXECUTE_FAILED);
+
+		pipeline.close();
+		BOOST_CHECK_THROW(pipeline.addMessage(), FbCppException);
+		BOOST_CHECK_EQUAL(pipeline.getPendingMessages(), 0u);
+
+		transaction.commit();
+	}
+
+	{  // scope
+		Transaction transaction{attachment};
+
+		// The identity follows the submission order.
+		Statement check{attachment, transaction,
+			"select count(*), sum(case when seq = id + 1 then 1 else 0 end) from batch_test"};
+
+		BOOST_REQUIRE(check.execute(transaction));
+		BOOST_CHECK_EQUAL(check.getInt32(0).value(), 1000);
+		BOOST_CHECK_EQUAL(check.getInt64(1).value(), 1000);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,154 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/Attachment.h"
+#include "fb-cpp/BatchWriter.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+BOOST_AUTO_TEST_SUITE(BatchWriterSuite)
+
+BOOST_AUTO_TEST_CASE(flushesAtByteLimitAndMergesStates)
+{
+	const auto database = getTempFile("BatchWriter-flushesAtByteLimitAndMergesStates.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction, "recreate table batch_test (id integer not null primary key)"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement insert{attachment, transaction, "insert into batch_test (id) values (?)"};
+
+		Batch batch{insert, transaction, BatchOptions().setMultiError(true).setRecordCounts(true)};
+
+		impl::StatusWrapper statusWrapper{CLIENT};
+		const auto messageLength = batch.getInputMetadata()->getAlignedLength(&statusWrapper);
+
+		// Room for two messages per execution.
+		BatchWriter writer{batch, BatchWriterOptions().setFlushBytes(messageLength * 2).setCommitEvery(2)};
+
+		for (const int id : {1, 2, 3, 3, 4})
+		{
+			insert.setInt32(0, id);
+			writer.addMessage();
+		}
+
+		BOOST_CHECK_EQUAL(writer.getMessageCount(), 5u);
+		BOOST_CHECK_EQUAL(writer.getPendingMessages(), 1u);
+
+		const auto report = writer.finish();
+
+		BOOST_CHECK_EQUAL(report.flushCount, 3u);
+		BOOST_CHECK_EQUAL(report.commitCount, 1u);
+		BOOST_REQUIRE_EQUAL(report.states.size(), 5u);
+		BOOST_CHECK_EQUAL(report.states[0], 1);
+		BOOST_CHECK_EQUAL(report.states[3], BatchCompletionState::EXECUTE_FAILED);
+		BOOST_CHECK_EQUAL(report.states[4], 1);
+		BOOST_REQUIRE_EQUAL(report.errors.size(), 1u);
+		BOOST_CHECK_EQUAL(report.errors[0].index, 3u);
+		BOOST_CHECK(!report.errors[0].status.empty());
+
+		BOOST_CHECK_EQUAL(writer.getMessageCount(), 0u);
+
+		transaction.commit();
+	}
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement count{attachment, transaction, "select count(*) from batch_test"};
+
+		BOOST_CHECK(count.execute(transaction));
+		BOOST_CHECK_EQUAL(count.getInt32(0).value(), 4);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(rawMessagesAreSplitAcrossFlushes)
+{
+	const auto database = getTempFile("BatchWriter-rawMessagesAreSplitAcrossFlushes.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction, "recreate table batch_test (id integer not null)"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement insert{attachment, transaction, "insert into batch_test (id) values (?)"};
+
+		Batch batch{insert, transaction};
+
+		impl::StatusWrapper statusWrapper{CLIENT};
+		const auto messageLength = batch.getInputMetadata()->getAlignedLength(&statusWrapper);
+		const auto& descriptor = batch.getInputDescriptorSet()->getLayout(0);
+
+		std::vector<std::byte> buffer(static_cast<std::size_t>(messageLength) * 10);
+
+		for (unsigned i = 0; i < 10; ++i)
+		{
+			auto* message = &buffer[static_cast<std::size_t>(i) * messageLength];
+			*reinterpret_cast<std::int32_t*>(&message[descriptor.offset]) = static_cast<std::int32_t>(i);
+			*reinterpret_cast<std::int16_t*>(&message[descriptor.nullOffset]) = FB_FALSE;
+		}
+
+		BatchWriter writer{batch, BatchWriterOptions().setFlushBytes(messageLength * 4)};
+		writer.add(10, buffer.data());
+
+		const auto report = writer.finish();
+
+		BOOST_CHECK_EQUAL(report.flushCount, 3u);
+		BOOST_CHECK_EQUAL(report.states.size(), 10u);
+		BOOST_CHECK(report.errors.empty());
+
+		transaction.commit();
+	}
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement count{attachment, transaction, "select count(*), sum(id) from batch_test"};
+
+		BOOST_CHECK(count.execute(transaction));
+		BOOST_CHECK_EQUAL(count.getInt32(0).value(), 10);
+		BOOST_CHECK_EQUAL(count.getInt64(1).value(), 45);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
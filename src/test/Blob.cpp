@@ -28,6 +28,9 @@
 #include "fb-cpp/Statement.h"
 #include "fb-cpp/Transaction.h"
 #include <array>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
 #include <limits>
 #include <span>
 #include <string>
@@ -225,4 +228,49 @@ BOOST_AUTO_TEST_CASE(cancelDiscardsHandle)
 	BOOST_CHECK_EQUAL(blob.isValid(), false);
 }
 
+BOOST_AUTO_TEST_CASE(writeFromFileAndReadToFile)
+{
+	const auto database = getTempFile("Blob-writeFromFileAndReadToFile.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	const std::filesystem::path sourcePath = getTempFile("Blob-writeFromFileAndReadToFile.src", false);
+	const std::filesystem::path targetPath = getTempFile("Blob-writeFromFileAndReadToFile.dst", false);
+
+	std::string text(3u * 1024u * 1024u + 777u, '\0');
+
+	for (std::size_t i = 0; i < text.size(); ++i)
+		text[i] = static_cast<char>('a' + (i % 23));
+
+	{  // scope
+		std::ofstream source{sourcePath, std::ios::binary};
+		source.write(text.data(), static_cast<std::streamsize>(text.size()));
+	}
+
+	const auto streamOptions = BlobOptions().setType(BlobType::STREAM);
+	Transaction transaction{attachment};
+
+	Blob writer{attachment, transaction, streamOptions};
+	BOOST_CHECK_EQUAL(writer.writeFromFile(sourcePath), text.size());
+	writer.close();
+
+	Blob reader{attachment, transaction, writer.getId(), streamOptions};
+	BOOST_CHECK_EQUAL(reader.getLength(), text.size());
+	BOOST_CHECK_EQUAL(reader.readToFile(targetPath), text.size());
+	reader.close();
+
+	std::ifstream target{targetPath, std::ios::binary};
+	const std::string result{std::istreambuf_iterator<char>{target}, std::istreambuf_iterator<char>{}};
+	BOOST_CHECK(result == text);
+	target.close();
+
+	Blob missing{attachment, transaction, streamOptions};
+	BOOST_CHECK_THROW(missing.writeFromFile(sourcePath.string() + ".missing"), FbCppException);
+	missing.cancel();
+
+	std::filesystem::remove(sourcePath);
+	std::filesystem::remove(targetPath);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,162 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/Attachment.h"
+#include "fb-cpp/Blob.h"
+#include "fb-cpp/BlobStream.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+BOOST_AUTO_TEST_SUITE(BlobStreamSuite)
+
+static std::string makeText(std::size_t size)
+{
+	std::string text(size, '\0');
+
+	for (std::size_t i = 0; i < text.size(); ++i)
+		text[i] = static_cast<char>('A' + (i % 26));
+
+	return text;
+}
+
+BOOST_AUTO_TEST_CASE(invalidOptions)
+{
+	const auto database = getTempFile("BlobStream-invalidOptions.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+	Blob blob{attachment, transaction, BlobOptions().setType(BlobType::STREAM)};
+
+	BOOST_CHECK_THROW(BlobWriter(blob, BlobStreamOptions().setBufferSize(0)), std::invalid_argument);
+	BOOST_CHECK_THROW(BlobWriter(blob, BlobStreamOptions().setBufferCount(0)), std::invalid_argument);
+	BOOST_CHECK_THROW(BlobReader(blob, BlobStreamOptions().setBufferSize(0)), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(streamsRoundTrip)
+{
+	const auto database = getTempFile("BlobStream-streamsRoundTrip.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	const auto blobOptions = BlobOptions().setType(BlobType::STREAM);
+	const auto text = makeText(1024 * 1024 + 12345);
+
+	for (const bool async : {true, false})
+	{
+		BOOST_TEST_CONTEXT("async=" << async)
+		{
+			// Buffer size deliberately not a multiple of the 64K segment size.
+			const auto streamOptions = BlobStreamOptions().setBufferSize(100000).setBufferCount(3).setAsync(async);
+
+			Transaction transaction{attachment};
+			BlobId blobId;
+
+			{  // scope
+				Blob blob{attachment, transaction, blobOptions};
+
+				BlobOutputStream out{blob, streamOptions};
+				out << text.substr(0, 10);
+				out.write(text.data() + 10, static_cast<std::streamsize>(text.size() - 10));
+				out.close();
+				BOOST_CHECK(out.good());
+
+				blob.close();
+				blobId = blob.getId();
+			}
+
+			{  // scope
+				Blob blob{attachment, transaction, blobId, blobOptions};
+				BOOST_CHECK_EQUAL(blob.getLength(), text.size());
+
+				BlobInputStream in{blob, streamOptions};
+				std::string result(text.size() + 10, '\0');
+				in.read(result.data(), static_cast<std::streamsize>(result.size()));
+
+				BOOST_CHECK(in.eof());
+				BOOST_CHECK_EQUAL(static_cast<std::size_t>(in.gcount()), text.size());
+				result.resize(static_cast<std::size_t>(in.gcount()));
+				BOOST_CHECK(result == text);
+			}
+
+			{  // scope
+				Blob blob{attachment, transaction, blobId, blobOptions};
+				BlobReader reader{blob, streamOptions};
+
+				std::vector<char> head(7);
+				BOOST_CHECK_EQUAL(reader.read(std::span{head}), head.size());
+				BOOST_CHECK_EQUAL(std::string(head.data(), head.size()), text.substr(0, head.size()));
+
+				std::ostringstream out;
+				BOOST_CHECK_EQUAL(reader.copyTo(out), text.size() - head.size());
+				BOOST_CHECK(out.str() == text.substr(head.size()));
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(writerCopiesFromStream)
+{
+	const auto database = getTempFile("BlobStream-writerCopiesFromStream.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	const auto blobOptions = BlobOptions().setType(BlobType::STREAM);
+	const auto text = makeText(300000);
+
+	Transaction transaction{attachment};
+	BlobId blobId;
+
+	{  // scope
+		Blob blob{attachment, transaction, blobOptions};
+		BlobWriter writer{blob, BlobStreamOptions().setBufferSize(65536)};
+
+		std::istringstream in{text};
+		BOOST_CHECK_EQUAL(writer.copyFrom(in), text.size());
+		writer.close();
+
+		blob.close();
+		blobId = blob.getId();
+	}
+
+	Blob blob{attachment, transaction, blobId, blobOptions};
+	BlobReader reader{blob};
+
+	std::vector<std::byte> buffer(text.size() + 1);
+	BOOST_CHECK_EQUAL(reader.read(buffer), text.size());
+	BOOST_CHECK(std::string(reinterpret_cast<const char*>(buffer.data()), text.size()) == text);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
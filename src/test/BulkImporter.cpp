@@ -0,0 +1,177 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "TestUtil.h"
+#include "fb-cpp/Batch.h"
+#include "fb-cpp/BulkImporter.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+BOOST_AUTO_TEST_SUITE(BulkImporterSuite)
+
+BOOST_AUTO_TEST_CASE(importsCsvAcrossChunks)
+{
+	const auto database = getTempFile("BulkImporter-importsCsvAcrossChunks.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement ddl{attachment, transaction,
+		"create table import_test (id integer not null primary key, amount numeric(10, 2), name varchar(20),"
+		" day date, moment timestamp, flag boolean, notes blob sub_type text)"};
+	ddl.execute(transaction);
+	transaction.commitRetaining();
+
+	Statement insert{attachment, transaction, "insert into import_test values (?, ?, ?, ?, ?, ?, ?)"};
+	Batch batch{insert, transaction,
+		BatchOptions().setMultiError(true).setRecordCounts(true).setBlobPolicy(BlobPolicy::ID_ENGINE)};
+
+	// A chunk smaller than most records makes every record span reads and the buffer grow.
+	BulkImporter importer{batch, BulkImportOptions().setChunkSize(8).setMessagesPerAdd(2)};
+
+	std::istringstream input{
+		"ID,AMOUNT,NAME,DAY,MOMENT,FLAG,NOTES\n"
+		"1,12.5,plain,2024-02-29,2024-02-29 10:20:30.5,true,first\n"
+		"2,-0.055,\"a,b \"\"q\"\"\",,1858-11-17 00:00:00,false,\"multi\nline\"\r\n"
+		"1,1,duplicate,,,,\n"
+		"3,,\"\",1970-01-01,,,"};
+
+	const auto report = importer.importFrom(input);
+
+	BOOST_REQUIRE_EQUAL(report.states.size(), 4u);
+	BOOST_CHECK_EQUAL(report.states[0], 1);
+	BOOST_CHECK_EQUAL(report.states[2], BatchCompletionState::EXECUTE_FAILED);
+	BOOST_REQUIRE_EQUAL(report.errors.size(), 1u);
+	BOOST_CHECK_EQUAL(report.errors[0].index, 2u);
+
+	Statement select{attachment, transaction,
+		"select id, cast(amount as varchar(20)), name, cast(day as varchar(10)), cast(moment as varchar(30)),"
+		" flag, cast(notes as varchar(20)) from import_test order by id"};
+
+	BOOST_REQUIRE(select.execute(transaction));
+	BOOST_CHECK_EQUAL(select.getInt32(0).value(), 1);
+	BOOST_CHECK_EQUAL(select.getString(1).value(), "12.50");
+	BOOST_CHECK_EQUAL(select.getString(2).value(), "plain");
+	BOOST_CHECK_EQUAL(select.getString(3).value(), "2024-02-29");
+	BOOST_CHECK_EQUAL(select.getString(4).value(), "2024-02-29 10:20:30.5000");
+	BOOST_CHECK_EQUAL(select.getBool(5).value(), true);
+	BOOST_CHECK_EQUAL(select.getString(6).value(), "first");
+
+	BOOST_REQUIRE(select.fetchNext());
+	BOOST_CHECK_EQUAL(select.getInt32(0).value(), 2);
+	// Rounded half away from zero.
+	BOOST_CHECK_EQUAL(select.getString(1).value(), "-0.06");
+	BOOST_CHECK_EQUAL(select.getString(2).value(), "a,b \"q\"");
+	BOOST_CHECK(!select.getString(3).has_value());
+	BOOST_CHECK_EQUAL(select.getString(4).value(), "1858-11-17 00:00:00.0000");
+	BOOST_CHECK_EQUAL(select.getBool(5).value(), false);
+	BOOST_CHECK_EQUAL(select.getString(6).value(), "multi\nline");
+
+	BOOST_REQUIRE(select.fetchNext());
+	BOOST_CHECK_EQUAL(select.getInt32(0).value(), 3);
+	BOOST_CHECK(!select.getString(1).has_value());
+	BOOST_CHECK_EQUAL(select.getString(2).value(), "");
+	BOOST_CHECK_EQUAL(select.getString(3).value(), "1970-01-01");
+	BOOST_CHECK(!select.getBool(5).has_value());
+
+	BOOST_CHECK(!select.fetchNext());
+}
+
+BOOST_AUTO_TEST_CASE(importsTsvAndRejectsMalformedRecords)
+{
+	const auto database = getTempFile("BulkImporter-importsTsvAndRejectsMalformedRecords.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement ddl{attachment, transaction, "create table import_test (id bigint, name varchar(20), t time)"};
+	ddl.execute(transaction);
+	transaction.commitRetaining();
+
+	Statement insert{attachment, transaction, "insert into import_test values (?, ?, ?)"};
+
+	{  // scope
+		Batch batch{insert, transaction};
+		BulkImporter importer{batch, BulkImportOptions().setFormat(ImportFormat::TSV).setHeader(false)};
+
+		const auto report = importer.importFrom(std::string_view{
+			"1\ttab\\there\\\\\t23:59:59.9999\n"
+			"-9223372036854775808\t\\N\t00:00:00\n"});
+
+		BOOST_CHECK_EQUAL(report.states.size(), 2u);
+		BOOST_CHECK(report.errors.empty());
+	}
+
+	{  // scope
+		Statement select{attachment, transaction,
+			"select id, name, cast(t as varchar(13)) from import_test order by id desc"};
+
+		BOOST_REQUIRE(select.execute(transaction));
+		BOOST_CHECK_EQUAL(select.getInt64(0).value(), 1);
+		BOOST_CHECK_EQUAL(select.getString(1).value(), "tab\there\\");
+		BOOST_CHECK_EQUAL(select.getString(2).value(), "23:59:59.9999");
+
+		BOOST_REQUIRE(select.fetchNext());
+		BOOST_CHECK_EQUAL(select.getInt64(0).value(), std::numeric_limits<std::int64_t>::min());
+		BOOST_CHECK(!select.getString(1).has_value());
+		BOOST_CHECK_EQUAL(select.getString(2).value(), "00:00:00.0000");
+	}
+
+	Batch batch{insert, transaction};
+
+	BOOST_CHECK_THROW(BulkImporter(batch, BulkImportOptions().setChunkSize(0)), std::invalid_argument);
+
+	const auto importFails = [&](std::string_view data)
+	{
+		BulkImporter importer{batch, BulkImportOptions().setHeader(false)};
+		BOOST_CHECK_THROW(importer.importFrom(data), FbCppException);
+		batch.cancel();
+	};
+
+	importFails("1,a\n");
+	importFails("1,a,00:00:00,extra\n");
+	importFails("x,a,00:00:00\n");
+	importFails("9223372036854775808,a,00:00:00\n");
+	importFails("1,a,24:00:00\n");
+	importFails("1,\"unterminated,00:00:00\n");
+	importFails("1,\"a\"b,00:00:00\n");
+	importFails("1,123456789012345678901,00:00:00\n");
+
+	// Blob parameters need batch-local blob IDs.
+	Statement blobInsert{attachment, transaction, "insert into import_test (name) values (cast(? as blob))"};
+	Batch blobBatch{blobInsert, transaction};
+	BOOST_CHECK_THROW(BulkImporter{blobBatch}, std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
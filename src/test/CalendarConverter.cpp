@@ -281,5 +281,49 @@ BOOST_DATA_TEST_CASE(timestampTzOffsetConversion, data::make(TIMESTAMP_TZ_OFFSET
 	BOOST_CHECK_EQUAL(text, inputText);
 }
 
+BOOST_AUTO_TEST_CASE(timeZoneNamesAreInterned)
+{
+	impl::StatusWrapper statusWrapper{CLIENT};
+
+	impl::CalendarConverter converter{CLIENT};
+
+	const TimestampTz timestampTz{Timestamp{Date{2024y / month{2} / 29d}, Time{16h}}, "America/Sao_Paulo"};
+	const auto opaqueTimestamp = converter.timestampTzToOpaqueTimestampTz(&statusWrapper, timestampTz);
+	BOOST_CHECK(converter.timestampTzToOpaqueTimestampTz(&statusWrapper, timestampTz) == opaqueTimestamp);
+
+	const auto first = converter.opaqueTimestampTzToTimestampTz(&statusWrapper, opaqueTimestamp);
+	const auto second = converter.opaqueTimestampTzToTimestampTz(&statusWrapper, opaqueTimestamp);
+	BOOST_CHECK(first == timestampTz);
+	BOOST_CHECK(&first.zone.str() == &second.zone.str());
+
+	const TimeTz timeTz{Time{16h}, "America/Sao_Paulo"};
+	const auto opaqueTime = converter.timeTzToOpaqueTimeTz(&statusWrapper, timeTz);
+	BOOST_CHECK_EQUAL(opaqueTime.value.time_zone, opaqueTimestamp.value.time_zone);
+
+	const auto decodedTime = converter.opaqueTimeTzToTimeTz(&statusWrapper, opaqueTime);
+	BOOST_CHECK(decodedTime == timeTz);
+	BOOST_CHECK(&decodedTime.zone.str() == &first.zone.str());
+	BOOST_CHECK(decodedTime.zone == std::string_view{timeTz.zone});
+}
+
+
+static const std::initializer_list<std::string_view> INVALID_TIME_TEXTS{
+	"",
+	"1:02:03",
+	"01:02",
+	"01:02:03.",
+	"01:02:03.12345",
+	"01:02:03 x",
+};
+
+BOOST_DATA_TEST_CASE(invalidTimeTextThrows, data::make(INVALID_TIME_TEXTS), text)
+{
+	impl::CalendarConverter converter{CLIENT};
+
+	BOOST_CHECK_THROW(converter.stringToTime(text), DatabaseException);
+	BOOST_CHECK_THROW(converter.stringToDate(text), DatabaseException);
+	BOOST_CHECK_THROW(converter.stringToTimestamp(std::string{"2024-02-29 "} + std::string{text}), DatabaseException);
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -23,6 +23,12 @@
  */
 
 #include "TestUtil.h"
+#include "fb-cpp/Exception.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <atomic>
+#include <thread>
+#include <vector>
 
 
 BOOST_AUTO_TEST_SUITE(ClientSuite)
@@ -43,6 +49,74 @@ BOOST_AUTO_TEST_CASE(isNotValidAfterMove)
 	BOOST_CHECK_EQUAL(client1.isValid(), false);
 }
 
+BOOST_AUTO_TEST_CASE(sharedByWorkerThreads)
+{
+	// A new Client, so the worker threads race on the first use of the numeric utility interfaces.
+	Client client{CLIENT.getMaster()};
+
+	const auto database = getTempFile("Client-sharedByWorkerThreads.fdb");
+
+	Attachment attachment{client, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	constexpr unsigned threadCount = 64;
+	constexpr int iterations = 10;
+
+	std::vector<fb::IInt128*> int128Utils(threadCount);
+	std::vector<fb::IDecFloat34*> decFloat34Utils(threadCount);
+	std::atomic<unsigned> failures = 0;
+	std::atomic<unsigned> started = 0;
+
+	{  // scope
+		std::vector<std::jthread> threads;
+
+		for (unsigned t = 0; t < threadCount; ++t)
+		{
+			threads.emplace_back(
+				[&, t]
+				{
+					++started;
+
+					while (started.load() != threadCount)
+						std::this_thread::yield();
+
+					try
+					{
+						impl::StatusWrapper statusWrapper{client};
+						int128Utils[t] = client.getInt128Util(&statusWrapper);
+						decFloat34Utils[t] = client.getDecFloat34Util(&statusWrapper);
+
+						for (int i = 0; i < iterations; ++i)
+						{
+							Transaction transaction{attachment};
+							Statement statement{attachment, transaction, "select ? + 1 from rdb$database"};
+							statement.setInt32(0, i);
+
+							if (!statement.execute(transaction) || statement.getInt32(0) != i + 1)
+								++failures;
+
+							transaction.commit();
+						}
+					}
+					catch (...)
+					{
+						++failures;
+					}
+				});
+		}
+	}
+
+	BOOST_CHECK_EQUAL(failures.load(), 0u);
+
+	for (unsigned t = 0; t < threadCount; ++t)
+	{
+		BOOST_CHECK(int128Utils[t] != nullptr);
+		BOOST_CHECK(int128Utils[t] == int128Utils[0]);
+		BOOST_CHECK(decFloat34Utils[t] != nullptr);
+		BOOST_CHECK(decFloat34Utils[t] == decFloat34Utils[0]);
+	}
+}
+
 #if FB_CPP_USE_BOOST_DLL != 0
 BOOST_AUTO_TEST_CASE(loadWithBoostDll)
 {
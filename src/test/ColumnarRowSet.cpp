@@ -0,0 +1,100 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/ColumnarRowSet.h"
+#include "fb-cpp/RowSet.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <numeric>
+
+
+BOOST_AUTO_TEST_SUITE(ColumnarRowSetSuite)
+
+BOOST_AUTO_TEST_CASE(transposeColumns)
+{
+	const auto database = getTempFile("ColumnarRowSet-transposeColumns.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement ddl{attachment, transaction, "create table t (id bigint, val double precision, name varchar(10))"};
+	ddl.execute(transaction);
+	transaction.commitRetaining();
+
+	Statement insert{attachment, transaction, "insert into t (id, val, name) values (?, ?, ?)"};
+	for (int i = 1; i <= 70; ++i)
+	{
+		insert.setInt64(0, i);
+
+		if (i % 10 == 0)
+			insert.setNull(1);
+		else
+			insert.setDouble(1, i * 0.5);
+
+		insert.setString(2, "n" + std::to_string(i));
+		insert.execute(transaction);
+	}
+
+	Statement select{attachment, transaction, "select id, val, name from t order by id"};
+	BOOST_REQUIRE(select.execute(transaction));
+
+	// execute() fetched row 1.
+	ColumnarRowSet columnar{select, 100};
+	BOOST_CHECK_EQUAL(columnar.getCount(), 69u);
+	BOOST_CHECK_EQUAL(columnar.getColumnCount(), 3u);
+
+	const auto ids = columnar.getValues<std::int64_t>(0);
+	BOOST_REQUIRE_EQUAL(ids.size(), 69u);
+	BOOST_CHECK_EQUAL(std::accumulate(ids.begin(), ids.end(), std::int64_t{0}), 70 * 71 / 2 - 1);
+
+	BOOST_CHECK_THROW(columnar.getValues<std::int32_t>(0), FbCppException);
+	BOOST_CHECK_THROW(columnar.getValues<double>(3), std::out_of_range);
+
+	// Null doubles are stored as zero.
+	const auto values = columnar.getValues<double>(1);
+	BOOST_CHECK_EQUAL(columnar.getNullCount(1), 7u);
+	BOOST_CHECK(columnar.isNull(1, 8u));  // id 10
+	BOOST_CHECK(columnar.isNull(1, 68u));  // id 70
+	BOOST_CHECK_EQUAL(values[8], 0.0);
+	BOOST_CHECK_EQUAL(values[0], 1.0);
+	BOOST_CHECK_EQUAL(columnar.getNullBitmap(1).size(), 2u);
+
+	BOOST_CHECK_EQUAL(columnar.getString(2, 0).value(), "n2");
+	BOOST_CHECK_EQUAL(columnar.getString(2, 68).value(), "n70");
+	BOOST_CHECK_THROW(columnar.getString(0, 0), FbCppException);
+
+	// Transposing a RowSet gives the same layout.
+	BOOST_REQUIRE(select.execute(transaction));
+	RowSet rowSet{select, 5};
+	ColumnarRowSet fromRowSet{rowSet};
+	BOOST_CHECK_EQUAL(fromRowSet.getCount(), 5u);
+	BOOST_CHECK_EQUAL(fromRowSet.getValues<std::int64_t>(0)[4], 6);
+	BOOST_CHECK_EQUAL(fromRowSet.getString(2, 4).value(), "n6");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
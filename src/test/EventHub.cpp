@@ -0,0 +1,137 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "fb-cpp/Attachment.h"
+#include "fb-cpp/EventHub.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+BOOST_AUTO_TEST_SUITE(EventHubSuite)
+
+namespace
+{
+	class CountCollector final
+	{
+	public:
+		EventHub::Callback callback()
+		{
+			return [this](const std::vector<EventCount>& counts)
+			{
+				std::lock_guard mutexGuard{mutex};
+
+				for (const auto& count : counts)
+					totals[count.name] += count.count;
+
+				condition.notify_all();
+			};
+		}
+
+		bool waitFor(const std::string& name, unsigned count)
+		{
+			std::unique_lock mutexGuard{mutex};
+			return condition.wait_for(mutexGuard, std::chrono::seconds{10}, [&] { return totals[name] >= count; });
+		}
+
+		unsigned get(const std::string& name)
+		{
+			std::lock_guard mutexGuard{mutex};
+			return totals[name];
+		}
+
+	private:
+		std::mutex mutex;
+		std::condition_variable condition;
+		std::map<std::string, unsigned> totals;
+	};
+
+	void postEvents(Attachment& attachment, const std::vector<std::string>& names)
+	{
+		std::string sql = "execute block as begin";
+
+		for (const auto& name : names)
+			sql += " post_event '" + name + "';";
+
+		sql += " end";
+
+		Transaction transaction{attachment};
+		Statement statement{attachment, transaction, sql};
+		statement.execute(transaction);
+		transaction.commit();
+	}
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(multiplexesSubscriptions)
+{
+	const auto database = getTempFile("EventHub-multiplexesSubscriptions.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	EventHub hub{2u};
+
+	std::vector<std::string> manyNames;
+
+	for (unsigned i = 0; i < 300u; ++i)
+		manyNames.push_back("hub_event_" + std::to_string(i));
+
+	CountCollector manyCollector;
+	const auto manyId = hub.subscribe(attachment, manyNames, manyCollector.callback());
+	BOOST_CHECK_EQUAL(hub.getRegistrationCount(), 2u);
+
+	CountCollector singleCollector;
+	hub.subscribe(attachment, {"hub_event_1"}, singleCollector.callback());
+	BOOST_CHECK_EQUAL(hub.getSubscriptionCount(), 2u);
+	BOOST_CHECK_EQUAL(hub.getRegistrationCount(), 2u);
+
+	postEvents(attachment, {"hub_event_1", "hub_event_299"});
+
+	BOOST_CHECK(manyCollector.waitFor("hub_event_1", 1u));
+	BOOST_CHECK(manyCollector.waitFor("hub_event_299", 1u));
+	BOOST_CHECK(singleCollector.waitFor("hub_event_1", 1u));
+
+	hub.unsubscribe(manyId);
+	BOOST_CHECK_EQUAL(hub.getSubscriptionCount(), 1u);
+	BOOST_CHECK_EQUAL(hub.getRegistrationCount(), 1u);
+
+	postEvents(attachment, {"hub_event_1", "hub_event_2"});
+
+	BOOST_CHECK(singleCollector.waitFor("hub_event_1", 2u));
+	BOOST_CHECK_EQUAL(manyCollector.get("hub_event_2"), 0u);
+
+	BOOST_CHECK_THROW(hub.subscribe(attachment, {}, singleCollector.callback()), std::invalid_argument);
+
+	hub.stop();
+	BOOST_CHECK_EQUAL(hub.getSubscriptionCount(), 0u);
+	BOOST_CHECK_THROW(hub.subscribe(attachment, {"hub_event_1"}, singleCollector.callback()), FbCppException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
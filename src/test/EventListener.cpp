@@ -23,12 +23,15 @@
 
 #include "TestUtil.h"
 #include "fb-cpp/EventListener.h"
+#include "fb-cpp/SpscRing.h"
 #include "fb-cpp/Statement.h"
 #include "fb-cpp/Transaction.h"
 #include <boost/test/unit_test.hpp>
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <mutex>
+#include <span>
 #include <vector>
 
 
@@ -202,4 +205,86 @@ BOOST_AUTO_TEST_CASE(stopsReceivingEventsAfterStop)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(spscRingWrapsAtCapacity)
+{
+	impl::SpscRing<int> ring{3u};
+	BOOST_CHECK_EQUAL(ring.getCapacity(), 4u);
+
+	for (int i = 0; i < 4; ++i)
+		BOOST_CHECK(ring.tryPush(i));
+
+	BOOST_CHECK(!ring.tryPush(4));
+
+	int value = -1;
+	BOOST_CHECK(ring.tryPop(value));
+	BOOST_CHECK_EQUAL(value, 0);
+	BOOST_CHECK(ring.tryPush(4));
+
+	for (int i = 1; i <= 4; ++i)
+	{
+		BOOST_CHECK(ring.tryPop(value));
+		BOOST_CHECK_EQUAL(value, i);
+	}
+
+	BOOST_CHECK(!ring.tryPop(value));
+}
+
+BOOST_AUTO_TEST_CASE(lockFreeModeDeliversIndexedCounts)
+{
+	const auto database = getTempFile("EventListener-lockFreeModeDeliversIndexedCounts.fdb");
+	Attachment attachment{CLIENT, database,
+		AttachmentOptions().setCreateDatabase(true).setForcedWrites(false).setConnectionCharSet("UTF8")};
+	FbDropDatabase attachmentDrop{attachment};
+
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::vector<std::uint32_t> totals(3u);
+
+	const auto listenerCallback = [&](std::span<const std::uint32_t> counts)
+	{
+		std::lock_guard mutexGuard{mutex};
+
+		for (std::size_t i = 0; i < counts.size(); ++i)
+			totals[i] += counts[i];
+
+		condition.notify_all();
+	};
+
+	// A two-entry ring forces the overflow counters to be used.
+	EventListener listener{attachment, {"lf_a", "lf_b", "lf_c"}, listenerCallback, 2u};
+
+	BOOST_CHECK(listener.isListening());
+	BOOST_CHECK_EQUAL(listener.getEventNames()[1], "lf_b");
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement statement{attachment, transaction, R"""(
+			execute block
+			as
+			begin
+			    post_event 'lf_a';
+			    post_event 'lf_c';
+			    post_event 'lf_c';
+			    post_event 'lf_b';
+			end
+		)"""};
+		BOOST_CHECK(statement.execute(transaction));
+		transaction.commit();
+	}
+
+	{  // scope
+		std::unique_lock mutexGuard{mutex};
+		BOOST_REQUIRE(condition.wait_for(
+			mutexGuard, 5s, [&] { return totals[0] >= 1u && totals[1] >= 1u && totals[2] >= 2u; }));
+	}
+
+	listener.stop();
+	BOOST_CHECK(!listener.isListening());
+
+	std::lock_guard mutexGuard{mutex};
+	BOOST_CHECK_EQUAL(totals[0], 1u);
+	BOOST_CHECK_EQUAL(totals[1], 1u);
+	BOOST_CHECK_EQUAL(totals[2], 2u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -26,6 +26,7 @@
 #include "fb-cpp/Exception.h"
 #include "fb-cpp/Statement.h"
 #include "fb-cpp/Transaction.h"
+#include <cstdint>
 #include <string>
 
 
@@ -60,6 +61,13 @@ BOOST_AUTO_TEST_CASE(syntaxErrorExceptionProperties)
 		// getErrorCode() should return the first GDS code
 		BOOST_CHECK_NE(ex.getErrorCode(), 0);
 		BOOST_CHECK_EQUAL(ex.getErrorCode(), errors[1]);
+		BOOST_CHECK(ex.hasErrorCode(ex.getErrorCode()));
+		BOOST_CHECK(!ex.hasErrorCode(0));
+
+		// Copies share the lazily formatted message
+		const DatabaseException copy{ex};
+		BOOST_CHECK(copy.what() == ex.what());
+		BOOST_CHECK(copy.getErrors() == errors);
 
 		// SQL state, when present, should be a 5-character string
 		if (!ex.getSqlState().empty())
@@ -67,4 +75,35 @@ BOOST_AUTO_TEST_CASE(syntaxErrorExceptionProperties)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(pooledStatusIsReused)
+{
+	const std::intptr_t errors[] = {
+		isc_arg_gds, isc_random, isc_arg_cstring, 3, reinterpret_cast<std::intptr_t>("abcdef"), isc_arg_end};
+
+	fb::IStatus* firstStatus;
+
+	{  // scope
+		const auto status = CLIENT.newStatus();
+		firstStatus = status.get();
+
+		status->setErrors(errors);
+		BOOST_CHECK(status->getState() & fb::IStatus::STATE_ERRORS);
+
+		const auto copied = status->getErrors();
+		BOOST_CHECK_EQUAL(copied[0], isc_arg_gds);
+		BOOST_CHECK_EQUAL(copied[1], isc_random);
+		BOOST_CHECK_EQUAL(copied[2], isc_arg_string);
+		BOOST_CHECK_EQUAL(std::string{reinterpret_cast<const char*>(copied[3])}, "abc");
+		BOOST_CHECK_EQUAL(copied[4], isc_arg_end);
+
+		const DatabaseException exception{CLIENT, copied};
+		BOOST_CHECK(exception.hasErrorCode(isc_random));
+		BOOST_CHECK(!std::string{exception.what()}.empty());
+	}
+
+	const auto status = CLIENT.newStatus();
+	BOOST_CHECK(status.get() == firstStatus);
+	BOOST_CHECK_EQUAL(status->getState(), 0u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
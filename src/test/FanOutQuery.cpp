@@ -0,0 +1,171 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/FanOutQuery.h"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+BOOST_AUTO_TEST_SUITE(FanOutQuerySuite)
+
+BOOST_AUTO_TEST_CASE(invalidOptions)
+{
+	AttachmentPool pool{CLIENT};
+
+	BOOST_CHECK_THROW(FanOutQuery(pool, {}, {}, "select 1 from rdb$database"), std::invalid_argument);
+	BOOST_CHECK_THROW(FanOutQuery(pool, {"unused.fdb"}, {}, "select 1 from rdb$database",
+						  FanOutQueryOptions().setWindowSize(0u)),
+		std::invalid_argument);
+	BOOST_CHECK_THROW(FanOutQuery(pool, {"unused.fdb"}, {}, "select 1 from rdb$database",
+						  FanOutQueryOptions().setWindowCount(0u)),
+		std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(concatenateAndMergeShards)
+{
+	constexpr unsigned SHARDS = 3;
+	constexpr int ROWS = 300;
+
+	const auto createShard = [](unsigned shard)
+	{
+		const auto database = getTempFile("FanOutQuery-concatenateAndMergeShards-" + std::to_string(shard) + ".fdb");
+		return Attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	};
+
+	Attachment attachment0 = createShard(0);
+	FbDropDatabase attachment0Drop{attachment0};
+	Attachment attachment1 = createShard(1);
+	FbDropDatabase attachment1Drop{attachment1};
+	Attachment attachment2 = createShard(2);
+	FbDropDatabase attachment2Drop{attachment2};
+
+	std::vector<std::reference_wrapper<Attachment>> shards{attachment0, attachment1, attachment2};
+
+	for (unsigned shard = 0; shard < SHARDS; ++shard)
+	{
+		auto& attachment = shards[shard].get();
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction, "recreate table fan_out_test (id integer not null, name varchar(20))"};
+		ddl.execute(transaction);
+		transaction.commitRetaining();
+
+		// Shard k holds the ids congruent to k modulo the number of shards.
+		Statement insert{attachment, transaction, "insert into fan_out_test (id, name) values (?, ?)"};
+
+		for (int id = static_cast<int>(shard); id < ROWS; id += SHARDS)
+		{
+			insert.setInt32(0, id);
+			insert.setString(1, "name" + std::to_string(id));
+			insert.execute(transaction);
+		}
+
+		transaction.commit();
+	}
+
+	const auto options = FanOutQueryOptions().setWindowSize(7u).setWindowCount(2u);
+
+	{  // scope
+		FanOutQuery query{shards, "select id, name from fan_out_test where id < ?", options,
+			[](Statement& statement, unsigned) { statement.setInt32(0, 150); }};
+
+		std::vector<unsigned> shardRows(SHARDS);
+		std::int64_t sum = 0;
+
+		query.concatenate(
+			[&](unsigned shard, RowSet& window)
+			{
+				for (auto row : window)
+				{
+					const auto id = row.getInt32(0).value();
+					BOOST_CHECK_EQUAL(id % static_cast<int>(SHARDS), static_cast<int>(shard));
+					BOOST_CHECK_EQUAL(row.getString(1).value(), "name" + std::to_string(id));
+					sum += id;
+					++shardRows[shard];
+				}
+			});
+
+		BOOST_CHECK_EQUAL(sum, 149 * 150 / 2);
+		BOOST_CHECK_EQUAL(shardRows[0] + shardRows[1] + shardRows[2], 150u);
+		BOOST_CHECK_EQUAL(shardRows[0], 50u);
+	}
+
+	{  // scope
+		FanOutQuery query{shards, "select id, name from fan_out_test order by id", options};
+
+		std::vector<int> ids;
+		query.merge(0, [&](unsigned, const Row& row) { ids.push_back(row.getInt32(0).value()); });
+
+		BOOST_REQUIRE_EQUAL(ids.size(), static_cast<std::size_t>(ROWS));
+
+		for (int i = 0; i < ROWS; ++i)
+			BOOST_CHECK_EQUAL(ids[i], i);
+
+		BOOST_CHECK_THROW(query.merge(2, [](unsigned, const Row&) {}), std::out_of_range);
+	}
+
+	{  // scope
+		FanOutQuery query{shards, "select name from fan_out_test order by name desc",
+			FanOutQueryOptions(options).setDescending(true)};
+
+		std::vector<std::string> names;
+		query.merge(0, [&](unsigned, const Row& row) { names.push_back(row.getString(0).value()); });
+
+		BOOST_REQUIRE_EQUAL(names.size(), static_cast<std::size_t>(ROWS));
+		BOOST_CHECK(std::is_sorted(names.rbegin(), names.rend()));
+	}
+
+	for (unsigned shard = 0; shard < SHARDS; ++shard)
+	{
+		auto& attachment = shards[shard].get();
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction,
+			shard == 2 ? "recreate table fan_out_kind (v varchar(10))" : "recreate table fan_out_kind (v integer)"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	{  // scope
+		FanOutQuery query{shards, "select v from fan_out_kind", options};
+		BOOST_CHECK_THROW(query.concatenate([](unsigned, RowSet&) {}), FbCppException);
+	}
+
+	{  // scope
+		FanOutQuery query{shards, "select id from fan_out_test", options,
+			[](Statement&, unsigned shard)
+			{
+				if (shard == 1)
+					throw std::runtime_error("shard failure");
+			}};
+
+		BOOST_CHECK_THROW(query.concatenate([](unsigned, RowSet&) {}), std::runtime_error);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,79 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "fb-cpp/Metrics.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <thread>
+
+
+BOOST_AUTO_TEST_SUITE(MetricsSuite)
+
+BOOST_AUTO_TEST_CASE(snapshotCountsClientCalls)
+{
+	const auto database = getTempFile("Metrics-snapshotCountsClientCalls.fdb");
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	const auto before = CLIENT.metricsSnapshot();
+	BOOST_CHECK_EQUAL(before.enabled, FB_CPP_ENABLE_METRICS != 0);
+
+	const auto runQuery = [&]
+	{
+		Transaction transaction{attachment};
+		Statement statement{attachment, transaction, "select rdb$relation_id from rdb$relations"};
+
+		for (bool fetched = statement.execute(transaction); fetched; fetched = statement.fetchNext())
+			;
+
+		transaction.commit();
+	};
+
+	runQuery();
+	std::thread{runQuery}.join();
+
+	const auto after = CLIENT.metricsSnapshot();
+	const auto delta = [&](MetricsCall call) { return after.get(call).calls - before.get(call).calls; };
+
+	if (!after.enabled)
+	{
+		BOOST_CHECK_EQUAL(after.threads, 0u);
+		BOOST_CHECK_EQUAL(after.getTotal().calls, 0u);
+		return;
+	}
+
+	BOOST_CHECK(after.threads >= before.threads + 1u);
+	BOOST_CHECK_EQUAL(delta(MetricsCall::START_TRANSACTION), 2u);
+	BOOST_CHECK_EQUAL(delta(MetricsCall::PREPARE), 2u);
+	BOOST_CHECK_EQUAL(delta(MetricsCall::OPEN_CURSOR), 2u);
+	BOOST_CHECK_EQUAL(delta(MetricsCall::COMMIT), 2u);
+	BOOST_CHECK(delta(MetricsCall::FETCH) > 2u);
+	BOOST_CHECK_EQUAL(delta(MetricsCall::EXECUTE), 0u);
+	BOOST_CHECK(after.get(MetricsCall::FETCH).time > before.get(MetricsCall::FETCH).time);
+	BOOST_CHECK(after.get(MetricsCall::FETCH).getAverageTime().count() > 0);
+	BOOST_CHECK(after.getTotal().calls > before.getTotal().calls);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,144 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "fb-cpp/Exception.h"
+#include "fb-cpp/NativeNumeric.h"
+#include "fb-cpp/types.h"
+#include <cstdint>
+#include <limits>
+#include <string>
+
+
+BOOST_AUTO_TEST_SUITE(NativeNumericSuite)
+
+BOOST_AUTO_TEST_CASE(int128MatchesClientUtil)
+{
+	impl::StatusWrapper statusWrapper{CLIENT};
+	const auto int128Util = CLIENT.getInt128Util(&statusWrapper);
+
+	const auto toClientString = [&](const OpaqueInt128& value, int scale)
+	{
+		char buffer[fb::IInt128::STRING_SIZE + 1];
+		int128Util->toString(&statusWrapper, &value, scale, static_cast<unsigned>(sizeof(buffer)), buffer);
+		return std::string{buffer};
+	};
+
+	for (const auto* text : {"0", "1", "-1", "123.45", "-0.05", "99999999999999999999999999999999.999999",
+			 "170141183460469231731687303715884105727", "-170141183460469231731687303715884105728"})
+	{
+		const int scale = std::string{text}.find('.') == std::string::npos ? 0 : -6;
+
+		OpaqueInt128 expected;
+		int128Util->fromString(&statusWrapper, scale, text, &expected);
+
+		const auto actual = impl::stringToInt128(text, scale);
+		BOOST_REQUIRE(actual.has_value());
+		BOOST_CHECK_EQUAL(actual->fb_data[0], expected.fb_data[0]);
+		BOOST_CHECK_EQUAL(actual->fb_data[1], expected.fb_data[1]);
+
+		for (const int printScale : {0, -2, -6})
+			BOOST_CHECK_EQUAL(impl::int128ToString(expected, printScale), toClientString(expected, printScale));
+	}
+
+	// Values that need rounding or do not fit are left to fbclient.
+	BOOST_CHECK(!impl::stringToInt128("1.234", -2).has_value());
+	BOOST_CHECK(!impl::stringToInt128("170141183460469231731687303715884105728", 0).has_value());
+	BOOST_CHECK(!impl::stringToInt128("1e5", 0).has_value());
+
+	const auto value = impl::stringToInt128("-12.345", -3).value();
+	BOOST_CHECK_EQUAL(impl::int128ToInt64(value, -3, -2).value(), -1'235);
+	BOOST_CHECK_EQUAL(impl::int128ToInt64(value, -3, 0).value(), -12);
+	BOOST_CHECK_EQUAL(impl::int128ToInt64(value, -3, -5).value(), -1'234'500);
+	BOOST_CHECK_CLOSE(impl::int128ToDouble(value, -3), -12.345, 0.000001);
+
+	BOOST_CHECK(!impl::int128ToInt64(impl::stringToInt128("9223372036854775808", 0).value(), 0, 0).has_value());
+	BOOST_CHECK_EQUAL(impl::int128ToInt64(impl::stringToInt128("-9223372036854775808", 0).value(), 0, 0).value(),
+		std::numeric_limits<std::int64_t>::min());
+
+	BOOST_CHECK_EQUAL(impl::int128ToString(impl::int64ToInt128(ScaledInt64{15, -1}, -4).value(), -4), "1.5000");
+	BOOST_CHECK(!impl::int64ToInt128(ScaledInt64{2, 0}, -38).has_value());
+
+	// Beyond the int64 range, but within INT128.
+	BOOST_CHECK_EQUAL(impl::int128ToString(impl::doubleToInt128(1e20, 0).value(), 0), "100000000000000000000");
+	BOOST_CHECK_EQUAL(impl::int128ToString(impl::doubleToInt128(-1e20, -2).value(), -2), "-100000000000000000000.00");
+	BOOST_CHECK_EQUAL(impl::int128ToString(impl::doubleToInt128(-1.25, -1).value(), -1), "-1.3");
+	BOOST_CHECK(!impl::doubleToInt128(1e39, 0).has_value());
+	BOOST_CHECK(!impl::doubleToInt128(std::numeric_limits<double>::infinity(), 0).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(decFloatMatchesClientUtil)
+{
+	impl::StatusWrapper statusWrapper{CLIENT};
+	const auto decFloat16Util = CLIENT.getDecFloat16Util(&statusWrapper);
+	const auto decFloat34Util = CLIENT.getDecFloat34Util(&statusWrapper);
+
+	for (const auto* text : {"0", "-0", "1", "-1.5", "0.00", "123.456", "1E+10", "1.23E-9", "0.000001", "0E-7",
+			 "-0.0000123", "9999999999999999E369", "1E-398", "1234567890.123456"})
+	{
+		OpaqueDecFloat16 expected;
+		decFloat16Util->fromString(&statusWrapper, text, &expected);
+
+		const auto actual = impl::stringToDecFloat16(text);
+		BOOST_REQUIRE(actual.has_value());
+		BOOST_CHECK_EQUAL(actual->fb_data[0], expected.fb_data[0]);
+
+		char buffer[fb::IDecFloat16::STRING_SIZE + 1];
+		decFloat16Util->toString(&statusWrapper, &expected, static_cast<unsigned>(sizeof(buffer)), buffer);
+		BOOST_CHECK_EQUAL(impl::decFloat16ToString(expected), std::string{buffer});
+	}
+
+	for (const auto* text : {"0", "1", "-1.5", "123456789012345678901234567890.1234", "1E+6111", "-1E-6176",
+			 "0.000000012345", "42E-3"})
+	{
+		OpaqueDecFloat34 expected;
+		decFloat34Util->fromString(&statusWrapper, text, &expected);
+
+		const auto actual = impl::stringToDecFloat34(text);
+		BOOST_REQUIRE(actual.has_value());
+		BOOST_CHECK_EQUAL(actual->fb_data[0], expected.fb_data[0]);
+		BOOST_CHECK_EQUAL(actual->fb_data[1], expected.fb_data[1]);
+
+		char buffer[fb::IDecFloat34::STRING_SIZE + 1];
+		decFloat34Util->toString(&statusWrapper, &expected, static_cast<unsigned>(sizeof(buffer)), buffer);
+		BOOST_CHECK_EQUAL(impl::decFloat34ToString(expected), std::string{buffer});
+	}
+
+	// Special values and values that need rounding are decoded natively but encoded by fbclient.
+	OpaqueDecFloat16 infinity;
+	decFloat16Util->fromString(&statusWrapper, "-Infinity", &infinity);
+	BOOST_CHECK_EQUAL(impl::decFloat16ToString(infinity), "-Infinity");
+	BOOST_CHECK_EQUAL(impl::decFloat16ToDouble(infinity), -std::numeric_limits<double>::infinity());
+	BOOST_CHECK(!impl::stringToDecFloat16("-Infinity").has_value());
+	BOOST_CHECK(!impl::stringToDecFloat16("12345678901234567").has_value());
+	BOOST_CHECK(!impl::stringToDecFloat16("1E+400").has_value());
+
+	const auto value = impl::stringToDecFloat34("-123.456").value();
+	BOOST_CHECK_EQUAL(impl::decFloat34ToDouble(value), -123.456);
+	BOOST_CHECK_EQUAL(impl::decFloat34ToInt64(value, -2).value(), -12'346);
+	BOOST_CHECK_EQUAL(impl::decFloat34ToInt64(value, 0).value(), -123);
+	BOOST_CHECK(!impl::decFloat16ToInt64(infinity, 0).has_value());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
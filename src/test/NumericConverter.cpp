@@ -28,6 +28,8 @@
 #include "fb-cpp/Exception.h"
 #include <limits>
 #include <cstdint>
+#include <string>
+#include <string_view>
 
 static constexpr float floatTolerance = 0.00001f;
 static constexpr double doubleTolerance = 0.00000000000001;
@@ -847,4 +849,63 @@ BOOST_AUTO_TEST_CASE(decFloat34NumberLimits)
 
 #endif
 
+BOOST_AUTO_TEST_CASE(exactScalingAndStringConversions)
+{
+	impl::NumericConverter converter{CLIENT};
+
+	BOOST_CHECK_EQUAL(converter.numberToNumber<std::int64_t>(ScaledInt64{1, 0}, -18), 1'000'000'000'000'000'000LL);
+	BOOST_CHECK_THROW(converter.numberToNumber<std::int64_t>(ScaledInt64{1, 0}, -19), FbCppException);
+	BOOST_CHECK_EQUAL(converter.numberToNumber<std::int64_t>(ScaledInt64{0, 0}, -30), 0);
+	BOOST_CHECK_EQUAL(converter.numberToNumber<std::int64_t>(ScaledInt64{922'337'203'685'477'580'7LL, -1}, 0),
+		922'337'203'685'477'581LL);
+	BOOST_CHECK_EQUAL(converter.numberToNumber<std::int64_t>(ScaledInt64{6'000'000'000'000'000'000LL, -19}, 0), 1);
+	BOOST_CHECK_EQUAL(converter.numberToNumber<std::int64_t>(ScaledInt64{-6'000'000'000'000'000'000LL, -19}, 0), -1);
+	BOOST_CHECK_EQUAL(converter.numberToNumber<std::int64_t>(ScaledInt64{4'999'999'999'999'999'999LL, -19}, 0), 0);
+	BOOST_CHECK_EQUAL(converter.numberToNumber<std::int64_t>(ScaledInt64{123, -1}, 5), 0);
+
+	// Large scaled values keep their integral part exact when converted to double.
+	BOOST_CHECK_EQUAL(converter.numberToNumber<double>(ScaledInt64{4'225'453'175'133'970'594LL, -6}),
+		std::stod("4225453175133.970594"));
+
+	BOOST_CHECK_EQUAL(converter.numberToString(ScaledInt64{5, -3}), "0.005");
+	BOOST_CHECK_EQUAL(converter.numberToString(ScaledInt64{-5, -1}), "-0.5");
+	BOOST_CHECK_EQUAL(converter.numberToString(ScaledInt32{12, 2}), "1200");
+	BOOST_CHECK_EQUAL(converter.numberToString(ScaledInt16{0, -2}), "0.00");
+
+	// Floating-point values use the shortest representation that round-trips.
+	BOOST_CHECK_EQUAL(converter.numberToString(0.1), "0.1");
+	BOOST_CHECK_EQUAL(std::stod(converter.numberToString(1.0 / 3.0)), 1.0 / 3.0);
+	BOOST_CHECK_EQUAL(std::stof(converter.numberToString(3.14f)), 3.14f);
+
+	const auto checkScaledInt64 = [&](std::string_view str, std::int64_t value, int scale)
+	{
+		const auto result = converter.stringToScaledInt64(str);
+		BOOST_CHECK_EQUAL(result.value, value);
+		BOOST_CHECK_EQUAL(result.scale, scale);
+	};
+
+	checkScaledInt64("12345.6789", 123'456'789, -4);
+	checkScaledInt64("-12.50", -1'250, -2);
+	checkScaledInt64("-.5", -5, -1);
+	checkScaledInt64("7.", 7, 0);
+	checkScaledInt64("9223372036854775807", std::numeric_limits<std::int64_t>::max(), 0);
+	checkScaledInt64("-922337203685477.5808", std::numeric_limits<std::int64_t>::min(), -4);
+	checkScaledInt64("-0.9223372036854775808", std::numeric_limits<std::int64_t>::min(), -19);
+
+	// Fractional digits that do not fit are rounded away instead of rejected.
+	checkScaledInt64("0.00000000000000000001", 0, -19);
+	checkScaledInt64("1.50000000000000000000", 1'500'000'000'000'000'000, -18);
+	checkScaledInt64("922337203685477.5808", 922'337'203'685'477'581, -3);
+	checkScaledInt64("0.9999999999999999999", 1'000'000'000'000'000'000, -18);
+	checkScaledInt64("-9223372036854775807.5", std::numeric_limits<std::int64_t>::min(), 0);
+
+	BOOST_CHECK_THROW(converter.stringToScaledInt64(""), FbCppException);
+	BOOST_CHECK_THROW(converter.stringToScaledInt64("-"), FbCppException);
+	BOOST_CHECK_THROW(converter.stringToScaledInt64("1.2.3"), FbCppException);
+	BOOST_CHECK_THROW(converter.stringToScaledInt64("1e5"), FbCppException);
+	BOOST_CHECK_THROW(converter.stringToScaledInt64("9223372036854775808"), FbCppException);
+	BOOST_CHECK_THROW(converter.stringToScaledInt64("9223372036854775807.5"), FbCppException);
+	BOOST_CHECK_THROW(converter.stringToScaledInt64("1.x"), FbCppException);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,207 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/Attachment.h"
+#include "fb-cpp/Batch.h"
+#include "fb-cpp/Blob.h"
+#include "fb-cpp/Exception.h"
+#include "fb-cpp/Observer.h"
+#include "fb-cpp/RowSet.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+BOOST_AUTO_TEST_SUITE(ObserverSuite)
+
+namespace
+{
+	class RecordingObserver final : public OperationObserver
+	{
+	public:
+		struct Record
+		{
+			OperationType type;
+			std::string sql;
+			std::uint64_t rows;
+			std::uint64_t bytes;
+			bool failed;
+		};
+
+	public:
+		void onOperation(const OperationEvent& event) override
+		{
+			BOOST_CHECK(event.duration.count() >= 0);
+
+			std::lock_guard mutexGuard{mutex};
+			records.push_back(Record{
+				.type = event.type,
+				.sql = std::string{event.sql},
+				.rows = event.rows,
+				.bytes = event.bytes,
+				.failed = event.error != nullptr,
+			});
+		}
+
+		std::vector<Record> take()
+		{
+			std::lock_guard mutexGuard{mutex};
+			return std::exchange(records, {});
+		}
+
+	private:
+		std::mutex mutex;
+		std::vector<Record> records;
+	};
+
+	std::size_t countOf(const std::vector<RecordingObserver::Record>& records, OperationType type)
+	{
+		return static_cast<std::size_t>(std::count_if(
+			records.begin(), records.end(), [type](const auto& record) { return record.type == type; }));
+	}
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(reportsOperations)
+{
+	const auto database = getTempFile("Observer-reportsOperations.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction, "recreate table observer_test (id integer, data blob)"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	const auto observer = std::make_shared<RecordingObserver>();
+	attachment.setObserver(observer);
+	BOOST_CHECK(attachment.getObserver() == observer);
+	BOOST_CHECK(!CLIENT.getObserver());
+
+	const std::string insertSql = "insert into observer_test (id, data) values (?, ?)";
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement insert{attachment, transaction, insertSql};
+
+		Blob blob{attachment, transaction, BlobOptions().setType(BlobType::STREAM)};
+		const std::string text = "observed blob";
+		blob.write(std::as_bytes(std::span{text}));
+		blob.close();
+
+		insert.setInt32(0, 1);
+		insert.setBlobId(1, blob.getId());
+		insert.execute(transaction);
+
+		Batch batch{insert, transaction};
+
+		for (int i = 2; i <= 4; ++i)
+		{
+			insert.setInt32(0, i);
+			insert.setNull(1);
+			batch.addMessage();
+		}
+
+		batch.execute();
+		transaction.commit();
+	}
+
+	auto records = observer->take();
+	BOOST_CHECK_EQUAL(countOf(records, OperationType::PREPARE), 1u);
+	BOOST_CHECK_EQUAL(countOf(records, OperationType::BLOB_WRITE), 1u);
+	BOOST_CHECK_EQUAL(countOf(records, OperationType::EXECUTE), 1u);
+	BOOST_CHECK_EQUAL(countOf(records, OperationType::BATCH_EXECUTE), 1u);
+	BOOST_CHECK_EQUAL(countOf(records, OperationType::COMMIT), 1u);
+
+	for (const auto& record : records)
+	{
+		BOOST_CHECK(!record.failed);
+
+		if (record.type == OperationType::BLOB_WRITE)
+			BOOST_CHECK_EQUAL(record.bytes, 13u);
+		else if (record.type == OperationType::BATCH_EXECUTE)
+		{
+			BOOST_CHECK_EQUAL(record.rows, 3u);
+			BOOST_CHECK_EQUAL(record.sql, insertSql);
+		}
+		else if (record.type == OperationType::PREPARE || record.type == OperationType::EXECUTE)
+			BOOST_CHECK_EQUAL(record.sql, insertSql);
+	}
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement select{attachment, transaction, "select id from observer_test order by id"};
+
+		BOOST_REQUIRE(select.execute(transaction));
+		BOOST_CHECK(select.fetchNext());
+
+		RowSet rowSet{select, 10u};
+		BOOST_CHECK_EQUAL(rowSet.getCount(), 2u);
+
+		BOOST_CHECK_THROW(Statement(attachment, transaction, "select * from missing_table"), DatabaseException);
+
+		transaction.rollback();
+	}
+
+	records = observer->take();
+	BOOST_CHECK_EQUAL(countOf(records, OperationType::PREPARE), 2u);
+	BOOST_CHECK_EQUAL(countOf(records, OperationType::FETCH), 1u);
+	BOOST_CHECK_EQUAL(countOf(records, OperationType::ROW_SET_FETCH), 1u);
+	BOOST_CHECK_EQUAL(countOf(records, OperationType::ROLLBACK), 1u);
+
+	const auto rowSetRecord = std::find_if(records.begin(), records.end(),
+		[](const auto& record) { return record.type == OperationType::ROW_SET_FETCH; });
+	BOOST_REQUIRE(rowSetRecord != records.end());
+	BOOST_CHECK_EQUAL(rowSetRecord->rows, 2u);
+	BOOST_CHECK_GT(rowSetRecord->bytes, 0u);
+
+	const auto failedRecord =
+		std::find_if(records.begin(), records.end(), [](const auto& record) { return record.failed; });
+	BOOST_REQUIRE(failedRecord != records.end());
+	BOOST_CHECK(failedRecord->type == OperationType::PREPARE);
+	BOOST_CHECK_EQUAL(failedRecord->sql, "select * from missing_table");
+
+	// Objects created without an observer are not affected by a later registration.
+	attachment.setObserver(nullptr);
+
+	{  // scope
+		Transaction transaction{attachment};
+		attachment.setObserver(observer);
+		transaction.commit();
+	}
+
+	BOOST_CHECK(observer->take().empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
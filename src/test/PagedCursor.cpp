@@ -0,0 +1,155 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "fb-cpp/PagedCursor.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <stdexcept>
+
+
+BOOST_AUTO_TEST_SUITE(PagedCursorSuite)
+
+BOOST_AUTO_TEST_CASE(answersPositioningFromCachedPages)
+{
+	const auto database = getTempFile("PagedCursor-answersPositioningFromCachedPages.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement ddl{attachment, transaction, "create table t (col integer)"};
+	ddl.execute(transaction);
+	transaction.commitRetaining();
+
+	Statement insert{attachment, transaction, "insert into t (col) values (?)"};
+
+	for (int i = 1; i <= 100; ++i)
+	{
+		insert.setInt32(0, i);
+		insert.execute(transaction);
+	}
+
+	Statement forwardOnly{attachment, transaction, "select col from t order by col"};
+	forwardOnly.execute(transaction);
+	BOOST_CHECK_THROW(PagedCursor(forwardOnly, 10), std::invalid_argument);
+
+	const auto scrollable = StatementOptions().setCursorType(CursorType::SCROLLABLE);
+
+	{  // scope
+		Statement select{attachment, transaction, "select col from t order by col", scrollable};
+		select.execute(transaction);
+
+		BOOST_CHECK_THROW(PagedCursor(select, 0), std::invalid_argument);
+		BOOST_CHECK_THROW(PagedCursor(select, 10, 1, 1), std::invalid_argument);
+
+		PagedCursor cursor{select, 10, 3, 1};
+		BOOST_CHECK_EQUAL(cursor.getPosition(), 0u);
+		BOOST_CHECK(!cursor.hasRow());
+		BOOST_CHECK(!cursor.fetchPrior());
+
+		// Page 0, prefetching page 1.
+		BOOST_REQUIRE(cursor.fetchNext());
+		BOOST_CHECK_EQUAL(cursor.getRow().getInt32(0).value(), 1);
+		BOOST_CHECK_EQUAL(cursor.getPageLoadCount(), 2u);
+
+		// Page 1 is cached; page 2 is prefetched.
+		BOOST_REQUIRE(cursor.fetchAbsolute(15));
+		BOOST_CHECK_EQUAL(cursor.getRow().getInt32(0).value(), 15);
+		BOOST_CHECK_EQUAL(cursor.getPageLoadCount(), 3u);
+
+		BOOST_REQUIRE(cursor.fetchRelative(-3));
+		BOOST_CHECK_EQUAL(cursor.getRow().getInt32(0).value(), 12);
+		BOOST_CHECK_EQUAL(cursor.getPageLoadCount(), 3u);
+		BOOST_CHECK(!cursor.getRowCount().has_value());
+
+		// Page 9, then the empty page 10 reveals the row count.
+		BOOST_REQUIRE(cursor.fetchAbsolute(95));
+		BOOST_CHECK_EQUAL(cursor.getRow().getInt32(0).value(), 95);
+		BOOST_CHECK_EQUAL(cursor.getPageLoadCount(), 5u);
+		BOOST_CHECK_EQUAL(cursor.getRowCount().value_or(0), 100u);
+
+		for (int i = 96; i <= 100; ++i)
+		{
+			BOOST_REQUIRE(cursor.fetchNext());
+			BOOST_CHECK_EQUAL(cursor.getRow().getInt32(0).value(), i);
+		}
+
+		BOOST_CHECK(!cursor.fetchNext());
+		BOOST_CHECK(!cursor.hasRow());
+		BOOST_CHECK_EQUAL(cursor.getPosition(), 101u);
+
+		// Scrolling backward prefetches page 8.
+		BOOST_REQUIRE(cursor.fetchPrior());
+		BOOST_CHECK_EQUAL(cursor.getRow().getInt32(0).value(), 100);
+		BOOST_CHECK_EQUAL(cursor.getPageLoadCount(), 6u);
+
+		BOOST_REQUIRE(cursor.fetchLast());
+		BOOST_CHECK_EQUAL(cursor.getRow().getInt32(0).value(), 100);
+		BOOST_CHECK_EQUAL(cursor.getPageLoadCount(), 6u);
+
+		// Page 1 is cached; page 0 was evicted and is loaded again by the backward prefetch.
+		BOOST_REQUIRE(cursor.fetchAbsolute(12));
+		BOOST_CHECK_EQUAL(cursor.getRow().getInt32(0).value(), 12);
+		BOOST_CHECK_EQUAL(cursor.getPageLoadCount(), 7u);
+
+		BOOST_CHECK(!cursor.fetchRelative(-12));
+		BOOST_CHECK_EQUAL(cursor.getPosition(), 0u);
+
+		BOOST_REQUIRE(cursor.fetchNext());
+		BOOST_CHECK_EQUAL(cursor.getRow().getInt32(0).value(), 1);
+		BOOST_CHECK_EQUAL(cursor.getPageLoadCount(), 7u);
+	}
+
+	{  // scope
+		Statement select{attachment, transaction, "select col from t order by col", scrollable};
+		select.execute(transaction);
+
+		PagedCursor cursor{select, 7, 4, 2};
+
+		BOOST_REQUIRE(cursor.fetchLast());
+		BOOST_CHECK_EQUAL(cursor.getRow().getInt32(0).value(), 100);
+		BOOST_CHECK_EQUAL(cursor.getRowCount().value_or(0), 100u);
+		BOOST_CHECK_EQUAL(cursor.getPosition(), 100u);
+
+		BOOST_REQUIRE(cursor.fetchRelative(-10));
+		BOOST_CHECK_EQUAL(cursor.getRow().getInt32(0).value(), 90);
+
+		BOOST_REQUIRE(cursor.fetchFirst());
+		BOOST_CHECK_EQUAL(cursor.getRow().getInt32(0).value(), 1);
+	}
+
+	{  // scope
+		Statement select{attachment, transaction, "select col from t where col < 0", scrollable};
+		select.execute(transaction);
+
+		PagedCursor cursor{select, 10};
+		BOOST_CHECK(!cursor.fetchLast());
+		BOOST_CHECK(!cursor.fetchFirst());
+		BOOST_CHECK_EQUAL(cursor.getRowCount().value_or(1), 0u);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
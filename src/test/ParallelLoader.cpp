@@ -0,0 +1,152 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/ParallelLoader.h"
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+
+BOOST_AUTO_TEST_SUITE(ParallelLoaderSuite)
+
+BOOST_AUTO_TEST_CASE(invalidOptions)
+{
+	AttachmentPool pool{CLIENT};
+
+	BOOST_CHECK_THROW(ParallelLoader(pool, "unused.fdb", {}, "insert into t values (?)",
+						  ParallelLoaderOptions().setWorkerCount(0u)),
+		std::invalid_argument);
+	BOOST_CHECK_THROW(ParallelLoader(pool, "unused.fdb", {}, "insert into t values (?)",
+						  ParallelLoaderOptions().setBatchSize(0u)),
+		std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(loadSpanAcrossWorkers)
+{
+	struct Record
+	{
+		std::int32_t id;
+	};
+
+	const auto database = getTempFile("ParallelLoader-loadSpanAcrossWorkers.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction, "recreate table load_test (id integer not null primary key)"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	std::vector<Record> records;
+
+	for (int i = 0; i < 1000; ++i)
+		records.push_back({i});
+
+	// Duplicate a key so the server reports one failed row.
+	records[500].id = 10;
+
+	AttachmentPool pool{CLIENT};
+
+	{  // scope
+		ParallelLoader loader{pool, database, {}, "insert into load_test (id) values (?)",
+			ParallelLoaderOptions().setWorkerCount(3u).setBatchSize(100u)};
+
+		const auto result = loader.load(std::span{records});
+
+		BOOST_CHECK_EQUAL(result.rows, 1000u);
+		BOOST_CHECK_EQUAL(result.failedRows, 1u);
+		BOOST_REQUIRE_EQUAL(result.errors.size(), 1u);
+		BOOST_CHECK(result.errors[0].index == 10u || result.errors[0].index == 500u);
+		BOOST_REQUIRE_EQUAL(result.workers.size(), 3u);
+
+		std::uint64_t workerRows = 0;
+
+		for (const auto& worker : result.workers)
+		{
+			BOOST_CHECK(worker.batches >= 3u);
+			workerRows += worker.rows;
+		}
+
+		BOOST_CHECK_EQUAL(workerRows, 1000u);
+	}
+
+	pool.clear();
+
+	Transaction transaction{attachment};
+	Statement count{attachment, transaction, "select count(*) from load_test"};
+	BOOST_REQUIRE(count.execute(transaction));
+	BOOST_CHECK_EQUAL(count.getInt64(0).value(), 999);
+}
+
+BOOST_AUTO_TEST_CASE(loadFromRowSource)
+{
+	const auto database = getTempFile("ParallelLoader-loadFromRowSource.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction, "recreate table load_test (id integer not null)"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	AttachmentPool pool{CLIENT};
+
+	{  // scope
+		ParallelLoader loader{pool, database, {}, "insert into load_test (id) values (?)",
+			ParallelLoaderOptions().setWorkerCount(2u).setBatchSize(64u)};
+
+		int next = 0;
+		const auto result = loader.load(
+			[&](Statement& statement)
+			{
+				if (next == 500)
+					return false;
+
+				statement.setInt32(0, next++);
+				return true;
+			});
+
+		BOOST_CHECK_EQUAL(result.rows, 500u);
+		BOOST_CHECK(result.errors.empty());
+	}
+
+	pool.clear();
+
+	Transaction transaction{attachment};
+	Statement sum{attachment, transaction, "select count(*), sum(id) from load_test"};
+	BOOST_REQUIRE(sum.execute(transaction));
+	BOOST_CHECK_EQUAL(sum.getInt64(0).value(), 500);
+	BOOST_CHECK_EQUAL(sum.getInt64(1).value(), 124750);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,131 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "fb-cpp/Batch.h"
+#include "fb-cpp/Blob.h"
+#include "fb-cpp/ParameterBlock.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <span>
+#include <stdexcept>
+#include <string>
+
+
+BOOST_AUTO_TEST_SUITE(ParameterBlockSuite)
+
+BOOST_AUTO_TEST_CASE(compiledBlocksAreAcceptedByConstructors)
+{
+	const auto database = getTempFile("ParameterBlock-compiledBlocksAreAcceptedByConstructors.fdb");
+
+	const auto attachmentOptions = AttachmentOptions().setCreateDatabase(true).setForcedWrites(false);
+	const auto dpb = attachmentOptions.compile(CLIENT);
+	BOOST_CHECK(dpb.getType() == ParameterBlockType::DPB);
+	BOOST_CHECK(dpb.getLength() > 0u);
+
+	Attachment attachment{CLIENT, database, attachmentOptions, dpb};
+	FbDropDatabase attachmentDrop{attachment};
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction, "create table block_test (id integer, data blob sub_type text)"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	const auto tpb = TransactionOptions()
+						 .setIsolationLevel(TransactionIsolationLevel::READ_COMMITTED)
+						 .setAccessMode(TransactionAccessMode::READ_ONLY)
+						 .compile(CLIENT);
+	BOOST_CHECK(tpb.getType() == ParameterBlockType::TPB);
+
+	// Copies share the same bytes.
+	const auto tpbCopy = tpb;
+	BOOST_CHECK_EQUAL(tpbCopy.getData(), tpb.getData());
+
+	for (int i = 0; i < 2; ++i)
+	{
+		Transaction transaction{attachment, tpbCopy};
+
+		Statement select{
+			attachment, transaction, "select rdb$get_context('SYSTEM', 'ISOLATION_LEVEL') from rdb$database"};
+		BOOST_REQUIRE(select.execute(transaction));
+		BOOST_CHECK_EQUAL(select.getString(0).value(), "READ COMMITTED");
+
+		Statement insert{attachment, transaction, "insert into block_test (id) values (1)"};
+		BOOST_CHECK_THROW(insert.execute(transaction), DatabaseException);
+	}
+
+	BOOST_CHECK_THROW((Transaction{attachment, dpb}), std::invalid_argument);
+
+	Transaction transaction{attachment};
+
+	const auto bpb = BlobOptions().setType(BlobType::STREAM).compile(CLIENT);
+	const std::string text = "compiled";
+
+	BlobId blobId;
+
+	{  // scope
+		Blob blob{attachment, transaction, bpb};
+		blob.write(std::span{text});
+		blob.close();
+		blobId = blob.getId();
+	}
+
+	{  // scope
+		Blob blob{attachment, transaction, blobId, bpb};
+		std::string buffer(text.size(), '\0');
+		BOOST_CHECK_EQUAL(blob.read(std::span{buffer}), text.size());
+		BOOST_CHECK_EQUAL(buffer, text);
+	}
+
+	const auto batchOptions = BatchOptions().setBlobPolicy(BlobPolicy::ID_ENGINE).setRecordCounts(true);
+	const auto batchBlock = batchOptions.compile(CLIENT);
+	BOOST_CHECK(batchBlock.getType() == ParameterBlockType::BATCH);
+
+	Statement insert{attachment, transaction, "insert into block_test (id, data) values (?, ?)"};
+	Batch batch{insert, transaction, batchOptions, batchBlock};
+	BOOST_CHECK(batch.getOptions().getBlobPolicy() == BlobPolicy::ID_ENGINE);
+
+	const auto batchBpb = BlobOptions().compile(CLIENT);
+	batch.setDefaultBpb(batchBpb);
+
+	insert.setInt32(0, 2);
+	insert.setBlobId(1, batch.addBlob(std::as_bytes(std::span{text}), batchBpb));
+	batch.addMessage();
+
+	auto completionState = batch.execute();
+	BOOST_CHECK_EQUAL(completionState.getSize(), 1u);
+	BOOST_CHECK_EQUAL(completionState.getState(0), 1);
+
+	Statement select{attachment, transaction, "select data from block_test where id = 2"};
+	BOOST_REQUIRE(select.execute(transaction));
+
+	Blob reader{attachment, transaction, select.getBlobId(0).value(), bpb};
+	std::string buffer(text.size(), '\0');
+	BOOST_CHECK_EQUAL(reader.read(std::span{buffer}), text.size());
+	BOOST_CHECK_EQUAL(buffer, text);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
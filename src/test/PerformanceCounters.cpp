@@ -0,0 +1,87 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "TestUtil.h"
+#include "fb-cpp/PerformanceCounters.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+
+
+BOOST_AUTO_TEST_SUITE(PerformanceCountersSuite)
+
+BOOST_AUTO_TEST_CASE(reportsStatementAndAttachmentCounters)
+{
+	const auto database = getTempFile("PerformanceCounters-reportsStatementAndAttachmentCounters.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement ddl{attachment, transaction, "create table perf_test (id integer)"};
+	ddl.execute(transaction);
+	transaction.commitRetaining();
+
+	Statement insert{attachment, transaction,
+		"insert into perf_test select row_number() over () from rdb$types a cross join rdb$types b rows 100"};
+	insert.execute(transaction);
+	BOOST_CHECK_EQUAL(insert.getExecutionStats().insertedRecords, 100u);
+
+	Statement relation{attachment, transaction,
+		"select rdb$relation_id from rdb$relations where rdb$relation_name = 'PERF_TEST'"};
+	BOOST_REQUIRE(relation.execute(transaction));
+	const auto relationId = static_cast<unsigned>(relation.getInt16(0).value());
+
+	PerformanceSnapshot snapshot{attachment};
+
+	Statement update{attachment, transaction, "update perf_test set id = -id where id <= 10"};
+	update.execute(transaction);
+
+	const auto updateStats = update.getExecutionStats();
+	BOOST_CHECK_EQUAL(updateStats.updatedRecords, 10u);
+	BOOST_CHECK_EQUAL(updateStats.insertedRecords, 0u);
+
+	Statement select{attachment, transaction, "select id from perf_test"};
+	BOOST_REQUIRE(select.execute(transaction));
+
+	while (select.fetchNext())
+		;
+
+	BOOST_CHECK_EQUAL(select.getExecutionStats().selectedRecords, 100u);
+
+	const auto delta = snapshot.getDelta();
+	BOOST_CHECK_GT(delta.pageFetches, 0u);
+	BOOST_CHECK_GT(delta.currentMemory, 0u);
+
+	const auto table = delta.tables.find(relationId);
+	BOOST_REQUIRE(table != delta.tables.end());
+	// The update scans the table once and the select reads it again.
+	BOOST_CHECK_EQUAL(table->second.sequentialReads, 200u);
+	BOOST_CHECK_EQUAL(table->second.updates, 10u);
+	BOOST_CHECK_EQUAL(table->second.inserts, 0u);
+
+	snapshot.reset();
+	BOOST_CHECK(!snapshot.getDelta().tables.contains(relationId));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
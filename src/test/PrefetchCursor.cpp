@@ -0,0 +1,109 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/PrefetchCursor.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <stdexcept>
+
+
+BOOST_AUTO_TEST_SUITE(PrefetchCursorSuite)
+
+BOOST_AUTO_TEST_CASE(windowsCoverRemainingRowsInOrder)
+{
+	const auto database = getTempFile("PrefetchCursor-windowsCoverRemainingRowsInOrder.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement select{attachment, transaction,
+		"with recursive r(n) as (select 1 from rdb$database union all select n + 1 from r where n < 100) "
+		"select n from r"};
+	BOOST_REQUIRE(select.execute(transaction));
+	BOOST_CHECK_EQUAL(select.getInt32(0).value(), 1);
+
+	PrefetchCursor cursor{select, 7, 3};
+
+	std::int32_t expected = 2;
+	unsigned windows = 0;
+
+	while (const auto window = cursor.next())
+	{
+		++windows;
+		BOOST_CHECK(window->getCount() <= 7u);
+
+		for (auto row : *window)
+			BOOST_CHECK_EQUAL(row.getInt32(0).value(), expected++);
+	}
+
+	BOOST_CHECK_EQUAL(expected, 101);
+	BOOST_CHECK_EQUAL(windows, 15u);
+	BOOST_CHECK(cursor.next() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(closeStopsBeforeEndOfCursor)
+{
+	const auto database = getTempFile("PrefetchCursor-closeStopsBeforeEndOfCursor.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement select{attachment, transaction,
+		"with recursive r(n) as (select 1 from rdb$database union all select n + 1 from r where n < 1000) "
+		"select n from r"};
+	BOOST_REQUIRE(select.execute(transaction));
+
+	PrefetchCursor cursor{select, 10};
+
+	const auto window = cursor.next();
+	BOOST_REQUIRE(window);
+	BOOST_CHECK_EQUAL(window->getRow(0).getInt32(0).value(), 2);
+
+	cursor.close();
+	BOOST_CHECK(cursor.next() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(zeroWindowSizeThrows)
+{
+	const auto database = getTempFile("PrefetchCursor-zeroWindowSizeThrows.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement select{attachment, transaction, "select 1 from rdb$database"};
+	BOOST_REQUIRE(select.execute(transaction));
+
+	BOOST_CHECK_THROW((PrefetchCursor{select, 0}), std::invalid_argument);
+	BOOST_CHECK_THROW((PrefetchCursor{select, 1, 0}), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,165 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "TestUtil.h"
+#include "fb-cpp/ResultExporter.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+BOOST_AUTO_TEST_SUITE(ResultExporterSuite)
+
+BOOST_AUTO_TEST_CASE(exportsTextFormats)
+{
+	const auto database = getTempFile("ResultExporter-exportsTextFormats.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	const auto sql = "select id, name, amount, created, flag from ("
+					 "select 1 id, cast('plain' as varchar(20)) name, cast(12.5 as numeric(10,2)) amount, "
+					 "date '2024-02-29' created, true flag from rdb$database union all "
+					 "select 2, 'a,b \"q\"', -0.05, null, false from rdb$database union all "
+					 "select 3, '', null, date '1858-11-17', null from rdb$database union all "
+					 "select 4, 'tab\there\\', 100, null, null from rdb$database) order by id";
+
+	{  // scope
+		Statement statement{attachment, transaction, sql};
+		statement.execute(transaction);
+
+		BOOST_CHECK_THROW(ResultExporter(statement, transaction, ResultExportOptions().setWindowSize(0)),
+			std::invalid_argument);
+		BOOST_CHECK_THROW(ResultExporter(statement, transaction, ResultExportOptions().setDelimiter('"')),
+			std::invalid_argument);
+	}
+
+	for (const auto writerThread : {false, true})
+	{
+		const auto options = ResultExportOptions().setWindowSize(3).setBufferSize(16).setWriterThread(writerThread);
+
+		{  // scope
+			Statement statement{attachment, transaction, sql};
+			std::ostringstream out;
+			const auto fetched = statement.execute(transaction);
+
+			BOOST_CHECK_EQUAL(
+				ResultExporter(statement, transaction, ResultExportOptions(options).setIncludeCurrentRow(fetched))
+					.exportTo(out),
+				4u);
+			BOOST_CHECK_EQUAL(out.str(),
+				"ID,NAME,AMOUNT,CREATED,FLAG\n"
+				"1,plain,12.50,2024-02-29,true\n"
+				"2,\"a,b \"\"q\"\"\",-0.05,,false\n"
+				"3,\"\",,1858-11-17,\n"
+				"4,tab\there\\,100.00,,\n");
+		}
+
+		{  // scope
+			Statement statement{attachment, transaction, sql};
+			std::ostringstream out;
+			statement.execute(transaction);
+
+			// The row fetched by execute() is skipped.
+			BOOST_CHECK_EQUAL(
+				ResultExporter(statement, transaction,
+					ResultExportOptions(options).setFormat(ExportFormat::TSV).setHeader(false))
+					.exportTo(out),
+				3u);
+			BOOST_CHECK_EQUAL(out.str(),
+				"2\ta,b \"q\"\t-0.05\t\\N\tfalse\n"
+				"3\t\t\\N\t1858-11-17\t\\N\n"
+				"4\ttab\\there\\\\\t100.00\t\\N\t\\N\n");
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(exportsBinaryFormat)
+{
+	const auto database = getTempFile("ResultExporter-exportsBinaryFormat.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement statement{attachment, transaction,
+		"select cast(7 as integer) x, cast('abc' as varchar(10)) s from rdb$database union all "
+		"select null, null from rdb$database"};
+
+	std::vector<std::byte> out;
+	const auto fetched = statement.execute(transaction);
+
+	BOOST_CHECK_EQUAL(ResultExporter(statement, transaction,
+						  ResultExportOptions().setFormat(ExportFormat::BINARY).setIncludeCurrentRow(fetched))
+						  .exportTo([&out](std::span<const std::byte> data)
+							  { out.insert(out.end(), data.begin(), data.end()); }),
+		2u);
+
+	std::size_t offset = 0;
+	const auto next = [&]<typename T>(T value)
+	{
+		BOOST_REQUIRE_LE(offset + sizeof(T), out.size());
+		std::memcpy(&value, &out[offset], sizeof(T));
+		offset += sizeof(T);
+		return value;
+	};
+	const auto nextString = [&](std::size_t length)
+	{
+		BOOST_REQUIRE_LE(offset + length, out.size());
+		std::string value(reinterpret_cast<const char*>(&out[offset]), length);
+		offset += length;
+		return value;
+	};
+
+	BOOST_CHECK_EQUAL(nextString(8), "FBCPPEXP");
+	BOOST_CHECK_EQUAL(next(std::uint16_t{}), 1u);
+	BOOST_CHECK_EQUAL(next(std::uint16_t{}), 2u);
+
+	BOOST_CHECK_EQUAL(next(std::uint16_t{}), static_cast<std::uint16_t>(DescriptorAdjustedType::INT32));
+	BOOST_CHECK_EQUAL(next(std::int16_t{}), 0);
+	BOOST_CHECK_EQUAL(next(std::uint32_t{}), 4u);
+	BOOST_CHECK_EQUAL(nextString(next(std::uint16_t{})), "X");
+
+	BOOST_CHECK_EQUAL(next(std::uint16_t{}), static_cast<std::uint16_t>(DescriptorAdjustedType::STRING));
+	BOOST_CHECK_EQUAL(next(std::int16_t{}), 0);
+	next(std::uint32_t{});
+	BOOST_CHECK_EQUAL(nextString(next(std::uint16_t{})), "S");
+
+	BOOST_CHECK_EQUAL(next(std::int32_t{}), 4);
+	BOOST_CHECK_EQUAL(next(std::int32_t{}), 7);
+	BOOST_CHECK_EQUAL(next(std::int32_t{}), 3);
+	BOOST_CHECK_EQUAL(nextString(3), "abc");
+
+	BOOST_CHECK_EQUAL(next(std::int32_t{}), -1);
+	BOOST_CHECK_EQUAL(next(std::int32_t{}), -1);
+	BOOST_CHECK_EQUAL(offset, out.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -26,6 +26,12 @@
 #include "fb-cpp/RowSet.h"
 #include "fb-cpp/Statement.h"
 #include "fb-cpp/Transaction.h"
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
 
 
 BOOST_AUTO_TEST_SUITE(RowSetSuite)
@@ -61,6 +67,11 @@ BOOST_AUTO_TEST_CASE(fetchRowsIntoRowSet)
 	BOOST_CHECK_EQUAL(
 		rowSet.getRawBuffer().size(), static_cast<std::size_t>(rowSet.getCount()) * rowSet.getMessageLength());
 
+	// The descriptors are shared with the statement, not copied.
+	BOOST_CHECK_EQUAL(rowSet.getDescriptorSet().get(), select.getOutputDescriptorSet().get());
+	BOOST_REQUIRE_EQUAL(rowSet.getDescriptorSet()->getLayouts().size(), 1u);
+	BOOST_CHECK_EQUAL(rowSet.getDescriptorSet()->getLayout(0).offset, rowSet.getDescriptors()[0].offset);
+
 	// Verify row data using typed Row access.
 	for (unsigned i = 0; i < rowSet.getCount(); ++i)
 	{
@@ -260,4 +271,263 @@ BOOST_AUTO_TEST_CASE(fetchMultipleBatchesFromSameStatement)
 	BOOST_CHECK_EQUAL(batch4.getCount(), 0u);
 }
 
+BOOST_AUTO_TEST_CASE(refillReusesBuffer)
+{
+	const auto database = getTempFile("RowSet-refillReusesBuffer.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement ddl{attachment, transaction, "create table t (col integer)"};
+	ddl.execute(transaction);
+	transaction.commitRetaining();
+
+	Statement insert{attachment, transaction, "insert into t (col) values (?)"};
+	for (int i = 1; i <= 8; ++i)
+	{
+		insert.setInt32(0, i);
+		insert.execute(transaction);
+	}
+
+	Statement select{attachment, transaction, "select col from t order by col"};
+	BOOST_REQUIRE(select.execute(transaction));
+
+	// execute() fetched row 1. Page through the remaining 7 rows in windows of 3.
+	RowSet rowSet{select, 3};
+	BOOST_CHECK_EQUAL(rowSet.getMaxRows(), 3u);
+	BOOST_CHECK_EQUAL(rowSet.getCount(), 3u);
+	BOOST_CHECK(!rowSet.isEof());
+	BOOST_CHECK_EQUAL(rowSet.getRow(0).getInt32(0).value(), 2);
+
+	const auto* data = rowSet.getRawBuffer().data();
+
+	BOOST_CHECK(rowSet.refill(select));
+	BOOST_CHECK_EQUAL(rowSet.getCount(), 3u);
+	BOOST_CHECK(!rowSet.isEof());
+	BOOST_CHECK_EQUAL(rowSet.getRow(0).getInt32(0).value(), 5);
+	BOOST_CHECK_EQUAL(rowSet.getRow(2).getInt32(0).value(), 7);
+	BOOST_CHECK_EQUAL(rowSet.getRawBuffer().data(), data);
+
+	BOOST_CHECK(rowSet.refill(select));
+	BOOST_CHECK_EQUAL(rowSet.getCount(), 1u);
+	BOOST_CHECK(rowSet.isEof());
+	BOOST_CHECK_EQUAL(rowSet.getRow(0).getInt32(0).value(), 8);
+	BOOST_CHECK_EQUAL(rowSet.getRawBuffer().data(), data);
+
+	BOOST_CHECK(!rowSet.refill(select));
+	BOOST_CHECK_EQUAL(rowSet.getCount(), 0u);
+	BOOST_CHECK(rowSet.isEof());
+
+	// Past the end, refill() does not fetch again.
+	BOOST_CHECK(!rowSet.refill(select));
+	BOOST_CHECK_EQUAL(rowSet.getCount(), 0u);
+	BOOST_CHECK(rowSet.isEof());
+}
+
+BOOST_AUTO_TEST_CASE(rangeForOverRows)
+{
+	const auto database = getTempFile("RowSet-rangeForOverRows.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement select{attachment, transaction,
+		"select n, cast(n * 10 as varchar(10)) from (select 1 n from rdb$database union all "
+		"select 2 from rdb$database union all select 3 from rdb$database) order by n"};
+	BOOST_REQUIRE(select.execute(transaction));
+	BOOST_CHECK_EQUAL(select.getInt32(0).value(), 1);
+
+	RowSet rowSet{select, 10};
+
+	int expected = 2;
+
+	for (auto row : rowSet)
+	{
+		BOOST_CHECK_EQUAL(row.getInt32(0).value(), expected);
+		BOOST_CHECK_EQUAL(row.getString(1).value(), std::to_string(expected * 10));
+		++expected;
+	}
+
+	BOOST_CHECK_EQUAL(expected, 4);
+	BOOST_CHECK(std::distance(rowSet.begin(), rowSet.end()) == 2);
+	static_assert(std::forward_iterator<RowSet::Iterator>);
+	// Iterators over different row sets never compare equal.
+	BOOST_CHECK(rowSet.begin() != RowSet::Iterator{});
+
+	const auto& constRowSet = rowSet;
+	expected = 2;
+
+	for (auto row : constRowSet)
+		BOOST_CHECK_EQUAL(row.getInt32(0).value(), expected++);
+
+	BOOST_CHECK_EQUAL(expected, 4);
+
+	const auto slice = constRowSet.slice(1, 2);
+	expected = 3;
+
+	for (auto row : slice)
+		BOOST_CHECK_EQUAL(row.getInt32(0).value(), expected++);
+
+	BOOST_CHECK_EQUAL(expected, 4);
+}
+
+BOOST_AUTO_TEST_CASE(slicesAreReadConcurrently)
+{
+	const auto database = getTempFile("RowSet-slicesAreReadConcurrently.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement select{attachment, transaction,
+		"with recursive r (n) as (select 1 from rdb$database union all select n + 1 from r where n < 1000) "
+		"select n, cast(n as numeric(18, 2)) from r"};
+	BOOST_REQUIRE(select.execute(transaction));
+
+	RowSet rowSet{select, 1000};
+	BOOST_REQUIRE_EQUAL(rowSet.getCount(), 1000u);
+
+	const auto& constRowSet = rowSet;
+	constexpr unsigned THREADS = 4;
+	constexpr unsigned ROWS_PER_THREAD = 250;
+
+	std::vector<std::int64_t> intSums(THREADS);
+	std::vector<double> doubleSums(THREADS);
+	std::vector<unsigned> mismatches(THREADS);
+	std::vector<std::thread> threads;
+
+	for (unsigned i = 0; i < THREADS; ++i)
+	{
+		threads.emplace_back(
+			[&, i]
+			{
+				auto slice = constRowSet.slice(i * ROWS_PER_THREAD, (i + 1) * ROWS_PER_THREAD);
+
+				unsigned index = slice.getOffset();
+
+				for (auto row : slice)
+				{
+					intSums[i] += row.getInt64(0).value();
+					doubleSums[i] += row.getDouble(1).value();
+
+					if (constRowSet.getRow(index++).getInt32(0) != row.getInt32(0))
+						++mismatches[i];
+				}
+			});
+	}
+
+	for (auto& thread : threads)
+		thread.join();
+
+	std::int64_t intSum = 0;
+	double doubleSum = 0;
+
+	for (unsigned i = 0; i < THREADS; ++i)
+	{
+		intSum += intSums[i];
+		doubleSum += doubleSums[i];
+		BOOST_CHECK_EQUAL(mismatches[i], 0u);
+	}
+
+	BOOST_CHECK_EQUAL(intSum, 500500);
+	BOOST_CHECK_CLOSE(doubleSum, 500500.0, 0.001);
+
+	auto tail = rowSet.slice(990, 1000);
+	BOOST_CHECK_EQUAL(tail.getOffset(), 990u);
+	BOOST_CHECK_EQUAL(tail.getCount(), 10u);
+	BOOST_CHECK_EQUAL(tail.getRow(9).getInt32(0).value(), 1000);
+	BOOST_CHECK(rowSet.slice(1000, 1000).isEmpty());
+	BOOST_CHECK_THROW(rowSet.slice(10, 5), std::out_of_range);
+	BOOST_CHECK_THROW(rowSet.slice(0, 1001), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(fromCurrentRowKeepsExecutedRow)
+{
+	const auto database = getTempFile("RowSet-fromCurrentRowKeepsExecutedRow.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement select{attachment, transaction,
+		"select n from (select 1 n from rdb$database union all select 2 from rdb$database union all "
+		"select 3 from rdb$database) order by n"};
+	BOOST_REQUIRE(select.execute(transaction));
+
+	auto rowSet = RowSet::fromCurrentRow(select, 2);
+	BOOST_REQUIRE_EQUAL(rowSet.getCount(), 2u);
+	BOOST_CHECK_EQUAL(rowSet.getRow(0).getInt32(0).value(), 1);
+	BOOST_CHECK_EQUAL(rowSet.getRow(1).getInt32(0).value(), 2);
+
+	BOOST_CHECK(rowSet.refill(select));
+	BOOST_REQUIRE_EQUAL(rowSet.getCount(), 1u);
+	BOOST_CHECK_EQUAL(rowSet.getRow(0).getInt32(0).value(), 3);
+	BOOST_CHECK(rowSet.isEof());
+}
+
+BOOST_AUTO_TEST_CASE(prefetchesSmallBlobs)
+{
+	const auto database = getTempFile("RowSet-prefetchesSmallBlobs.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement ddl{attachment, transaction, "create table t (id integer, body blob sub_type text, extra blob)"};
+	ddl.execute(transaction);
+	transaction.commitRetaining();
+
+	Statement insert{attachment, transaction,
+		"insert into t (id, body, extra) "
+		"select 1, 'small', null from rdb$database union all "
+		"select 2, lpad('', 200, 'x'), 'other' from rdb$database union all "
+		"select 3, null, null from rdb$database union all "
+		"select 4, '', null from rdb$database"};
+	insert.execute(transaction);
+
+	Statement select{attachment, transaction, "select id, body, extra from t order by id",
+		StatementOptions().setMaxInlineBlobSize(1024)};
+	BOOST_REQUIRE(select.execute(transaction));
+
+	BOOST_CHECK_THROW(RowSet(select, 10, transaction, BlobPrefetchOptions().setColumns({0})), std::invalid_argument);
+	BOOST_CHECK_THROW(RowSet(select, 10, transaction, BlobPrefetchOptions().setColumns({5})), std::out_of_range);
+
+	// The first row (1) was fetched by execute().
+	RowSet rowSet{select, 2, transaction, BlobPrefetchOptions().setColumns({1}).setMaxBlobSize(100)};
+	BOOST_REQUIRE_EQUAL(rowSet.getCount(), 2u);
+
+	// Too large for the threshold: read with Blob instead.
+	BOOST_CHECK(!rowSet.isBlobPrefetched(0, 1));
+	BOOST_CHECK_THROW(rowSet.getBlobBytes(0, 1), FbCppException);
+
+	// Not selected.
+	BOOST_CHECK(!rowSet.isBlobPrefetched(0, 2));
+	BOOST_CHECK_THROW(rowSet.getBlobString(0, 2), FbCppException);
+
+	BOOST_CHECK(rowSet.isBlobPrefetched(1, 1));
+	BOOST_CHECK(!rowSet.getBlobString(1, 1).has_value());
+
+	BOOST_REQUIRE(rowSet.refill(select));
+	BOOST_REQUIRE_EQUAL(rowSet.getCount(), 1u);
+	BOOST_CHECK_EQUAL(rowSet.getBlobString(0, 1).value(), "");
+
+	BOOST_REQUIRE(select.execute(transaction));
+	RowSet all{RowSet::fromCurrentRow(select, 10)};
+	BOOST_CHECK(!all.isBlobPrefetched(0, 1));
+
+	BOOST_REQUIRE(select.execute(transaction));
+	RowSet allColumns{select, 10, transaction, BlobPrefetchOptions()};
+	BOOST_REQUIRE_EQUAL(allColumns.getCount(), 3u);
+	BOOST_CHECK_EQUAL(allColumns.getBlobString(0, 1).value(), std::string(200, 'x'));
+	BOOST_CHECK_EQUAL(allColumns.getBlobString(0, 2).value(), "other");
+	BOOST_CHECK(!allColumns.getBlobBytes(1, 1).has_value());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,123 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "fb-cpp/SharedReadTransaction.h"
+#include "fb-cpp/Statement.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+
+BOOST_AUTO_TEST_SUITE(SharedReadTransactionSuite)
+
+BOOST_AUTO_TEST_CASE(sharesAndRenewsTransaction)
+{
+	const auto database = getTempFile("SharedReadTransaction-sharesAndRenewsTransaction.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction, "create table shared_test (id integer)"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	SharedReadTransaction shared{attachment};
+	BOOST_CHECK_EQUAL(shared.getStartedCount(), 0u);
+
+	const auto currentTransactionId = [&]
+	{
+		return shared.run(
+			[&](Transaction& transaction)
+			{
+				Statement select{attachment, transaction, "select current_transaction from rdb$database"};
+				select.execute(transaction);
+				return select.getInt64(0).value();
+			});
+	};
+
+	const auto firstId = currentTransactionId();
+	BOOST_CHECK_EQUAL(currentTransactionId(), firstId);
+	BOOST_CHECK_EQUAL(shared.getStartedCount(), 1u);
+
+	// Concurrent readers share the same transaction and see data committed later.
+	{  // scope
+		Transaction transaction{attachment};
+		Statement insert{attachment, transaction, "insert into shared_test values (1)"};
+		insert.execute(transaction);
+		transaction.commit();
+	}
+
+	std::atomic<unsigned> seen = 0u;
+	std::vector<std::thread> threads;
+
+	for (unsigned i = 0u; i < 4u; ++i)
+	{
+		threads.emplace_back(
+			[&]
+			{
+				auto lease = shared.acquire();
+				Statement select{attachment, *lease, "select count(*) from shared_test"};
+				select.execute(*lease);
+				seen += static_cast<unsigned>(select.getInt64(0).value());
+			});
+	}
+
+	for (auto& thread : threads)
+		thread.join();
+
+	BOOST_CHECK_EQUAL(seen.load(), 4u);
+	BOOST_CHECK_EQUAL(shared.getStartedCount(), 1u);
+
+	// An invalidated transaction stays usable by its lease while the next acquire gets a new one.
+	{  // scope
+		auto oldLease = shared.acquire();
+		oldLease.invalidate();
+
+		auto newLease = shared.acquire();
+		BOOST_CHECK(&oldLease.get() != &newLease.get());
+		BOOST_CHECK(oldLease->isValid());
+	}
+
+	BOOST_CHECK_EQUAL(shared.getStartedCount(), 2u);
+	BOOST_CHECK_NE(currentTransactionId(), firstId);
+
+	shared.renew();
+	currentTransactionId();
+	BOOST_CHECK_EQUAL(shared.getStartedCount(), 3u);
+
+	// Expired transactions are replaced on acquire.
+	SharedReadTransaction shortLived{
+		attachment, SharedReadTransactionOptions().setMaxAge(std::chrono::milliseconds{1})};
+	auto lease = shortLived.acquire();
+	std::this_thread::sleep_for(std::chrono::milliseconds{5});
+	BOOST_CHECK(&shortLived.acquire().get() != &lease.get());
+	BOOST_CHECK_EQUAL(shortLived.getStartedCount(), 2u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,143 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "fb-cpp/RowSet.h"
+#include "fb-cpp/SlowQueryLog.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+BOOST_AUTO_TEST_SUITE(SlowQueryLogSuite)
+
+BOOST_AUTO_TEST_CASE(recordsSlowExecutions)
+{
+	const auto database = getTempFile("SlowQueryLog-recordsSlowExecutions.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	BOOST_CHECK(!attachment.getSlowQueryLog());
+
+	auto log = std::make_shared<SlowQueryLog>(SlowQueryLogOptions().setThreshold(std::chrono::nanoseconds{0}));
+	attachment.setSlowQueryLog(log);
+
+	Transaction transaction{attachment};
+
+	{  // scope
+		Statement select{
+			attachment, transaction, "select rdb$relation_id from rdb$relations where rdb$relation_id < ?"};
+		BOOST_CHECK(select.getSlowQueryLog() == log);
+
+		select.setInt32(0, 10);
+		BOOST_REQUIRE(select.execute(transaction));
+
+		unsigned rows = 1u;
+
+		while (select.fetchNext())
+			++rows;
+
+		const auto entries = log->getEntries();
+		BOOST_REQUIRE_EQUAL(entries.size(), 1u);
+
+		const auto& entry = entries[0];
+		BOOST_CHECK(entry.sql.find("rdb$relations") != std::string::npos);
+		BOOST_CHECK(!entry.plan.empty());
+		BOOST_REQUIRE_EQUAL(entry.parameterTypes.size(), 1u);
+		BOOST_CHECK(entry.parameterTypes[0] == DescriptorOriginalType::LONG);
+		BOOST_CHECK_EQUAL(entry.fetchedRows, rows);
+		BOOST_CHECK(entry.prepareTime > std::chrono::nanoseconds{0});
+		BOOST_CHECK(entry.totalTime == entry.prepareTime + entry.executeTime + entry.fetchTime);
+		BOOST_REQUIRE(entry.stats.has_value());
+		BOOST_CHECK_EQUAL(entry.stats->selectedRecords, rows);
+
+		// A re-execution is recorded again, without the prepare time.
+		select.setInt32(0, 1);
+		BOOST_REQUIRE(select.execute(transaction));
+		BOOST_CHECK(!select.fetchNext());
+
+		const auto again = log->getEntries();
+		BOOST_REQUIRE_EQUAL(again.size(), 2u);
+		BOOST_CHECK(again[1].prepareTime == std::chrono::nanoseconds{0});
+		BOOST_CHECK_EQUAL(again[1].fetchedRows, 1u);
+		BOOST_CHECK_EQUAL(again[1].plan, entry.plan);
+	}
+
+	log->clear();
+	BOOST_CHECK(log->getEntries().empty());
+
+	{  // scope
+		Statement select{attachment, transaction, "select rdb$relation_id from rdb$relations"};
+		BOOST_REQUIRE(select.execute(transaction));
+
+		RowSet rowSet{select, 1000u};
+		BOOST_CHECK_EQUAL(log->getEntries().size(), 1u);
+		BOOST_CHECK_EQUAL(log->getEntries()[0].fetchedRows, rowSet.getCount() + 1u);
+	}
+
+	// Ring overwrite and sink delivery.
+	SlowQueryLog ring{SlowQueryLogOptions().setCapacity(2u)};
+
+	for (unsigned i = 0; i < 3u; ++i)
+	{
+		SlowQueryEntry entry;
+		entry.sql = std::to_string(i);
+		ring.record(std::move(entry));
+	}
+
+	const auto ringEntries = ring.getEntries();
+	BOOST_REQUIRE_EQUAL(ringEntries.size(), 2u);
+	BOOST_CHECK_EQUAL(ringEntries[0].sql, "1");
+	BOOST_CHECK_EQUAL(ringEntries[1].sql, "2");
+	BOOST_CHECK_EQUAL(ring.getRecordedCount(), 3u);
+
+	std::vector<std::string> delivered;
+	SlowQueryLog sinkLog{SlowQueryLogOptions().setSink(
+		[&](const SlowQueryEntry& entry)
+		{
+			delivered.push_back(entry.sql);
+		})};
+
+	SlowQueryEntry sinkEntry;
+	sinkEntry.sql = "sink";
+	sinkLog.record(std::move(sinkEntry));
+	BOOST_REQUIRE_EQUAL(delivered.size(), 1u);
+	BOOST_CHECK_EQUAL(delivered[0], "sink");
+	BOOST_CHECK(sinkLog.getEntries().empty());
+
+	// A high threshold records nothing.
+	attachment.setSlowQueryLog(
+		std::make_shared<SlowQueryLog>(SlowQueryLogOptions().setThreshold(std::chrono::hours{1})));
+
+	Statement fast{attachment, transaction, "select 1 from rdb$database"};
+	BOOST_REQUIRE(fast.execute(transaction));
+	BOOST_CHECK(!fast.fetchNext());
+	BOOST_CHECK(attachment.getSlowQueryLog()->getEntries().empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -25,11 +25,18 @@
 #include "TestUtil.h"
 #include "fb-cpp/Blob.h"
 #include "fb-cpp/Exception.h"
+#include "fb-cpp/RowSet.h"
 #include "fb-cpp/Statement.h"
 #include "fb-cpp/Transaction.h"
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 
 BOOST_AUTO_TEST_SUITE(StatementLifecycleSuite)
@@ -76,6 +83,11 @@ BOOST_AUTO_TEST_CASE(isNotValidAfterMove)
 
 	BOOST_CHECK_EQUAL(stmt1.isValid(), false);
 	BOOST_CHECK_EQUAL(stmt2.isValid(), true);
+
+	// The moved-from statement keeps empty descriptors.
+	BOOST_CHECK(stmt1.getInputDescriptors().empty());
+	BOOST_CHECK(stmt1.getOutputDescriptors().empty());
+	BOOST_CHECK_EQUAL(stmt2.getOutputDescriptors().size(), 1u);
 }
 
 BOOST_AUTO_TEST_CASE(moveAssignmentTransfersOwnership)
@@ -360,6 +372,143 @@ BOOST_AUTO_TEST_CASE(getOutputMessageContainsFetchedValueAtMetadataOffset)
 	BOOST_CHECK_EQUAL(*reinterpret_cast<const std::int32_t*>(data), 42);
 }
 
+BOOST_AUTO_TEST_CASE(callerOwnedMessages)
+{
+	const auto database = getTempFile("Statement-callerOwnedMessages.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction, "recreate table message_test (id integer not null)"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	Transaction transaction{attachment};
+
+	// Encode all input messages up front into one caller-owned buffer.
+	constexpr unsigned count = 5u;
+	Statement insert{attachment, transaction, "insert into message_test (id) values (?)"};
+	const auto inLength = insert.getInputMessage().size();
+	std::vector<std::byte> inMessages(inLength * count);
+
+	for (unsigned i = 0u; i < count; ++i)
+	{
+		insert.setInt32(0, static_cast<std::int32_t>(i * 10u));
+		std::copy(insert.getInputMessage().begin(), insert.getInputMessage().end(), inMessages.begin() + i * inLength);
+	}
+
+	insert.clearParameters();
+
+	for (unsigned i = 0u; i < count; ++i)
+		insert.execute(transaction, std::span{inMessages}.subspan(i * inLength, inLength));
+
+	BOOST_CHECK_THROW(insert.execute(transaction, std::span{inMessages}.first(inLength + 1u)), std::invalid_argument);
+
+	// Fetch all rows into consecutive slots of a caller-owned buffer.
+	Statement select{attachment, transaction, "select id from message_test where id >= ? order by id"};
+	select.setInt32(0, 20);
+
+	const auto outLength = select.getOutputMessage().size();
+	const auto valueOffset = select.getOutputDescriptors()[0].offset;
+	std::vector<std::byte> outMessages(outLength * count);
+
+	unsigned fetched = 0u;
+	auto slot = [&](unsigned index) { return std::span{outMessages}.subspan(index * outLength, outLength); };
+
+	if (select.execute(transaction, select.getInputMessage(), slot(fetched)))
+	{
+		do
+			++fetched;
+		while (select.fetchNextInto(slot(fetched)));
+	}
+
+	BOOST_REQUIRE_EQUAL(fetched, 3u);
+
+	for (unsigned i = 0u; i < fetched; ++i)
+	{
+		BOOST_CHECK_EQUAL(
+			*reinterpret_cast<const std::int32_t*>(&outMessages[i * outLength + valueOffset]), 20 + 10 * i);
+	}
+
+	BOOST_CHECK_THROW(select.fetchNextInto(std::span{outMessages}.first(outLength - 1u)), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(StatementNameSuite)
+
+BOOST_AUTO_TEST_CASE(namedParametersAndColumnNames)
+{
+	const auto database = getTempFile("Statement-namedParametersAndColumnNames.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction, "recreate table name_test (id integer, name varchar(20))"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	Transaction transaction{attachment};
+
+	Statement insert{attachment, transaction,
+		"insert into name_test (id, name) values (:id, :name) /* :block */ -- :comment",
+		StatementOptions().setNamedParameters(true)};
+
+	BOOST_CHECK_EQUAL(insert.getInputDescriptors().size(), 2u);
+	BOOST_CHECK(insert.getParameterIndexes("ID") == std::vector<unsigned>{0u});
+	BOOST_CHECK(insert.getParameterIndexes("Name") == std::vector<unsigned>{1u});
+	BOOST_CHECK_THROW(insert.getParameterIndexes("comment"), std::out_of_range);
+	BOOST_CHECK_THROW(insert.getParameterIndexes("block"), std::out_of_range);
+
+	insert.set("id", 1);
+	insert.set("name", std::string{"one"});
+	insert.execute(transaction);
+
+	insert.set("id", 2);
+	insert.setNull("name");
+	insert.execute(transaction);
+
+	// The same name may appear several times, mixed with positional parameters.
+	Statement select{attachment, transaction,
+		"select id, name as label, id * 10 as \"Tens\", ':min' from name_test "
+		"where id >= :min and cast(? as integer) = ? and id <= cast(:MIN as integer) + 1 order by id",
+		StatementOptions().setNamedParameters(true)};
+
+	BOOST_CHECK(select.getParameterIndexes("min") == (std::vector<unsigned>{0u, 3u}));
+	select.set("min", 1);
+	select.setInt32(1, 0);
+	select.setInt32(2, 0);
+
+	static constexpr DescriptorName LABEL{"LABEL"};
+
+	BOOST_CHECK_EQUAL(select.getIndex("ID"), 0u);
+	BOOST_CHECK_EQUAL(select.getIndex("id"), 0u);
+	BOOST_CHECK_EQUAL(select.getIndex(LABEL), 1u);
+	BOOST_CHECK_EQUAL(select.getIndex("NAME"), 1u);  // field name as fallback for the alias
+	BOOST_CHECK_EQUAL(select.getIndex("tens"), 2u);
+	BOOST_CHECK_THROW(select.getIndex("missing"), std::out_of_range);
+
+	BOOST_REQUIRE(select.execute(transaction));
+	BOOST_CHECK_EQUAL(select.get<std::optional<std::int32_t>>("id").value(), 1);
+	BOOST_CHECK_EQUAL(select.get<std::optional<std::string>>(LABEL).value(), "one");
+	BOOST_CHECK_EQUAL(select.get<std::optional<std::int32_t>>("Tens").value(), 10);
+
+	RowSet rowSet{select, 10u};
+	BOOST_REQUIRE_EQUAL(rowSet.getCount(), 1u);
+
+	auto row = rowSet.getRow(0u);
+	BOOST_CHECK_EQUAL(row.getIndex("label"), 1u);
+	BOOST_CHECK_EQUAL(row.get<std::optional<std::int32_t>>("ID").value(), 2);
+	BOOST_CHECK(!row.get<std::optional<std::string>>("label").has_value());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -1199,6 +1348,38 @@ BOOST_AUTO_TEST_CASE(stringTruncationThrows)
 	BOOST_CHECK_THROW(stmt.setString(0, "This is too long"), DatabaseException);
 }
 
+BOOST_AUTO_TEST_CASE(stringViewAndBytesReadMessageInPlace)
+{
+	const auto database = getTempFile("Statement-stringViewAndBytesReadMessageInPlace.fdb");
+
+	Attachment attachment{CLIENT, database,
+		AttachmentOptions().setCreateDatabase(true).setForcedWrites(false).setConnectionCharSet("UTF8")};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement stmt{attachment, transaction,
+		"select cast('abc' as varchar(5)), cast(x'00FF' as varchar(4) character set octets), "
+		"cast(null as varchar(10)), 1 from rdb$database"};
+	BOOST_REQUIRE(stmt.execute(transaction));
+
+	const auto view = stmt.getStringView(0);
+	BOOST_REQUIRE(view.has_value());
+	BOOST_CHECK_EQUAL(view.value(), "abc");
+	BOOST_CHECK_EQUAL(stmt.get<std::optional<std::string_view>>(0).value(), "abc");
+
+	const auto bytes = stmt.getBytes(1);
+	BOOST_REQUIRE(bytes.has_value());
+	BOOST_REQUIRE_EQUAL(bytes->size(), 2u);
+	BOOST_CHECK(bytes->data()[0] == std::byte{0x00});
+	BOOST_CHECK(bytes->data()[1] == std::byte{0xFF});
+
+	BOOST_CHECK(!stmt.getStringView(2).has_value());
+	BOOST_CHECK(!stmt.getBytes(2).has_value());
+
+	BOOST_CHECK_THROW(stmt.getStringView(3), FbCppException);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -2923,6 +3104,88 @@ BOOST_AUTO_TEST_CASE(setStructWithOptionalNull)
 	BOOST_CHECK(!stmt.getString(1).has_value());
 }
 
+BOOST_AUTO_TEST_CASE(bindingPlanRoundTripsStruct)
+{
+	struct Params
+	{
+		std::int32_t val1;
+		std::optional<std::string_view> val2;
+		double val3;
+	};
+
+	struct Result
+	{
+		std::int32_t col1;
+		std::optional<std::string> col2;
+		std::optional<std::int64_t> col3;
+	};
+
+	const auto database = getTempFile("Statement-bindingPlanRoundTripsStruct.fdb");
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+	Statement stmt{attachment, transaction,
+		"select cast(? as integer), cast(? as varchar(50)), cast(? as bigint) from rdb$database"};
+
+	const BindingPlan<Params> inPlan{stmt.getInputDescriptorSet()};
+	BOOST_CHECK(inPlan.isDirect(0));
+	BOOST_CHECK(inPlan.isDirect(1));
+	BOOST_CHECK(!inPlan.isDirect(2));
+
+	const BindingPlan<Result> outPlan{stmt.getOutputDescriptorSet()};
+	BOOST_CHECK(outPlan.isDirect(0));
+	BOOST_CHECK(outPlan.isDirect(1));
+	BOOST_CHECK(outPlan.isDirect(2));
+
+	stmt.set(inPlan, Params{123, "test", 7.0});
+	BOOST_REQUIRE(stmt.execute(transaction));
+
+	auto result = stmt.get(outPlan);
+	BOOST_CHECK_EQUAL(result.col1, 123);
+	BOOST_CHECK_EQUAL(result.col2.value(), "test");
+	BOOST_CHECK_EQUAL(result.col3.value(), 7);
+
+	stmt.set(inPlan, Params{456, std::nullopt, 8.0});
+	BOOST_REQUIRE(stmt.execute(transaction));
+
+	result = stmt.get(outPlan);
+	BOOST_CHECK_EQUAL(result.col1, 456);
+	BOOST_CHECK(!result.col2.has_value());
+	BOOST_CHECK_EQUAL(result.col3.value(), 8);
+}
+
+BOOST_AUTO_TEST_CASE(bindingPlanRejectsMismatches)
+{
+	struct One
+	{
+		std::int32_t value;
+	};
+
+	struct Two
+	{
+		std::int32_t value1;
+		std::int32_t value2;
+	};
+
+	const auto database = getTempFile("Statement-bindingPlanRejectsMismatches.fdb");
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+	Statement stmt1{attachment, transaction, "select cast(null as integer) from rdb$database"};
+	Statement stmt2{attachment, transaction, "select 1 from rdb$database"};
+
+	BOOST_CHECK_THROW(BindingPlan<Two>{stmt1.getOutputDescriptorSet()}, FbCppException);
+
+	const BindingPlan<One> plan{stmt1.getOutputDescriptorSet()};
+	BOOST_REQUIRE(stmt1.execute(transaction));
+	BOOST_CHECK_THROW(stmt1.get(plan), FbCppException);
+
+	BOOST_REQUIRE(stmt2.execute(transaction));
+	BOOST_CHECK_THROW(stmt2.get(plan), FbCppException);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -3377,6 +3640,61 @@ BOOST_AUTO_TEST_CASE(setStructWithVariant)
 	BOOST_CHECK_EQUAL(stmt.getString(1).value(), "from struct");
 }
 
+BOOST_AUTO_TEST_CASE(variantPlanGetAndSet)
+{
+	using MyVariant = std::variant<std::monostate, ScaledInt32, std::int32_t, double, std::string, Date>;
+
+	const auto database = getTempFile("Statement-variantPlanGetAndSet.fdb");
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+	Statement stmt{attachment, transaction,
+		"select cast(? as integer), cast(? as numeric(9, 2)), cast(? as varchar(20)), cast(? as date), "
+		"cast(? as double precision), cast(null as integer), cast(? as bigint) "
+		"from rdb$database"};
+
+	const VariantPlan<MyVariant> inPlan{stmt.getInputDescriptorSet()};
+	const VariantPlan<MyVariant> outPlan{stmt.getOutputDescriptorSet()};
+
+	BOOST_CHECK_EQUAL(outPlan.getAlternative(0), 2u);
+	BOOST_CHECK(outPlan.isDirect(0));
+	BOOST_CHECK_EQUAL(outPlan.getAlternative(1), 1u);
+	BOOST_CHECK(outPlan.isDirect(1));
+	BOOST_CHECK(outPlan.isDirect(2));
+	BOOST_CHECK_EQUAL(outPlan.getAlternative(3), 5u);
+	BOOST_CHECK(!outPlan.isDirect(3));
+	BOOST_CHECK_EQUAL(outPlan.getAlternative(6), 1u);
+	BOOST_CHECK_THROW(outPlan.getAlternative(7), std::out_of_range);
+
+	const auto date = Date{std::chrono::year{2024}, std::chrono::month{2}, std::chrono::day{29}};
+
+	stmt.set(inPlan, 0, MyVariant{std::int32_t{42}});
+	stmt.set(inPlan, 1, MyVariant{ScaledInt32{12345, -2}});
+	stmt.set(inPlan, 2, MyVariant{std::string{"plan"}});
+	stmt.set(inPlan, 3, MyVariant{date});
+	stmt.set(inPlan, 4, MyVariant{std::int32_t{7}});
+	stmt.set(inPlan, 5, MyVariant{std::int32_t{9}});
+	BOOST_REQUIRE(stmt.execute(transaction));
+
+	BOOST_CHECK_EQUAL(std::get<std::int32_t>(stmt.get(outPlan, 0)), 42);
+	BOOST_CHECK_EQUAL(std::get<ScaledInt32>(stmt.get(outPlan, 1)).value, 12345);
+	BOOST_CHECK_EQUAL(std::get<ScaledInt32>(stmt.get(outPlan, 1)).scale, -2);
+	BOOST_CHECK_EQUAL(std::get<std::string>(stmt.get(outPlan, 2)), "plan");
+	BOOST_CHECK(std::get<Date>(stmt.get(outPlan, 3)) == date);
+	BOOST_CHECK_EQUAL(std::get<double>(stmt.get(outPlan, 4)), 7.0);
+	BOOST_CHECK(std::holds_alternative<std::monostate>(stmt.get(outPlan, 5)));
+
+	// BIGINT fits no exact alternative, so it falls back to the first usable one, as get<V>() does.
+	BOOST_CHECK_EQUAL(std::get<ScaledInt32>(stmt.get(outPlan, 6)).value, 9);
+
+	for (unsigned i = 0; i < 7; ++i)
+		BOOST_CHECK(stmt.get(outPlan, i).index() == stmt.get<MyVariant>(i).index());
+
+	BOOST_CHECK_THROW(stmt.get(inPlan, 0), FbCppException);
+}
+
+
 #if FB_CPP_USE_BOOST_MULTIPRECISION != 0
 
 BOOST_AUTO_TEST_CASE(getVariantScaledOpaqueInt128Preferred)
@@ -0,0 +1,89 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/StatementCache.h"
+#include "fb-cpp/Transaction.h"
+#include <stdexcept>
+
+
+BOOST_AUTO_TEST_SUITE(StatementCacheSuite)
+
+BOOST_AUTO_TEST_CASE(cacheHitsAndEviction)
+{
+	const auto database = getTempFile("StatementCache-cacheHitsAndEviction.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	BOOST_CHECK_THROW(StatementCache(attachment, 0u), std::invalid_argument);
+
+	Transaction transaction{attachment};
+	StatementCache cache{attachment, 2u};
+
+	auto& select1 = cache.prepare(transaction, "select cast(? as integer) from rdb$database");
+	select1.setInt32(0, 10);
+	BOOST_REQUIRE(select1.execute(transaction));
+	BOOST_CHECK_EQUAL(*select1.getInt32(0), 10);
+
+	// Cache hit returns the same statement, with parameters reset.
+	auto& select2 = cache.prepare(transaction, "select cast(? as integer) from rdb$database");
+	BOOST_CHECK_EQUAL(&select1, &select2);
+	BOOST_CHECK_EQUAL(cache.getHitCount(), 1u);
+	BOOST_CHECK_EQUAL(cache.getMissCount(), 1u);
+	BOOST_REQUIRE(select2.execute(transaction));
+	BOOST_CHECK(!select2.getInt32(0).has_value());
+
+	// Different options are a different key.
+	auto& scrollable = cache.prepare(transaction, "select cast(? as integer) from rdb$database",
+		StatementOptions().setCursorType(CursorType::SCROLLABLE));
+	BOOST_CHECK_NE(&scrollable, &select1);
+	BOOST_CHECK_EQUAL(cache.getSize(), 2u);
+
+	// Touch the first statement so the scrollable one becomes the least recently used.
+	cache.prepare(transaction, "select cast(? as integer) from rdb$database");
+	cache.prepare(transaction, "select 1 from rdb$database");
+	BOOST_CHECK_EQUAL(cache.getSize(), 2u);
+	BOOST_CHECK_EQUAL(cache.getMissCount(), 3u);
+
+	BOOST_CHECK(!cache.erase("select cast(? as integer) from rdb$database",
+		StatementOptions().setCursorType(CursorType::SCROLLABLE)));
+	BOOST_CHECK(cache.erase("select 1 from rdb$database"));
+	BOOST_CHECK_EQUAL(cache.getSize(), 1u);
+
+	// A statement freed by the user is prepared again.
+	auto& select3 = cache.prepare(transaction, "select cast(? as integer) from rdb$database");
+	select3.free();
+	auto& select4 = cache.prepare(transaction, "select cast(? as integer) from rdb$database");
+	BOOST_CHECK(select4.isValid());
+	BOOST_CHECK_EQUAL(cache.getMissCount(), 4u);
+
+	cache.clear();
+	BOOST_CHECK_EQUAL(cache.getSize(), 0u);
+
+	transaction.commit();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,87 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "fb-cpp/StatementCache.h"
+#include "fb-cpp/StatementWarmUp.h"
+#include "fb-cpp/Transaction.h"
+#include <array>
+#include <vector>
+
+
+BOOST_AUTO_TEST_SUITE(StatementWarmUpSuite)
+
+BOOST_AUTO_TEST_CASE(preparesStatementsInEveryCache)
+{
+	const auto database = getTempFile("StatementWarmUp-preparesStatementsInEveryCache.fdb");
+
+	Attachment attachment1{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment1};
+	Attachment attachment2{CLIENT, database};
+
+	StatementCache cache1{attachment1};
+	StatementCache cache2{attachment2};
+	const std::array<StatementCache*, 2> caches{&cache1, &cache2};
+
+	const std::vector<WarmUpStatement> statements{
+		{"select 1 from rdb$database", {}},
+		{"select count(*) from missing_table", {}},
+		{"select rdb$relation_name from rdb$relations where rdb$relation_id = ?", {}},
+	};
+
+	const auto report = StatementWarmUp::run(caches, statements);
+
+	BOOST_CHECK(!report.isSuccess());
+	BOOST_CHECK_EQUAL(report.failedCount, 2u);
+	BOOST_REQUIRE_EQUAL(report.results.size(), 6u);
+
+	for (std::size_t i = 0u; i < report.results.size(); ++i)
+	{
+		const auto& result = report.results[i];
+		BOOST_CHECK_EQUAL(result.cacheIndex, i / 3u);
+		BOOST_CHECK_EQUAL(result.statementIndex, i % 3u);
+		BOOST_CHECK_EQUAL(static_cast<bool>(result.error), result.statementIndex == 1u);
+		BOOST_CHECK_EQUAL(result.errorMessage.empty(), result.statementIndex != 1u);
+		BOOST_CHECK(result.prepareTime > std::chrono::nanoseconds{0});
+	}
+
+	BOOST_CHECK_EQUAL(cache1.getSize(), 2u);
+	BOOST_CHECK_EQUAL(cache2.getSize(), 2u);
+	BOOST_CHECK_EQUAL(cache1.getMissCount(), 3u);
+
+	// The warmed statements are served from the caches.
+	Transaction transaction{attachment2};
+	auto& statement = cache2.prepare(transaction, statements[2].sql);
+	BOOST_CHECK_EQUAL(cache2.getHitCount(), 1u);
+
+	statement.setInt16(0, 0);
+	BOOST_REQUIRE(statement.execute(transaction));
+	BOOST_CHECK(statement.getString(0).has_value());
+
+	StatementCache small{attachment1, 2u};
+	const std::array<StatementCache*, 1> smallCaches{&small};
+	BOOST_CHECK_THROW(StatementWarmUp::run(smallCaches, statements), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
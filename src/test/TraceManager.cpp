@@ -0,0 +1,161 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/TraceManager.h"
+#include "fb-cpp/Transaction.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+	ServiceManagerOptions makeServiceManagerOptions()
+	{
+		auto options = ServiceManagerOptions{};
+
+		if (const auto server = getServer())
+			options.setServer(server.value());
+
+		return options;
+	}
+}  // namespace
+
+
+BOOST_AUTO_TEST_SUITE(TraceManagerSuite)
+
+BOOST_AUTO_TEST_CASE(traceSessionDeliversStatementEvents)
+{
+	const auto database = getTempFile("TraceManager-traceSessionDeliversStatementEvents.fdb");
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	const auto config = std::string{"database = %[\\\\/]TraceManager-traceSessionDeliversStatementEvents.fdb\n"
+									"{\n"
+									"\tenabled = true\n"
+									"\tlog_statement_finish = true\n"
+									"\tprint_plan = true\n"
+									"\tprint_perf = true\n"
+									"\ttime_threshold = 0\n"
+									"}\n"};
+
+	std::mutex mutex;
+	std::condition_variable eventsChanged;
+	std::vector<TraceEvent> events;
+	std::promise<std::uint64_t> sessionIdPromise;
+	auto sessionIdFuture = sessionIdPromise.get_future();
+	std::exception_ptr traceError;
+
+	std::thread traceThread{[&]
+		{
+			try
+			{
+				TraceManager manager{CLIENT, makeServiceManagerOptions()};
+				manager.start(TraceSessionOptions()
+								  .setName("fb-cpp-test")
+								  .setConfig(config)
+								  .setSessionIdOutput([&](std::uint64_t id) { sessionIdPromise.set_value(id); }),
+					[&](const TraceEvent& event)
+					{
+						std::lock_guard lock{mutex};
+						events.push_back(event);
+						eventsChanged.notify_all();
+					});
+			}
+			catch (...)
+			{
+				traceError = std::current_exception();
+			}
+		}};
+
+	TraceManager control{CLIENT, makeServiceManagerOptions()};
+
+	if (sessionIdFuture.wait_for(std::chrono::seconds{30}) != std::future_status::ready)
+	{
+		traceThread.detach();
+		BOOST_FAIL("Trace session did not start");
+	}
+
+	const auto sessionId = sessionIdFuture.get();
+
+	const auto sessions = control.list();
+	const auto session = std::find_if(sessions.begin(), sessions.end(),
+		[&](const TraceSessionInfo& info) { return info.id == sessionId; });
+	BOOST_REQUIRE(session != sessions.end());
+	BOOST_CHECK_EQUAL(session->name, "fb-cpp-test");
+	BOOST_CHECK(session->isActive());
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement statement{attachment, transaction, "select /* fb-cpp-trace */ count(*) from rdb$relations"};
+		BOOST_REQUIRE(statement.execute(transaction));
+		transaction.commit();
+	}
+
+	const auto isTracedStatement = [](const TraceEvent& event)
+	{
+		return event.eventType.find("EXECUTE_STATEMENT_FINISH") != std::string::npos &&
+			event.sql.find("fb-cpp-trace") != std::string::npos;
+	};
+
+	bool traced = false;
+
+	{  // scope
+		std::unique_lock lock{mutex};
+		traced = eventsChanged.wait_for(lock, std::chrono::seconds{30},
+			[&] { return std::any_of(events.begin(), events.end(), isTracedStatement); });
+	}
+
+	control.stop(sessionId);
+	traceThread.join();
+
+	if (traceError)
+		std::rethrow_exception(traceError);
+
+	BOOST_REQUIRE(traced);
+
+	const auto event = *std::find_if(events.begin(), events.end(), isTracedStatement);
+	BOOST_CHECK(!event.timestamp.empty());
+	BOOST_CHECK(event.processId != 0u);
+	BOOST_CHECK(event.attachmentId.has_value());
+	BOOST_CHECK(event.transactionId.has_value());
+	BOOST_CHECK(event.statementId.has_value());
+	BOOST_CHECK(event.database.find("TraceManager-traceSessionDeliversStatementEvents") != std::string::npos);
+	BOOST_CHECK(event.plan.find("RDB$RELATIONS") != std::string::npos);
+	BOOST_CHECK(event.recordsFetched.has_value());
+	BOOST_CHECK(event.elapsed.has_value());
+	BOOST_CHECK(event.fetches.value_or(0u) > 0u);
+
+	BOOST_CHECK_THROW(control.stop(sessionId), FbCppException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,191 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "fb-cpp/Attachment.h"
+#include "fb-cpp/Exception.h"
+#include "fb-cpp/Observer.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include "fb-cpp/TransactionRetry.h"
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+
+BOOST_AUTO_TEST_SUITE(TransactionRetrySuite)
+
+namespace
+{
+	class RetryObserver final : public OperationObserver
+	{
+	public:
+		struct Record
+		{
+			OperationType type;
+			std::uint32_t attempts;
+			bool failed;
+		};
+
+	public:
+		void onOperation(const OperationEvent& event) override
+		{
+			if (event.type != OperationType::TRANSACTION_RETRY && event.type != OperationType::RUN_IN_TRANSACTION)
+				return;
+
+			std::lock_guard mutexGuard{mutex};
+			records.push_back(Record{
+				.type = event.type,
+				.attempts = event.attempts,
+				.failed = event.error != nullptr,
+			});
+		}
+
+		std::vector<Record> take()
+		{
+			std::lock_guard mutexGuard{mutex};
+			return std::exchange(records, {});
+		}
+
+	private:
+		std::mutex mutex;
+		std::vector<Record> records;
+	};
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(retriesConflicts)
+{
+	const auto database = getTempFile("TransactionRetry-retriesConflicts.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setForcedWrites(false)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction, "recreate table retry_test (id integer primary key, val integer)"};
+		ddl.execute(transaction);
+		transaction.commitRetaining();
+		Statement insert{attachment, transaction, "insert into retry_test (id, val) values (1, 0)"};
+		insert.execute(transaction);
+		transaction.commit();
+	}
+
+	const auto observer = std::make_shared<RetryObserver>();
+	attachment.setObserver(observer);
+
+	const auto options = TransactionOptions()
+							 .setIsolationLevel(TransactionIsolationLevel::READ_COMMITTED)
+							 .setReadCommittedMode(TransactionReadCommittedMode::RECORD_VERSION)
+							 .setWaitMode(TransactionWaitMode::NO_WAIT);
+	const auto policy = RetryPolicy().setInitialBackoff(std::chrono::milliseconds{1}).setMaxAttempts(3u);
+
+	Attachment blockerAttachment{CLIENT, database};
+	const auto lockRow = [&](Transaction& transaction)
+	{
+		Statement update{blockerAttachment, transaction, "update retry_test set val = val + 100 where id = 1"};
+		update.execute(transaction);
+	};
+
+	// The first attempt conflicts with the blocker, which is committed before the second one.
+	{  // scope
+		Transaction blocker{blockerAttachment};
+		lockRow(blocker);
+
+		unsigned calls = 0;
+		const auto value = runInTransaction(
+			attachment, options,
+			[&](Transaction& transaction)
+			{
+				if (++calls == 2u)
+					blocker.commit();
+
+				Statement update{attachment, transaction, "update retry_test set val = val + 1 where id = 1"};
+				update.execute(transaction);
+
+				Statement select{attachment, transaction, "select val from retry_test where id = 1"};
+				select.execute(transaction);
+				return select.getInt32(0).value();
+			},
+			policy);
+
+		BOOST_CHECK_EQUAL(calls, 2u);
+		BOOST_CHECK_EQUAL(value, 101);
+
+		const auto records = observer->take();
+		BOOST_REQUIRE_EQUAL(records.size(), 2u);
+		BOOST_CHECK(records[0].type == OperationType::TRANSACTION_RETRY);
+		BOOST_CHECK_EQUAL(records[0].attempts, 1u);
+		BOOST_CHECK(records[0].failed);
+		BOOST_CHECK(records[1].type == OperationType::RUN_IN_TRANSACTION);
+		BOOST_CHECK_EQUAL(records[1].attempts, 2u);
+		BOOST_CHECK(!records[1].failed);
+	}
+
+	// A conflict that persists is rethrown after the maximum number of attempts.
+	{  // scope
+		Transaction blocker{blockerAttachment};
+		lockRow(blocker);
+
+		unsigned calls = 0;
+		BOOST_CHECK_THROW(runInTransaction(
+							  attachment, options,
+							  [&](Transaction& transaction)
+							  {
+								  ++calls;
+								  Statement update{attachment, transaction, "delete from retry_test where id = 1"};
+								  update.execute(transaction);
+							  },
+							  policy),
+			DatabaseException);
+		BOOST_CHECK_EQUAL(calls, 3u);
+
+		const auto records = observer->take();
+		BOOST_REQUIRE_EQUAL(records.size(), 3u);
+		BOOST_CHECK(records[2].type == OperationType::RUN_IN_TRANSACTION);
+		BOOST_CHECK_EQUAL(records[2].attempts, 3u);
+		BOOST_CHECK(records[2].failed);
+
+		blocker.rollback();
+	}
+
+	// Errors that are not conflicts are not retried.
+	unsigned calls = 0;
+	BOOST_CHECK_THROW(runInTransaction(
+						  attachment, options,
+						  [&](Transaction& transaction)
+						  {
+							  ++calls;
+							  Statement invalid{attachment, transaction, "update retry_test set missing = 1"};
+						  },
+						  policy),
+		DatabaseException);
+	BOOST_CHECK_EQUAL(calls, 1u);
+
+	BOOST_CHECK(RetryPolicy().setJitter(0.0).getBackoff(3u) == std::chrono::milliseconds{40});
+	BOOST_CHECK(RetryPolicy().setJitter(0.0).getBackoff(20u) == std::chrono::seconds{1});
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,118 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/TwoPhaseCommit.h"
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+BOOST_AUTO_TEST_SUITE(TwoPhaseCommitSuite)
+
+BOOST_AUTO_TEST_CASE(commitsIndependentTransactions)
+{
+	const auto database1 = getTempFile("TwoPhaseCommit-commitsIndependentTransactions-1.fdb");
+	const auto database2 = getTempFile("TwoPhaseCommit-commitsIndependentTransactions-2.fdb");
+	const auto logPath = std::filesystem::path{getTempFile("TwoPhaseCommit-commitsIndependentTransactions.log", false)};
+	std::filesystem::remove(logPath);
+
+	const auto createOptions = AttachmentOptions().setCreateDatabase(true).setForcedWrites(false);
+	Attachment attachment1{CLIENT, database1, createOptions};
+	FbDropDatabase attachment1Drop{attachment1};
+	Attachment attachment2{CLIENT, database2, createOptions};
+	FbDropDatabase attachment2Drop{attachment2};
+
+	for (auto* attachment : {&attachment1, &attachment2})
+	{
+		Transaction transaction{*attachment};
+		Statement ddl{*attachment, transaction, "create table tpc_test (id integer)"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	auto log = std::make_shared<FileDecisionLog>(logPath);
+	TwoPhaseCoordinator coordinator{log};
+
+	Transaction transaction1{attachment1};
+	Transaction transaction2{attachment2};
+
+	Statement insert1{attachment1, transaction1, "insert into tpc_test values (1)"};
+	insert1.execute(transaction1);
+	Statement insert2{attachment2, transaction2, "insert into tpc_test values (2)"};
+	insert2.execute(transaction2);
+
+	const std::vector<std::reference_wrapper<Transaction>> participants{transaction1, transaction2};
+	const auto result = coordinator.commit(participants);
+
+	BOOST_CHECK(result.isComplete());
+	BOOST_CHECK_EQUAL(result.globalId.size(), 32u);
+	BOOST_CHECK(transaction1.getState() == TransactionState::COMMITTED);
+	BOOST_CHECK(transaction2.getState() == TransactionState::COMMITTED);
+
+	for (auto* attachment : {&attachment1, &attachment2})
+	{
+		Transaction transaction{*attachment};
+		Statement select{*attachment, transaction, "select count(*) from tpc_test"};
+		BOOST_REQUIRE(select.execute(transaction));
+		BOOST_CHECK_EQUAL(select.getInt64(0).value(), 1);
+	}
+
+	// The completed decision is not pending anymore and disappears on compaction.
+	BOOST_CHECK(!log->isCommitted(result.globalId));
+	BOOST_CHECK(log->getPendingCommits().empty());
+
+	log->logCommit("pending-id");
+	log->compact();
+
+	{  // scope
+		FileDecisionLog reopened{logPath};
+		BOOST_CHECK(reopened.isCommitted("pending-id"));
+		BOOST_CHECK(!reopened.isCommitted(result.globalId));
+		BOOST_CHECK_THROW(reopened.logCommit("bad id"), std::invalid_argument);
+	}
+
+	std::ifstream in{logPath};
+	const std::string contents{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+	BOOST_CHECK_EQUAL(contents, "C pending-id\n");
+
+	// Participants must be active.
+	BOOST_CHECK_THROW(coordinator.commit(participants), std::invalid_argument);
+
+	// A recovery without limbo transactions does nothing.
+	const auto recovery = coordinator.recover(attachment1);
+	BOOST_CHECK_EQUAL(recovery.committed, 0u);
+	BOOST_CHECK_EQUAL(recovery.rolledBack, 0u);
+
+	in.close();
+	std::filesystem::remove(logPath);
+}
+
+BOOST_AUTO_TEST_SUITE_END()